@@ -5,6 +5,8 @@
 ****************************************************************************/
 #include "SrGeometricTools.h"
 #include "SrDataType.h"
+#include "../Algorithms/BentleyOttmann.h"
+#include "../Algorithms/PolygonBoolean.h"
 
 #include <stdio.h>
 #include <algorithm>
@@ -13,6 +15,9 @@
 #include <set>
 #include <queue>
 #include <map>
+#include <vector>
+#include <time.h>
+#include <math.h>
 using namespace std;
 
 typedef SrPoint2D		Point2D;
@@ -21,183 +26,8 @@ typedef SrReal			Real;
 
 #define  EPS			SR_EPS
 
-#define POINT_TYPE_LEFT			0x01
-#define POINT_TYPE_RIGHT		0x02
-#define	POINT_TYPE_INTER		0x04
-
-
-/*
-\brief б
-*/
-#define SLOPE_INVALID		0x00
-#define	SLOPE_INFINITY		0x01
-#define SLOPE_NORMAL		0x02
-
-class Slope
-{
-private:
-	int	 mType;
-	Real mValue;
-public:
-	Slope()
-	{
-		mType = SLOPE_INVALID;
-		mValue = 0;
-	}
-	void make(const Point2D& p0, const Point2D& p1)
-	{
-		if( EQUAL(p0.x,p1.x) )
-		{
-			mType = SLOPE_INFINITY;
-		}
-		else
-		{
-			mType  = SLOPE_NORMAL;
-			mValue = (p1.y - p0.y) / (p1.x - p0.x);
-		}
-	}
-	int getType()const
-	{
-		return mType;
-	}
-	Real getValue()const
-	{
-		return mValue;
-	}
-	bool operator < (const Slope& s) const
-	{
-		if( mType==SLOPE_INFINITY ) 
-			return false;
-		return (s.mType==SLOPE_INFINITY || LESS(mValue,s.mValue));
-	}
-};
-
-/*
-\brief ߶
-*/
-class Segment
-{
-private:
-	Point2D	mPoint1;
-	Point2D	mPoint2;
-	Slope	mSlope;
-public:
-	Segment()
-	{
-		mPoint1 = Point2D(0,0);
-		mPoint2 = Point2D(0,0);
-	}
-	Segment(const Point2D& p1, const Point2D& p2)
-	{
-		ASSERT(init(p1,p2));
-	}
-	bool init(const Point2D& p1, const Point2D& p2)
-	{
-		if( LESS(p1.x , p2.x) || (EQUAL(p1.x, p2.x)&& LESS(p1.y , p2.y)))
-		{
-			mPoint1 = p1;
-			mPoint2 = p2;
-		}
-		else
-		{
-			mPoint1 = p2;
-			mPoint2 = p1;
-		}
-		mSlope.make(mPoint1,mPoint2);
-		return true;
-	}
-	bool isLeftEnd(const Point2D& p) const
-	{
-		return (EQUAL(mPoint1.x,p.x) && EQUAL(mPoint1.y,p.y));
-	}
-	bool isRightEnd(const Point2D& p) const
-	{
-		return (EQUAL(mPoint2.x,p.x) && EQUAL(mPoint2.y,p.y));
-	}
-	bool isOnSegment(const Point2D& p) const
-	{//p߶
-		return (!isLeftEnd(p)) && (!isRightEnd(p));
-	}
-	bool less(const Segment& s,const Point2D& p)const
-	{
-		Real h1 = height(p), h2 = s.height(p);
-		return (LESS(h1 , h2) || ((EQUAL(h1, h2) && mSlope < s.mSlope)));
-	}
-	Real height(const Point2D& p)const
-	{
-		if( mSlope.getType()==SLOPE_INFINITY )
-		{
-			Real py = p.y;
-			Real ly = mPoint1.y;
-			Real ry = mPoint2.y;
-			if(LESS(py , ly))
-				return ly;
-			else if(LESS(ry , py))
-				return ry;
-			return py;
-		}
-
-		return (mPoint2.y - mPoint1.y)*(p.x - mPoint1.x)/(mPoint2.x - mPoint1.x) + mPoint1.y;
-	}
-	bool intersect(const Segment& segment,Point2D& result)const
-	{
-		Vector2D direction1 = mPoint2 - mPoint1;
-		Vector2D direction2 = segment.mPoint2 - segment.mPoint1;
-
-		Real dir1Square = direction1.magnitudeSquared();
-		Real dir2Square = direction2.magnitudeSquared();
-
-		Real kcross = direction1.cross(direction2);
-		Vector2D e = segment.mPoint1 - mPoint1;
-
-		if( (kcross*kcross) > EPS * EPS * dir1Square * dir2Square  )
-		{//The intersection angle is not 0 based on relative error.||Cross(d1,d2)||^2/ (||d1||^2*||d2||^2)<=sin(a).
-			Real s = e.cross(direction2) / kcross;
-			if(LESS(s, 0) || GREATER(s, 1))
-				return false;
-			Real t = e.cross(direction1) / kcross;
-			if(LESS(t , 0) || GREATER(t, 1))
-				return false;
-			result = mPoint1 + s*direction1;
-
-			return true;
-		}
-		return false;
-	}
-	Point2D getLeftPoint()const
-	{
-		return mPoint1;
-	}
-	Point2D getRightPoint()const
-	{
-		return mPoint2;
-	}
-};
-
-class Event
-{
-private:
-	Point2D	mPoint;
-public:
-	Event()
-	{
-		mPoint = Point2D(0,0);
-	}
-	Event(const Point2D& p)
-	{
-		mPoint = p;
-	}
-	Point2D getPoint()const
-	{
-		return mPoint;
-	}
-	bool operator < (const Event& b)const
-	{
-		if( EQUAL(mPoint.x, b.mPoint.x) )
-			return LESS(mPoint.y, b.mPoint.y);
-		return LESS(mPoint.x,b.mPoint.x);
-	}
-};
+typedef SrSweepSegment	Segment;
+typedef SrSweepEvent	Event;
 
 
 struct sCompare
@@ -468,8 +298,270 @@ void TestTentley()
 	delete []segs;
 }
 
+
+/*
+	żжϵǷڶ໷Ķ
+*/
+bool IsInsidePolygon(const Point2D* vertex,const int* ringStart,int numRing,const Point2D& p)
+{
+	bool inside = false;
+	int ring , i , j;
+	for( ring=0 ; ring<numRing ; ring++ )
+	{
+		for( i=ringStart[ring] , j=ringStart[ring + 1] - 1 ; i<ringStart[ring + 1] ; j=i ++ )
+		{
+			if( (vertex[i].y>p.y)!=(vertex[j].y>p.y) &&
+				p.x<(vertex[j].x - vertex[i].x)*(p.y - vertex[i].y)/(vertex[j].y - vertex[i].y) + vertex[i].x )
+				inside = !inside;
+		}
+	}
+	return inside;
+}
+
+Real PolygonArea(const Point2D* vertex,const int* ringStart,int numRing)
+{
+	Real area = 0;
+	int ring , i , j;
+	for( ring=0 ; ring<numRing ; ring++ )
+		for( i=ringStart[ring] , j=ringStart[ring + 1] - 1 ; i<ringStart[ring + 1] ; j=i ++ )
+			area += vertex[j].cross(vertex[i]);
+	return area/2;
+}
+
+bool Operate(int operation,bool subject,bool clip)
+{
+	switch( operation )
+	{
+	case SR_BOOLEAN_INTERSECTION:	return subject && clip;
+	case SR_BOOLEAN_UNION:			return subject || clip;
+	case SR_BOOLEAN_DIFFERENCE:		return subject && !clip;
+	default:						return subject!=clip;
+	}
+}
+
+class BooleanPolygon
+{
+public:
+	vector<Point2D>	mVertex;
+	vector<int>		mRingStart;
+
+	BooleanPolygon()
+	{
+		mRingStart.push_back(0);
+	}
+	void addRing(const Point2D* vertex,int numVertex)
+	{
+		mVertex.insert(mVertex.end(),vertex,vertex + numVertex);
+		mRingStart.push_back((int)mVertex.size());
+	}
+	void addRectangle(Real x0,Real y0,Real x1,Real y1,bool isCCW)
+	{
+		Point2D rect[4] = { Point2D(x0,y0) , Point2D(x1,y0) , Point2D(x1,y1) , Point2D(x0,y1) };
+		if( !isCCW )
+			swap(rect[1],rect[3]);
+		addRing(rect,4);
+	}
+	void addStar(const Point2D& center,Real radius,int numVertex)
+	{
+		vector<Point2D> ring(numVertex);
+		int i;
+		for( i=0 ; i<numVertex ; i++ )
+		{
+			Real angle = 6.28318530717958647692*i/numVertex;
+			Real r = radius*(0.3 + 0.7*(rand()%1000)/1000.0);
+			ring[i] = center + Vector2D(cos(angle),sin(angle))*r;
+		}
+		addRing(&ring[0],numVertex);
+	}
+	int numRing()const
+	{
+		return (int)mRingStart.size() - 1;
+	}
+	tBooleanPolygon polygon()const
+	{
+		tBooleanPolygon result;
+		result.mVertex	  = mVertex.empty() ? NULL : &mVertex[0];
+		result.mRingStart = &mRingStart[0];
+		result.mNumRing	  = numRing();
+		return result;
+	}
+	bool isInside(const Point2D& p)const
+	{
+		return !mVertex.empty() && IsInsidePolygon(&mVertex[0],&mRingStart[0],numRing(),p);
+	}
+	Real area()const
+	{
+		return mVertex.empty() ? 0 : PolygonArea(&mVertex[0],&mRingStart[0],numRing());
+	}
+};
+
+/*
+	ֲ㣬Ĺϵĵ⣬numSampleȡڰΧ[minPoint,maxPoint]
+*/
+void CheckBoolean(SrPolygonBoolean& engine,const BooleanPolygon& subject,const BooleanPolygon& clip,
+				  const Point2D& minPoint,const Point2D& maxPoint,int numSample)
+{
+	BooleanPolygon result[4];
+	int operation , i;
+	for( operation=0 ; operation<4 ; operation++ )
+	{
+		engine.compute(subject.polygon(),clip.polygon(),operation,result[operation].mVertex,result[operation].mRingStart);
+		//⻷ʱ룬ڻ˳ʱ룬Ǹ
+		ASSERT(result[operation].area()>-1e-9);
+		for( i=0 ; i<numSample ; i++ )
+		{
+			Point2D p(minPoint.x + (maxPoint.x - minPoint.x)*(rand()%100003)/100003.0,
+					  minPoint.y + (maxPoint.y - minPoint.y)*(rand()%100003)/100003.0);
+			ASSERT(result[operation].isInside(p)==Operate(operation,subject.isInside(p),clip.isInside(p)));
+		}
+	}
+#ifdef _DEBUG
+	//նεõż
+	BooleanPolygon empty , normal[2];
+	engine.compute(subject.polygon(),empty.polygon(),SR_BOOLEAN_XOR,normal[0].mVertex,normal[0].mRingStart);
+	engine.compute(clip.polygon(),empty.polygon(),SR_BOOLEAN_XOR,normal[1].mVertex,normal[1].mRingStart);
+	Real area[4];
+	for( operation=0 ; operation<4 ; operation++ )
+		area[operation] = result[operation].area();
+	Real areaSubject = normal[0].area() , areaClip = normal[1].area();
+	Real tolerance = 1e-8*(1 + areaSubject + areaClip);
+	ASSERT(fabs(area[SR_BOOLEAN_UNION] + area[SR_BOOLEAN_INTERSECTION] - areaSubject - areaClip)<tolerance);
+	ASSERT(fabs(area[SR_BOOLEAN_DIFFERENCE] + area[SR_BOOLEAN_INTERSECTION] - areaSubject)<tolerance);
+	ASSERT(fabs(area[SR_BOOLEAN_XOR] + area[SR_BOOLEAN_INTERSECTION] - area[SR_BOOLEAN_UNION])<tolerance);
+#endif
+}
+
+void TestPolygonBoolean()
+{
+	SrPolygonBoolean engine;
+	BooleanPolygon a , b;
+	vector<Point2D> vertex;
+	vector<int> ringStart;
+	int i , j;
+
+	//
+	a.addRectangle(0,0,2,2,true);
+	b.addRectangle(1,1,3,3,false);
+#ifdef _DEBUG
+	Real expect[4] = { 1 , 7 , 3 , 6 };
+#endif
+	for( i=0 ; i<4 ; i++ )
+	{
+		vertex.clear();
+		ringStart.clear();
+		engine.compute(a.polygon(),b.polygon(),i,vertex,ringStart);
+		ASSERT(EQUAL(PolygonArea(&vertex[0],&ringStart[0],(int)ringStart.size() - 1),expect[i]));
+	}
+	CheckBoolean(engine,a,b,Point2D(-1,-1),Point2D(4,4),1000);
+
+	//ĶΣԼߡľ
+	a = BooleanPolygon();
+	b = BooleanPolygon();
+	a.addRectangle(0,0,10,10,true);
+	a.addRectangle(2,2,8,8,true);
+	b.addRectangle(5,0,15,10,true);
+	b.addRectangle(8,8,9,9,false);
+	CheckBoolean(engine,a,b,Point2D(-1,-1),Point2D(16,11),5000);
+	vertex.clear();
+	ringStart.clear();
+	//ax<5Cβ֣ԼbĶaĲ
+	ASSERT(engine.compute(a.polygon(),b.polygon(),SR_BOOLEAN_DIFFERENCE,vertex,ringStart)==2);
+	ASSERT(EQUAL(PolygonArea(&vertex[0],&ringStart[0],2),50 - 18 + 1));
+
+	//εıڽ㴦ָ֮󣬲ͬεļμߣɨϵ˳ȻҪ
+	Point2D triangle[4][3] = { { Point2D(5,2) , Point2D(1,0) , Point2D(4,4) } ,
+							   { Point2D(1,0) , Point2D(4,0) , Point2D(3,1) } ,
+							   { Point2D(0,0) , Point2D(3,5) , Point2D(4,1) } ,
+							   { Point2D(0,3) , Point2D(3,5) , Point2D(3,0) } };
+	a = BooleanPolygon();
+	b = BooleanPolygon();
+	a.addRing(triangle[0],3);
+	b.addRing(triangle[1],3);
+	b.addRing(triangle[3],3);
+	CheckBoolean(engine,a,b,Point2D(-1.013,-0.987),Point2D(6.031,6.047),2000);
+	a.addRing(triangle[1],3);
+	b = BooleanPolygon();
+	b.addRing(triangle[2],3);
+	b.addRing(triangle[3],3);
+	CheckBoolean(engine,a,b,Point2D(-1.013,-0.987),Point2D(6.031,6.047),2000);
+
+	//ĶλͬһεĻҲཻصж߶غһ
+	for( i=0 ; i<2000 ; i++ )
+	{
+		a = BooleanPolygon();
+		b = BooleanPolygon();
+		for( j=0 ; j<2 + i%3 ; j++ )
+		{
+			Point2D corner[3] = { Point2D(rand()%6,rand()%6) , Point2D(rand()%6,rand()%6) , Point2D(rand()%6,rand()%6) };
+			if( j%2==0 )
+				a.addRing(corner,3);
+			else
+				b.addRing(corner,3);
+		}
+		CheckBoolean(engine,a,b,Point2D(-1.013,-0.987),Point2D(6.031,6.047),100);
+	}
+
+	//ϵΣдصı
+	for( i=0 ; i<500 ; i++ )
+	{
+		a = BooleanPolygon();
+		b = BooleanPolygon();
+		for( j=0 ; j<2 ; j++ )
+		{
+			int x0 = rand()%10 , y0 = rand()%10;
+			a.addRectangle(x0,y0,x0 + 1 + rand()%6,y0 + 1 + rand()%6,rand()%2==0);
+		}
+		int x0 = rand()%10 , y0 = rand()%10;
+		b.addRectangle(x0,y0,x0 + 1 + rand()%6,y0 + 1 + rand()%6,rand()%2==0);
+		//aصʱǼ򵥶ΣżȻ
+		CheckBoolean(engine,a,b,Point2D(-0.5,-0.5),Point2D(17,17),200);
+	}
+
+	//ζ
+	for( i=0 ; i<500 ; i++ )
+	{
+		a = BooleanPolygon();
+		b = BooleanPolygon();
+		a.addStar(Point2D(rand()%20,rand()%20),5 + rand()%10,3 + rand()%40);
+		b.addStar(Point2D(rand()%20,rand()%20),5 + rand()%10,3 + rand()%40);
+		if( i%2 )
+			b.addStar(Point2D(rand()%20 + 40,rand()%20),5 + rand()%10,3 + rand()%40);
+		CheckBoolean(engine,a,b,Point2D(-16,-16),Point2D(76,36),200);
+	}
+	printf("Polygon boolean checks passed\n");
+
+	//ԼĽͬ
+	int numPair = 20000;
+	vector<BooleanPolygon> subject(numPair) , clip(numPair);
+	vector<tBooleanPolygon> subjectView(numPair) , clipView(numPair);
+	for( i=0 ; i<numPair ; i++ )
+	{
+		subject[i].addStar(Point2D(rand()%20,rand()%20),5 + rand()%10,20 + rand()%40);
+		clip[i].addStar(Point2D(rand()%20,rand()%20),5 + rand()%10,20 + rand()%40);
+		subjectView[i] = subject[i].polygon();
+		clipView[i] = clip[i].polygon();
+	}
+	vector<Point2D> batchVertex;
+	vector<int> batchRing , pairStart;
+	double seconds = clock();
+	vertex.clear();
+	ringStart.clear();
+	for( i=0 ; i<numPair ; i++ )
+		engine.compute(subjectView[i],clipView[i],SR_BOOLEAN_UNION,vertex,ringStart);
+	seconds = (clock() - seconds)/CLOCKS_PER_SEC;
+	printf("Sequential Union Time:	%.6lf\n",seconds);
+
+	seconds = clock();
+	PolygonBooleanBatch(&subjectView[0],&clipView[0],numPair,SR_BOOLEAN_UNION,batchVertex,batchRing,pairStart);
+	seconds = (clock() - seconds)/CLOCKS_PER_SEC;
+	printf("Batch Union CPU Time:	%.6lf\n",seconds);
+	ASSERT(batchVertex==vertex && batchRing==ringStart);
+	ASSERT(pairStart[0]==0 && pairStart[numPair]==(int)batchRing.size() - 1);
+}
+
 int main ()
 {
 	TestTentley();
+	TestPolygonBoolean();
 	return 0;
 }
\ No newline at end of file
@@ -0,0 +1,229 @@
+/************************************************************************
+\link	www.twinklingstar.cn
+\author Twinkling Star
+\date	2014/06/04
+****************************************************************************/
+#ifndef SR_ALGORITHMS_BENTLEY_OTTMANN_H_
+#define SR_ALGORITHMS_BENTLEY_OTTMANN_H_
+
+/** \addtogroup algorithms
+  @{
+*/
+#include "SrGeometricTools.h"
+#include "SrDataType.h"
+
+/*
+\brief б
+*/
+#define SR_SLOPE_INVALID		0x00
+#define	SR_SLOPE_INFINITY		0x01
+#define SR_SLOPE_NORMAL			0x02
+
+/**
+\brief The slope of a segment of the sweep line algorithms.
+*/
+class SrSweepSlope
+{
+private:
+	int		mType;
+	SrReal	mValue;
+public:
+	SrSweepSlope()
+	{
+		mType = SR_SLOPE_INVALID;
+		mValue = 0;
+	}
+	void make(const SrPoint2D& p0, const SrPoint2D& p1)
+	{
+		if( EQUAL(p0.x,p1.x) )
+		{
+			mType = SR_SLOPE_INFINITY;
+		}
+		else
+		{
+			mType  = SR_SLOPE_NORMAL;
+			mValue = (p1.y - p0.y) / (p1.x - p0.x);
+		}
+	}
+	int getType()const
+	{
+		return mType;
+	}
+	SrReal getValue()const
+	{
+		return mValue;
+	}
+	bool operator < (const SrSweepSlope& s) const
+	{
+		if( mType==SR_SLOPE_INFINITY )
+			return false;
+		return (s.mType==SR_SLOPE_INFINITY || LESS(mValue,s.mValue));
+	}
+};
+
+/**
+\brief A segment of the sweep line algorithms, mPoint1 is the left end and mPoint2 is the right end.
+*/
+class SrSweepSegment
+{
+private:
+	SrPoint2D		mPoint1;
+	SrPoint2D		mPoint2;
+	SrSweepSlope	mSlope;
+public:
+	SrSweepSegment()
+	{
+		mPoint1 = SrPoint2D(0,0);
+		mPoint2 = SrPoint2D(0,0);
+	}
+	SrSweepSegment(const SrPoint2D& p1, const SrPoint2D& p2)
+	{
+		init(p1,p2);
+	}
+	bool init(const SrPoint2D& p1, const SrPoint2D& p2)
+	{
+		if( LESS(p1.x , p2.x) || (EQUAL(p1.x, p2.x)&& LESS(p1.y , p2.y)))
+		{
+			mPoint1 = p1;
+			mPoint2 = p2;
+		}
+		else
+		{
+			mPoint1 = p2;
+			mPoint2 = p1;
+		}
+		mSlope.make(mPoint1,mPoint2);
+		return true;
+	}
+	bool isLeftEnd(const SrPoint2D& p) const
+	{
+		return (EQUAL(mPoint1.x,p.x) && EQUAL(mPoint1.y,p.y));
+	}
+	bool isRightEnd(const SrPoint2D& p) const
+	{
+		return (EQUAL(mPoint2.x,p.x) && EQUAL(mPoint2.y,p.y));
+	}
+	bool isOnSegment(const SrPoint2D& p) const
+	{//p߶
+		return (!isLeftEnd(p)) && (!isRightEnd(p));
+	}
+	bool less(const SrSweepSegment& s,const SrPoint2D& p)const
+	{
+		SrReal h1 = height(p), h2 = s.height(p);
+		return (LESS(h1 , h2) || ((EQUAL(h1, h2) && mSlope < s.mSlope)));
+	}
+	SrReal height(const SrPoint2D& p)const
+	{
+		if( mSlope.getType()==SR_SLOPE_INFINITY )
+		{
+			SrReal py = p.y;
+			SrReal ly = mPoint1.y;
+			SrReal ry = mPoint2.y;
+			if(LESS(py , ly))
+				return ly;
+			else if(LESS(ry , py))
+				return ry;
+			return py;
+		}
+
+		return (mPoint2.y - mPoint1.y)*(p.x - mPoint1.x)/(mPoint2.x - mPoint1.x) + mPoint1.y;
+	}
+	bool intersect(const SrSweepSegment& segment,SrPoint2D& result)const
+	{
+		SrVector2D direction1 = mPoint2 - mPoint1;
+		SrVector2D direction2 = segment.mPoint2 - segment.mPoint1;
+
+		SrReal dir1Square = direction1.magnitudeSquared();
+		SrReal dir2Square = direction2.magnitudeSquared();
+
+		SrReal kcross = direction1.cross(direction2);
+		SrVector2D e = segment.mPoint1 - mPoint1;
+
+		if( (kcross*kcross) > SR_EPS * SR_EPS * dir1Square * dir2Square  )
+		{//The intersection angle is not 0 based on relative error.||Cross(d1,d2)||^2/ (||d1||^2*||d2||^2)<=sin(a).
+			SrReal s = e.cross(direction2) / kcross;
+			if(LESS(s, 0) || GREATER(s, 1))
+				return false;
+			SrReal t = e.cross(direction1) / kcross;
+			if(LESS(t , 0) || GREATER(t, 1))
+				return false;
+			result = mPoint1 + s*direction1;
+
+			return true;
+		}
+		return false;
+	}
+	/*
+	\brief	intersect()ͬҲص߶Σصʱresult0result1صֵҶ˵㡣
+	\return	ĸ0ʾཻ1ʾһ㣬2ʾص
+	*/
+	int intersect(const SrSweepSegment& segment,SrPoint2D& result0,SrPoint2D& result1)const
+	{
+		SrVector2D direction1 = mPoint2 - mPoint1;
+		SrVector2D direction2 = segment.mPoint2 - segment.mPoint1;
+		SrReal dir1Square = direction1.magnitudeSquared();
+		SrReal dir2Square = direction2.magnitudeSquared();
+		SrReal kcross = direction1.cross(direction2);
+		SrVector2D e = segment.mPoint1 - mPoint1;
+
+		if( (kcross*kcross) > SR_EPS * SR_EPS * dir1Square * dir2Square )
+			return intersect(segment,result0) ? 1 : 0;
+
+		//ƽе߶ΣжǷߡ˵㼸غʱeķģԾ߶εĳ߶ȱȽ
+		SrReal eSquare = e.magnitudeSquared();
+		kcross = e.cross(direction1);
+		if( (kcross*kcross) > SR_EPS * SR_EPS * dir1Square * (eSquare + dir1Square) )
+			return 0;
+		//Ҷ˵㶼˵ұߣصǲ[s0,s1][0,1]Ľ
+		SrReal s0 = direction1.dot(e) / dir1Square;
+		SrReal s1 = s0 + direction1.dot(direction2) / dir1Square;
+		if( LESS(s1, 0) || GREATER(s0, 1) )
+			return 0;
+		if( s0<0 )	s0 = 0;
+		if( s1>1 )	s1 = 1;
+		result0 = mPoint1 + s0*direction1;
+		if( EQUAL(s0, s1) )
+			return 1;
+		result1 = mPoint1 + s1*direction1;
+		return 2;
+	}
+	SrPoint2D getLeftPoint()const
+	{
+		return mPoint1;
+	}
+	SrPoint2D getRightPoint()const
+	{
+		return mPoint2;
+	}
+};
+
+/**
+\brief An event point of the sweep line algorithms, the events are swept from left to right and from bottom to top.
+*/
+class SrSweepEvent
+{
+private:
+	SrPoint2D	mPoint;
+public:
+	SrSweepEvent()
+	{
+		mPoint = SrPoint2D(0,0);
+	}
+	SrSweepEvent(const SrPoint2D& p)
+	{
+		mPoint = p;
+	}
+	SrPoint2D getPoint()const
+	{
+		return mPoint;
+	}
+	bool operator < (const SrSweepEvent& b)const
+	{
+		if( EQUAL(mPoint.x, b.mPoint.x) )
+			return LESS(mPoint.y, b.mPoint.y);
+		return LESS(mPoint.x,b.mPoint.x);
+	}
+};
+
+/** @} */
+#endif
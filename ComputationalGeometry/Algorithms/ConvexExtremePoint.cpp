@@ -0,0 +1,248 @@
+/************************************************************************
+\link	www.twinklingstar.cn
+\author Twinkling Star
+\date	2026/10/19
+****************************************************************************/
+/************************************************************************
+\description	͹ϵļеѯʱ͹εıߵⷨź
+				iǷڱi-1i֮ⷨķļ㡣Ѳѯķ
+				ǷֵͰͰı߽ͶεıһÿͰʼߣÿ
+				ֻҪͰʼǰ߼ͰеıߺܶʱͰж֡
+****************************************************************************/
+#include "ConvexExtremePoint.h"
+#include "SrSimd.h"
+#include <algorithm>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+/*
+\brief	ش(x,y)ļǣȡֵΧ[0,4)ڸͰ
+*/
+static SrReal PseudoAngle(SrReal x,SrReal y)
+{
+	SrReal sum = fabs(x) + fabs(y);
+	if( sum==0 )
+		return 0;
+	SrReal t = y / sum;
+	if( x>=0 )
+		return y>=0 ? t : 4 + t;
+	return 2 - t;
+}
+
+SrConvexExtremePoint::SrConvexExtremePoint()
+{
+	mVertex = NULL;
+	mNumVertex = 0;
+}
+
+void SrConvexExtremePoint::build(const SrPoint2D* vertex,int numVertex)
+{
+	ASSERT(numVertex>=3);
+	int i;
+	mVertex = vertex;
+	mNumVertex = numVertex;
+	mEdgeX.resize(numVertex + 2);
+	mEdgeY.resize(numVertex + 2);
+	mHalf.resize(numVertex + 2);
+	mAngle.resize(numVertex);
+	mCenter = SrPoint2D(0,0);
+	for( i=0 ; i<numVertex ; i++ )
+	{
+		mEdgeX[i] = vertex[Next(i,numVertex)].x - vertex[i].x;
+		mEdgeY[i] = vertex[Next(i,numVertex)].y - vertex[i].y;
+		mCenter += vertex[i];
+	}
+	mCenter *= 1 / (SrReal)numVertex;
+	//iⷨ(mEdgeY[i],-mEdgeX[i])0ⷨĲߵĲ
+	SrVector2D edge0(mEdgeX[0],mEdgeY[0]);
+	for( i=0 ; i<numVertex ; i++ )
+	{
+		SrVector2D edge(mEdgeX[i],mEdgeY[i]);
+		SrReal cross = edge0.cross(edge);
+		mHalf[i] = (cross>0 || (cross==0 && edge0.dot(edge)>0)) ? 0 : 1;
+		mAngle[i] = PseudoAngle(edge0.dot(edge),cross);
+	}
+	for( i=numVertex ; i<numVertex + 2 ; i++ )
+	{
+		mEdgeX[i] = mEdgeY[i] = 0;
+		mHalf[i] = 2;
+	}
+}
+
+/*
+\brief	ڱ0ⷨƽ(ⷨ)ʱ0򷵻1
+*/
+int SrConvexExtremePoint::halfPlane(const SrVector2D& direction) const
+{
+	SrVector2D edge0(mEdgeX[0],mEdgeY[0]);
+	SrReal dot = edge0.dot(direction);
+	return (dot>0 || (dot==0 && direction.cross(edge0)>0)) ? 0 : 1;
+}
+
+/*
+\brief	edgeⷨļǷСڷdirectionļǣǴӱ0ⷨʼ㡣
+		ͬһƽУⷨ뷽Ĳڱ뷽ĵ
+*/
+bool SrConvexExtremePoint::isBefore(int edge,int half,const SrVector2D& direction) const
+{
+	if( mHalf[edge]!=half )
+		return mHalf[edge]<half;
+	return mEdgeX[edge]*direction.x + mEdgeY[edge]*direction.y>0;
+}
+
+int SrConvexExtremePoint::extremeVertex(const SrVector2D& direction) const
+{
+	int half = halfPlane(direction) , low = 0 , high = mNumVertex , middle;
+	//һⷨdirection֮ǰı
+	while( low<high )
+	{
+		middle = (low + high) / 2;
+		if( isBefore(middle,half,direction) )
+			low = middle + 1;
+		else
+			high = middle;
+	}
+	return low==mNumVertex ? 0 : low;
+}
+
+/*
+\brief	ӱstartʼԽⷨdirection֮ǰıߣÿSSE2жߡ
+*/
+int SrConvexExtremePoint::walk(const SrVector2D& direction,int start) const
+{
+	const SrSimdReal dirX = SrSimd::splat(direction.x) , dirY = SrSimd::splat(direction.y);
+	const SrSimdReal half = SrSimd::splat((SrReal)halfPlane(direction)) , zero = SrSimd::splat(0);
+	SrSimdReal dot , before;
+	int i = start , mask;
+	while( i<mNumVertex )
+	{
+		dot = SrSimd::add(SrSimd::mul(dirX,SrSimd::load(&mEdgeX[i])),SrSimd::mul(dirY,SrSimd::load(&mEdgeY[i])));
+		before = SrSimd::cmpLess(SrSimd::load(&mHalf[i]),half);
+		before = SrSimd::orMask(before,SrSimd::andMask(SrSimd::equal(SrSimd::load(&mHalf[i]),half),SrSimd::cmpGreater(dot,zero)));
+		mask = SrSimd::moveMask(before);
+		if( mask!=SR_SIMD_FULL_MASK )
+		{
+			i += mask & 1;
+			break;
+		}
+		i += 2;
+	}
+	return i;
+}
+
+void SrConvexExtremePoint::extremeVertexBatch(const SrVector2D* direction,int numDirection,int* result) const
+{
+	int i , log2 = 0;
+	while( (1<<log2)<mNumVertex )
+		log2 ++;
+	if( numDirection<SR_EXTREME_POINT_MIN_BATCH || numDirection*log2<mNumVertex )
+	{
+#pragma omp parallel for
+		for( i=0 ; i<numDirection ; i++ )
+			result[i] = extremeVertex(direction[i]);
+		return;
+	}
+
+	//Ѽ[0,4)ȷֳnumBucketͰͬʱͰı߽Ͷεıһ飬ÿͰʼ
+	int numBucket = std::min(numDirection,mNumVertex) , bucket;
+	std::vector<int> bucketStart(numBucket);
+	for( bucket=0 , i=0 ; bucket<numBucket ; bucket++ )
+	{
+		while( i<mNumVertex && mAngle[i]*numBucket<4*bucket )
+			i ++;
+		bucketStart[bucket] = i;
+	}
+	//ÿڵͰʼǰߡߵļǾۼͰʱͰж֣
+	//ᳬһͰʼߣʹʱǰ
+	SrVector2D edge0(mEdgeX[0],mEdgeY[0]);
+#pragma omp parallel for private(bucket)
+	for( i=0 ; i<numDirection ; i++ )
+	{
+		SrReal angle = PseudoAngle(direction[i].cross(edge0),edge0.dot(direction[i]));
+		bucket = std::min(numBucket - 1,(int)(angle*numBucket / 4));
+		int low = bucketStart[bucket] , high = bucket + 1<numBucket ? bucketStart[bucket + 1] : mNumVertex , middle;
+		if( high - low>SR_EXTREME_POINT_MAX_WALK )
+		{
+			int half = halfPlane(direction[i]);
+			while( high - low>SR_EXTREME_POINT_MAX_WALK )
+			{
+				middle = (low + high) / 2;
+				if( isBefore(middle,half,direction[i]) )
+					low = middle + 1;
+				else
+					high = middle;
+			}
+		}
+		int current = walk(direction[i],low);
+		result[i] = current==mNumVertex ? 0 : current;
+	}
+}
+
+/*
+\brief	pointڱedgeʱҲʱظҲıǴӵpointüıߡ
+*/
+SrReal SrConvexExtremePoint::side(int edge,const SrPoint2D& point) const
+{
+	edge %= mNumVertex;
+	return mEdgeX[edge]*(point.y - mVertex[edge].y) - mEdgeY[edge]*(point.x - mVertex[edge].x);
+}
+
+bool SrConvexExtremePoint::tangentVertex(const SrPoint2D& point,int& right,int& left) const
+{
+	int n = mNumVertex , v , low , high , middle , far;
+	//ָڲķϵļ㣬ڵıһԶ
+	v = extremeVertex(mCenter - point);
+	SrVector2D base = mVertex[v] - point;
+	//vʼǿļǲСvĶ㣬ȻСvĶ
+	low = 1;
+	high = n;
+	while( low<high )
+	{
+		middle = (low + high) / 2;
+		if( base.cross(mVertex[(v + middle) % n] - point)>=0 )
+			low = middle + 1;
+		else
+			high = middle;
+	}
+	far = low;
+	//[0,far)УǿıߣȻǿüıߣһüıߵе
+	low = 0;
+	high = far;
+	while( low<high )
+	{
+		middle = (low + high) / 2;
+		if( side(v + middle,point)>=0 )
+			low = middle + 1;
+		else
+			high = middle;
+	}
+	left = low;
+	//ǿüıߣȻǿıߣһıߵе
+	high = n;
+	while( low<high )
+	{
+		middle = (low + high) / 2;
+		if( side(v + middle,point)<0 )
+			low = middle + 1;
+		else
+			high = middle;
+	}
+	right = (v + low) % n;
+	left = (v + left) % n;
+	//ڶڲ߽ʱûпüı
+	if( side(left,point)>=0 || side(left + n - 1,point)<0 || side(right,point)<0 || side(right + n - 1,point)>=0 )
+	{
+		right = left = -1;
+		return false;
+	}
+	return true;
+}
+
+void SrConvexExtremePoint::tangentVertexBatch(const SrPoint2D* point,int numPoint,int* right,int* left) const
+{
+	int i;
+#pragma omp parallel for
+	for( i=0 ; i<numPoint ; i++ )
+		tangentVertex(point[i],right[i],left[i]);
+}
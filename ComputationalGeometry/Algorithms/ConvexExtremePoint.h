@@ -0,0 +1,91 @@
+/************************************************************************
+\link	www.twinklingstar.cn
+\author Twinkling Star
+\date	2026/10/19
+****************************************************************************/
+#ifndef SR_ALGORITHMS_CONVEX_EXTREME_POINT_H_
+#define SR_ALGORITHMS_CONVEX_EXTREME_POINT_H_
+
+/** \addtogroup algorithms
+  @{
+*/
+#include "ConvexPolygon.h"
+#include <vector>
+
+/*
+	ѯķ߷log2(n)Сnʱֲ
+*/
+#define SR_EXTREME_POINT_MIN_BATCH		64
+
+/*
+	ѯʱڵͰеı߲ôŴͰʼǰߣȶСΧ
+*/
+#define SR_EXTREME_POINT_MAX_WALK		8
+
+/**
+\brief Extreme point and tangent queries on a convex polygon, many at a time.
+
+build() keeps the edges of a counterclockwise convex polygon as a structure of
+arrays, the polygon is not copied. The outward normals of the edges are sorted
+by the angle from the normal of edge 0, and vertex i is the extreme vertex of
+the directions between the normals of edge i - 1 and edge i. extremeVertex()
+finds it by binary search on the angle, the angles are compared by the signs of
+dot and cross products.
+
+extremeVertexBatch() sorts the directions into buckets of a pseudo angle, a
+monotone function of the angle without trigonometry. One merged walk over the
+bucket bounds and the edges finds the first edge of every bucket. A direction
+whose bucket holds more than SR_EXTREME_POINT_MAX_WALK edges first halves the
+bucket by binary search, then it walks the last few edges, two edges per SSE2
+step. A batch costs O(n + k) when the edge angles are spread out, and edges
+clustered in a few buckets cost O(log n) per direction instead of a walk over
+the whole cluster. Small batches fall back to binary search.
+
+tangentVertex() finds the two tangent vertices from a point outside of the
+polygon in O(log n). Seen from the point, the angle of the vertices increases
+on the far chain and decreases on the near chain, so three binary searches
+starting from a vertex of the far chain find both tangents.
+*/
+class SrConvexExtremePoint
+{
+public:
+	SrConvexExtremePoint();
+
+	void				build(const SrPoint2D* vertex,int numVertex);
+	/**
+	\return The index of the extreme vertex, the smaller one if an edge is extreme.
+	*/
+	int					extremeVertex(const SrVector2D& direction) const;
+	void				extremeVertexBatch(const SrVector2D* direction,int numDirection,int* result) const;
+	/**
+	\brief The tangent vertices from point, seen from point the polygon is on the right of the
+	line to left and on the left of the line to right.
+	\return False if point is inside of the polygon or on its boundary.
+	*/
+	bool				tangentVertex(const SrPoint2D& point,int& right,int& left) const;
+	/**
+	\brief The tangents of many points in parallel, -1 if a point is not outside of the polygon.
+	*/
+	void				tangentVertexBatch(const SrPoint2D* point,int numPoint,int* right,int* left) const;
+
+public:
+	const SrPoint2D*	mVertex;
+	int					mNumVertex;
+
+private:
+	int					halfPlane(const SrVector2D& direction) const;
+	bool				isBefore(int edge,int half,const SrVector2D& direction) const;
+	int					walk(const SrVector2D& direction,int start) const;
+	SrReal				side(int edge,const SrPoint2D& point) const;
+
+	//i(mEdgeX[i],mEdgeY[i])ⷨڷ0һ࣬Լӷ0ʼαǣ
+	//ĩβԶԽı
+	std::vector<SrReal>	mEdgeX;
+	std::vector<SrReal>	mEdgeY;
+	std::vector<SrReal>	mHalf;
+	std::vector<SrReal>	mAngle;
+	SrPoint2D			mCenter;
+};
+
+/** @} */
+#endif
@@ -0,0 +1,162 @@
+/************************************************************************
+\link	www.twinklingstar.cn
+\author Twinkling Star
+\date	2014/11/04
+****************************************************************************/
+#include "ConvexInterConvex.h"
+
+#define Real		SrReal
+#define Point2D		SrPoint2D
+#define Vector2D	SrVector2D
+
+#define INSIDE		-1
+#define OUTSIDE		 1
+#define ON			 0
+
+
+static bool SegInterSeg(const Point2D& p0, const Point2D& p1, const Point2D& q0, const Point2D& q1,Point2D& result)
+{
+	Vector2D direction1 = p1 - p0;
+	Vector2D direction2 = q1 - q0;
+
+	Real dir1Square = direction1.magnitudeSquared();
+	Real dir2Square = direction2.magnitudeSquared();
+
+	Real kcross = direction1.cross(direction2);
+	Vector2D e = q0 - p0;
+
+	if( (kcross*kcross) > SR_EPS*SR_EPS*dir1Square*dir2Square  )
+	{//The intersection angle is not 0 based on relative error.||Cross(d1,d2)||^2/ (||d1||^2*||d2||^2)<=sin(a).
+		Real s = e.cross(direction2) / kcross;
+		if( LESS(s,0) || GREATER(s,1) )
+			return false;
+		Real t = e.cross(direction1) / kcross;
+		if( LESS(t,0) || GREATER(t,1) )
+			return false;
+		result = p0 + s*direction1;
+		return true;
+	}
+	return false;
+}
+
+static int Next(int k ,int n)
+{
+	return (k + 1)%n;
+}
+
+static bool IsHyperplane(const Point2D& p0, const Point2D& p1, const Point2D& q)
+{
+	Vector2D e = p1 - p0;
+	Vector2D norm = Vector2D(-e.y, e.x);
+	if( GREATER(norm.dot(q - p0) , 0) )
+		return true;
+	return false;
+}
+
+static int IsPointInConv(const Point2D* v, int n, const Point2D& p)
+{
+	int left = 0 , right = 0 , middle;
+	Vector2D edge , normal;
+	Real tmp;
+	while(true)
+	{
+		if( (right - left + n) % n == 1 )
+		{
+			edge = v[right] - v[left];
+			Vector2D e0 = p - v[left];
+			normal.set(edge.y , -edge.x);
+			tmp = normal.dot(e0);
+			if( GREATER(tmp,0) )
+				return OUTSIDE;
+			else if( LESS(tmp,0) )
+				return INSIDE;
+			if( LESS(edge.dot(e0),0) )
+				return OUTSIDE;
+			SrVector2D e1 = p - v[right];
+			if( GREATER(edge.dot(e1),0) )
+				return OUTSIDE;
+			return ON;
+		}
+		middle = left < right?((left + right) >> 1):((left + right + n) >> 1) % n;
+
+		edge = v[middle] - v[left];
+		normal.set(edge.y , -edge.x);
+
+		tmp = normal.dot(p - v[left]);
+		if( GEQUAL(tmp,0) )
+			right = middle;
+		else
+			left = middle;
+	}
+}
+
+int ConvexInterConvex(const Point2D* p,int n, const Point2D* q, int m,PointList& plist)
+{
+	int i = 0, j = 0, count = (n << 1) + (m << 1);
+	bool isInConvP;
+	Point2D p0, p1, q0, q1;
+	Point2D inter;
+	Vector2D ep, eq;
+	Real d;
+	while( count-- )
+	{
+		p0 = p[i];
+		p1 = p[Next(i,n)];
+		q0 = q[j];
+		q1 = q[Next(j,m)];
+
+		if( SegInterSeg(p0,p1,q0,q1,inter) )
+		{
+			if(plist.size()!=0 && inter == *plist.begin() )
+				return SR_INTERSECTING;
+			plist.push_back(inter);
+			if( IsHyperplane(q0,q1,p0) )
+				isInConvP = true;
+			else
+				isInConvP = false;
+		}
+		ep = p1 - p0;
+		eq = q1 - q0;
+		d  = eq.cross(ep);
+		if( GEQUAL(d,0) )
+		{
+			if( IsHyperplane(q0,q1,p1) )
+			{
+				isInConvP = false;
+				j = Next(j,m);
+			}
+			else
+			{
+				isInConvP = true;
+				i = Next(i,n);
+			}
+		}
+		else
+		{
+			if( IsHyperplane(p0,p1,q1) )
+			{
+				isInConvP = true;
+				i = Next(i,n);
+			}
+			else
+			{
+				isInConvP = false;
+				j = Next(j,m);
+			}
+		}
+	}
+	if( plist.size()!=0 )
+		return SR_INTERSECTING;
+	//߽粻ཻʱж͹Ƿڰϵ
+	if( IsPointInConv(p,n,q[0]) != OUTSIDE )
+	{
+		plist.insert(plist.end(),q,q + m);
+		return SR_OVERLAPPING;
+	}
+	if( IsPointInConv(q,m,p[0]) != OUTSIDE )
+	{
+		plist.insert(plist.end(),p,p + n);
+		return SR_OVERLAPPING;
+	}
+	return SR_DISJOINT;
+}
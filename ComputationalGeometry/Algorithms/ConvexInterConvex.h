@@ -0,0 +1,32 @@
+/************************************************************************
+\link	www.twinklingstar.cn
+\author Twinkling Star
+\date	2026/10/19
+****************************************************************************/
+#ifndef SR_ALGORITHMS_CONVEX_INTER_CONVEX_H_
+#define SR_ALGORITHMS_CONVEX_INTER_CONVEX_H_
+
+/** \addtogroup algorithms
+  @{
+*/
+#include "SrGeometricTools.h"
+#include "SrDataType.h"
+#include <list>
+
+typedef std::list<SrPoint2D>	PointList;
+
+/*
+\brief	͹α߽Ľ㣬͹ζʱ˳ġ
+\param[in]	p		͹PĶ
+\param[in]	n		͹PĶ
+\param[in]	q		͹QĶ
+\param[in]	m		͹QĶ
+\param[out]	plist	߽Ľ㣻һ͹ΰһΪ͹εĶ
+\return	SR_INTERSECTING	͹εıཻ߽
+		SR_OVERLAPPING	һ͹ΰһ͹
+		SR_DISJOINT		͹βཻ
+*/
+int ConvexInterConvex(const SrPoint2D* p,int n, const SrPoint2D* q, int m,PointList& plist);
+
+/** @} */
+#endif
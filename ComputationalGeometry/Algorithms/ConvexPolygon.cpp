@@ -0,0 +1,105 @@
+/************************************************************************
+\link	www.twinklingstar.cn
+\author Twinkling Star
+\date	2014/05/29
+****************************************************************************/
+/************************************************************************
+\description	͹εĹúԭ͹ΡGrahamɨת⾶
+				иһݡ
+****************************************************************************/
+#include "ConvexPolygon.h"
+#include <algorithm>
+
+int Next(int i,int n)
+{
+	return (i + 1) % n;
+}
+
+int CompareVertex(const SrPoint2D& p0,const SrPoint2D& p1)
+{
+	if( LESS(p0.x,p1.x) ) return 1;
+	if( GREATER(p0.x,p1.x) ) return -1;
+	if( LESS(p0.y,p1.y) ) return 1;
+	if( GREATER(p0.y,p1.y) ) return -1;
+	return 0;
+}
+
+bool IsConvex(const SrPoint2D* vertex,int numVertex)
+{
+	int last , current , next;
+	//͹εĶ㰴ֵȵٵݼѭؿֻαţŴż
+	//ֻͳǰnumVertex - 1ڱȽϵıţ2ʱѭıŴ4
+	int lastSign = CompareVertex(vertex[numVertex - 1],vertex[0]) , curSign;
+	int signChange = 0;
+	if( lastSign==0 )
+		return false;
+	for( last = 0 , current = 1; current<numVertex ; last = current, current ++ )
+	{
+		curSign = CompareVertex(vertex[last],vertex[current]);
+		if( curSign==0 )
+			return false;
+		if( curSign!=lastSign )
+		{
+			lastSign = curSign;
+			if( ++signChange>2 )
+				return false;
+		}
+	}
+	bool isGreater = false;
+	SrReal angle;
+	for(last = numVertex-2, current = numVertex-1, next = 0 ; next < numVertex ; last = current, current=next, next++)
+	{
+		angle = (vertex[next]-vertex[current]).cross(vertex[last]-vertex[current]);
+		if( LESS(angle,0) )
+			return false;
+		else if( !isGreater && GREATER(angle,0) )
+			isGreater = true;
+	}
+	if( isGreater )
+		return true;
+	//Degenerate case.
+	return false;
+}
+
+int LowestVertex(const SrPoint2D* vertex,int numVertex)
+{
+	int i , lowest = 0;
+	for( i=1 ; i<numVertex ; i++ )
+	{
+		if( CompareVertex(vertex[i],vertex[lowest])>0 )
+			lowest = i;
+	}
+	return lowest;
+}
+
+static bool LessVertex(const SrPoint2D& p0,const SrPoint2D& p1)
+{
+	return p0.x<p1.x || (p0.x==p1.x && p0.y<p1.y);
+}
+
+int MonotoneChainHull(SrPoint2D* point,int numPoint,SrPoint2D* hull)
+{
+	ASSERT(numPoint>=1);
+	int i , k = 0 , lower;
+	std::sort(point,point + numPoint,LessVertex);
+	//͹Ȼ͹ֻϸתĶ
+	for( i=0 ; i<numPoint ; i++ )
+	{
+		while( k>=2 && (hull[k - 1] - hull[k - 2]).cross(point[i] - hull[k - 2])<=0 )
+			k --;
+		if( k==1 && hull[0]==point[i] )
+			continue;
+		hull[k++] = point[i];
+	}
+	for( i=numPoint - 2 , lower = k + 1 ; i>=0 ; i-- )
+	{
+		while( k>=lower && (hull[k - 1] - hull[k - 2]).cross(point[i] - hull[k - 2])<=0 )
+			k --;
+		hull[k++] = point[i];
+	}
+	//һһͬ
+	k --;
+	if( k==2 && hull[0]==hull[1] )
+		k = 1;
+	return std::max(k,1);
+}
@@ -0,0 +1,44 @@
+/************************************************************************
+\link	www.twinklingstar.cn
+\author Twinkling Star
+\date	2014/05/29
+****************************************************************************/
+#ifndef SR_ALGORITHMS_CONVEX_POLYGON_H_
+#define SR_ALGORITHMS_CONVEX_POLYGON_H_
+
+/** \addtogroup algorithms
+  @{
+*/
+#include "SrGeometricTools.h"
+#include "SrDataType.h"
+
+/*
+\brief	͹϶iһ
+*/
+int Next(int i,int n);
+/*
+\brief	Compare the 2d points lexicographically.p<q	<==> (px<qx) or ((px=qx)and(py<qy)).
+\return	If pi<pj, return 1;
+		If pi>pj, return -1;
+		If pi==pj,return 0;
+*/
+int CompareVertex(const SrPoint2D& p0,const SrPoint2D& p1);
+/*
+\brief	жһǷ͹ΣĶʱ˳
+\param[in]	vertex, numVertex	涨Ķ
+*/
+bool IsConvex(const SrPoint2D* vertex,int numVertex);
+/*
+\brief	CompareVertex˳СĶ㣬µĶ
+*/
+int LowestVertex(const SrPoint2D* vertex,int numVertex);
+/*
+\brief	Andrew㷨㼯͹ʱ临ӶO(nlogn)ߵĵظĵ㶼ȥ
+\param[in,out]	point, numPoint	ĵ㼯ᱻֵ
+\param[out]		hull			ʱ˳͹ҪnumPoint + 1Ŀռ
+\return	͹ĸеĵغʱ1ʱ2
+*/
+int MonotoneChainHull(SrPoint2D* point,int numPoint,SrPoint2D* hull);
+
+/** @} */
+#endif
@@ -152,8 +152,10 @@ public:
 	{
 		ASSERT(mOutsideSet!=NULL);
 		cPlane plane;
-		ASSERT(plane.initPlane(mVertex[0]->mPoint,mVertex[1]->mPoint,mVertex[2]->mPoint));
 		VertexIterator iter = mOutsideSet->mVertexList.begin();
+		//Only the facets with a valid plane get an outside set.
+		if( !plane.initPlane(mVertex[0]->mPoint,mVertex[1]->mPoint,mVertex[2]->mPoint) )
+			return iter;
 		VertexIterator iterVertex;
 		SrReal maxDist = 0 , dist;
 		for( ; iter!=mOutsideSet->mVertexList.end();iter++ )
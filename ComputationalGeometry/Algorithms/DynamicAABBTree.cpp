@@ -0,0 +1,720 @@
+/************************************************************************
+\link	www.twinklingstar.cn
+\author Twinkling Star
+\date	2026/10/19
+****************************************************************************/
+/************************************************************************
+\description	̬AABBҶӽڵ㱣ŴAABBʽ룬
+				ɾʱŵڵ·תƽ⡣οף
+				Catto, E. "Dynamic AABB Tree." Box2D, b2DynamicTree.
+				Kopta, D., et al. "Fast, effective BVH updates for animated scenes." I3D 2012.
+****************************************************************************/
+#include "DynamicAABBTree.h"
+#include <math.h>
+#include <string.h>
+#include <algorithm>
+
+#define NULL_NODE			-1
+#define STACK_SIZE			64
+
+/*
+	ʱʹõջڵ㲻ʱҪڴ档
+*/
+class SrNodeStack
+{
+public:
+	SrNodeStack()
+	{
+		mStack	  = mArray;
+		mCount	  = 0;
+		mCapacity = STACK_SIZE;
+	}
+	~SrNodeStack()
+	{
+		if( mStack!=mArray )
+			delete []mStack;
+	}
+	void	push(int node)
+	{
+		if( mCount==mCapacity )
+		{
+			int* old = mStack;
+			mCapacity *= 2;
+			mStack = new int[mCapacity];
+			memcpy(mStack,old,sizeof(int)*mCount);
+			if( old!=mArray )
+				delete []old;
+		}
+		mStack[mCount++] = node;
+	}
+	int		pop()			{ return mStack[--mCount]; }
+	bool	isEmpty() const	{ return mCount==0; }
+
+private:
+	int*	mStack;
+	int		mArray[STACK_SIZE];
+	int		mCount;
+	int		mCapacity;
+};
+
+static void Merge(const SrAABBox3D& aabb1,const SrAABBox3D& aabb2,SrAABBox3D& result)
+{
+	result.mMinAABB = aabb1.mMinAABB;
+	result.mMinAABB.min(aabb2.mMinAABB);
+	result.mMaxAABB = aabb1.mMaxAABB;
+	result.mMaxAABB.max(aabb2.mMaxAABB);
+}
+
+static SrReal SurfaceArea(const SrAABBox3D& aabb)
+{
+	SrVector3D d = aabb.mMaxAABB - aabb.mMinAABB;
+	return 2*(d.x*d.y + d.y*d.z + d.z*d.x);
+}
+
+static SrReal MergedArea(const SrAABBox3D& aabb1,const SrAABBox3D& aabb2)
+{
+	SrAABBox3D merged;
+	Merge(aabb1,aabb2,merged);
+	return SurfaceArea(merged);
+}
+
+static bool Contain(const SrAABBox3D& outer,const SrAABBox3D& inner)
+{
+	return outer.mMinAABB.x<=inner.mMinAABB.x && outer.mMinAABB.y<=inner.mMinAABB.y && outer.mMinAABB.z<=inner.mMinAABB.z &&
+		   inner.mMaxAABB.x<=outer.mMaxAABB.x && inner.mMaxAABB.y<=outer.mMaxAABB.y && inner.mMaxAABB.z<=outer.mMaxAABB.z;
+}
+
+static bool Overlap(const SrAABBox3D& aabb1,const SrAABBox3D& aabb2)
+{
+	return aabb1.mMinAABB.x<=aabb2.mMaxAABB.x && aabb2.mMinAABB.x<=aabb1.mMaxAABB.x &&
+		   aabb1.mMinAABB.y<=aabb2.mMaxAABB.y && aabb2.mMinAABB.y<=aabb1.mMaxAABB.y &&
+		   aabb1.mMinAABB.z<=aabb2.mMaxAABB.z && aabb2.mMinAABB.z<=aabb1.mMaxAABB.z;
+}
+
+static void AABBToOBB(const SrAABBox3D& aabb,SrOBBox3D& obb)
+{
+	obb.mCenter = (aabb.mMinAABB + aabb.mMaxAABB)*0.5;
+	obb.mAxis[0] = SrVector3D(1,0,0);
+	obb.mAxis[1] = SrVector3D(0,1,0);
+	obb.mAxis[2] = SrVector3D(0,0,1);
+	obb.mHalfLength[0] = (aabb.mMaxAABB.x - aabb.mMinAABB.x)*0.5;
+	obb.mHalfLength[1] = (aabb.mMaxAABB.y - aabb.mMinAABB.y)*0.5;
+	obb.mHalfLength[2] = (aabb.mMaxAABB.z - aabb.mMinAABB.z)*0.5;
+}
+
+SrDynamicAABBTree::SrDynamicAABBTree(SrReal margin)
+{
+	mMargin	  = margin;
+	mRoot	  = NULL_NODE;
+	mFreeList = NULL_NODE;
+	mNumLeaf  = 0;
+}
+
+SrDynamicAABBTree::~SrDynamicAABBTree()
+{
+}
+
+void SrDynamicAABBTree::release()
+{
+	mNode.clear();
+	mRoot	  = NULL_NODE;
+	mFreeList = NULL_NODE;
+	mNumLeaf  = 0;
+}
+
+int SrDynamicAABBTree::allocateNode()
+{
+	int node;
+	if( mFreeList==NULL_NODE )
+	{
+		node = (int)mNode.size();
+		mNode.push_back(tTreeNode());
+	}
+	else
+	{
+		node = mFreeList;
+		mFreeList = mNode[node].mParent;
+	}
+	mNode[node].mParent = NULL_NODE;
+	mNode[node].mChild1 = NULL_NODE;
+	mNode[node].mChild2 = NULL_NODE;
+	mNode[node].mHeight = 0;
+	mNode[node].mData	= -1;
+	return node;
+}
+
+void SrDynamicAABBTree::freeNode(int node)
+{
+	mNode[node].mParent = mFreeList;
+	mNode[node].mHeight = -1;
+	mFreeList = node;
+}
+
+int SrDynamicAABBTree::insert(const SrAABBox3D& aabb,int data)
+{
+	int leaf = allocateNode();
+	SrVector3D margin(mMargin,mMargin,mMargin);
+	mNode[leaf].mBox.mMinAABB = aabb.mMinAABB - margin;
+	mNode[leaf].mBox.mMaxAABB = aabb.mMaxAABB + margin;
+	mNode[leaf].mData = data;
+	insertLeaf(leaf);
+	mNumLeaf ++;
+	return leaf;
+}
+
+int SrDynamicAABBTree::insert(const SrOBBox3D& obb,int data)
+{
+	SrAABBox3D aabb;
+	aabb.setOBB(obb);
+	return insert(aabb,data);
+}
+
+void SrDynamicAABBTree::remove(int proxy)
+{
+	ASSERT(proxy>=0 && proxy<(int)mNode.size() && isLeaf(proxy));
+	removeLeaf(proxy);
+	freeNode(proxy);
+	mNumLeaf --;
+}
+
+bool SrDynamicAABBTree::move(int proxy,const SrAABBox3D& aabb)
+{
+	ASSERT(proxy>=0 && proxy<(int)mNode.size() && isLeaf(proxy));
+	if( Contain(mNode[proxy].mBox,aabb) )
+		return false;
+	removeLeaf(proxy);
+	SrVector3D margin(mMargin,mMargin,mMargin);
+	mNode[proxy].mBox.mMinAABB = aabb.mMinAABB - margin;
+	mNode[proxy].mBox.mMaxAABB = aabb.mMaxAABB + margin;
+	insertLeaf(proxy);
+	return true;
+}
+
+bool SrDynamicAABBTree::move(int proxy,const SrOBBox3D& obb)
+{
+	SrAABBox3D aabb;
+	aabb.setOBB(obb);
+	return move(proxy,aabb);
+}
+
+void SrDynamicAABBTree::setLeafBox(int proxy,const SrAABBox3D& aabb)
+{
+	ASSERT(proxy>=0 && proxy<(int)mNode.size() && isLeaf(proxy));
+	SrVector3D margin(mMargin,mMargin,mMargin);
+	mNode[proxy].mBox.mMinAABB = aabb.mMinAABB - margin;
+	mNode[proxy].mBox.mMaxAABB = aabb.mMaxAABB + margin;
+}
+
+/*
+\brief	Ӹڵ㿪ʼʽѡֵܽڵ㣺ҶӷڵǰڵµĴǺϲı
+		ŵĳʱǰڵıӵĲǼ̳еĴۡ
+*/
+void SrDynamicAABBTree::insertLeaf(int leaf)
+{
+	if( mRoot==NULL_NODE )
+	{
+		mRoot = leaf;
+		mNode[leaf].mParent = NULL_NODE;
+		return;
+	}
+	SrAABBox3D leafBox = mNode[leaf].mBox;
+	int index = mRoot , child1 , child2;
+	SrReal area , combinedArea , cost , inheritance , cost1 , cost2;
+	while( !isLeaf(index) )
+	{
+		child1 = mNode[index].mChild1;
+		child2 = mNode[index].mChild2;
+		area		 = SurfaceArea(mNode[index].mBox);
+		combinedArea = MergedArea(mNode[index].mBox,leafBox);
+		cost		 = 2*combinedArea;
+		inheritance	 = 2*(combinedArea - area);
+
+		cost1 = MergedArea(leafBox,mNode[child1].mBox) + inheritance;
+		if( !isLeaf(child1) )
+			cost1 -= SurfaceArea(mNode[child1].mBox);
+		cost2 = MergedArea(leafBox,mNode[child2].mBox) + inheritance;
+		if( !isLeaf(child2) )
+			cost2 -= SurfaceArea(mNode[child2].mBox);
+
+		if( cost<cost1 && cost<cost2 )
+			break;
+		index = cost1<cost2 ? child1 : child2;
+	}
+
+	int sibling = index;
+	int oldParent = mNode[sibling].mParent;
+	int newParent = allocateNode();
+	tTreeNode& parent = mNode[newParent];
+	parent.mParent = oldParent;
+	Merge(leafBox,mNode[sibling].mBox,parent.mBox);
+	parent.mHeight = mNode[sibling].mHeight + 1;
+	parent.mChild1 = sibling;
+	parent.mChild2 = leaf;
+	mNode[sibling].mParent = newParent;
+	mNode[leaf].mParent	   = newParent;
+	if( oldParent!=NULL_NODE )
+	{
+		if( mNode[oldParent].mChild1==sibling )
+			mNode[oldParent].mChild1 = newParent;
+		else
+			mNode[oldParent].mChild2 = newParent;
+	}
+	else
+		mRoot = newParent;
+
+	fixUpwards(mNode[leaf].mParent);
+}
+
+void SrDynamicAABBTree::removeLeaf(int leaf)
+{
+	if( leaf==mRoot )
+	{
+		mRoot = NULL_NODE;
+		return;
+	}
+	int parent		= mNode[leaf].mParent;
+	int grandParent = mNode[parent].mParent;
+	int sibling		= mNode[parent].mChild1==leaf ? mNode[parent].mChild2 : mNode[parent].mChild1;
+	if( grandParent!=NULL_NODE )
+	{//ֵܽڵ游ڵ
+		if( mNode[grandParent].mChild1==parent )
+			mNode[grandParent].mChild1 = sibling;
+		else
+			mNode[grandParent].mChild2 = sibling;
+		mNode[sibling].mParent = grandParent;
+		freeNode(parent);
+		fixUpwards(grandParent);
+	}
+	else
+	{
+		mRoot = sibling;
+		mNode[sibling].mParent = NULL_NODE;
+		freeNode(parent);
+	}
+}
+
+void SrDynamicAABBTree::updateNode(int node)
+{
+	tTreeNode& n = mNode[node];
+	Merge(mNode[n.mChild1].mBox,mNode[n.mChild2].mBox,n.mBox);
+	n.mHeight = 1 + (mNode[n.mChild1].mHeight>mNode[n.mChild2].mHeight ? mNode[n.mChild1].mHeight : mNode[n.mChild2].mHeight);
+}
+
+/*
+\brief	nodeʼϣƽÿڵ㲢İΧк͸߶ȡ
+*/
+void SrDynamicAABBTree::fixUpwards(int node)
+{
+	while( node!=NULL_NODE )
+	{
+		node = balance(node);
+		updateNode(node);
+		node = mNode[node].mParent;
+	}
+}
+
+/*
+\brief	ڵnodeAĸ߶1ѽϸߵĺתµĸڵ㡣
+
+		  A			  C
+		 / \		 / \
+		B   C	->	A   F
+		   / \	   / \
+		  F   G	  B   G
+*/
+int SrDynamicAABBTree::balance(int nodeA)
+{
+	tTreeNode& A = mNode[nodeA];
+	if( isLeaf(nodeA) || A.mHeight<2 )
+		return nodeA;
+	int nodeB = A.mChild1 , nodeC = A.mChild2;
+	tTreeNode& B = mNode[nodeB];
+	tTreeNode& C = mNode[nodeC];
+	int diff = C.mHeight - B.mHeight;
+	if( diff>1 )
+	{//Cת
+		int nodeF = C.mChild1 , nodeG = C.mChild2;
+		tTreeNode& F = mNode[nodeF];
+		tTreeNode& G = mNode[nodeG];
+		C.mChild1 = nodeA;
+		C.mParent = A.mParent;
+		A.mParent = nodeC;
+		if( C.mParent!=NULL_NODE )
+		{
+			if( mNode[C.mParent].mChild1==nodeA )
+				mNode[C.mParent].mChild1 = nodeC;
+			else
+				mNode[C.mParent].mChild2 = nodeC;
+		}
+		else
+			mRoot = nodeC;
+		if( F.mHeight>G.mHeight )
+		{
+			C.mChild2 = nodeF;
+			A.mChild2 = nodeG;
+			G.mParent = nodeA;
+		}
+		else
+		{
+			C.mChild2 = nodeG;
+			A.mChild2 = nodeF;
+			F.mParent = nodeA;
+		}
+		updateNode(nodeA);
+		updateNode(nodeC);
+		return nodeC;
+	}
+	if( diff<-1 )
+	{//Bת
+		int nodeD = B.mChild1 , nodeE = B.mChild2;
+		tTreeNode& D = mNode[nodeD];
+		tTreeNode& E = mNode[nodeE];
+		B.mChild1 = nodeA;
+		B.mParent = A.mParent;
+		A.mParent = nodeB;
+		if( B.mParent!=NULL_NODE )
+		{
+			if( mNode[B.mParent].mChild1==nodeA )
+				mNode[B.mParent].mChild1 = nodeB;
+			else
+				mNode[B.mParent].mChild2 = nodeB;
+		}
+		else
+			mRoot = nodeB;
+		if( D.mHeight>E.mHeight )
+		{
+			B.mChild2 = nodeD;
+			A.mChild1 = nodeE;
+			E.mParent = nodeA;
+		}
+		else
+		{
+			B.mChild2 = nodeE;
+			A.mChild1 = nodeD;
+			D.mParent = nodeA;
+		}
+		updateNode(nodeA);
+		updateNode(nodeB);
+		return nodeB;
+	}
+	return nodeA;
+}
+
+/*
+\brief	nodeһһӵһӣѡʹıĺӵıĽ
+		nodeİΧв䣬ֻҪ±ıĺӡ
+*/
+void SrDynamicAABBTree::rotate(int node)
+{
+	int child[2] , i , k , best = -1 , bestK = -1;
+	child[0] = mNode[node].mChild1;
+	child[1] = mNode[node].mChild2;
+	SrReal gain , bestGain = 0 , area;
+	int grandChild[2];
+	for( i=0 ; i<2 ; i++ )
+	{//child[1-i]child[i]ĺgrandChild[k]
+		if( isLeaf(child[i]) )
+			continue;
+		grandChild[0] = mNode[child[i]].mChild1;
+		grandChild[1] = mNode[child[i]].mChild2;
+		area = SurfaceArea(mNode[child[i]].mBox);
+		for( k=0 ; k<2 ; k++ )
+		{
+			gain = area - MergedArea(mNode[child[1 - i]].mBox,mNode[grandChild[1 - k]].mBox);
+			if( gain>bestGain )
+			{
+				bestGain = gain;
+				best	 = i;
+				bestK	 = k;
+			}
+		}
+	}
+	if( best<0 )
+		return;
+
+	int other = child[1 - best] , parent = child[best];
+	int swapped = bestK==0 ? mNode[parent].mChild1 : mNode[parent].mChild2;
+	if( best==0 )
+		mNode[node].mChild2 = swapped;
+	else
+		mNode[node].mChild1 = swapped;
+	mNode[swapped].mParent = node;
+	if( bestK==0 )
+		mNode[parent].mChild1 = other;
+	else
+		mNode[parent].mChild2 = other;
+	mNode[other].mParent = parent;
+	updateNode(parent);
+	updateNode(node);
+}
+
+void SrDynamicAABBTree::preOrder(std::vector<int>& order) const
+{
+	order.clear();
+	if( mRoot==NULL_NODE )
+		return;
+	SrNodeStack stack;
+	stack.push(mRoot);
+	int node;
+	while( !stack.isEmpty() )
+	{
+		node = stack.pop();
+		order.push_back(node);
+		if( !isLeaf(node) )
+		{
+			stack.push(mNode[node].mChild1);
+			stack.push(mNode[node].mChild2);
+		}
+	}
+}
+
+void SrDynamicAABBTree::refit()
+{
+	std::vector<int> order;
+	preOrder(order);
+	int i;
+	//кӶڸڵ֮ʱѾ
+	for( i=(int)order.size() - 1 ; i>=0 ; i-- )
+	{
+		if( !isLeaf(order[i]) )
+			updateNode(order[i]);
+	}
+}
+
+void SrDynamicAABBTree::rebalance()
+{
+	std::vector<int> order;
+	preOrder(order);
+	int i;
+	for( i=(int)order.size() - 1 ; i>=0 ; i-- )
+	{
+		if( !isLeaf(order[i]) )
+		{
+			updateNode(order[i]);
+			rotate(order[i]);
+		}
+	}
+}
+
+SrReal SrDynamicAABBTree::getAreaCost() const
+{
+	SrReal cost = 0;
+	int i;
+	for( i=0 ; i<(int)mNode.size() ; i++ )
+	{
+		if( mNode[i].mHeight>0 )
+			cost += SurfaceArea(mNode[i].mBox);
+	}
+	return cost;
+}
+
+void SrDynamicAABBTree::queryOverlap(const SrAABBox3D& aabb,std::vector<int>& result) const
+{
+	result.clear();
+	if( mRoot==NULL_NODE )
+		return;
+	SrNodeStack stack;
+	stack.push(mRoot);
+	int node;
+	while( !stack.isEmpty() )
+	{
+		node = stack.pop();
+		if( !Overlap(mNode[node].mBox,aabb) )
+			continue;
+		if( isLeaf(node) )
+			result.push_back(mNode[node].mData);
+		else
+		{
+			stack.push(mNode[node].mChild1);
+			stack.push(mNode[node].mChild2);
+		}
+	}
+}
+
+void SrDynamicAABBTree::querySegment(const SrSegment3D& segment,std::vector<int>& result) const
+{
+	result.clear();
+	if( mRoot==NULL_NODE )
+		return;
+	SrNodeStack stack;
+	stack.push(mRoot);
+	SrOBBox3D obb;
+	int node;
+	while( !stack.isEmpty() )
+	{
+		node = stack.pop();
+		AABBToOBB(mNode[node].mBox,obb);
+		if( !SegmentOverlapTestOBB_FastTesting(segment,obb) )
+			continue;
+		if( isLeaf(node) )
+			result.push_back(mNode[node].mData);
+		else
+		{
+			stack.push(mNode[node].mChild1);
+			stack.push(mNode[node].mChild2);
+		}
+	}
+}
+
+void SrDynamicAABBTree::queryRay(const SrPoint3D& base,const SrVector3D& direction,SrReal maxT,std::vector<int>& result) const
+{
+	querySegment(SrSegment3D(base,base + direction*maxT),result);
+}
+
+void SrDynamicAABBTree::queryPlane(const SrPlane3D& plane,std::vector<int>& result) const
+{
+	result.clear();
+	if( mRoot==NULL_NODE )
+		return;
+	SrNodeStack stack;
+	stack.push(mRoot);
+	int node , status;
+	while( !stack.isEmpty() )
+	{
+		node = stack.pop();
+		status = Plane3DHitTestAABB_DistanceMethod(plane,mNode[node].mBox);
+		if( status==SR_PLANE_FRONT || status==SR_PLANE_BACK )
+			continue;
+		if( isLeaf(node) )
+			result.push_back(mNode[node].mData);
+		else
+		{
+			stack.push(mNode[node].mChild1);
+			stack.push(mNode[node].mChild2);
+		}
+	}
+}
+
+void SrDynamicAABBTree::collectLeaves(int node,std::vector<int>& result) const
+{
+	SrNodeStack stack;
+	stack.push(node);
+	while( !stack.isEmpty() )
+	{
+		node = stack.pop();
+		if( isLeaf(node) )
+			result.push_back(mNode[node].mData);
+		else
+		{
+			stack.push(mNode[node].mChild1);
+			stack.push(mNode[node].mChild2);
+		}
+	}
+}
+
+/*
+\brief	ջͬʱڵҪƽ룬Ϊ0嶼͹ڡ
+*/
+void SrDynamicAABBTree::queryPlaneSet(const SrPlaneSet& planes,std::vector<int>& inside,std::vector<int>& intersecting) const
+{
+	inside.clear();
+	intersecting.clear();
+	if( mRoot==NULL_NODE )
+		return;
+	SrNodeStack stack;
+	stack.push(mRoot);
+	stack.push((int)planes.fullMask());
+	int node , status;
+	SrU32 planeMask;
+	while( !stack.isEmpty() )
+	{
+		planeMask = (SrU32)stack.pop();
+		node	  = stack.pop();
+		status = PlaneSetCullAABB(planes,mNode[node].mBox,planeMask);
+		if( status==SR_CULL_OUTSIDE )
+			continue;
+		if( status==SR_CULL_INSIDE )
+			collectLeaves(node,inside);
+		else if( isLeaf(node) )
+			intersecting.push_back(mNode[node].mData);
+		else
+		{
+			stack.push(mNode[node].mChild1);
+			stack.push((int)planeMask);
+			stack.push(mNode[node].mChild2);
+			stack.push((int)planeMask);
+		}
+	}
+}
+
+/*
+\brief	ͬʱһڵչɺ֮ϣ
+		ͬڵֻڰΧصʱչϴǸڵ㡣
+*/
+void SrDynamicAABBTree::queryPairs(BoxPairArray& pairs) const
+{
+	pairs.clear();
+	if( mRoot==NULL_NODE )
+		return;
+	SrNodeStack stack;
+	tBoxPair pair;
+	int node1 , node2;
+	stack.push(mRoot);
+	stack.push(mRoot);
+	while( !stack.isEmpty() )
+	{
+		node2 = stack.pop();
+		node1 = stack.pop();
+		if( node1==node2 )
+		{
+			if( isLeaf(node1) )
+				continue;
+			stack.push(mNode[node1].mChild1);
+			stack.push(mNode[node1].mChild1);
+			stack.push(mNode[node1].mChild2);
+			stack.push(mNode[node1].mChild2);
+			stack.push(mNode[node1].mChild1);
+			stack.push(mNode[node1].mChild2);
+			continue;
+		}
+		if( !Overlap(mNode[node1].mBox,mNode[node2].mBox) )
+			continue;
+		if( isLeaf(node1) && isLeaf(node2) )
+		{
+			pair.mBox1 = mNode[node1].mData;
+			pair.mBox2 = mNode[node2].mData;
+			if( pair.mBox1>pair.mBox2 )
+				std::swap(pair.mBox1,pair.mBox2);
+			pairs.push_back(pair);
+			continue;
+		}
+		//չϴĽڵ
+		if( isLeaf(node2) || (!isLeaf(node1) && SurfaceArea(mNode[node1].mBox)>SurfaceArea(mNode[node2].mBox)) )
+			std::swap(node1,node2);
+		stack.push(node1);
+		stack.push(mNode[node2].mChild1);
+		stack.push(node1);
+		stack.push(mNode[node2].mChild2);
+	}
+}
+
+int SrDynamicAABBTree::validateNode(int node) const
+{
+	const tTreeNode& n = mNode[node];
+	if( isLeaf(node) )
+	{
+		ASSERT(n.mHeight==0);
+		return 1;
+	}
+	ASSERT(mNode[n.mChild1].mParent==node && mNode[n.mChild2].mParent==node);
+	ASSERT(Contain(n.mBox,mNode[n.mChild1].mBox) && Contain(n.mBox,mNode[n.mChild2].mBox));
+#ifdef _DEBUG
+	int height1 = mNode[n.mChild1].mHeight , height2 = mNode[n.mChild2].mHeight;
+	ASSERT(n.mHeight==1 + (height1>height2 ? height1 : height2));
+#endif
+	return validateNode(n.mChild1) + validateNode(n.mChild2);
+}
+
+void SrDynamicAABBTree::validate() const
+{
+	if( mRoot==NULL_NODE )
+	{
+		ASSERT(mNumLeaf==0);
+		return;
+	}
+	ASSERT(mNode[mRoot].mParent==NULL_NODE);
+#ifdef _DEBUG
+	int numLeaf = validateNode(mRoot);
+	ASSERT(numLeaf==mNumLeaf);
+#endif
+}
@@ -0,0 +1,151 @@
+/************************************************************************
+\link	www.twinklingstar.cn
+\author Twinkling Star
+\date	2026/10/19
+****************************************************************************/
+#ifndef SR_ALGORITHMS_DYNAMIC_AABB_TREE_H_
+#define SR_ALGORITHMS_DYNAMIC_AABB_TREE_H_
+
+/** \addtogroup algorithms
+  @{
+*/
+#include "SrAABBox3D.h"
+#include "FrustumCulling.h"
+#include "SegmentOverlapOBB.h"
+#include "SweepAndPrune.h"
+#include <vector>
+
+/**
+\brief A node of the dynamic AABB tree.
+
+A leaf has mChild1==-1, its box is the fat AABB of an object and mData is the
+user data of the object. A free node has mHeight==-1, and mParent links the
+free list.
+*/
+typedef struct
+{
+	SrAABBox3D	mBox;
+	int			mParent;
+	int			mChild1;
+	int			mChild2;
+	int			mHeight;		//0 for a leaf.
+	int			mData;
+}tTreeNode;
+
+/**
+\brief Dynamic bounding volume tree over moving objects.
+
+Every object is stored in a leaf with a fat AABB, its tight AABB enlarged by a
+margin, so an object that moves a little does not change the tree. Leaves are
+inserted by the surface area heuristic and the tree is kept balanced with
+rotations on the path to the root, so insertion, removal and movement cost
+O(log n). For scenes where almost every object moves, setLeafBox() followed
+by refit() updates the boxes in one bottom-up pass, and rebalance() then
+restores the quality of the tree with surface area reducing rotations.
+
+An object is identified by the proxy returned by insert(), which is the index
+of its leaf.
+*/
+class SrDynamicAABBTree
+{
+public:
+	SrDynamicAABBTree(SrReal margin = 0.1);
+	~SrDynamicAABBTree();
+
+	void				release();
+	/**
+	\brief Insert an object with its tight AABB, return the proxy.
+	*/
+	int					insert(const SrAABBox3D& aabb,int data);
+	int					insert(const SrOBBox3D& obb,int data);
+	void				remove(int proxy);
+	/**
+	\brief Move an object, it is reinserted only if its new AABB leaves the fat one.
+	\return true if the tree is changed.
+	*/
+	bool				move(int proxy,const SrAABBox3D& aabb);
+	bool				move(int proxy,const SrOBBox3D& obb);
+	/**
+	\brief Set the fat AABB of a leaf without changing the tree, refit() must be called before the next query.
+	*/
+	void				setLeafBox(int proxy,const SrAABBox3D& aabb);
+	/**
+	\brief Recompute the boxes of all the internal nodes, in O(n).
+	*/
+	void				refit();
+	/**
+	\brief Rotate the internal nodes bottom-up where it reduces the surface area of a child, in O(n).
+	*/
+	void				rebalance();
+
+	const SrAABBox3D&	getFatBox(int proxy) const	{ return mNode[proxy].mBox; }
+	int					getData(int proxy) const	{ return mNode[proxy].mData; }
+	int					getHeight() const			{ return mRoot<0 ? 0 : mNode[mRoot].mHeight; }
+	int					getNumLeaf() const			{ return mNumLeaf; }
+	/**
+	\brief The sum of the surface areas of the internal nodes, a measure of the quality of the tree.
+	*/
+	SrReal				getAreaCost() const;
+
+	/**
+	\brief The data of the objects whose fat AABBs overlap aabb.
+	*/
+	void				queryOverlap(const SrAABBox3D& aabb,std::vector<int>& result) const;
+	/**
+	\brief The data of the objects whose fat AABBs overlap the segment, the nodes are tested with SegmentOverlapTestOBB_FastTesting.
+	*/
+	void				querySegment(const SrSegment3D& segment,std::vector<int>& result) const;
+	/**
+	\brief The objects hit by the ray base + t*direction, 0<=t<=maxT, the same as querySegment.
+	*/
+	void				queryRay(const SrPoint3D& base,const SrVector3D& direction,SrReal maxT,std::vector<int>& result) const;
+	/**
+	\brief The data of the objects whose fat AABBs intersect or touch the plane, the nodes are tested with Plane3DHitTestAABB_DistanceMethod.
+	*/
+	void				queryPlane(const SrPlane3D& plane,std::vector<int>& result) const;
+	/**
+	\brief Cull the objects against the convex volume bounded by a plane set, see PlaneSetCullAABB().
+
+	A node in the back half space of a plane passes the plane to its subtree, and a
+	subtree inside all the planes is accepted without further tests.
+	\param[out] inside The data of the objects whose fat AABBs are inside the volume.
+	\param[out] intersecting The data of the objects whose fat AABBs intersect the boundary of the volume.
+	*/
+	void				queryPlaneSet(const SrPlaneSet& planes,std::vector<int>& inside,std::vector<int>& intersecting) const;
+	/**
+	\brief All the pairs of objects whose fat AABBs overlap, mBox1 and mBox2 are the data of the objects with mBox1<mBox2.
+	*/
+	void				queryPairs(BoxPairArray& pairs) const;
+	/**
+	\brief Check the structure of the tree, in debug mode.
+	*/
+	void				validate() const;
+
+public:
+	SrReal					mMargin;
+
+private:
+	SrDynamicAABBTree(const SrDynamicAABBTree&);
+	SrDynamicAABBTree& operator=(const SrDynamicAABBTree&);
+
+	bool				isLeaf(int node) const	{ return mNode[node].mChild1<0; }
+	int					allocateNode();
+	void				freeNode(int node);
+	void				insertLeaf(int leaf);
+	void				removeLeaf(int leaf);
+	void				fixUpwards(int node);
+	int					balance(int node);
+	void				rotate(int node);
+	void				updateNode(int node);
+	void				preOrder(std::vector<int>& order) const;
+	void				collectLeaves(int node,std::vector<int>& result) const;
+	int					validateNode(int node) const;
+
+	std::vector<tTreeNode>	mNode;
+	int						mRoot;
+	int						mFreeList;
+	int						mNumLeaf;
+};
+
+/** @} */
+#endif
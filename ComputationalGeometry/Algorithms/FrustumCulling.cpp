@@ -0,0 +1,397 @@
+/************************************************************************
+\link	www.twinklingstar.cn
+\author Twinkling Star
+\date	2026/10/19
+****************************************************************************/
+/************************************************************************
+\description	жϰΧ׶塢k-DOPƽ漯Χ͹Ĺϵÿƽж
+				жSSE2ĴͬʱΧУ¼һΰѰΧųƽ棬
+				֡ԣڲΰΧʱͨƽȽڵѾȫͨƽ档
+				οףAssarsson, U., and Moller, T. "Optimized view frustum culling algorithms for bounding boxes."
+				Journal of Graphics Tools 5.1 (2000): 9-22.
+****************************************************************************/
+#include "FrustumCulling.h"
+#include "SrSimd.h"
+#include <string.h>
+#include <math.h>
+
+#define PACKET_WIDTH	SR_CULL_PACKET_WIDTH
+
+SrAABBox3DSoA::SrAABBox3DSoA()
+{
+	mBuffer = NULL;
+	mNumBox = 0;
+	memset(mMin,0,sizeof(mMin));
+	memset(mMax,0,sizeof(mMax));
+}
+
+SrAABBox3DSoA::SrAABBox3DSoA(int numBox)
+{
+	mBuffer = NULL;
+	mNumBox = 0;
+	memset(mMin,0,sizeof(mMin));
+	memset(mMax,0,sizeof(mMax));
+	allocate(numBox);
+}
+
+SrAABBox3DSoA::~SrAABBox3DSoA()
+{
+	if( mBuffer )
+		delete []mBuffer;
+}
+
+void SrAABBox3DSoA::allocate(int numBox)
+{
+	if( mBuffer )
+		delete []mBuffer;
+	int capacity = (numBox + PACKET_WIDTH - 1) / PACKET_WIDTH * PACKET_WIDTH;
+	mBuffer = new SrReal[6*capacity];
+	memset(mBuffer,0,sizeof(SrReal)*6*capacity);
+	int c;
+	for( c=0 ; c<3 ; c++ )
+	{
+		mMin[c] = mBuffer + c*capacity;
+		mMax[c] = mBuffer + (3 + c)*capacity;
+	}
+	mNumBox = numBox;
+}
+
+void SrAABBox3DSoA::setBox(int i,const SrAABBox3D& aabb)
+{
+	ASSERT(i>=0 && i<mNumBox);
+	int c;
+	for( c=0 ; c<3 ; c++ )
+	{
+		mMin[c][i] = aabb.mMinAABB[c];
+		mMax[c][i] = aabb.mMaxAABB[c];
+	}
+}
+
+const SrAABBox3D SrAABBox3DSoA::getBox(int i) const
+{
+	ASSERT(i>=0 && i<mNumBox);
+	return SrAABBox3D(SrPoint3D(mMin[0][i],mMin[1][i],mMin[2][i]),SrPoint3D(mMax[0][i],mMax[1][i],mMax[2][i]));
+}
+
+
+/*
+\brief	ݾжtmprжϰΧһƽĹϵPlane3DHitTestAABB_DistanceMethodж˳ͬ
+*/
+static int ClassifyPlane(SrReal tmp,SrReal r)
+{
+	if( EQUAL(tmp,r) || EQUAL(tmp,-r) )
+		return SR_PLANE_TANGENT;
+	else if( GREATER(tmp,r) )
+		return SR_PLANE_FRONT;
+	else if( LESS(tmp,-r) )
+		return SR_PLANE_BACK;
+	return SR_PLANE_INTERSECTING;
+}
+
+int PlaneSetCullAABB(const SrPlaneSet& planes,const SrAABBox3D& aabb,SrU32& planeMask)
+{
+	SrVector3D extent = aabb.mMaxAABB - aabb.mMinAABB;
+	SrPoint3D center = aabb.mMinAABB + aabb.mMaxAABB;
+	SrReal r , tmp;
+	int i , status;
+	for( i=0 ; i<planes.mNumPlane ; i++ )
+	{
+		if( !(planeMask & ((SrU32)1<<i)) )
+			continue;
+		r = 0;
+		r += fabs(planes.mNormal[0][i]*extent.x);
+		r += fabs(planes.mNormal[1][i]*extent.y);
+		r += fabs(planes.mNormal[2][i]*extent.z);
+		tmp = planes.mNormal[0][i]*center.x + planes.mNormal[1][i]*center.y + planes.mNormal[2][i]*center.z + 2*planes.mD[i];
+		status = ClassifyPlane(tmp,r);
+		if( status==SR_PLANE_FRONT )
+			return SR_CULL_OUTSIDE;
+		if( status==SR_PLANE_BACK )
+			planeMask &= ~((SrU32)1<<i);
+	}
+	return planeMask ? SR_CULL_INTERSECTING : SR_CULL_INSIDE;
+}
+
+int PlaneSetCullOBB(const SrPlaneSet& planes,const SrOBBox3D& obb,SrU32& planeMask)
+{
+	SrVector3D normal;
+	SrReal r , tmp;
+	int i , status;
+	for( i=0 ; i<planes.mNumPlane ; i++ )
+	{
+		if( !(planeMask & ((SrU32)1<<i)) )
+			continue;
+		normal = SrVector3D(planes.mNormal[0][i],planes.mNormal[1][i],planes.mNormal[2][i]);
+		r = 0;
+		r += fabs(normal.dot(obb.mAxis[0])*obb.mHalfLength[0]);
+		r += fabs(normal.dot(obb.mAxis[1])*obb.mHalfLength[1]);
+		r += fabs(normal.dot(obb.mAxis[2])*obb.mHalfLength[2]);
+		tmp = normal.dot(obb.mCenter) + planes.mD[i];
+		status = ClassifyPlane(tmp,r);
+		if( status==SR_PLANE_FRONT )
+			return SR_CULL_OUTSIDE;
+		if( status==SR_PLANE_BACK )
+			planeMask &= ~((SrU32)1<<i);
+	}
+	return planeMask ? SR_CULL_INTERSECTING : SR_CULL_INSIDE;
+}
+
+
+/*
+	SR_SIMD_WIDTHΧУװĴСAABBԽߺǵĺͣ汾мͬ
+*/
+typedef struct
+{
+	SrSimdReal	mExtent[3];
+	SrSimdReal	mCenter[3];
+}tAABBPacket;
+
+typedef struct
+{
+	SrSimdReal	mCenter[3];
+	SrSimdReal	mAxis[3][3];
+	SrSimdReal	mHalfLength[3];
+}tOBBPacket;
+
+static void LoadPacket(const SrAABBox3DSoA& aabb,int first,tAABBPacket& packet)
+{
+	int c;
+	SrSimdReal mn , mx;
+	for( c=0 ; c<3 ; c++ )
+	{
+		mn = SrSimd::load(aabb.mMin[c] + first);
+		mx = SrSimd::load(aabb.mMax[c] + first);
+		packet.mExtent[c] = SrSimd::sub(mx,mn);
+		packet.mCenter[c] = SrSimd::add(mn,mx);
+	}
+}
+
+static void LoadPacket(const SrOBBox3DSoA& obb,int first,tOBBPacket& packet)
+{
+	int k , c;
+	for( c=0 ; c<3 ; c++ )
+	{
+		packet.mCenter[c]	  = SrSimd::load(obb.mCenter[c] + first);
+		packet.mHalfLength[c] = SrSimd::load(obb.mHalfLength[c] + first);
+	}
+	for( k=0 ; k<3 ; k++ )
+		for( c=0 ; c<3 ; c++ )
+			packet.mAxis[k][c] = SrSimd::load(obb.mAxis[k][c] + first);
+}
+
+static SrSimdReal DotPacket(const SrSimdReal* u,const SrSimdReal* v)
+{
+	return SrSimd::add(SrSimd::add(SrSimd::mul(u[0],v[0]),SrSimd::mul(u[1],v[1])),SrSimd::mul(u[2],v[2]));
+}
+
+/*
+	ƽ漯еÿƽչĴͨϣAABBʹԤȳ2ƽ泣
+*/
+typedef struct
+{
+	SrSimdReal	mNormal[3];
+	SrSimdReal	mAbsNormal[3];
+	SrSimdReal	mD;
+	SrSimdReal	mD2;
+}tPlanePacket;
+
+static void SplatPlanes(const SrPlaneSet& planes,tPlanePacket* packet)
+{
+	int i;
+	for( i=0 ; i<planes.mNumPlane ; i++ )
+	{
+		packet[i].mNormal[0] = SrSimd::splat(planes.mNormal[0][i]);
+		packet[i].mNormal[1] = SrSimd::splat(planes.mNormal[1][i]);
+		packet[i].mNormal[2] = SrSimd::splat(planes.mNormal[2][i]);
+		packet[i].mAbsNormal[0] = SrSimd::abs(packet[i].mNormal[0]);
+		packet[i].mAbsNormal[1] = SrSimd::abs(packet[i].mNormal[1]);
+		packet[i].mAbsNormal[2] = SrSimd::abs(packet[i].mNormal[2]);
+		packet[i].mD  = SrSimd::splat(planes.mD[i]);
+		packet[i].mD2 = SrSimd::splat(2*planes.mD[i]);
+	}
+}
+
+static void PlaneDistance(const tAABBPacket& aabb,const tPlanePacket& plane,SrSimdReal& tmp,SrSimdReal& r)
+{
+	//AABBĶԽ߷Ǹ|n*e||n|*eĽȫͬ
+	r = DotPacket(plane.mAbsNormal,aabb.mExtent);
+	tmp = SrSimd::add(DotPacket(plane.mNormal,aabb.mCenter),plane.mD2);
+}
+
+static void PlaneDistance(const tOBBPacket& obb,const tPlanePacket& plane,SrSimdReal& tmp,SrSimdReal& r)
+{
+	r = SrSimd::add(SrSimd::add(SrSimd::abs(SrSimd::mul(DotPacket(plane.mNormal,obb.mAxis[0]),obb.mHalfLength[0])),
+								SrSimd::abs(SrSimd::mul(DotPacket(plane.mNormal,obb.mAxis[1]),obb.mHalfLength[1]))),
+					SrSimd::abs(SrSimd::mul(DotPacket(plane.mNormal,obb.mAxis[2]),obb.mHalfLength[2])));
+	tmp = SrSimd::add(DotPacket(plane.mNormal,obb.mCenter),plane.mD);
+}
+
+/*
+\brief	ClassifyPlaneļĴ汾GREATER(tmp,r)EQUAL(tmp,r)⣬ռֻҪųEQUAL(tmp,-r)
+		ռͬ
+*/
+static int FrontMask(SrSimdReal tmp,SrSimdReal r)
+{
+	return SrSimd::moveMask(SrSimd::andNot(SrSimd::equal(tmp,SrSimd::neg(r)),SrSimd::greater(tmp,r)));
+}
+
+static int BackMask(SrSimdReal tmp,SrSimdReal r)
+{
+	return SrSimd::moveMask(SrSimd::andNot(SrSimd::equal(tmp,r),SrSimd::less(tmp,SrSimd::neg(r))));
+}
+
+static int ValidMask(int numBox,int first)
+{
+	int numLane = numBox - first;
+	return numLane>=PACKET_WIDTH ? (1<<PACKET_WIDTH) - 1 : (1<<numLane) - 1;
+}
+
+/*
+\brief	һݰеİΧ͹ĹϵÿΧм¼ƽ⣬Ĵμеƽ棬
+		Ĵеͨ͹ʱǰĴݰǰƽ١
+\param[in]	box			PACKET_WIDTH/SR_SIMD_WIDTHĴеİΧ
+\param[in]	lastPlane	ָݰеһΧм¼ƽ棬ΪNULL
+\param[in]	validMask	Чͨ
+*/
+template<class tBoxPacket>
+static void CullPacket(const SrPlaneSet& planes,const tPlanePacket* planePacket,const tBoxPacket* box,int* lastPlane,int validMask,int& insideMask,int& outsideMask)
+{
+	SrSimdReal tmp , r;
+	int i , h , lane , active , front , back , inside = validMask , outside = 0;
+	if( lastPlane )
+	{
+		tPlanePacket gather;
+		SrReal value[4][SR_SIMD_WIDTH];
+		int c , plane;
+		for( h=0 ; h<PACKET_WIDTH ; h+=SR_SIMD_WIDTH )
+		{
+			active = (validMask>>h) & SR_SIMD_FULL_MASK;
+			if( !active )
+				break;
+			for( lane=0 ; lane<SR_SIMD_WIDTH ; lane++ )
+			{
+				plane = (active & (1<<lane)) ? lastPlane[h + lane] : 0;
+				if( plane<0 || plane>=planes.mNumPlane )
+					plane = 0;
+				for( c=0 ; c<3 ; c++ )
+					value[c][lane] = planes.mNormal[c][plane];
+				value[3][lane] = planes.mD[plane];
+			}
+			for( c=0 ; c<3 ; c++ )
+				gather.mNormal[c] = SrSimd::load(value[c]);
+			for( c=0 ; c<3 ; c++ )
+				gather.mAbsNormal[c] = SrSimd::abs(gather.mNormal[c]);
+			gather.mD  = SrSimd::load(value[3]);
+			gather.mD2 = SrSimd::add(gather.mD,gather.mD);
+			PlaneDistance(box[h/SR_SIMD_WIDTH],gather,tmp,r);
+			outside |= (FrontMask(tmp,r) & active) << h;
+		}
+	}
+	for( h=0 ; h<PACKET_WIDTH ; h+=SR_SIMD_WIDTH )
+	{
+		active = ((validMask & ~outside)>>h) & SR_SIMD_FULL_MASK;
+		for( i=0 ; i<planes.mNumPlane && active ; i++ )
+		{
+			PlaneDistance(box[h/SR_SIMD_WIDTH],planePacket[i],tmp,r);
+			front = FrontMask(tmp,r) & active;
+			back  = BackMask(tmp,r);
+			if( front )
+			{
+				if( lastPlane )
+				{
+					for( lane=0 ; lane<SR_SIMD_WIDTH ; lane++ )
+						if( front & (1<<lane) )
+							lastPlane[h + lane] = i;
+				}
+				outside |= front << h;
+				active &= ~front;
+			}
+			inside &= (back << h) | ~(SR_SIMD_FULL_MASK << h);
+		}
+	}
+	insideMask	= inside & ~outside;
+	outsideMask = outside;
+}
+
+static void CullAABBPacket(const SrPlaneSet& planes,const tPlanePacket* planePacket,const SrAABBox3DSoA& aabb,int first,int* lastPlane,int& insideMask,int& outsideMask)
+{
+	tAABBPacket packet[PACKET_WIDTH/SR_SIMD_WIDTH];
+	int h;
+	for( h=0 ; h<PACKET_WIDTH ; h+=SR_SIMD_WIDTH )
+		LoadPacket(aabb,first + h,packet[h/SR_SIMD_WIDTH]);
+	CullPacket(planes,planePacket,packet,lastPlane ? lastPlane + first : NULL,ValidMask(aabb.mNumBox,first),insideMask,outsideMask);
+}
+
+static void CullOBBPacket(const SrPlaneSet& planes,const tPlanePacket* planePacket,const SrOBBox3DSoA& obb,int first,int* lastPlane,int& insideMask,int& outsideMask)
+{
+	tOBBPacket packet[PACKET_WIDTH/SR_SIMD_WIDTH];
+	int h;
+	for( h=0 ; h<PACKET_WIDTH ; h+=SR_SIMD_WIDTH )
+		LoadPacket(obb,first + h,packet[h/SR_SIMD_WIDTH]);
+	CullPacket(planes,planePacket,packet,lastPlane ? lastPlane + first : NULL,ValidMask(obb.mNumBox,first),insideMask,outsideMask);
+}
+
+void PlaneSetCullAABB_Packet(const SrPlaneSet& planes,const SrAABBox3DSoA& aabb,int first,int* lastPlane,int& insideMask,int& outsideMask)
+{
+	ASSERT(first>=0 && first<aabb.mNumBox);
+	tPlanePacket planePacket[SR_CULL_MAX_PLANE];
+	SplatPlanes(planes,planePacket);
+	CullAABBPacket(planes,planePacket,aabb,first,lastPlane,insideMask,outsideMask);
+}
+
+void PlaneSetCullOBB_Packet(const SrPlaneSet& planes,const SrOBBox3DSoA& obb,int first,int* lastPlane,int& insideMask,int& outsideMask)
+{
+	ASSERT(first>=0 && first<obb.mNumBox);
+	tPlanePacket planePacket[SR_CULL_MAX_PLANE];
+	SplatPlanes(planes,planePacket);
+	CullOBBPacket(planes,planePacket,obb,first,lastPlane,insideMask,outsideMask);
+}
+
+/*
+\brief	һݰдÿΧеĹϵز͹İΧеĸ
+*/
+static int WriteStatus(int first,int numBox,int insideMask,int outsideMask,unsigned char* status)
+{
+	int lane , count = 0;
+	for( lane=0 ; lane<PACKET_WIDTH && first + lane<numBox ; lane++ )
+	{
+		if( outsideMask & (1<<lane) )
+			status[first + lane] = SR_CULL_OUTSIDE;
+		else
+		{
+			status[first + lane] = (insideMask & (1<<lane)) ? SR_CULL_INSIDE : SR_CULL_INTERSECTING;
+			count ++;
+		}
+	}
+	return count;
+}
+
+int PlaneSetCullAABB_Batch(const SrPlaneSet& planes,const SrAABBox3DSoA& aabb,unsigned char* status,int* lastPlane)
+{
+	tPlanePacket planePacket[SR_CULL_MAX_PLANE];
+	SplatPlanes(planes,planePacket);
+	int numPacket = (aabb.mNumBox + PACKET_WIDTH - 1) / PACKET_WIDTH;
+	int i , inside , outside , count = 0;
+#pragma omp parallel for schedule(static) private(inside,outside) reduction(+:count)
+	for( i=0 ; i<numPacket ; i++ )
+	{
+		CullAABBPacket(planes,planePacket,aabb,i*PACKET_WIDTH,lastPlane,inside,outside);
+		count += WriteStatus(i*PACKET_WIDTH,aabb.mNumBox,inside,outside,status);
+	}
+	return count;
+}
+
+int PlaneSetCullOBB_Batch(const SrPlaneSet& planes,const SrOBBox3DSoA& obb,unsigned char* status,int* lastPlane)
+{
+	tPlanePacket planePacket[SR_CULL_MAX_PLANE];
+	SplatPlanes(planes,planePacket);
+	int numPacket = (obb.mNumBox + PACKET_WIDTH - 1) / PACKET_WIDTH;
+	int i , inside , outside , count = 0;
+#pragma omp parallel for schedule(static) private(inside,outside) reduction(+:count)
+	for( i=0 ; i<numPacket ; i++ )
+	{
+		CullOBBPacket(planes,planePacket,obb,i*PACKET_WIDTH,lastPlane,inside,outside);
+		count += WriteStatus(i*PACKET_WIDTH,obb.mNumBox,inside,outside,status);
+	}
+	return count;
+}
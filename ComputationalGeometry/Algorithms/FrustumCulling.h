@@ -0,0 +1,152 @@
+/************************************************************************
+\link	www.twinklingstar.cn
+\author Twinkling Star
+\date	2026/10/19
+****************************************************************************/
+#ifndef SR_ALGORITHMS_FRUSTUM_CULLING_H_
+#define SR_ALGORITHMS_FRUSTUM_CULLING_H_
+
+/** \addtogroup algorithms
+  @{
+*/
+#include "PlaneHitTestBV.h"
+#include "OBBOverlapOBBPacket.h"
+
+/*
+	ƽ漯ƽÿƽӦƽеһλ
+*/
+#define SR_CULL_MAX_PLANE		32
+/*
+	һݰаİΧеĸSR_OBB_PACKET_WIDTHͬ
+*/
+#define SR_CULL_PACKET_WIDTH	SR_OBB_PACKET_WIDTH
+
+/*
+	Χƽ漯Χ͹Ĺϵ
+*/
+#define SR_CULL_OUTSIDE			0x01
+#define SR_CULL_INSIDE			0x02
+#define SR_CULL_INTERSECTING	0x03
+
+/**
+\brief A convex volume bounded by a set of planes, such as a view frustum or a k-DOP.
+
+The volume is the intersection of the back half spaces of the planes, that is,
+the normals of the planes point out of the volume. The planes are stored as a
+structure of arrays, mNormal[c][i] is the c-th coordinate of the normal of the
+i-th plane.
+*/
+class SrPlaneSet
+{
+public:
+	SrPlaneSet()
+	{
+		mNumPlane = 0;
+	}
+	SrPlaneSet(const SrPlane3D* plane,int numPlane)
+	{
+		set(plane,numPlane);
+	}
+	void	set(const SrPlane3D* plane,int numPlane)
+	{
+		ASSERT(numPlane>=0 && numPlane<=SR_CULL_MAX_PLANE);
+		int i;
+		for( i=0 ; i<numPlane ; i++ )
+		{
+			mNormal[0][i] = plane[i].mNormal.x;
+			mNormal[1][i] = plane[i].mNormal.y;
+			mNormal[2][i] = plane[i].mNormal.z;
+			mD[i]		  = plane[i].mD;
+		}
+		mNumPlane = numPlane;
+	}
+	/**
+	\brief The plane mask with a bit set for every plane.
+	*/
+	SrU32	fullMask() const
+	{
+		return mNumPlane==32 ? 0xffffffff : ((SrU32)1<<mNumPlane) - 1;
+	}
+
+public:
+	SrReal	mNormal[3][SR_CULL_MAX_PLANE];
+	SrReal	mD[SR_CULL_MAX_PLANE];
+	int		mNumPlane;
+};
+
+/**
+\brief 3D axis-aligned bounding boxes stored as a structure of arrays (SoA).
+
+mMin[c][i] and mMax[c][i] are the c-th coordinates of the minimum and maximum
+corners of the i-th box. The arrays are padded with zeros to a multiple of
+SR_CULL_PACKET_WIDTH, so a packet can always be loaded as a whole.
+*/
+class SrAABBox3DSoA
+{
+public:
+	SrAABBox3DSoA();
+	SrAABBox3DSoA(int numBox);
+	~SrAABBox3DSoA();
+	/**
+	\brief Allocate the arrays for numBox boxes, the old data is released.
+	*/
+	void				allocate(int numBox);
+	void				setBox(int i,const SrAABBox3D& aabb);
+	const SrAABBox3D	getBox(int i) const;
+
+public:
+	SrReal*		mMin[3];
+	SrReal*		mMax[3];
+	int			mNumBox;
+
+private:
+	SrAABBox3DSoA(const SrAABBox3DSoA&);
+	SrAABBox3DSoA& operator=(const SrAABBox3DSoA&);
+
+	SrReal*		mBuffer;
+};
+
+/*
+\brief	жAABBƽ漯Χ͹ĹϵֻplaneMaskλƽ档ÿƽж
+		Plane3DHitTestAABB_DistanceMethodͬAABBĳƽռ͹⣬
+		ƽĸռ͹ڣ͹ཻ
+\param[in,out]	planeMask	AABB为ռϵƽӦλڲΰΧʱ
+							ӽڵ㲻ҪټЩƽ棬planeMaskΪ0ʱ͹ڡ
+\return	SR_CULL_OUTSIDE			AABB͹
+		SR_CULL_INSIDE			AABB͹
+		SR_CULL_INTERSECTING	AABB͹ཻ
+*/
+int PlaneSetCullAABB(const SrPlaneSet& planes,const SrAABBox3D& aabb,SrU32& planeMask);
+/*
+\brief	жOBBƽ漯Χ͹ĹϵÿƽжPlane3DHitTestOBB_DistanceMethodͬͬPlaneSetCullAABB
+*/
+int PlaneSetCullOBB(const SrPlaneSet& planes,const SrOBBox3D& obb,SrU32& planeMask);
+
+/*
+\brief	SSE2Ĵжaabb[first],...,aabb[first + SR_CULL_PACKET_WIDTH - 1]͹Ĺϵ
+		ÿAABBĽPlaneSetCullAABBȫͬ
+\param[in,out]	lastPlane	ΪNULLlastPlane[i]¼һΰѵiΧųƽ棬
+							ȼƽ棬֡ʱΧֻҪһƽ档
+\param[out]	insideMask		iλΪ1ʾaabb[first + i]͹
+\param[out]	outsideMask		iλΪ1ʾaabb[first + i]͹⣬Чλʾཻ
+*/
+void PlaneSetCullAABB_Packet(const SrPlaneSet& planes,const SrAABBox3DSoA& aabb,int first,int* lastPlane,int& insideMask,int& outsideMask);
+/*
+\brief	SSE2ĴжһݰеOBB͹ĹϵͬPlaneSetCullAABB_Packet
+*/
+void PlaneSetCullOBB_Packet(const SrPlaneSet& planes,const SrOBBox3DSoA& obb,int first,int* lastPlane,int& insideMask,int& outsideMask);
+
+/*
+\brief	̵߳ݰжAABB͹Ĺϵ
+\param[out]		status		ÿAABBĹϵSR_CULL_OUTSIDESR_CULL_INSIDESR_CULL_INTERSECTINGҪaabb.mNumBoxԪ
+\param[in,out]	lastPlane	ÿAABBһαųʱƽ棬ΪNULLʼʱȫΪ0
+\return	͹AABBĸ
+*/
+int PlaneSetCullAABB_Batch(const SrPlaneSet& planes,const SrAABBox3DSoA& aabb,unsigned char* status,int* lastPlane = NULL);
+/*
+\brief	̵߳ݰжOBB͹ĹϵͬPlaneSetCullAABB_Batch
+*/
+int PlaneSetCullOBB_Batch(const SrPlaneSet& planes,const SrOBBox3DSoA& obb,unsigned char* status,int* lastPlane = NULL);
+
+/** @} */
+#endif
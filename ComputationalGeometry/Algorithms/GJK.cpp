@@ -0,0 +1,875 @@
+/************************************************************************
+\link	www.twinklingstar.cn
+\author Twinkling Star
+\date	2026/10/19
+****************************************************************************/
+/************************************************************************
+\description	GJK㷨͹֮ľ룬EPA㷨ǵĴ͸ȡ͹
+				ֻ֧ͨźʣÿһֻҪѯһ֧ŵ㣬ñ
+				ȫ㡣εͬʱ͹ϵ㡣
+****************************************************************************/
+#include "GJK.h"
+#include <algorithm>
+
+/*
+\brief	ԭ㵽߶ab㣬lambdaʾ
+*/
+template<class Vector>
+static void ClosestPointSegment(const Vector& a,const Vector& b,SrReal* lambda)
+{
+	Vector ab = b - a;
+	SrReal t = -a.dot(ab) , denom = ab.dot(ab);
+	if( t<=0 )
+	{
+		lambda[0] = 1;
+		lambda[1] = 0;
+	}
+	else if( t>=denom )
+	{
+		lambda[0] = 0;
+		lambda[1] = 1;
+	}
+	else
+	{
+		lambda[1] = t / denom;
+		lambda[0] = 1 - lambda[1];
+	}
+}
+
+/*
+\brief	ԭ㵽abc㣬lambdaʾVoronoiжϡ
+		˻߶ʱȡĵ㡣
+*/
+template<class Vector>
+static void ClosestPointTriangle(const Vector& a,const Vector& b,const Vector& c,SrReal* lambda)
+{
+	Vector ab = b - a , ac = c - a;
+	SrReal d1 = -ab.dot(a) , d2 = -ac.dot(a);
+	lambda[0] = lambda[1] = lambda[2] = 0;
+	if( d1<=0 && d2<=0 )
+	{
+		lambda[0] = 1;
+		return ;
+	}
+	SrReal d3 = -ab.dot(b) , d4 = -ac.dot(b);
+	if( d3>=0 && d4<=d3 )
+	{
+		lambda[1] = 1;
+		return ;
+	}
+	SrReal vc = d1*d4 - d3*d2;
+	if( vc<=0 && d1>=0 && d3<=0 )
+	{
+		lambda[1] = d1 / (d1 - d3);
+		lambda[0] = 1 - lambda[1];
+		return ;
+	}
+	SrReal d5 = -ab.dot(c) , d6 = -ac.dot(c);
+	if( d6>=0 && d5<=d6 )
+	{
+		lambda[2] = 1;
+		return ;
+	}
+	SrReal vb = d5*d2 - d1*d6;
+	if( vb<=0 && d2>=0 && d6<=0 )
+	{
+		lambda[2] = d2 / (d2 - d6);
+		lambda[0] = 1 - lambda[2];
+		return ;
+	}
+	SrReal va = d3*d6 - d5*d4;
+	if( va<=0 && d4 - d3>=0 && d5 - d6>=0 )
+	{
+		lambda[2] = (d4 - d3) / ((d4 - d3) + (d5 - d6));
+		lambda[1] = 1 - lambda[2];
+		return ;
+	}
+	//va + vb + vc|ab x ac|^2
+	SrReal denom = va + vb + vc;
+	if( denom<=SR_EPS*ab.magnitudeSquared()*ac.magnitudeSquared() )
+	{
+		const Vector* point[3] = {&a,&b,&c};
+		SrReal edgeLambda[2] , dist , minDist = SR_MAX_F64;
+		int i , j;
+		for( i=0 ; i<3 ; i++ )
+		{
+			j = (i + 1) % 3;
+			ClosestPointSegment(*point[i],*point[j],edgeLambda);
+			dist = ((*point[i])*edgeLambda[0] + (*point[j])*edgeLambda[1]).magnitudeSquared();
+			if( dist<minDist )
+			{
+				minDist = dist;
+				lambda[0] = lambda[1] = lambda[2] = 0;
+				lambda[i] = edgeLambda[0];
+				lambda[j] = edgeLambda[1];
+			}
+		}
+		return ;
+	}
+	lambda[1] = vb / denom;
+	lambda[2] = vc / denom;
+	lambda[0] = 1 - lambda[1] - lambda[2];
+}
+
+/*
+\brief	ȥΪ0Ķ㣬ʣµĶ
+*/
+template<class Vertex>
+static int CompactSimplex(Vertex* simplex,SrReal* lambda,int numVertex)
+{
+	int i , n = 0;
+	for( i=0 ; i<numVertex ; i++ )
+	{
+		if( lambda[i]>0 )
+		{
+			simplex[n] = simplex[i];
+			lambda[n] = lambda[i];
+			n ++;
+		}
+	}
+	return n;
+}
+
+SrPolygonShape2D::SrPolygonShape2D(const SrPoint2D* vertex,int numVertex)
+{
+	mVertex = vertex;
+	mNumVertex = numVertex;
+}
+
+SrPoint2D SrPolygonShape2D::support(const SrVector2D& direction) const
+{
+	int i , best = 0;
+	SrReal dot , maxDot = mVertex[0].dot(direction);
+	for( i=1 ; i<mNumVertex ; i++ )
+	{
+		dot = mVertex[i].dot(direction);
+		if( dot>maxDot )
+		{
+			maxDot = dot;
+			best = i;
+		}
+	}
+	return mVertex[best];
+}
+
+SrHullShape3D::SrHullShape3D(const tHull* hull)
+{
+	mHull = hull;
+	mExtremePoint = NULL;
+	mLastVertex = 0;
+}
+
+SrHullShape3D::SrHullShape3D(const SrHullExtremePoint* extremePoint)
+{
+	mHull = extremePoint->mHull;
+	mExtremePoint = extremePoint;
+	mLastVertex = 0;
+}
+
+SrPoint3D SrHullShape3D::support(const SrVector3D& direction) const
+{
+	if( mExtremePoint )
+	{
+		mLastVertex = mExtremePoint->extremeVertex(direction,mLastVertex);
+		return mHull->mVertes[mLastVertex];
+	}
+	int i , best = 0;
+	SrReal dot , maxDot = mHull->mVertes[0].dot(direction);
+	for( i=1 ; i<mHull->mNumVertes ; i++ )
+	{
+		dot = mHull->mVertes[i].dot(direction);
+		if( dot>maxDot )
+		{
+			maxDot = dot;
+			best = i;
+		}
+	}
+	return mHull->mVertes[best];
+}
+
+SrOBBShape3D::SrOBBShape3D(const SrOBBox3D& obb)
+{
+	mBox = obb;
+}
+
+SrPoint3D SrOBBShape3D::support(const SrVector3D& direction) const
+{
+	SrPoint3D p = mBox.mCenter;
+	int i;
+	for( i=0 ; i<3 ; i++ )
+	{
+		if( mBox.mAxis[i].dot(direction)>=0 )
+			p += mBox.mAxis[i]*mBox.mHalfLength[i];
+		else
+			p -= mBox.mAxis[i]*mBox.mHalfLength[i];
+	}
+	return p;
+}
+
+SrSphereShape3D::SrSphereShape3D(const SrSphere3D& sphere)
+{
+	mCenter = sphere.mCenter;
+	mMargin = sphere.mRadius;
+}
+
+SrPoint3D SrSphereShape3D::support(const SrVector3D& /*direction*/) const
+{
+	return mCenter;
+}
+
+SrTriangleShape3D::SrTriangleShape3D(const SrTriangle3D& triangle)
+{
+	mTriangle = triangle;
+}
+
+SrPoint3D SrTriangleShape3D::support(const SrVector3D& direction) const
+{
+	SrReal dot0 = mTriangle.mPoint[0].dot(direction);
+	SrReal dot1 = mTriangle.mPoint[1].dot(direction);
+	SrReal dot2 = mTriangle.mPoint[2].dot(direction);
+	if( dot0>=dot1 && dot0>=dot2 )
+		return mTriangle.mPoint[0];
+	return dot1>=dot2 ? mTriangle.mPoint[1] : mTriangle.mPoint[2];
+}
+
+/************************************************************************
+								ά
+****************************************************************************/
+SrGJK2D::SrGJK2D()
+{
+	mShapeA = mShapeB = NULL;
+	mNumSupport = 0;
+	mNumSimplex = 0;
+}
+
+void SrGJK2D::makeVertex(const SrVector2D& direction,tVertex& vertex)
+{
+	vertex.mA = mShapeA->support(direction);
+	vertex.mB = mShapeB->support(-direction);
+	vertex.mW = vertex.mA - vertex.mB;
+	vertex.mDirection = direction;
+	mNumSupport ++;
+}
+
+/*
+\brief	󵥴ԭĵvֻڵĶ㡣
+\return	ԭڵʱfalse
+*/
+bool SrGJK2D::solveSimplex(SrVector2D& v)
+{
+	if( mNumSimplex==1 )
+		mLambda[0] = 1;
+	else if( mNumSimplex==2 )
+		ClosestPointSegment(mSimplex[0].mW,mSimplex[1].mW,mLambda);
+	else
+		ClosestPointTriangle(mSimplex[0].mW,mSimplex[1].mW,mSimplex[2].mW,mLambda);
+	mNumSimplex = CompactSimplex(mSimplex,mLambda,mNumSimplex);
+	if( mNumSimplex==3 )
+		return false;
+	int i;
+	v = SrVector2D(0,0);
+	for( i=0 ; i<mNumSimplex ; i++ )
+		v += mSimplex[i].mW*mLambda[i];
+	return true;
+}
+
+/*
+\brief	ڵϼdirection֧ŵ㣬֧ŵѾڵʱfalse
+*/
+bool SrGJK2D::addSimplexVertex(const SrVector2D& direction)
+{
+	tVertex vertex;
+	makeVertex(direction,vertex);
+	int i;
+	for( i=0 ; i<mNumSimplex ; i++ )
+	{
+		if( vertex.mW==mSimplex[i].mW )
+			return false;
+	}
+	mSimplex[mNumSimplex ++] = vertex;
+	return true;
+}
+
+/*
+\brief	GJKѭÿһ-vA - B֧ŵwwʹvԵرʱ
+\return	͹ཻʱtrue
+*/
+bool SrGJK2D::runGJK(SrGJKCache2D* cache,SrVector2D& v)
+{
+	int i;
+	bool isIntersect = false;
+	mNumSupport = 0;
+	mNumSimplex = 0;
+	if( cache && cache->mNumVertex>0 )
+	{
+		for( i=0 ; i<cache->mNumVertex ; i++ )
+			addSimplexVertex(cache->mDirection[i]);
+	}
+	else
+	{
+		addSimplexVertex(SrVector2D(1,0));
+	}
+	SrReal maxSquare = 0 , vSquare;
+	for( i=0 ; i<mNumSimplex ; i++ )
+		maxSquare = std::max(maxSquare,mSimplex[i].mW.magnitudeSquared());
+	if( !solveSimplex(v) )
+		isIntersect = true;
+	for( i=0 ; !isIntersect && i<SR_GJK_MAX_ITERATION ; i++ )
+	{
+		vSquare = v.magnitudeSquared();
+		if( vSquare<=SR_EPS*maxSquare )
+		{
+			isIntersect = true;
+			break;
+		}
+		if( !addSimplexVertex(-v) )
+			break;
+		const SrPoint2D& w = mSimplex[mNumSimplex - 1].mW;
+		if( vSquare - v.dot(w)<=SR_GJK_TOLERANCE*vSquare )
+		{
+			mNumSimplex --;
+			break;
+		}
+		maxSquare = std::max(maxSquare,w.magnitudeSquared());
+		if( !solveSimplex(v) )
+			isIntersect = true;
+	}
+	if( cache )
+	{
+		cache->mNumVertex = mNumSimplex;
+		for( i=0 ; i<mNumSimplex ; i++ )
+			cache->mDirection[i] = mSimplex[i].mDirection;
+	}
+	return isIntersect;
+}
+
+void SrGJK2D::setSeparated(const SrVector2D& v,tGJKResult2D& result)
+{
+	int i;
+	result.mIsIntersect = false;
+	result.mDistance = v.magnitude();
+	result.mNormal = v*(-1 / result.mDistance);
+	result.mPointA = result.mPointB = SrPoint2D(0,0);
+	for( i=0 ; i<mNumSimplex ; i++ )
+	{
+		result.mPointA += mSimplex[i].mA*mLambda[i];
+		result.mPointB += mSimplex[i].mB*mLambda[i];
+	}
+	result.mNumSupport = mNumSupport;
+}
+
+bool SrGJK2D::distance(const SrConvexShape2D& shapeA,const SrConvexShape2D& shapeB,tGJKResult2D& result,SrGJKCache2D* cache)
+{
+	SrVector2D v;
+	mShapeA = &shapeA;
+	mShapeB = &shapeB;
+	if( runGJK(cache,v) )
+	{
+		result.mIsIntersect = true;
+		result.mNumSupport = mNumSupport;
+		return true;
+	}
+	setSeparated(v,result);
+	return false;
+}
+
+bool SrGJK2D::penetration(const SrConvexShape2D& shapeA,const SrConvexShape2D& shapeB,tGJKResult2D& result,SrGJKCache2D* cache)
+{
+	SrVector2D v;
+	mShapeA = &shapeA;
+	mShapeB = &shapeB;
+	if( !runGJK(cache,v) )
+	{
+		setSeparated(v,result);
+		return false;
+	}
+	runEPA(result);
+	return true;
+}
+
+/*
+\brief	EPA㷨ѵųʱ͹Σÿԭıߵ֧ⷨŵ㣬
+		뵽Уֱ߾A - Bı߽ϡ
+*/
+void SrGJK2D::runEPA(tGJKResult2D& result)
+{
+	int i , j , k , closest , numIteration;
+	SrVector2D normal , edge;
+	SrReal dist , minDist;
+	static const SrVector2D axis[4] = {SrVector2D(1,0),SrVector2D(-1,0),SrVector2D(0,1),SrVector2D(0,-1)};
+
+	result.mIsIntersect = true;
+	//ųΣA - B˻߶ʱ͸Ϊ0
+	for( i=0 ; mNumSimplex==1 && i<4 ; i++ )
+		addSimplexVertex(axis[i]);
+	if( mNumSimplex==2 )
+	{
+		edge = mSimplex[1].mW - mSimplex[0].mW;
+		normal = SrVector2D(-edge.y,edge.x);
+		if( !addSimplexVertex(normal) || ANGLE_EQUAL_ZERO(edge.cross(mSimplex[2].mW - mSimplex[0].mW),edge.magnitudeSquared(),(mSimplex[2].mW - mSimplex[0].mW).magnitudeSquared()) )
+		{
+			mNumSimplex = 2;
+			if( !addSimplexVertex(-normal) || ANGLE_EQUAL_ZERO(edge.cross(mSimplex[2].mW - mSimplex[0].mW),edge.magnitudeSquared(),(mSimplex[2].mW - mSimplex[0].mW).magnitudeSquared()) )
+			{
+				mNumSimplex = 2;
+				ClosestPointSegment(mSimplex[0].mW,mSimplex[1].mW,mLambda);
+				normal.normalize();
+				result.mDistance = 0;
+				result.mNormal = normal;
+				result.mPointA = mSimplex[0].mA*mLambda[0] + mSimplex[1].mA*mLambda[1];
+				result.mPointB = mSimplex[0].mB*mLambda[0] + mSimplex[1].mB*mLambda[1];
+				result.mNumSupport = mNumSupport;
+				return ;
+			}
+		}
+	}
+	mPolygon.assign(mSimplex,mSimplex + 3);
+	if( (mPolygon[1].mW - mPolygon[0].mW).cross(mPolygon[2].mW - mPolygon[0].mW)<0 )
+		std::swap(mPolygon[1],mPolygon[2]);
+
+	for( numIteration=0 ; ; numIteration++ )
+	{
+		closest = 0;
+		minDist = SR_MAX_F64;
+		for( i=0 ; i<(int)mPolygon.size() ; i++ )
+		{
+			j = (i + 1) % (int)mPolygon.size();
+			edge = mPolygon[j].mW - mPolygon[i].mW;
+			normal = SrVector2D(edge.y,-edge.x);
+			dist = normal.dot(mPolygon[i].mW) / normal.magnitude();
+			if( dist<minDist )
+			{
+				minDist = dist;
+				closest = i;
+			}
+		}
+		i = closest;
+		j = (i + 1) % (int)mPolygon.size();
+		edge = mPolygon[j].mW - mPolygon[i].mW;
+		normal = SrVector2D(edge.y,-edge.x);
+		normal.normalize();
+		if( numIteration==SR_EPA_MAX_ITERATION )
+			break;
+		tVertex vertex;
+		makeVertex(normal,vertex);
+		if( vertex.mW.dot(normal) - minDist<=SR_GJK_TOLERANCE*vertex.mW.magnitude() )
+			break;
+		for( k=0 ; k<(int)mPolygon.size() ; k++ )
+		{
+			if( mPolygon[k].mW==vertex.mW )
+				break;
+		}
+		if( k<(int)mPolygon.size() )
+			break;
+		mPolygon.insert(mPolygon.begin() + j,vertex);
+	}
+	//ԭıϵͶӰ
+	ClosestPointSegment(mPolygon[i].mW,mPolygon[j].mW,mLambda);
+	if( minDist<0 )
+		minDist = 0;
+	result.mDistance = -minDist;
+	result.mNormal = normal;
+	result.mPointA = mPolygon[i].mA*mLambda[0] + mPolygon[j].mA*mLambda[1];
+	result.mPointB = mPolygon[i].mB*mLambda[0] + mPolygon[j].mB*mLambda[1];
+	result.mNumSupport = mNumSupport;
+}
+
+/************************************************************************
+								ά
+****************************************************************************/
+SrGJK3D::SrGJK3D()
+{
+	mShapeA = mShapeB = NULL;
+	mNumSupport = 0;
+	mNumSimplex = 0;
+}
+
+/*
+\brief	A - Bdirectionϵ֧ŵ㣬withMarginΪfalseʱֻú״
+*/
+void SrGJK3D::makeVertex(const SrVector3D& direction,bool withMargin,tVertex& vertex)
+{
+	vertex.mA = mShapeA->support(direction);
+	vertex.mB = mShapeB->support(-direction);
+	if( withMargin && (mShapeA->mMargin>0 || mShapeB->mMargin>0) )
+	{
+		SrVector3D unit = direction;
+		unit.normalize();
+		vertex.mA += unit*mShapeA->mMargin;
+		vertex.mB -= unit*mShapeB->mMargin;
+	}
+	vertex.mW = vertex.mA - vertex.mB;
+	vertex.mDirection = direction;
+	mNumSupport ++;
+}
+
+/*
+\brief	SrGJK2D::solveSimplex()ͬԭ㲻ڵÿ㣬ȡһ
+		˻ʱе涼Ƚϡ
+*/
+bool SrGJK3D::solveSimplex(SrVector3D& v)
+{
+	static const int face[4][4] = {{0,1,2,3},{0,3,1,2},{0,2,3,1},{1,3,2,0}};
+	int i , j;
+	if( mNumSimplex==1 )
+		mLambda[0] = 1;
+	else if( mNumSimplex==2 )
+		ClosestPointSegment(mSimplex[0].mW,mSimplex[1].mW,mLambda);
+	else if( mNumSimplex==3 )
+		ClosestPointTriangle(mSimplex[0].mW,mSimplex[1].mW,mSimplex[2].mW,mLambda);
+	else
+	{
+		SrReal faceLambda[3] , dist , minDist = SR_MAX_F64;
+		bool isOutside = false;
+		for( i=0 ; i<4 ; i++ )
+		{
+			const SrPoint3D& p0 = mSimplex[face[i][0]].mW;
+			SrVector3D normal = (mSimplex[face[i][1]].mW - p0).cross(mSimplex[face[i][2]].mW - p0);
+			SrVector3D opposite = mSimplex[face[i][3]].mW - p0;
+			SrReal signOrigin = -normal.dot(p0) , signOpposite = normal.dot(opposite);
+			if( signOrigin*signOpposite>0 && !ANGLE_EQUAL_ZERO(signOpposite,normal.magnitudeSquared(),opposite.magnitudeSquared()) )
+				continue;
+			isOutside = true;
+			ClosestPointTriangle(p0,mSimplex[face[i][1]].mW,mSimplex[face[i][2]].mW,faceLambda);
+			SrVector3D p = p0*faceLambda[0] + mSimplex[face[i][1]].mW*faceLambda[1] + mSimplex[face[i][2]].mW*faceLambda[2];
+			dist = p.magnitudeSquared();
+			if( dist<minDist )
+			{
+				minDist = dist;
+				for( j=0 ; j<3 ; j++ )
+					mLambda[face[i][j]] = faceLambda[j];
+				mLambda[face[i][3]] = 0;
+			}
+		}
+		if( !isOutside )
+		{
+			//ԭڣԭ湹ɵı
+			SrReal volume = (mSimplex[1].mW - mSimplex[0].mW).cross(mSimplex[2].mW - mSimplex[0].mW).dot(mSimplex[3].mW - mSimplex[0].mW);
+			for( i=0 ; i<4 ; i++ )
+			{
+				const SrPoint3D& p0 = mSimplex[face[i][0]].mW;
+				SrVector3D normal = (mSimplex[face[i][1]].mW - p0).cross(mSimplex[face[i][2]].mW - p0);
+				mLambda[face[i][3]] = fabs(normal.dot(p0) / volume);
+			}
+			return false;
+		}
+	}
+	mNumSimplex = CompactSimplex(mSimplex,mLambda,mNumSimplex);
+	v = SrVector3D(0,0,0);
+	for( i=0 ; i<mNumSimplex ; i++ )
+		v += mSimplex[i].mW*mLambda[i];
+	return true;
+}
+
+bool SrGJK3D::addSimplexVertex(const SrVector3D& direction)
+{
+	tVertex vertex;
+	makeVertex(direction,false,vertex);
+	int i;
+	for( i=0 ; i<mNumSimplex ; i++ )
+	{
+		if( vertex.mW==mSimplex[i].mW )
+			return false;
+	}
+	mSimplex[mNumSimplex ++] = vertex;
+	return true;
+}
+
+/*
+\brief	SrGJK2D::runGJK()ֻͬ͹ĺ״
+*/
+bool SrGJK3D::runGJK(SrGJKCache3D* cache,SrVector3D& v)
+{
+	int i;
+	bool isIntersect = false;
+	mNumSupport = 0;
+	mNumSimplex = 0;
+	if( cache && cache->mNumVertex>0 )
+	{
+		for( i=0 ; i<cache->mNumVertex ; i++ )
+			addSimplexVertex(cache->mDirection[i]);
+	}
+	else
+	{
+		addSimplexVertex(SrVector3D(1,0,0));
+	}
+	SrReal maxSquare = 0 , vSquare;
+	for( i=0 ; i<mNumSimplex ; i++ )
+		maxSquare = std::max(maxSquare,mSimplex[i].mW.magnitudeSquared());
+	if( !solveSimplex(v) )
+		isIntersect = true;
+	for( i=0 ; !isIntersect && i<SR_GJK_MAX_ITERATION ; i++ )
+	{
+		vSquare = v.magnitudeSquared();
+		if( vSquare<=SR_EPS*maxSquare )
+		{
+			isIntersect = true;
+			break;
+		}
+		if( !addSimplexVertex(-v) )
+			break;
+		const SrPoint3D& w = mSimplex[mNumSimplex - 1].mW;
+		if( vSquare - v.dot(w)<=SR_GJK_TOLERANCE*vSquare )
+		{
+			mNumSimplex --;
+			break;
+		}
+		maxSquare = std::max(maxSquare,w.magnitudeSquared());
+		if( !solveSimplex(v) )
+			isIntersect = true;
+	}
+	if( cache )
+	{
+		cache->mNumVertex = mNumSimplex;
+		for( i=0 ; i<mNumSimplex ; i++ )
+			cache->mDirection[i] = mSimplex[i].mDirection;
+	}
+	return isIntersect;
+}
+
+/*
+\brief	״ʱĽطƶ뾶mMargin벻0ʱ͹ཻ
+*/
+void SrGJK3D::setSeparated(const SrVector3D& v,tGJKResult3D& result)
+{
+	int i;
+	SrReal coreDistance = v.magnitude();
+	result.mNormal = v*(-1 / coreDistance);
+	result.mPointA = result.mPointB = SrPoint3D(0,0,0);
+	for( i=0 ; i<mNumSimplex ; i++ )
+	{
+		result.mPointA += mSimplex[i].mA*mLambda[i];
+		result.mPointB += mSimplex[i].mB*mLambda[i];
+	}
+	result.mPointA += result.mNormal*mShapeA->mMargin;
+	result.mPointB -= result.mNormal*mShapeB->mMargin;
+	result.mDistance = coreDistance - mShapeA->mMargin - mShapeB->mMargin;
+	result.mIsIntersect = result.mDistance<=0;
+	result.mNumSupport = mNumSupport;
+}
+
+bool SrGJK3D::distance(const SrConvexShape3D& shapeA,const SrConvexShape3D& shapeB,tGJKResult3D& result,SrGJKCache3D* cache)
+{
+	SrVector3D v;
+	mShapeA = &shapeA;
+	mShapeB = &shapeB;
+	if( runGJK(cache,v) )
+	{
+		result.mIsIntersect = true;
+		result.mNumSupport = mNumSupport;
+		return true;
+	}
+	setSeparated(v,result);
+	return result.mIsIntersect;
+}
+
+bool SrGJK3D::penetration(const SrConvexShape3D& shapeA,const SrConvexShape3D& shapeB,tGJKResult3D& result,SrGJKCache3D* cache)
+{
+	SrVector3D v;
+	mShapeA = &shapeA;
+	mShapeB = &shapeB;
+	if( !runGJK(cache,v) )
+	{
+		setSeparated(v,result);
+		return result.mIsIntersect;
+	}
+	runEPA(result);
+	return true;
+}
+
+/*
+\brief	GJKʱԭĵų壬A - Bƽʱfalse
+*/
+bool SrGJK3D::blowUpSimplex()
+{
+	static const SrVector3D axis[6] = {SrVector3D(1,0,0),SrVector3D(-1,0,0),SrVector3D(0,1,0),
+									   SrVector3D(0,-1,0),SrVector3D(0,0,1),SrVector3D(0,0,-1)};
+	int i;
+	for( i=0 ; mNumSimplex==1 && i<6 ; i++ )
+		addSimplexVertex(axis[i]);
+	if( mNumSimplex==2 )
+	{
+		SrVector3D edge = mSimplex[1].mW - mSimplex[0].mW;
+		//edgeֱ
+		int minAxis = fabs(edge.x)<fabs(edge.y) ? (fabs(edge.x)<fabs(edge.z) ? 0 : 4) : (fabs(edge.y)<fabs(edge.z) ? 2 : 4);
+		SrVector3D direction[4];
+		direction[0] = edge.cross(axis[minAxis]);
+		direction[1] = edge.cross(direction[0]);
+		direction[2] = -direction[0];
+		direction[3] = -direction[1];
+		for( i=0 ; mNumSimplex==2 && i<4 ; i++ )
+		{
+			if( addSimplexVertex(direction[i]) )
+			{
+				SrVector3D offset = mSimplex[2].mW - mSimplex[0].mW;
+				if( edge.cross(offset).magnitudeSquared()<=SR_EPS*SR_EPS*edge.magnitudeSquared()*offset.magnitudeSquared() )
+					mNumSimplex = 2;
+			}
+		}
+	}
+	if( mNumSimplex==3 )
+	{
+		SrVector3D normal = (mSimplex[1].mW - mSimplex[0].mW).cross(mSimplex[2].mW - mSimplex[0].mW);
+		for( i=0 ; mNumSimplex==3 && i<2 ; i++ )
+		{
+			if( addSimplexVertex(i==0 ? normal : -normal) )
+			{
+				SrVector3D offset = mSimplex[3].mW - mSimplex[0].mW;
+				if( ANGLE_EQUAL_ZERO(normal.dot(offset),normal.magnitudeSquared(),offset.magnitudeSquared()) )
+					mNumSimplex = 3;
+			}
+		}
+	}
+	return mNumSimplex==4;
+}
+
+/*
+\brief	һ棬㰴￴ʱ˳
+*/
+void SrGJK3D::addFace(int v0,int v1,int v2)
+{
+	tFace face;
+	face.mVertex[0] = v0;
+	face.mVertex[1] = v1;
+	face.mVertex[2] = v2;
+	face.mNormal = (mPolytope[v1].mW - mPolytope[v0].mW).cross(mPolytope[v2].mW - mPolytope[v0].mW);
+	face.mIsObsolete = false;
+	if( face.mNormal.normalize()>0 )
+		face.mDistance = face.mNormal.dot(mPolytope[v0].mW);
+	else
+		face.mDistance = SR_MAX_F64;
+	mFace.push_back(face);
+}
+
+/*
+\brief	EPA㷨ԭ֧ⷨŵ㣬ȥ֧ŵܿ棬ٰ֧ŵ
+		Щı߽磨ƽߣӳµ棬ֱA - Bı߽ϡ
+*/
+void SrGJK3D::runEPA(tGJKResult3D& result)
+{
+	static const int face[4][4] = {{0,1,2,3},{0,3,1,2},{0,2,3,1},{1,3,2,0}};
+	int i , j , k , closest = -1 , numIteration;
+	SrReal minDist = 0;
+
+	result.mIsIntersect = true;
+	if( !blowUpSimplex() )
+	{
+		//A - Bƽģķƶֿܷ
+		SrVector3D v;
+		solveSimplex(v);
+		result.mNormal = mNumSimplex==3 ? (mSimplex[1].mW - mSimplex[0].mW).cross(mSimplex[2].mW - mSimplex[0].mW) : SrVector3D(0,0,1);
+		result.mNormal.normalize();
+		result.mDistance = 0;
+		result.mPointA = result.mPointB = SrPoint3D(0,0,0);
+		for( i=0 ; i<mNumSimplex ; i++ )
+		{
+			result.mPointA += mSimplex[i].mA*mLambda[i];
+			result.mPointB += mSimplex[i].mB*mLambda[i];
+		}
+		result.mNumSupport = mNumSupport;
+		return ;
+	}
+	//泯⣬EPA֧ŵ͹İ뾶
+	mPolytope.assign(mSimplex,mSimplex + 4);
+	mFace.clear();
+	for( i=0 ; i<4 ; i++ )
+	{
+		const SrPoint3D& p0 = mPolytope[face[i][0]].mW;
+		SrVector3D normal = (mPolytope[face[i][1]].mW - p0).cross(mPolytope[face[i][2]].mW - p0);
+		if( normal.dot(mPolytope[face[i][3]].mW - p0)>0 )
+			addFace(face[i][0],face[i][2],face[i][1]);
+		else
+			addFace(face[i][0],face[i][1],face[i][2]);
+	}
+
+	for( numIteration=0 ; ; numIteration++ )
+	{
+		closest = -1;
+		minDist = SR_MAX_F64;
+		for( i=0 ; i<(int)mFace.size() ; i++ )
+		{
+			if( !mFace[i].mIsObsolete && mFace[i].mDistance<minDist )
+			{
+				minDist = mFace[i].mDistance;
+				closest = i;
+			}
+		}
+		if( numIteration==SR_EPA_MAX_ITERATION )
+			break;
+		tVertex vertex;
+		SrVector3D normal = mFace[closest].mNormal;
+		makeVertex(normal,true,vertex);
+		if( vertex.mW.dot(normal) - minDist<=SR_GJK_TOLERANCE*vertex.mW.magnitude() )
+			break;
+		for( k=0 ; k<(int)mPolytope.size() ; k++ )
+		{
+			if( mPolytope[k].mW==vertex.mW )
+				break;
+		}
+		if( k<(int)mPolytope.size() )
+			break;
+		mPolytope.push_back(vertex);
+		//ƽǱȥıУûбȥı
+		mHorizon.clear();
+		for( i=0 ; i<(int)mFace.size() ; i++ )
+		{
+			tFace& f = mFace[i];
+			if( f.mIsObsolete || (i!=closest && f.mNormal.dot(vertex.mW - mPolytope[f.mVertex[0]].mW)<=0) )
+				continue;
+			f.mIsObsolete = true;
+			for( j=0 ; j<3 ; j++ )
+			{
+				int v0 = f.mVertex[j] , v1 = f.mVertex[(j + 1) % 3];
+				for( k=0 ; k<(int)mHorizon.size() ; k+=2 )
+				{
+					if( mHorizon[k]==v1 && mHorizon[k + 1]==v0 )
+						break;
+				}
+				if( k<(int)mHorizon.size() )
+				{
+					mHorizon.erase(mHorizon.begin() + k,mHorizon.begin() + k + 2);
+				}
+				else
+				{
+					mHorizon.push_back(v0);
+					mHorizon.push_back(v1);
+				}
+			}
+		}
+		for( k=0 ; k<(int)mHorizon.size() ; k+=2 )
+			addFace(mHorizon[k],mHorizon[k + 1],(int)mPolytope.size() - 1);
+	}
+	//ԭϵͶӰļͬȡͶӰǸ
+	SrReal lambda[3] , faceLambda[3] , error , minError = SR_MAX_F64;
+	for( i=0 ; i<(int)mFace.size() ; i++ )
+	{
+		const tFace& f = mFace[i];
+		if( f.mIsObsolete || f.mDistance>minDist + SR_GJK_TOLERANCE*(1 + minDist) )
+			continue;
+		SrPoint3D p0 = mPolytope[f.mVertex[0]].mW - f.mNormal*f.mDistance;
+		SrPoint3D p1 = mPolytope[f.mVertex[1]].mW - f.mNormal*f.mDistance;
+		SrPoint3D p2 = mPolytope[f.mVertex[2]].mW - f.mNormal*f.mDistance;
+		ClosestPointTriangle(p0,p1,p2,faceLambda);
+		error = (p0*faceLambda[0] + p1*faceLambda[1] + p2*faceLambda[2]).magnitudeSquared();
+		if( error<minError )
+		{
+			minError = error;
+			closest = i;
+			for( j=0 ; j<3 ; j++ )
+				lambda[j] = faceLambda[j];
+		}
+	}
+	const tFace& f = mFace[closest];
+	minDist = f.mDistance;
+	if( minDist<0 )
+		minDist = 0;
+	result.mDistance = -minDist;
+	result.mNormal = f.mNormal;
+	result.mPointA = result.mPointB = SrPoint3D(0,0,0);
+	for( i=0 ; i<3 ; i++ )
+	{
+		result.mPointA += mPolytope[f.mVertex[i]].mA*lambda[i];
+		result.mPointB += mPolytope[f.mVertex[i]].mB*lambda[i];
+	}
+	result.mNumSupport = mNumSupport;
+}
@@ -0,0 +1,279 @@
+/************************************************************************
+\link	www.twinklingstar.cn
+\author Twinkling Star
+\date	2026/10/19
+****************************************************************************/
+#ifndef SR_ALGORITHMS_GJK_H_
+#define SR_ALGORITHMS_GJK_H_
+
+/** \addtogroup algorithms
+  @{
+*/
+#include "HullExtremePoint.h"
+#include "SrOBBox3D.h"
+#include "SrSphere3D.h"
+#include "Tri3DOverlapTri3D.h"
+#include <vector>
+
+/*
+	GJKEPA
+*/
+#define SR_GJK_MAX_ITERATION		64
+#define SR_EPA_MAX_ITERATION		64
+/*
+	GJKEPAԾ
+*/
+#define SR_GJK_TOLERANCE			1e-10
+
+/**
+\brief A 2D convex shape given by its support function.
+
+support(d) returns a point p of the shape where p.dot(d) is maximal, d is not
+necessarily unit.
+*/
+class SrConvexShape2D
+{
+public:
+	virtual ~SrConvexShape2D() {}
+	virtual SrPoint2D	support(const SrVector2D& direction) const = 0;
+};
+
+/**
+\brief A convex polygon, the vertices are not copied.
+*/
+class SrPolygonShape2D : public SrConvexShape2D
+{
+public:
+	SrPolygonShape2D(const SrPoint2D* vertex,int numVertex);
+	virtual SrPoint2D	support(const SrVector2D& direction) const;
+
+public:
+	const SrPoint2D*	mVertex;
+	int					mNumVertex;
+};
+
+/**
+\brief A 3D convex shape given by its support function.
+
+The shape is the core shape returned by support() swept by a ball of radius
+mMargin, so a sphere is a point with a margin. GJK works on the core shapes and
+subtracts the margins, which is exact and much faster for round shapes.
+*/
+class SrConvexShape3D
+{
+public:
+	SrConvexShape3D()	{ mMargin = 0; }
+	virtual ~SrConvexShape3D() {}
+	virtual SrPoint3D	support(const SrVector3D& direction) const = 0;
+
+public:
+	SrReal				mMargin;
+};
+
+/**
+\brief A convex polyhedron built by QuickHull, the hull is not copied.
+
+With an SrHullExtremePoint, a support query climbs from the vertex of the last
+query instead of scanning all the vertices, so a shape should not be shared by
+threads.
+*/
+class SrHullShape3D : public SrConvexShape3D
+{
+public:
+	SrHullShape3D(const tHull* hull);
+	SrHullShape3D(const SrHullExtremePoint* extremePoint);
+	virtual SrPoint3D	support(const SrVector3D& direction) const;
+
+public:
+	const tHull*		mHull;
+	const SrHullExtremePoint*	mExtremePoint;
+	mutable int			mLastVertex;
+};
+
+class SrOBBShape3D : public SrConvexShape3D
+{
+public:
+	SrOBBShape3D(const SrOBBox3D& obb);
+	virtual SrPoint3D	support(const SrVector3D& direction) const;
+
+public:
+	SrOBBox3D			mBox;
+};
+
+class SrSphereShape3D : public SrConvexShape3D
+{
+public:
+	SrSphereShape3D(const SrSphere3D& sphere);
+	virtual SrPoint3D	support(const SrVector3D& direction) const;
+
+public:
+	SrPoint3D			mCenter;
+};
+
+class SrTriangleShape3D : public SrConvexShape3D
+{
+public:
+	SrTriangleShape3D(const SrTriangle3D& triangle);
+	virtual SrPoint3D	support(const SrVector3D& direction) const;
+
+public:
+	SrTriangle3D		mTriangle;
+};
+
+/**
+\brief The result of a GJK query between the shapes A and B.
+
+mPointA and mPointB are the closest points if the shapes are apart, or the
+deepest points if they overlap, and mPointB - mPointA = mDistance*mNormal.
+mDistance is the distance, or minus the penetration depth, moving B along
+mNormal by -mDistance makes the shapes touch. mNumSupport is the number of
+support queries on each shape.
+*/
+typedef struct
+{
+	bool		mIsIntersect;
+	SrReal		mDistance;
+	SrPoint2D	mPointA;
+	SrPoint2D	mPointB;
+	SrVector2D	mNormal;
+	int			mNumSupport;
+}tGJKResult2D;
+
+typedef struct
+{
+	bool		mIsIntersect;
+	SrReal		mDistance;
+	SrPoint3D	mPointA;
+	SrPoint3D	mPointB;
+	SrVector3D	mNormal;
+	int			mNumSupport;
+}tGJKResult3D;
+
+/**
+\brief The last simplex of a pair of shapes, to warm start the next query of the pair.
+
+A vertex of the simplex is kept as the direction of its support queries, so the
+cache stays valid when the shapes move, it only starts GJK from the support
+points of the old directions. Use one cache per pair.
+*/
+class SrGJKCache2D
+{
+public:
+	SrGJKCache2D()		{ mNumVertex = 0; }
+	void				reset()	{ mNumVertex = 0; }
+
+public:
+	SrVector2D			mDirection[3];
+	int					mNumVertex;
+};
+
+class SrGJKCache3D
+{
+public:
+	SrGJKCache3D()		{ mNumVertex = 0; }
+	void				reset()	{ mNumVertex = 0; }
+
+public:
+	SrVector3D			mDirection[4];
+	int					mNumVertex;
+};
+
+/**
+\brief GJK distance and EPA penetration depth of 2D convex shapes.
+
+GJK walks a simplex of the Minkowski difference A - B towards the origin, every
+step costs one support query on each shape. If the origin is inside of A - B,
+EPA expands the last simplex to a polygon until the edge of A - B nearest to the
+origin is found. The object keeps the memory of the polygon, use one object per
+thread.
+*/
+class SrGJK2D
+{
+public:
+	SrGJK2D();
+	/**
+	\return True if the shapes intersect, then only mIsIntersect and mNumSupport are valid.
+	*/
+	bool				distance(const SrConvexShape2D& shapeA,const SrConvexShape2D& shapeB,tGJKResult2D& result,SrGJKCache2D* cache = NULL);
+	/**
+	\brief The same as distance(), and the penetration depth if the shapes intersect.
+	*/
+	bool				penetration(const SrConvexShape2D& shapeA,const SrConvexShape2D& shapeB,tGJKResult2D& result,SrGJKCache2D* cache = NULL);
+
+private:
+	typedef struct
+	{
+		SrPoint2D	mW;
+		SrPoint2D	mA;
+		SrPoint2D	mB;
+		SrVector2D	mDirection;
+	}tVertex;
+
+	void				makeVertex(const SrVector2D& direction,tVertex& vertex);
+	bool				solveSimplex(SrVector2D& v);
+	bool				runGJK(SrGJKCache2D* cache,SrVector2D& v);
+	void				setSeparated(const SrVector2D& v,tGJKResult2D& result);
+	bool				addSimplexVertex(const SrVector2D& direction);
+	void				runEPA(tGJKResult2D& result);
+
+	const SrConvexShape2D*	mShapeA;
+	const SrConvexShape2D*	mShapeB;
+	int					mNumSupport;
+	tVertex				mSimplex[3];
+	SrReal				mLambda[3];
+	int					mNumSimplex;
+	std::vector<tVertex>	mPolygon;
+};
+
+/**
+\brief GJK distance and EPA penetration depth of 3D convex shapes.
+
+The same as SrGJK2D, EPA expands the last simplex to a polyhedron whose faces
+are kept in a list, the faces seen from a new support point are removed and
+the hole is closed by the faces from its horizon to the point.
+*/
+class SrGJK3D
+{
+public:
+	SrGJK3D();
+	bool				distance(const SrConvexShape3D& shapeA,const SrConvexShape3D& shapeB,tGJKResult3D& result,SrGJKCache3D* cache = NULL);
+	bool				penetration(const SrConvexShape3D& shapeA,const SrConvexShape3D& shapeB,tGJKResult3D& result,SrGJKCache3D* cache = NULL);
+
+private:
+	typedef struct
+	{
+		SrPoint3D	mW;
+		SrPoint3D	mA;
+		SrPoint3D	mB;
+		SrVector3D	mDirection;
+	}tVertex;
+	typedef struct
+	{
+		int			mVertex[3];
+		SrVector3D	mNormal;
+		SrReal		mDistance;
+		bool		mIsObsolete;
+	}tFace;
+
+	void				makeVertex(const SrVector3D& direction,bool withMargin,tVertex& vertex);
+	bool				solveSimplex(SrVector3D& v);
+	bool				runGJK(SrGJKCache3D* cache,SrVector3D& v);
+	void				setSeparated(const SrVector3D& v,tGJKResult3D& result);
+	bool				addSimplexVertex(const SrVector3D& direction);
+	bool				blowUpSimplex();
+	void				addFace(int v0,int v1,int v2);
+	void				runEPA(tGJKResult3D& result);
+
+	const SrConvexShape3D*	mShapeA;
+	const SrConvexShape3D*	mShapeB;
+	int					mNumSupport;
+	tVertex				mSimplex[4];
+	SrReal				mLambda[4];
+	int					mNumSimplex;
+	std::vector<tVertex>	mPolytope;
+	std::vector<tFace>	mFace;
+	std::vector<int>	mHorizon;
+};
+
+/** @} */
+#endif
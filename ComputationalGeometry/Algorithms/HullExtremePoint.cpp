@@ -0,0 +1,241 @@
+/************************************************************************
+\link	www.twinklingstar.cn
+\author Twinkling Star
+\date	2026/10/19
+****************************************************************************/
+/************************************************************************
+\description	͹ϵļѯ͹һĵֻһֲֵ
+				ԴⶥŵıɽܵＫ㡣
+				Dobkin-Kirkpatrickνṹÿɾһ黥ڵĵͶ㣬ѯ
+				ʱӶ£ÿֻȽһ㼫㱻ɾڵ㡣
+****************************************************************************/
+#include "HullExtremePoint.h"
+#include <map>
+#include <algorithm>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+/*
+\brief	͹ڽӹϵmFInx󶥵ڽӹϵÿֻӽСһΡ
+*/
+static void BuildVertexAdjacency(const tHull* hull,std::vector<int>& start,std::vector<int>& neighbor)
+{
+	int i , j , k , a , b , other;
+	std::vector<int> count(hull->mNumVertes + 1,0);
+	start.assign(hull->mNumVertes + 1,0);
+	for( k=0 ; k<2 ; k++ )
+	{
+		for( i=0 ; i<hull->mNumFacet ; i++ )
+		{
+			const tFacet& facet = hull->mFacet[i];
+			for( j=0 ; j<3 ; j++ )
+			{
+				a = facet.mVInx[j];
+				b = facet.mVInx[(j + 1) % 3];
+				//ҵab
+				for( other=0 ; other<3 ; other++ )
+				{
+					const tFacet& neighborFacet = hull->mFacet[facet.mFInx[other]];
+					if( (neighborFacet.mVInx[0]==a || neighborFacet.mVInx[1]==a || neighborFacet.mVInx[2]==a) &&
+						(neighborFacet.mVInx[0]==b || neighborFacet.mVInx[1]==b || neighborFacet.mVInx[2]==b) )
+						break;
+				}
+				if( other<3 && facet.mFInx[other]<i )
+					continue;
+				if( k==0 )
+				{
+					start[a + 1] ++;
+					start[b + 1] ++;
+				}
+				else
+				{
+					neighbor[start[a] + count[a]++] = b;
+					neighbor[start[b] + count[b]++] = a;
+				}
+			}
+		}
+		if( k==0 )
+		{
+			for( i=0 ; i<hull->mNumVertes ; i++ )
+				start[i + 1] += start[i];
+			neighbor.resize(start[hull->mNumVertes]);
+		}
+	}
+}
+
+SrHullExtremePoint::SrHullExtremePoint()
+{
+	mHull = NULL;
+	mNumLevel = 0;
+}
+
+void SrHullExtremePoint::build(const tHull* hull,bool isHierarchy)
+{
+	mHull = hull;
+	BuildVertexAdjacency(hull,mNeighborStart,mNeighbor);
+	mNumLevel = 0;
+	mTopVertex.clear();
+	mCandidateStart.clear();
+	mCandidate.clear();
+	if( isHierarchy )
+		buildHierarchy();
+}
+
+/*
+\brief	ÿ̰ĵѡSR_HULL_MAX_REMOVED_DEGREEڵĶ㣬ʣµĶ
+		͹¼ÿµĶ㱻ɾڵ㡣
+*/
+void SrHullExtremePoint::buildHierarchy()
+{
+	int n = mHull->mNumVertes , numCurrent , numRemoved , i , j , base , offset;
+	std::vector<int> current(n) , start(mNeighborStart) , neighbor(mNeighbor);
+	std::vector<int> isRemoved , isMarked;
+	std::vector<SrPoint3D> point;
+	std::map<SrPoint3D,int> globalIndex;
+	for( i=0 ; i<n ; i++ )
+		current[i] = i;
+
+	while( (int)current.size()>SR_HULL_TOP_VERTEX )
+	{
+		numCurrent = (int)current.size();
+		isRemoved.assign(numCurrent,0);
+		isMarked.assign(numCurrent,0);
+		numRemoved = 0;
+		for( i=0 ; i<numCurrent ; i++ )
+		{
+			if( isMarked[i] || start[i + 1] - start[i]>SR_HULL_MAX_REMOVED_DEGREE )
+				continue;
+			isRemoved[i] = isMarked[i] = 1;
+			for( j=start[i] ; j<start[i + 1] ; j++ )
+				isMarked[neighbor[j]] = 1;
+			numRemoved ++;
+		}
+		if( numRemoved==0 )
+			break;
+		point.clear();
+		globalIndex.clear();
+		for( i=0 ; i<numCurrent ; i++ )
+		{
+			if( !isRemoved[i] )
+			{
+				point.push_back(mHull->mVertes[current[i]]);
+				globalIndex[mHull->mVertes[current[i]]] = current[i];
+			}
+		}
+		QuickHull quickHull;
+		tHull hull;
+		if( (int)point.size()<4 || !quickHull.quickHull(&point[0],(int)point.size(),&hull) )
+			break;
+
+		//һĺѡ㣬µĶȫ
+		base = (int)mCandidateStart.size();
+		offset = (int)mCandidate.size();
+		mCandidateStart.resize(base + n + 1,0);
+		for( i=0 ; i<numCurrent ; i++ )
+		{
+			if( isRemoved[i] )
+			{
+				for( j=start[i] ; j<start[i + 1] ; j++ )
+					mCandidateStart[base + current[neighbor[j]] + 1] ++;
+			}
+		}
+		mCandidateStart[base] = offset;
+		for( i=0 ; i<n ; i++ )
+			mCandidateStart[base + i + 1] += mCandidateStart[base + i];
+		mCandidate.resize(mCandidateStart[base + n]);
+		std::vector<int> fill(mCandidateStart.begin() + base,mCandidateStart.begin() + base + n);
+		for( i=0 ; i<numCurrent ; i++ )
+		{
+			if( isRemoved[i] )
+			{
+				for( j=start[i] ; j<start[i + 1] ; j++ )
+					mCandidate[fill[current[neighbor[j]]]++] = current[i];
+			}
+		}
+
+		//һ͹
+		current.resize(hull.mNumVertes);
+		for( i=0 ; i<hull.mNumVertes ; i++ )
+			current[i] = globalIndex[hull.mVertes[i]];
+		BuildVertexAdjacency(&hull,start,neighbor);
+		delete []hull.mVertes;
+		delete []hull.mFacet;
+		mNumLevel ++;
+	}
+	mTopVertex = current;
+}
+
+int SrHullExtremePoint::extremeVertex(const SrVector3D& direction,int start) const
+{
+	const SrPoint3D* vertex = mHull->mVertes;
+	int current = start , best , i;
+	SrReal maxDot = vertex[current].dot(direction) , dot;
+	while( true )
+	{
+		best = current;
+		for( i=mNeighborStart[current] ; i<mNeighborStart[current + 1] ; i++ )
+		{
+			dot = vertex[mNeighbor[i]].dot(direction);
+			if( dot>maxDot )
+			{
+				maxDot = dot;
+				best = mNeighbor[i];
+			}
+		}
+		if( best==current )
+			return current;
+		current = best;
+	}
+}
+
+int SrHullExtremePoint::extremeVertexHierarchy(const SrVector3D& direction) const
+{
+	ASSERT(!mTopVertex.empty());
+	const SrPoint3D* vertex = mHull->mVertes;
+	int n = mHull->mNumVertes , best = mTopVertex[0] , level , i , base;
+	SrReal maxDot = vertex[best].dot(direction) , dot;
+	for( i=1 ; i<(int)mTopVertex.size() ; i++ )
+	{
+		dot = vertex[mTopVertex[i]].dot(direction);
+		if( dot>maxDot )
+		{
+			maxDot = dot;
+			best = mTopVertex[i];
+		}
+	}
+	//һļһļ㣬ɾڵ
+	for( level=mNumLevel - 1 ; level>=0 ; level-- )
+	{
+		base = level*(n + 1) + best;
+		int last = best;
+		for( i=mCandidateStart[base] ; i<mCandidateStart[base + 1] ; i++ )
+		{
+			dot = vertex[mCandidate[i]].dot(direction);
+			if( dot>maxDot )
+			{
+				maxDot = dot;
+				last = mCandidate[i];
+			}
+		}
+		best = last;
+	}
+	return best;
+}
+
+void SrHullExtremePoint::extremeVertexBatch(const SrVector3D* direction,int numDirection,int* result,bool isHierarchy) const
+{
+	int chunk , numChunk = (numDirection + SR_HULL_BATCH_CHUNK - 1) / SR_HULL_BATCH_CHUNK;
+#pragma omp parallel for schedule(dynamic,1)
+	for( chunk=0 ; chunk<numChunk ; chunk++ )
+	{
+		int i , start = 0 , end = std::min(numDirection,(chunk + 1)*SR_HULL_BATCH_CHUNK);
+		for( i=chunk*SR_HULL_BATCH_CHUNK ; i<end ; i++ )
+		{
+			if( isHierarchy )
+				result[i] = extremeVertexHierarchy(direction[i]);
+			else
+				result[i] = start = extremeVertex(direction[i],start);
+		}
+	}
+}
@@ -0,0 +1,76 @@
+/************************************************************************
+\link	www.twinklingstar.cn
+\author Twinkling Star
+\date	2026/10/19
+****************************************************************************/
+#ifndef SR_ALGORITHMS_HULL_EXTREME_POINT_H_
+#define SR_ALGORITHMS_HULL_EXTREME_POINT_H_
+
+/** \addtogroup algorithms
+  @{
+*/
+#include "QuickHull.h"
+#include <vector>
+
+/*
+	Dobkin-KirkpatrickνṹУɾĶԼ͹󶥵
+*/
+#define SR_HULL_MAX_REMOVED_DEGREE		8
+#define SR_HULL_TOP_VERTEX				16
+/*
+	ѯʱһ߳ķڵķһ㿪ʼɽ
+*/
+#define SR_HULL_BATCH_CHUNK				256
+
+/**
+\brief Extreme point queries on a convex polyhedron built by QuickHull.
+
+build() turns the facets of a tHull and their neighbors mFInx into the edges
+between the vertices. extremeVertex() climbs from a start vertex to the
+neighbor with the largest dot product until no neighbor is larger, which is the
+extreme vertex because the polyhedron is convex. A start vertex near the answer,
+such as the answer of the last query in a similar direction, makes the climb a
+few steps.
+
+The optional Dobkin-Kirkpatrick hierarchy is a sequence of smaller convex
+hulls, each one built without an independent set of vertices of low degree of
+the last one. extremeVertexHierarchy() finds the extreme vertex of the top hull
+by brute force, then at every level the extreme vertex is either the last one or
+one of its removed neighbors, so the query visits O(log n) levels.
+*/
+class SrHullExtremePoint
+{
+public:
+	SrHullExtremePoint();
+
+	void				build(const tHull* hull,bool isHierarchy = false);
+	/**
+	\return The index of the extreme vertex in mHull->mVertes.
+	*/
+	int					extremeVertex(const SrVector3D& direction,int start = 0) const;
+	int					extremeVertexHierarchy(const SrVector3D& direction) const;
+	/**
+	\brief The extreme vertices of many directions in parallel, directions next to each other should be similar.
+	*/
+	void				extremeVertexBatch(const SrVector3D* direction,int numDirection,int* result,bool isHierarchy = false) const;
+
+	int					numLevel() const	{ return mNumLevel; }
+
+public:
+	const tHull*		mHull;
+
+private:
+	void				buildHierarchy();
+
+	std::vector<int>	mNeighborStart;
+	std::vector<int>	mNeighbor;
+
+	int					mNumLevel;
+	std::vector<int>	mTopVertex;
+	//levelУһĶvɾڵmCandidate[mCandidateStart[level*(n + 1) + v]],...
+	std::vector<int>	mCandidateStart;
+	std::vector<int>	mCandidate;
+};
+
+/** @} */
+#endif
@@ -0,0 +1,564 @@
+/************************************************************************
+\link	www.twinklingstar.cn
+\author Twinkling Star
+\date	2026/10/19
+****************************************************************************/
+/************************************************************************
+\description	÷Ͱıʽ(SAH)İΧΣ
+				ͬʱΧΣصζԡ
+****************************************************************************/
+#include "MeshBVH.h"
+#include "OBBOverlapOBB.h"
+#include "SrEigen3.h"
+#include <algorithm>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+/*
+	ÿ߳ƽֵԵĸ
+*/
+#define TASK_PER_THREAD		16
+
+typedef struct
+{
+	int		mNode1;
+	int		mNode2;
+}tNodePair;
+typedef std::vector<tNodePair>	NodePairArray;
+
+/*
+	жεǷڷָ
+*/
+class cBinPredicate
+{
+public:
+	cBinPredicate(const SrPoint3D* centroid,int axis,SrReal minCoord,SrReal scale,int splitBin)
+	{
+		mCentroid	= centroid;
+		mAxis		= axis;
+		mMinCoord	= minCoord;
+		mScale		= scale;
+		mSplitBin	= splitBin;
+	}
+	bool operator()(int i) const
+	{
+		return BinIndex(mCentroid[i][mAxis],mMinCoord,mScale)<=mSplitBin;
+	}
+	static int BinIndex(SrReal coord,SrReal minCoord,SrReal scale)
+	{
+		int bin = (int)((coord - minCoord)*scale);
+		if( bin>=SR_BVH_NUM_BIN )
+			bin = SR_BVH_NUM_BIN - 1;
+		return bin;
+	}
+
+private:
+	const SrPoint3D*	mCentroid;
+	int					mAxis;
+	SrReal				mMinCoord;
+	SrReal				mScale;
+	int					mSplitBin;
+};
+
+static SrReal HalfSurfaceArea(const SrPoint3D& minPoint,const SrPoint3D& maxPoint)
+{
+	SrVector3D d = maxPoint - minPoint;
+	return d.x*d.y + d.y*d.z + d.z*d.x;
+}
+
+SrMeshBVH::SrMeshBVH()
+{
+	mTriangle	 = NULL;
+	mNumTriangle = 0;
+	mBoxType	 = SR_BVH_AABB;
+}
+
+SrMeshBVH::~SrMeshBVH()
+{
+	release();
+}
+
+void SrMeshBVH::release()
+{
+	mTriangle	 = NULL;
+	mNumTriangle = 0;
+	mNode.clear();
+	mTriIndex.clear();
+}
+
+void SrMeshBVH::build(const SrTriangle3D* triangle,int numTriangle,int boxType,int maxLeafSize)
+{
+	ASSERT(maxLeafSize>0 && (boxType==SR_BVH_AABB || boxType==SR_BVH_OBB));
+	release();
+	if( numTriangle<=0 )
+		return;
+	mTriangle	 = triangle;
+	mNumTriangle = numTriangle;
+	mBoxType	 = boxType;
+
+	SrPoint3D* minPoint = new SrPoint3D[numTriangle];
+	SrPoint3D* maxPoint = new SrPoint3D[numTriangle];
+	SrPoint3D* centroid = new SrPoint3D[numTriangle];
+	int i;
+	mTriIndex.resize(numTriangle);
+	for( i=0 ; i<numTriangle ; i++ )
+	{
+		minPoint[i] = maxPoint[i] = triangle[i].mPoint[0];
+		minPoint[i].min(triangle[i].mPoint[1]);
+		minPoint[i].min(triangle[i].mPoint[2]);
+		maxPoint[i].max(triangle[i].mPoint[1]);
+		maxPoint[i].max(triangle[i].mPoint[2]);
+		centroid[i] = (minPoint[i] + maxPoint[i])*(SrReal)0.5;
+		mTriIndex[i] = i;
+	}
+
+	//һö2*numTriangle - 1ڵ
+	mNode.reserve(2*numTriangle);
+	mNode.resize(1);
+	buildNode(0,0,numTriangle,maxLeafSize,minPoint,maxPoint,centroid);
+
+	delete []minPoint;
+	delete []maxPoint;
+	delete []centroid;
+}
+
+int BVHPartitionSAH(int* index,int count,const SrPoint3D* minPoint,const SrPoint3D* maxPoint,const SrPoint3D* centroid,int* splitAxis)
+{
+	ASSERT(count>1);
+	SrPoint3D minCentroid = centroid[index[0]] , maxCentroid = centroid[index[0]];
+	int i , j , axis;
+	for( i=1 ; i<count ; i++ )
+	{
+		minCentroid.min(centroid[index[i]]);
+		maxCentroid.max(centroid[index[i]]);
+	}
+
+	//ϷֱͰѡSAHСķָ
+	int		binCount[SR_BVH_NUM_BIN] , bin;
+	SrPoint3D binMin[SR_BVH_NUM_BIN] , binMax[SR_BVH_NUM_BIN];
+	SrReal	rightArea[SR_BVH_NUM_BIN];
+	int		rightCount[SR_BVH_NUM_BIN];
+	SrReal	bestCost = 0 , cost , scale;
+	int		bestAxis = -1 , bestBin = 0;
+	for( axis=0 ; axis<3 ; axis++ )
+	{
+		SrReal extent = maxCentroid[axis] - minCentroid[axis];
+		if( LEQUAL(extent,0) )
+			continue;
+		scale = SR_BVH_NUM_BIN / extent;
+		for( j=0 ; j<SR_BVH_NUM_BIN ; j++ )
+			binCount[j] = 0;
+		for( i=0 ; i<count ; i++ )
+		{
+			bin = cBinPredicate::BinIndex(centroid[index[i]][axis],minCentroid[axis],scale);
+			if( binCount[bin]==0 )
+			{
+				binMin[bin] = minPoint[index[i]];
+				binMax[bin] = maxPoint[index[i]];
+			}
+			else
+			{
+				binMin[bin].min(minPoint[index[i]]);
+				binMax[bin].max(maxPoint[index[i]]);
+			}
+			binCount[bin] ++;
+		}
+
+		//ۼƣrightArea[j]rightCount[j]Ͱj,...,SR_BVH_NUM_BIN-1Ĳ
+		SrPoint3D boxMin , boxMax;
+		int sum = 0;
+		for( j=SR_BVH_NUM_BIN-1 ; j>0 ; j-- )
+		{
+			if( binCount[j] )
+			{
+				if( sum==0 )
+				{
+					boxMin = binMin[j];
+					boxMax = binMax[j];
+				}
+				else
+				{
+					boxMin.min(binMin[j]);
+					boxMax.max(binMax[j]);
+				}
+				sum += binCount[j];
+			}
+			rightCount[j] = sum;
+			rightArea[j]  = sum ? HalfSurfaceArea(boxMin,boxMax) : 0;
+		}
+		//ɨ裬ָλͰjͰj+1֮
+		sum = 0;
+		for( j=0 ; j<SR_BVH_NUM_BIN-1 ; j++ )
+		{
+			if( binCount[j] )
+			{
+				if( sum==0 )
+				{
+					boxMin = binMin[j];
+					boxMax = binMax[j];
+				}
+				else
+				{
+					boxMin.min(binMin[j]);
+					boxMax.max(binMax[j]);
+				}
+				sum += binCount[j];
+			}
+			if( sum==0 || rightCount[j+1]==0 )
+				continue;
+			cost = HalfSurfaceArea(boxMin,boxMax)*sum + rightArea[j+1]*rightCount[j+1];
+			if( bestAxis<0 || cost<bestCost )
+			{
+				bestCost = cost;
+				bestAxis = axis;
+				bestBin	 = j;
+			}
+		}
+	}
+
+	int numLeft = 0;
+	if( bestAxis>=0 )
+	{
+		scale = SR_BVH_NUM_BIN / (maxCentroid[bestAxis] - minCentroid[bestAxis]);
+		int* middle = std::partition(index,index + count,cBinPredicate(centroid,bestAxis,minCentroid[bestAxis],scale,bestBin));
+		numLeft = (int)(middle - index);
+	}
+	//Ķغʱ޷ͰֱӴмֿ
+	if( numLeft==0 || numLeft==count )
+		numLeft = count / 2;
+	if( splitAxis )
+		*splitAxis = bestAxis>=0 ? bestAxis : 0;
+	return numLeft;
+
+}
+
+void SrMeshBVH::buildNode(int node,int first,int count,int maxLeafSize,
+						  const SrPoint3D* minPoint,const SrPoint3D* maxPoint,const SrPoint3D* centroid)
+{
+	computeBox(node,first,count,minPoint,maxPoint);
+	mNode[node].mFirst = first;
+	mNode[node].mCount = count;
+	if( count<=maxLeafSize )
+		return;
+
+	int numLeft = BVHPartitionSAH(&mTriIndex[0] + first,count,minPoint,maxPoint,centroid);
+	int child = (int)mNode.size();
+	mNode.resize(child + 2);
+	mNode[node].mFirst = child;
+	mNode[node].mCount = 0;
+	buildNode(child,first,numLeft,maxLeafSize,minPoint,maxPoint,centroid);
+	buildNode(child + 1,first + numLeft,count - numLeft,maxLeafSize,minPoint,maxPoint,centroid);
+}
+
+void SrMeshBVH::computeBox(int node,int first,int count,const SrPoint3D* minPoint,const SrPoint3D* maxPoint)
+{
+	SrOBBox3D& box = mNode[node].mBox;
+	int i , j;
+	if( mBoxType==SR_BVH_AABB )
+	{
+		SrPoint3D boxMin = minPoint[mTriIndex[first]] , boxMax = maxPoint[mTriIndex[first]];
+		for( i=1 ; i<count ; i++ )
+		{
+			boxMin.min(minPoint[mTriIndex[first + i]]);
+			boxMax.max(maxPoint[mTriIndex[first + i]]);
+		}
+		box.mAxis[0] = SrVector3D(1,0,0);
+		box.mAxis[1] = SrVector3D(0,1,0);
+		box.mAxis[2] = SrVector3D(0,0,1);
+		box.mCenter	 = (boxMin + boxMax)*(SrReal)0.5;
+		box.mHalfLength[0] = (boxMax.x - boxMin.x)*(SrReal)0.5;
+		box.mHalfLength[1] = (boxMax.y - boxMin.y)*(SrReal)0.5;
+		box.mHalfLength[2] = (boxMax.z - boxMin.z)*(SrReal)0.5;
+		return;
+	}
+
+	//OBBķȡڵжЭ
+	const SrTriangle3D* tri;
+	SrPoint3D mean(0,0,0);
+	for( i=0 ; i<count ; i++ )
+	{
+		tri = mTriangle + mTriIndex[first + i];
+		mean += tri->mPoint[0] + tri->mPoint[1] + tri->mPoint[2];
+	}
+	mean = mean / (SrReal)(3*count);
+
+	SrReal cMatrix[3][3];
+	SrVector3D d;
+	int r , c;
+	for( r=0 ; r<3 ; r++ )
+		for( c=0 ; c<3 ; c++ )
+			cMatrix[r][c] = 0;
+	for( i=0 ; i<count ; i++ )
+	{
+		tri = mTriangle + mTriIndex[first + i];
+		for( j=0 ; j<3 ; j++ )
+		{
+			d = tri->mPoint[j] - mean;
+			for( r=0 ; r<3 ; r++ )
+				for( c=r ; c<3 ; c++ )
+					cMatrix[r][c] += d[r]*d[c];
+		}
+	}
+
+	SrReal eigval[3];
+	SrEigen3::solve(cMatrix,eigval,box.mAxis);
+
+	SrVector3D minLen , maxLen , tmpLen;
+	tri = mTriangle + mTriIndex[first];
+	minLen.set(box.mAxis[0].dot(tri->mPoint[0]),box.mAxis[1].dot(tri->mPoint[0]),box.mAxis[2].dot(tri->mPoint[0]));
+	maxLen = minLen;
+	for( i=0 ; i<count ; i++ )
+	{
+		tri = mTriangle + mTriIndex[first + i];
+		for( j=0 ; j<3 ; j++ )
+		{
+			tmpLen.set(box.mAxis[0].dot(tri->mPoint[j]),box.mAxis[1].dot(tri->mPoint[j]),box.mAxis[2].dot(tri->mPoint[j]));
+			minLen.min(tmpLen);
+			maxLen.max(tmpLen);
+		}
+	}
+	box.mHalfLength[0] = (maxLen.x - minLen.x)*(SrReal)0.5;
+	box.mHalfLength[1] = (maxLen.y - minLen.y)*(SrReal)0.5;
+	box.mHalfLength[2] = (maxLen.z - minLen.z)*(SrReal)0.5;
+	box.mCenter = ((minLen.x + maxLen.x)*(SrReal)0.5)*box.mAxis[0] +
+				  ((minLen.y + maxLen.y)*(SrReal)0.5)*box.mAxis[1] +
+				  ((minLen.z + maxLen.z)*(SrReal)0.5)*box.mAxis[2];
+}
+
+
+/*
+	һαĲmIsSelfΪtrueʱͬһʱmNode1==mNode2ĽڵԱʾ
+	ڵļ⡣
+*/
+typedef struct
+{
+	const SrMeshBVH*	mBVH1;
+	const SrMeshBVH*	mBVH2;
+	bool				mIsSelf;
+	const int*			mVertexIndex;
+}tTraversal;
+
+static bool IsSelfPair(const tTraversal& traversal,const tNodePair& pair)
+{
+	return traversal.mIsSelf && pair.mNode1==pair.mNode2;
+}
+
+static bool NodeOverlapNode(const tTraversal& traversal,const tNodePair& pair)
+{
+	if( IsSelfPair(traversal,pair) )
+		return true;
+	return OBBOverlapTestOBB_OptimizedSeparatingAxisMethod(traversal.mBVH1->mNode[pair.mNode1].mBox,traversal.mBVH2->mNode[pair.mNode2].mBox);
+}
+
+static bool IsLeafPair(const tTraversal& traversal,const tNodePair& pair)
+{
+	return traversal.mBVH1->isLeaf(pair.mNode1) && traversal.mBVH2->isLeaf(pair.mNode2);
+}
+
+/*
+\brief	жӦչڵеĸڵ㣺Ҷӽڵ㲻չչϴǸڵ㡣
+\return	true	չnode1
+		false	չnode2
+*/
+static bool DescendFirst(const SrMeshBVH& bvh1,int node1,const SrMeshBVH& bvh2,int node2)
+{
+	if( bvh1.isLeaf(node1) )
+		return false;
+	if( bvh2.isLeaf(node2) )
+		return true;
+	const SrReal* len1 = bvh1.mNode[node1].mBox.mHalfLength;
+	const SrReal* len2 = bvh2.mNode[node2].mBox.mHalfLength;
+	return len1[0] + len1[1] + len1[2] >= len2[0] + len2[1] + len2[2];
+}
+
+static void DescendNodePair(const tTraversal& traversal,const tNodePair& pair,NodePairArray& result)
+{
+	const SrMeshBVH& bvh1 = *traversal.mBVH1;
+	const SrMeshBVH& bvh2 = *traversal.mBVH2;
+	tNodePair child = pair;
+	if( IsSelfPair(traversal,pair) )
+	{//ļֳɣ
+		int left = bvh1.mNode[pair.mNode1].mFirst;
+		child.mNode1 = child.mNode2 = left;
+		result.push_back(child);
+		child.mNode1 = child.mNode2 = left + 1;
+		result.push_back(child);
+		child.mNode1 = left;
+		child.mNode2 = left + 1;
+		result.push_back(child);
+	}
+	else if( DescendFirst(bvh1,pair.mNode1,bvh2,pair.mNode2) )
+	{
+		child.mNode1 = bvh1.mNode[pair.mNode1].mFirst;
+		result.push_back(child);
+		child.mNode1 ++;
+		result.push_back(child);
+	}
+	else
+	{
+		child.mNode2 = bvh2.mNode[pair.mNode2].mFirst;
+		result.push_back(child);
+		child.mNode2 ++;
+		result.push_back(child);
+	}
+}
+
+/*
+\brief	жͬһеǷ㣨ߵҲ㣩
+		ûжʱȽ϶Ƿͬ
+*/
+static bool IsAdjacent(const tTraversal& traversal,int tri1,int tri2)
+{
+	int i , j;
+	if( traversal.mVertexIndex )
+	{
+		const int* index1 = traversal.mVertexIndex + 3*tri1;
+		const int* index2 = traversal.mVertexIndex + 3*tri2;
+		for( i=0 ; i<3 ; i++ )
+			for( j=0 ; j<3 ; j++ )
+			{
+				if( index1[i]==index2[j] )
+					return true;
+			}
+		return false;
+	}
+	const SrTriangle3D& triangle1 = traversal.mBVH1->mTriangle[tri1];
+	const SrTriangle3D& triangle2 = traversal.mBVH1->mTriangle[tri2];
+	for( i=0 ; i<3 ; i++ )
+		for( j=0 ; j<3 ; j++ )
+		{
+			if( triangle1.mPoint[i]==triangle2.mPoint[j] )
+				return true;
+		}
+	return false;
+}
+
+static void TriangleIntersectTriangle(const tTraversal& traversal,int tri1,int tri2,TrianglePairArray& pairs)
+{
+	tTrianglePair pair;
+	if( traversal.mIsSelf )
+	{
+		if( IsAdjacent(traversal,tri1,tri2) )
+			return;
+		if( tri1>tri2 )
+		{
+			int tmp = tri1;
+			tri1 = tri2;
+			tri2 = tmp;
+		}
+	}
+	if( Tri3DOverlapTestTri3D_Guigue(traversal.mBVH1->mTriangle[tri1],traversal.mBVH2->mTriangle[tri2]) )
+	{
+		pair.mTri1 = tri1;
+		pair.mTri2 = tri2;
+		pairs.push_back(pair);
+	}
+}
+
+static void LeafIntersectLeaf(const tTraversal& traversal,const tNodePair& pair,TrianglePairArray& pairs)
+{
+	const SrMeshBVH& bvh1 = *traversal.mBVH1;
+	const SrMeshBVH& bvh2 = *traversal.mBVH2;
+	const tBVHNode& leaf1 = bvh1.mNode[pair.mNode1];
+	const tBVHNode& leaf2 = bvh2.mNode[pair.mNode2];
+	int i , j;
+	if( IsSelfPair(traversal,pair) )
+	{
+		for( i=0 ; i<leaf1.mCount ; i++ )
+			for( j=i+1 ; j<leaf1.mCount ; j++ )
+				TriangleIntersectTriangle(traversal,bvh1.mTriIndex[leaf1.mFirst + i],bvh1.mTriIndex[leaf1.mFirst + j],pairs);
+		return;
+	}
+	for( i=0 ; i<leaf1.mCount ; i++ )
+		for( j=0 ; j<leaf2.mCount ; j++ )
+			TriangleIntersectTriangle(traversal,bvh1.mTriIndex[leaf1.mFirst + i],bvh2.mTriIndex[leaf2.mFirst + j],pairs);
+}
+
+static void TraverseNodePair(const tTraversal& traversal,const tNodePair& root,TrianglePairArray& pairs)
+{
+	NodePairArray stack;
+	tNodePair pair;
+	stack.push_back(root);
+	while( !stack.empty() )
+	{
+		pair = stack.back();
+		stack.pop_back();
+		if( !NodeOverlapNode(traversal,pair) )
+			continue;
+		if( IsLeafPair(traversal,pair) )
+			LeafIntersectLeaf(traversal,pair,pairs);
+		else
+			DescendNodePair(traversal,pair,stack);
+	}
+}
+
+/*
+\brief	չصĽڵԣֱԵĸ㹻̣߳ٲеرЩԡ
+*/
+static int Traverse(const tTraversal& traversal,TrianglePairArray& pairs)
+{
+	int numThread = 1;
+#ifdef _OPENMP
+	numThread = omp_get_max_threads();
+#endif
+	NodePairArray task , next;
+	tNodePair root = {0,0};
+	task.push_back(root);
+	bool isDescended = true;
+	int i;
+	while( isDescended && (int)task.size()<TASK_PER_THREAD*numThread )
+	{
+		isDescended = false;
+		next.clear();
+		for( i=0 ; i<(int)task.size() ; i++ )
+		{
+			if( !NodeOverlapNode(traversal,task[i]) )
+				continue;
+			if( IsLeafPair(traversal,task[i]) )
+				next.push_back(task[i]);
+			else
+			{
+				DescendNodePair(traversal,task[i],next);
+				isDescended = true;
+			}
+		}
+		task.swap(next);
+	}
+
+	int numTask = (int)task.size();
+	std::vector<TrianglePairArray> taskPairs(numTask);
+#pragma omp parallel for schedule(dynamic)
+	for( i=0 ; i<numTask ; i++ )
+		TraverseNodePair(traversal,task[i],taskPairs[i]);
+
+	for( i=0 ; i<numTask ; i++ )
+		pairs.insert(pairs.end(),taskPairs[i].begin(),taskPairs[i].end());
+	return (int)pairs.size();
+}
+
+int MeshIntersectMesh(const SrMeshBVH& bvh1,const SrMeshBVH& bvh2,TrianglePairArray& pairs)
+{
+	pairs.clear();
+	if( bvh1.mNode.empty() || bvh2.mNode.empty() )
+		return 0;
+	tTraversal traversal;
+	traversal.mBVH1		  = &bvh1;
+	traversal.mBVH2		  = &bvh2;
+	traversal.mIsSelf	  = false;
+	traversal.mVertexIndex = NULL;
+	return Traverse(traversal,pairs);
+}
+
+int MeshSelfIntersect(const SrMeshBVH& bvh,const int* vertexIndex,TrianglePairArray& pairs)
+{
+	pairs.clear();
+	if( bvh.mNode.empty() )
+		return 0;
+	tTraversal traversal;
+	traversal.mBVH1		  = &bvh;
+	traversal.mBVH2		  = &bvh;
+	traversal.mIsSelf	  = true;
+	traversal.mVertexIndex = vertexIndex;
+	return Traverse(traversal,pairs);
+}
@@ -0,0 +1,119 @@
+/************************************************************************
+\link	www.twinklingstar.cn
+\author Twinkling Star
+\date	2026/10/19
+****************************************************************************/
+#ifndef SR_ALGORITHMS_MESH_BVH_H_
+#define SR_ALGORITHMS_MESH_BVH_H_
+
+/** \addtogroup algorithms
+  @{
+*/
+#include "SrOBBox3D.h"
+#include "Tri3DOverlapTri3D.h"
+#include <vector>
+
+/*
+	ΧεĽڵõİΧ
+*/
+#define SR_BVH_AABB			0x01
+#define SR_BVH_OBB			0x02
+
+/*
+	SAHͰĸ
+*/
+#define SR_BVH_NUM_BIN		16
+
+/**
+\brief A node of the bounding volume hierarchy.
+
+A leaf has mCount>0 triangles, which are mTriIndex[mFirst],...,mTriIndex[mFirst+mCount-1]
+of the hierarchy. An internal node has mCount==0, and its two children are
+mNode[mFirst] and mNode[mFirst+1]. AABB nodes are stored as OBBs with the
+coordinate axes, so that the same overlap test works for both kinds of nodes.
+*/
+typedef struct
+{
+	SrOBBox3D	mBox;
+	int			mFirst;
+	int			mCount;
+}tBVHNode;
+
+/**
+\brief A pair of overlapping triangles, mTri1 indexes the first mesh and mTri2 the second one.
+*/
+typedef struct
+{
+	int			mTri1;
+	int			mTri2;
+}tTrianglePair;
+
+typedef std::vector<tBVHNode>		BVHNodeArray;
+typedef std::vector<tTrianglePair>	TrianglePairArray;
+
+/**
+\brief Bounding volume hierarchy over a triangle soup, built with binned SAH.
+
+The hierarchy does not copy the triangles, the array passed to build() must
+stay alive as long as the hierarchy is used.
+*/
+class SrMeshBVH
+{
+public:
+	SrMeshBVH();
+	~SrMeshBVH();
+	/**
+	\brief Build the hierarchy, the old one is released.
+	\param[in] boxType SR_BVH_AABB or SR_BVH_OBB.
+	\param[in] maxLeafSize The maximum number of triangles in a leaf.
+	*/
+	void				build(const SrTriangle3D* triangle,int numTriangle,int boxType = SR_BVH_AABB,int maxLeafSize = 4);
+	void				release();
+
+	bool				isLeaf(int node) const	{ return mNode[node].mCount>0; }
+
+public:
+	const SrTriangle3D*	mTriangle;
+	int					mNumTriangle;
+	int					mBoxType;
+	BVHNodeArray		mNode;
+	std::vector<int>	mTriIndex;
+
+private:
+	void				buildNode(int node,int first,int count,int maxLeafSize,
+								  const SrPoint3D* minPoint,const SrPoint3D* maxPoint,const SrPoint3D* centroid);
+	void				computeBox(int node,int first,int count,const SrPoint3D* minPoint,const SrPoint3D* maxPoint);
+};
+
+/*
+\brief	÷Ͱıʽ(SAH)ѡСķָ棬index[0],...,index[count-1]
+		ʹڷָͼԪǰ档غʱмֿ
+\param[in]	minPoint,maxPoint,centroid	ÿͼԪAABBģindexеֵ
+\param[out]	splitAxis	ΪNULLʱطָ洹ֱ
+\return	ͼԪĸ0Сcount
+*/
+int BVHPartitionSAH(int* index,int count,const SrPoint3D* minPoint,const SrPoint3D* maxPoint,const SrPoint3D* centroid,int* splitAxis = NULL);
+
+/*
+\brief	ͬʱΧΣOBBOverlapTestOBB_OptimizedSeparatingAxisMethodڵǷص
+		ҶӽڵTri3DOverlapTestTri3D_GuigueζǷص
+		ڲεĶѽڵչɶصԣOpenMPеرǡ
+\param[in]	bvh1	һİΧ
+\param[in]	bvh2	ڶİΧ
+\param[out]	pairs	صζԣmTri1ǵһεmTri2ǵڶε
+\return	صζԵĸ
+*/
+int MeshIntersectMesh(const SrMeshBVH& bvh1,const SrMeshBVH& bvh2,TrianglePairArray& pairs);
+/*
+\brief	ཻͬһΧԱÿ⣬
+		ټ߱ߵζԱMeshIntersectMeshһԶ̱߳
+\param[in]	bvh			İΧ
+\param[in]	vertexIndex	ÿε3*bvh.mNumTriangleԪأ
+						ΪNULLʱͬĶ㱻ͬһ
+\param[out]	pairs		ཻζԣmTri1<mTri2
+\return	ཻζԵĸ
+*/
+int MeshSelfIntersect(const SrMeshBVH& bvh,const int* vertexIndex,TrianglePairArray& pairs);
+
+/** @} */
+#endif
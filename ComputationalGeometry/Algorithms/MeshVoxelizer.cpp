@@ -0,0 +1,481 @@
+/************************************************************************
+\link	www.twinklingstar.cn
+\author Twinkling Star
+\date	2026/10/19
+****************************************************************************/
+/************************************************************************
+\description	ıػÿֻAABBǵԣ
+				X8һݰSSE2Ĵͬʱԣ
+				رϡשУÿ߳ԼԺϲ
+****************************************************************************/
+#include "MeshVoxelizer.h"
+#include "SrSimd.h"
+#include <math.h>
+#include <string.h>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#define PACKET_WIDTH	SR_VOXEL_PACKET_WIDTH
+#define BRICK_SHIFT		SR_VOXEL_BRICK_SHIFT
+#define BRICK_MASK		SR_VOXEL_BRICK_MASK
+#define BRICK_BYTES		(SR_VOXEL_BRICK_SIZE*SR_VOXEL_BRICK_SIZE)
+
+/*
+	θǵطΧʱչľ룬صı߳Ϊλ
+	صı߽ʱضҪԡ
+*/
+static const SrReal RANGE_EPS = 1e-6;
+
+/*
+\brief	FibonacciɢУȡ˻ĸλΪλá
+*/
+static int HashBrick(int bx,int by,int bz,int shift)
+{
+	SrU32 h = (((SrU32)bx*0x9E3779B1u ^ (SrU32)by)*0x9E3779B1u ^ (SrU32)bz)*0x9E3779B1u;
+	return (int)(h >> shift);
+}
+
+/*
+\brief	iĵ꣬voxelBox()ݰʹͬһʽ֤ߵĽȫͬ
+*/
+static SrReal VoxelCenter(SrReal origin,SrReal voxelSize,int i)
+{
+	return origin + ((SrReal)i + 0.5)*voxelSize;
+}
+
+static void GetMinMax(SrReal t0, SrReal t1, SrReal t2,SrReal& minValue,SrReal& maxValue)
+{
+	minValue = maxValue = t0;
+	if( LESS(t1,minValue) )		minValue = t1;
+	if( GREATER(t1,maxValue))	maxValue = t1;
+	if( LESS(t2,minValue) )		minValue = t2;
+	if( GREATER(t2,maxValue) )	maxValue = t2;
+}
+
+static bool IsSeparatingAxis(SrReal p0, SrReal p1,SrReal r)
+{
+	SrReal mn,mx;
+	if( LESS(p0,p1) )
+	{
+		mn = p0;
+		mx = p1;
+	}
+	else
+	{
+		mn = p1;
+		mx = p0;
+	}
+	if( LESS(mx,-r) || GREATER(mn,r) )
+		return true;
+	return false;
+}
+
+/*
+\brief	IsSeparatingAxisݰ汾صΪ1λʾ롣
+*/
+static SrSimdReal IsSeparatingAxisPacket(SrSimdReal p0,SrSimdReal p1,SrSimdReal r)
+{
+	SrSimdReal lt = SrSimd::less(p0,p1);
+	SrSimdReal mn = SrSimd::select(lt,p0,p1);
+	SrSimdReal mx = SrSimd::select(lt,p1,p0);
+	return SrSimd::orMask(SrSimd::less(mx,SrSimd::neg(r)),SrSimd::greater(mn,r));
+}
+
+/*
+	εe0 = v1 - v0e1 = v2 - v1e2 = v2 - v0TriangleIntersectionOBB_SeparatingAxisMethodͬ
+	jߵķõv[gEdgeFirst[j]]v[gEdgeLast[j]]
+*/
+static const int gEdgeFirst[3] = {0,1,2};
+static const int gEdgeLast[3]  = {2,0,1};
+
+int TriangleIntersectionVoxel_Packet(const SrTriangle3D& triangle,const SrReal* centerX,SrReal centerY,SrReal centerZ,SrReal halfLength)
+{
+	int i , j , k;
+	SrReal vy[3] , vz[3] , ey[3] , ez[3] , mn , mx;
+	for( i=0 ; i<3 ; i++ )
+	{
+		vy[i] = triangle.mPoint[i].y - centerY;
+		vz[i] = triangle.mPoint[i].z - centerZ;
+	}
+	//YZݰͬ
+	GetMinMax(vy[0],vy[1],vy[2],mn,mx);
+	if( GREATER(mn,halfLength) || LESS(mx,-halfLength) )
+		return 0;
+	GetMinMax(vz[0],vz[1],vz[2],mn,mx);
+	if( GREATER(mn,halfLength) || LESS(mx,-halfLength) )
+		return 0;
+	ey[0] = vy[1] - vy[0];	ez[0] = vz[1] - vz[0];
+	ey[1] = vy[2] - vy[1];	ez[1] = vz[2] - vz[1];
+	ey[2] = vy[2] - vy[0];	ez[2] = vz[2] - vz[0];
+	//XߵĲn = (0,-e.z,e.y)ҲֻYZй
+	SrReal fey[3] , fez[3] , p0 , p2 , r;
+	for( j=0 ; j<3 ; j++ )
+	{
+		fey[j] = fabs(ey[j]);
+		fez[j] = fabs(ez[j]);
+		p0 = -ez[j]*vy[gEdgeFirst[j]] + ey[j]*vz[gEdgeFirst[j]];
+		p2 = -ez[j]*vy[gEdgeLast[j]] + ey[j]*vz[gEdgeLast[j]];
+		r  = fez[j]*halfLength + fey[j]*halfLength;
+		if( IsSeparatingAxis(p0,p2,r) )
+			return 0;
+	}
+	//ƽķX
+	SrReal normalX = ey[0]*ez[2] - ez[0]*ey[2];
+	SrReal minX , maxX;
+	if( GREATER(normalX,0) )
+	{
+		minX = -halfLength;
+		maxX =  halfLength;
+	}
+	else
+	{
+		minX =  halfLength;
+		maxX = -halfLength;
+	}
+
+	const SrSimdReal h		= SrSimd::splat(halfLength);
+	const SrSimdReal negH	= SrSimd::splat(-halfLength);
+	const SrSimdReal zero	= SrSimd::splat(0);
+	const SrSimdReal nx		= SrSimd::splat(normalX);
+	const SrSimdReal nxMin	= SrSimd::splat(normalX*minX);
+	const SrSimdReal nxMax	= SrSimd::splat(normalX*maxX);
+	SrSimdReal vx[3] , ex[3] , fex[3] , sep , m , mnx , mxx , ny , nz , d , t , yMin , yMax , zMin , zMax;
+	int result = 0;
+	for( k=0 ; k<PACKET_WIDTH ; k+=SR_SIMD_WIDTH )
+	{
+		SrSimdReal cx = SrSimd::load(centerX + k);
+		for( i=0 ; i<3 ; i++ )
+			vx[i] = SrSimd::sub(SrSimd::splat(triangle.mPoint[i].x),cx);
+		//X
+		mnx = mxx = vx[0];
+		for( i=1 ; i<3 ; i++ )
+		{
+			m	= SrSimd::less(vx[i],mnx);
+			mnx = SrSimd::select(m,vx[i],mnx);
+			m	= SrSimd::greater(vx[i],mxx);
+			mxx = SrSimd::select(m,vx[i],mxx);
+		}
+		sep = SrSimd::orMask(SrSimd::greater(mnx,h),SrSimd::less(mxx,negH));
+		if( SrSimd::moveMask(sep)==SR_SIMD_FULL_MASK )
+			continue;
+		//ڵƽ
+		ex[0] = SrSimd::sub(vx[1],vx[0]);
+		ex[1] = SrSimd::sub(vx[2],vx[1]);
+		ex[2] = SrSimd::sub(vx[2],vx[0]);
+		ny = SrSimd::sub(SrSimd::mul(SrSimd::splat(ez[0]),ex[2]),SrSimd::mul(ex[0],SrSimd::splat(ez[2])));
+		nz = SrSimd::sub(SrSimd::mul(ex[0],SrSimd::splat(ey[2])),SrSimd::mul(SrSimd::splat(ey[0]),ex[2]));
+		d  = SrSimd::add(SrSimd::add(SrSimd::mul(nx,vx[0]),SrSimd::mul(ny,SrSimd::splat(vy[0]))),SrSimd::mul(nz,SrSimd::splat(vz[0])));
+		d  = SrSimd::neg(d);
+		m	 = SrSimd::greater(ny,zero);
+		yMin = SrSimd::select(m,negH,h);
+		yMax = SrSimd::select(m,h,negH);
+		m	 = SrSimd::greater(nz,zero);
+		zMin = SrSimd::select(m,negH,h);
+		zMax = SrSimd::select(m,h,negH);
+		t	= SrSimd::add(SrSimd::add(SrSimd::add(nxMin,SrSimd::mul(ny,yMin)),SrSimd::mul(nz,zMin)),d);
+		sep = SrSimd::orMask(sep,SrSimd::greater(t,zero));
+		t	= SrSimd::add(SrSimd::add(SrSimd::add(nxMax,SrSimd::mul(ny,yMax)),SrSimd::mul(nz,zMax)),d);
+		sep = SrSimd::orMask(sep,SrSimd::less(t,zero));
+		if( SrSimd::moveMask(sep)==SR_SIMD_FULL_MASK )
+			continue;
+		//YᡢZߵĲ
+		for( j=0 ; j<3 ; j++ )
+		{
+			const SrSimdReal a = vx[gEdgeFirst[j]];
+			const SrSimdReal c = vx[gEdgeLast[j]];
+			fex[j] = SrSimd::abs(ex[j]);
+			//n = (0,1,0)[cross]e = (e.z,0,-e.x)
+			SrSimdReal q0 = SrSimd::sub(SrSimd::mul(SrSimd::splat(ez[j]),a),SrSimd::mul(ex[j],SrSimd::splat(vz[gEdgeFirst[j]])));
+			SrSimdReal q2 = SrSimd::sub(SrSimd::mul(SrSimd::splat(ez[j]),c),SrSimd::mul(ex[j],SrSimd::splat(vz[gEdgeLast[j]])));
+			SrSimdReal rr = SrSimd::add(SrSimd::splat(fez[j]*halfLength),SrSimd::mul(fex[j],h));
+			sep = SrSimd::orMask(sep,IsSeparatingAxisPacket(q0,q2,rr));
+			//n = (0,0,1)[cross]e = (-e.y,e.x,0)
+			q0 = SrSimd::add(SrSimd::mul(SrSimd::splat(-ey[j]),a),SrSimd::mul(ex[j],SrSimd::splat(vy[gEdgeFirst[j]])));
+			q2 = SrSimd::add(SrSimd::mul(SrSimd::splat(-ey[j]),c),SrSimd::mul(ex[j],SrSimd::splat(vy[gEdgeLast[j]])));
+			rr = SrSimd::add(SrSimd::splat(fey[j]*halfLength),SrSimd::mul(fex[j],h));
+			sep = SrSimd::orMask(sep,IsSeparatingAxisPacket(q0,q2,rr));
+		}
+		result |= (~SrSimd::moveMask(sep) & SR_SIMD_FULL_MASK) << k;
+	}
+	return result;
+}
+
+SrVoxelGrid::SrVoxelGrid()
+{
+	mTable = NULL;
+	reset(SrPoint3D(0,0,0),1);
+}
+
+SrVoxelGrid::SrVoxelGrid(const SrPoint3D& origin,SrReal voxelSize)
+{
+	mTable = NULL;
+	reset(origin,voxelSize);
+}
+
+SrVoxelGrid::~SrVoxelGrid()
+{
+	if( mTable )
+		delete []mTable;
+}
+
+void SrVoxelGrid::reset(const SrPoint3D& origin,SrReal voxelSize)
+{
+	ASSERT(GREATER(voxelSize,0));
+	mOrigin	   = origin;
+	mVoxelSize = voxelSize;
+	clear();
+}
+
+void SrVoxelGrid::clear()
+{
+	if( mTable )
+		delete []mTable;
+	mCapacity = 16;
+	mShift	  = 28;
+	mTable	  = new int[mCapacity];
+	memset(mTable,0xff,sizeof(int)*mCapacity);
+	mBrick.clear();
+}
+
+/*
+\brief	̽ש顣
+*/
+const tVoxelBrick* SrVoxelGrid::findBrick(int bx,int by,int bz) const
+{
+	int mask = mCapacity - 1;
+	int i = HashBrick(bx,by,bz,mShift) , k;
+	const tVoxelBrick* brick;
+	while( (k = mTable[i])>=0 )
+	{
+		brick = &mBrick[k];
+		if( brick->mBrick[0]==bx && brick->mBrick[1]==by && brick->mBrick[2]==bz )
+			return brick;
+		i = (i + 1) & mask;
+	}
+	return NULL;
+}
+
+tVoxelBrick* SrVoxelGrid::findBrick(int bx,int by,int bz,bool isInsert)
+{
+	tVoxelBrick* brick = const_cast<tVoxelBrick*>(((const SrVoxelGrid*)this)->findBrick(bx,by,bz));
+	if( brick || !isInsert )
+		return brick;
+	//װӲ0.5
+	if( 2*((int)mBrick.size() + 1)>mCapacity )
+		rehash(2*mCapacity);
+	int mask = mCapacity - 1;
+	int i = HashBrick(bx,by,bz,mShift);
+	while( mTable[i]>=0 )
+		i = (i + 1) & mask;
+	mTable[i] = (int)mBrick.size();
+
+	tVoxelBrick newBrick;
+	newBrick.mBrick[0] = bx;
+	newBrick.mBrick[1] = by;
+	newBrick.mBrick[2] = bz;
+	memset(newBrick.mBits,0,sizeof(newBrick.mBits));
+	mBrick.push_back(newBrick);
+	return &mBrick.back();
+}
+
+void SrVoxelGrid::rehash(int capacity)
+{
+	ASSERT(capacity==2*mCapacity);
+	delete []mTable;
+	mCapacity = capacity;
+	mShift --;
+	mTable	  = new int[mCapacity];
+	memset(mTable,0xff,sizeof(int)*mCapacity);
+	int mask = mCapacity - 1 , i , k;
+	for( k=0 ; k<(int)mBrick.size() ; k++ )
+	{
+		i = HashBrick(mBrick[k].mBrick[0],mBrick[k].mBrick[1],mBrick[k].mBrick[2],mShift);
+		while( mTable[i]>=0 )
+			i = (i + 1) & mask;
+		mTable[i] = k;
+	}
+}
+
+bool SrVoxelGrid::getVoxel(int x,int y,int z) const
+{
+	const tVoxelBrick* brick = findBrick(x>>BRICK_SHIFT,y>>BRICK_SHIFT,z>>BRICK_SHIFT);
+	if( !brick )
+		return false;
+	return ((brick->mBits[((z&BRICK_MASK)<<BRICK_SHIFT) + (y&BRICK_MASK)] >> (x&BRICK_MASK)) & 1)!=0;
+}
+
+void SrVoxelGrid::setVoxel(int x,int y,int z)
+{
+	tVoxelBrick* brick = findBrick(x>>BRICK_SHIFT,y>>BRICK_SHIFT,z>>BRICK_SHIFT,true);
+	brick->mBits[((z&BRICK_MASK)<<BRICK_SHIFT) + (y&BRICK_MASK)] |= (unsigned char)(1<<(x&BRICK_MASK));
+}
+
+const SrOBBox3D SrVoxelGrid::voxelBox(int x,int y,int z) const
+{
+	SrOBBox3D box;
+	box.mCenter.x = VoxelCenter(mOrigin.x,mVoxelSize,x);
+	box.mCenter.y = VoxelCenter(mOrigin.y,mVoxelSize,y);
+	box.mCenter.z = VoxelCenter(mOrigin.z,mVoxelSize,z);
+	box.mAxis[0].set(1,0,0);
+	box.mAxis[1].set(0,1,0);
+	box.mAxis[2].set(0,0,1);
+	box.mHalfLength[0] = box.mHalfLength[1] = box.mHalfLength[2] = mVoxelSize/2;
+	return box;
+}
+
+int SrVoxelGrid::countVoxel() const
+{
+	int count = 0 , i , k;
+	unsigned char bits;
+	for( i=0 ; i<(int)mBrick.size() ; i++ )
+	{
+		for( k=0 ; k<BRICK_BYTES ; k++ )
+		{
+			for( bits=mBrick[i].mBits[k] ; bits ; bits&=bits-1 )
+				count ++;
+		}
+	}
+	return count;
+}
+
+void SrVoxelGrid::merge(const SrVoxelGrid& other)
+{
+	ASSERT(EQUAL(mVoxelSize,other.mVoxelSize));
+	int i , k;
+	tVoxelBrick* brick;
+	for( i=0 ; i<(int)other.mBrick.size() ; i++ )
+	{
+		const tVoxelBrick& src = other.mBrick[i];
+		brick = findBrick(src.mBrick[0],src.mBrick[1],src.mBrick[2],true);
+		for( k=0 ; k<BRICK_BYTES ; k++ )
+			brick->mBits[k] |= src.mBits[k];
+	}
+}
+
+void SrVoxelGrid::voxelizeTriangle(const SrTriangle3D& triangle,int kernel)
+{
+	int c , lo[3] , hi[3];
+	SrReal mn , mx;
+	for( c=0 ; c<3 ; c++ )
+	{
+		mn = mx = triangle.mPoint[0][c];
+		if( triangle.mPoint[1][c]<mn )	mn = triangle.mPoint[1][c];
+		if( triangle.mPoint[1][c]>mx )	mx = triangle.mPoint[1][c];
+		if( triangle.mPoint[2][c]<mn )	mn = triangle.mPoint[2][c];
+		if( triangle.mPoint[2][c]>mx )	mx = triangle.mPoint[2][c];
+		lo[c] = (int)floor((mn - mOrigin[c])/mVoxelSize - RANGE_EPS);
+		hi[c] = (int)floor((mx - mOrigin[c])/mVoxelSize + RANGE_EPS);
+	}
+
+	SrReal centerX[PACKET_WIDTH] , centerY , centerZ , halfLength = mVoxelSize/2;
+	int x , y , z , bx , base , first , last , bits , lane;
+	tVoxelBrick* brick;
+	for( z=lo[2] ; z<=hi[2] ; z++ )
+	{
+		centerZ = VoxelCenter(mOrigin.z,mVoxelSize,z);
+		for( y=lo[1] ; y<=hi[1] ; y++ )
+		{
+			centerY = VoxelCenter(mOrigin.y,mVoxelSize,y);
+			for( bx=lo[0]>>BRICK_SHIFT ; bx<=(hi[0]>>BRICK_SHIFT) ; bx++ )
+			{
+				base  = bx<<BRICK_SHIFT;
+				first = lo[0]>base ? lo[0] : base;
+				last  = hi[0]<base + BRICK_MASK ? hi[0] : base + BRICK_MASK;
+				if( kernel==SR_VOXEL_KERNEL_PACKET )
+				{
+					for( lane=0 ; lane<PACKET_WIDTH ; lane++ )
+						centerX[lane] = VoxelCenter(mOrigin.x,mVoxelSize,base + lane);
+					bits  = TriangleIntersectionVoxel_Packet(triangle,centerX,centerY,centerZ,halfLength);
+					bits &= ((1<<(last - first + 1)) - 1) << (first - base);
+				}
+				else
+				{
+					bits = 0;
+					for( x=first ; x<=last ; x++ )
+					{
+						SrOBBox3D box = voxelBox(x,y,z);
+						bool isOverlap = kernel==SR_VOXEL_KERNEL_SAT ? TriangleIntersectionOBB_SeparatingAxisMethod(triangle,box)
+																	   : TriangleIntersectionOBB_Voorhies(triangle,box);
+						if( isOverlap )
+							bits |= 1<<(x - base);
+					}
+				}
+				if( bits )
+				{
+					brick = findBrick(bx,y>>BRICK_SHIFT,z>>BRICK_SHIFT,true);
+					brick->mBits[((z&BRICK_MASK)<<BRICK_SHIFT) + (y&BRICK_MASK)] |= (unsigned char)bits;
+				}
+			}
+		}
+	}
+}
+
+int SrVoxelGrid::voxelize(const SrTriangle3D* triangle,int numTriangle,int kernel)
+{
+	voxelizeRange(triangle,NULL,NULL,numTriangle,kernel);
+	return countVoxel();
+}
+
+int SrVoxelGrid::voxelize(const SrPoint3D* vertex,const int* vertexIndex,int numTriangle,int kernel)
+{
+	voxelizeRange(NULL,vertex,vertexIndex,numTriangle,kernel);
+	return countVoxel();
+}
+
+/*
+\brief	triangleΪNULLʱֱʹ飬öΡ
+		0ֱ߳д뵱ǰ̸߳дһʱ󰴶ķʽԺϲ
+		ÿһֵĺϲ֮以أԲС
+*/
+void SrVoxelGrid::voxelizeRange(const SrTriangle3D* triangle,const SrPoint3D* vertex,const int* vertexIndex,int numTriangle,int kernel)
+{
+	int numThread = 1 , i , t , step;
+#ifdef _OPENMP
+	if( numTriangle>=1024 )
+		numThread = omp_get_max_threads();
+#endif
+	std::vector<SrVoxelGrid*> grid(numThread);
+	grid[0] = this;
+	for( t=1 ; t<numThread ; t++ )
+		grid[t] = new SrVoxelGrid(mOrigin,mVoxelSize);
+
+#pragma omp parallel num_threads(numThread) private(i)
+	{
+		int thread = 0;
+#ifdef _OPENMP
+		thread = omp_get_thread_num();
+#endif
+		SrVoxelGrid* local = grid[thread];
+		SrTriangle3D tri;
+#pragma omp for schedule(dynamic,256)
+		for( i=0 ; i<numTriangle ; i++ )
+		{
+			if( triangle )
+			{
+				local->voxelizeTriangle(triangle[i],kernel);
+			}
+			else
+			{
+				tri.mPoint[0] = vertex[vertexIndex[3*i]];
+				tri.mPoint[1] = vertex[vertexIndex[3*i + 1]];
+				tri.mPoint[2] = vertex[vertexIndex[3*i + 2]];
+				local->voxelizeTriangle(tri,kernel);
+			}
+		}
+	}
+
+	for( step=1 ; step<numThread ; step*=2 )
+	{
+#pragma omp parallel for schedule(dynamic,1)
+		for( t=0 ; t<numThread ; t+=2*step )
+		{
+			if( t + step<numThread )
+			{
+				grid[t]->merge(*grid[t + step]);
+				delete grid[t + step];
+				grid[t + step] = NULL;
+			}
+		}
+	}
+}
@@ -0,0 +1,136 @@
+/************************************************************************
+\link	www.twinklingstar.cn
+\author Twinkling Star
+\date	2026/10/19
+****************************************************************************/
+#ifndef SR_ALGORITHMS_MESH_VOXELIZER_H_
+#define SR_ALGORITHMS_MESH_VOXELIZER_H_
+
+/** \addtogroup algorithms
+  @{
+*/
+#include "TriangleOverlapTestBV.h"
+#include <vector>
+
+/*
+	שı߳Ϊ2^SR_VOXEL_BRICK_SHIFTأһש鹲8*8*8
+*/
+#define SR_VOXEL_BRICK_SHIFT		3
+#define SR_VOXEL_BRICK_SIZE			(1<<SR_VOXEL_BRICK_SHIFT)
+#define SR_VOXEL_BRICK_MASK			(SR_VOXEL_BRICK_SIZE - 1)
+/*
+	һݰXصĸשı߳һݰĽשеһֽ
+*/
+#define SR_VOXEL_PACKET_WIDTH		SR_VOXEL_BRICK_SIZE
+
+/*
+	ػʹõصص㷨
+*/
+#define SR_VOXEL_KERNEL_PACKET		0
+#define SR_VOXEL_KERNEL_SAT			1
+#define SR_VOXEL_KERNEL_VOORHIES	2
+
+/**
+\brief A brick of 8x8x8 voxels of the sparse voxel grid.
+
+mBrick is the brick coordinate, the voxel (x,y,z) of the grid is in the brick
+(x>>3,y>>3,z>>3). The occupancy of the voxel is the bit (x&7) of the byte
+mBits[(z&7)*8 + (y&7)], so a row of 8 voxels along the X axis is one byte.
+*/
+typedef struct
+{
+	int				mBrick[3];
+	unsigned char	mBits[SR_VOXEL_BRICK_SIZE*SR_VOXEL_BRICK_SIZE];
+}tVoxelBrick;
+
+typedef std::vector<tVoxelBrick>	VoxelBrickArray;
+
+/**
+\brief Sparse voxel grid, only the bricks with occupied voxels are stored.
+
+The voxel (x,y,z) is the closed cube [mOrigin + (x,y,z)*mVoxelSize, mOrigin + (x+1,y+1,z+1)*mVoxelSize],
+the voxel coordinates may be negative. The bricks are kept in mBrick, in the
+order they were created, and an open addressing hash table maps a brick
+coordinate to its index in mBrick.
+*/
+class SrVoxelGrid
+{
+public:
+	SrVoxelGrid();
+	SrVoxelGrid(const SrPoint3D& origin,SrReal voxelSize);
+	~SrVoxelGrid();
+	/**
+	\brief Release all the bricks and set the origin and the size of the voxels.
+	*/
+	void				reset(const SrPoint3D& origin,SrReal voxelSize);
+	void				clear();
+
+	bool				getVoxel(int x,int y,int z) const;
+	void				setVoxel(int x,int y,int z);
+	/**
+	\brief The cube of the voxel (x,y,z) as an OBB with the coordinate axes.
+	*/
+	const SrOBBox3D		voxelBox(int x,int y,int z) const;
+	/**
+	\brief The number of occupied voxels.
+	*/
+	int					countVoxel() const;
+	int					numBrick() const	{ return (int)mBrick.size(); }
+	/**
+	\brief Find the brick with the brick coordinate (bx,by,bz).
+	\param[in] isInsert Insert an empty brick if it is not found.
+	\return The brick, or NULL if it is not found and isInsert is false.
+	*/
+	tVoxelBrick*		findBrick(int bx,int by,int bz,bool isInsert);
+	const tVoxelBrick*	findBrick(int bx,int by,int bz) const;
+	/**
+	\brief Add the occupied voxels of other, which must have the same origin and voxel size.
+	*/
+	void				merge(const SrVoxelGrid& other);
+
+	/**
+	\brief Conservative voxelization, mark every voxel that overlaps one of the triangles.
+	The voxels already occupied are kept. The triangles are distributed over
+	the threads, every thread fills a grid of its own and the grids are merged
+	in pairs at the end.
+	\param[in] kernel SR_VOXEL_KERNEL_PACKET, SR_VOXEL_KERNEL_SAT or SR_VOXEL_KERNEL_VOORHIES.
+	\return The number of occupied voxels.
+	*/
+	int					voxelize(const SrTriangle3D* triangle,int numTriangle,int kernel = SR_VOXEL_KERNEL_PACKET);
+	/**
+	\brief The same as above, the i-th triangle is vertex[vertexIndex[3*i]],vertex[vertexIndex[3*i+1]],vertex[vertexIndex[3*i+2]].
+	*/
+	int					voxelize(const SrPoint3D* vertex,const int* vertexIndex,int numTriangle,int kernel = SR_VOXEL_KERNEL_PACKET);
+	/**
+	\brief Mark the voxels that overlap one triangle, only the voxels in the AABB of the triangle are tested.
+	*/
+	void				voxelizeTriangle(const SrTriangle3D& triangle,int kernel = SR_VOXEL_KERNEL_PACKET);
+
+public:
+	SrPoint3D			mOrigin;
+	SrReal				mVoxelSize;
+	VoxelBrickArray		mBrick;
+
+private:
+	SrVoxelGrid(const SrVoxelGrid&);
+	SrVoxelGrid& operator=(const SrVoxelGrid&);
+
+	void				voxelizeRange(const SrTriangle3D* triangle,const SrPoint3D* vertex,const int* vertexIndex,int numTriangle,int kernel);
+	void				rehash(int capacity);
+
+	int*				mTable;			//Index of the brick in mBrick, -1 if the slot is empty.
+	int					mCapacity;		//A power of two.
+	int					mShift;			//32 - log2(mCapacity).
+};
+
+/*
+\brief	SSE2ĴжX᷽SR_VOXEL_PACKET_WIDTHǷص
+		i(centerX[i],centerY,centerZ)߳halfLength
+		ֻYZйصķᣨYᡢZԼXߵĲݰֻһΣÿĽ
+		TriangleIntersectionOBB_SeparatingAxisMethodȫͬ
+\return	λ룬iλΪ1ʾiص
+*/
+int TriangleIntersectionVoxel_Packet(const SrTriangle3D& triangle,const SrReal* centerX,SrReal centerY,SrReal centerZ,SrReal halfLength);
+
+/** @} */
+#endif
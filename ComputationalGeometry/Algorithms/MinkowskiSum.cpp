@@ -0,0 +1,88 @@
+/************************************************************************
+\link	www.twinklingstar.cn
+\author Twinkling Star
+\date	2026/10/19
+****************************************************************************/
+/************************************************************************
+\description	͹εMinkowskiͣʱ͹δͬһϵļ㿪ʼ
+				ǵı߶ǵ鲢һ鲢мɵõ͵ı߽硣
+****************************************************************************/
+#include "MinkowskiSum.h"
+#include <algorithm>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+/*
+\brief	p[startP]q[startQ]ʼǹ鲢εıߣp[startP]q[startQ]ͬһϵļ㡣
+*/
+static int MergeEdges(const SrPoint2D* p,int numP,int startP,const SrPoint2D* q,int numQ,int startQ,SrPoint2D* result)
+{
+	int i = startP , j = startQ , usedP = 0 , usedQ = 0 , n = 0;
+	SrReal cross;
+	result[n++] = p[i] + q[j];
+	while( true )
+	{
+		if( usedP==numP )
+			cross = -1;
+		else if( usedQ==numQ )
+			cross = 1;
+		else
+		{
+			SrVector2D edgeP = p[Next(i,numP)] - p[i] , edgeQ = q[Next(j,numQ)] - q[j];
+			cross = edgeP.cross(edgeQ);
+			//SrSweepSegment::intersect()һжƽ
+			if( cross*cross<=SR_EPS*SR_EPS*edgeP.magnitudeSquared()*edgeQ.magnitudeSquared() )
+				cross = 0;
+		}
+		//pıߵļǽСʱpıߣƽʱͬʱ
+		if( cross>=0 )
+		{
+			i = Next(i,numP);
+			usedP ++;
+		}
+		if( cross<=0 )
+		{
+			j = Next(j,numQ);
+			usedQ ++;
+		}
+		if( usedP==numP && usedQ==numQ )
+			break;
+		result[n++] = p[i] + q[j];
+	}
+	return n;
+}
+
+int ConvexMinkowskiSum(const SrPoint2D* p,int numP,const SrPoint2D* q,int numQ,SrPoint2D* result)
+{
+	return MergeEdges(p,numP,LowestVertex(p,numP),q,numQ,LowestVertex(q,numQ),result);
+}
+
+int ConvexMinkowskiSumBatch(const SrPoint2D* vertex,const int* polygonStart,int numPolygon,const SrPoint2D* footprint,int numFootprint,
+							std::vector<SrPoint2D>& result,std::vector<int>& resultStart)
+{
+	int i , startFootprint = LowestVertex(footprint,numFootprint);
+	std::vector<int> count(numPolygon);
+	resultStart.resize(numPolygon + 1);
+	result.resize(polygonStart[numPolygon] - polygonStart[0] + numPolygon*numFootprint);
+
+	//iдܵλϣ˳ؽ
+#pragma omp parallel for schedule(dynamic,256)
+	for( i=0 ; i<numPolygon ; i++ )
+	{
+		const SrPoint2D* polygon = vertex + polygonStart[i];
+		int numVertex = polygonStart[i + 1] - polygonStart[i];
+		count[i] = MergeEdges(polygon,numVertex,LowestVertex(polygon,numVertex),footprint,numFootprint,startFootprint,
+							  &result[0] + polygonStart[i] - polygonStart[0] + i*numFootprint);
+	}
+	resultStart[0] = 0;
+	for( i=0 ; i<numPolygon ; i++ )
+	{
+		int slot = polygonStart[i] - polygonStart[0] + i*numFootprint;
+		if( slot!=resultStart[i] )
+			std::copy(result.begin() + slot,result.begin() + slot + count[i],result.begin() + resultStart[i]);
+		resultStart[i + 1] = resultStart[i] + count[i];
+	}
+	result.resize(resultStart[numPolygon]);
+	return resultStart[numPolygon];
+}
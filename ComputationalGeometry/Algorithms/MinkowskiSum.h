@@ -0,0 +1,35 @@
+/************************************************************************
+\link	www.twinklingstar.cn
+\author Twinkling Star
+\date	2026/10/19
+****************************************************************************/
+#ifndef SR_ALGORITHMS_MINKOWSKI_SUM_H_
+#define SR_ALGORITHMS_MINKOWSKI_SUM_H_
+
+/** \addtogroup algorithms
+  @{
+*/
+#include "ConvexPolygon.h"
+#include <vector>
+
+/*
+\brief	͹εMinkowski͡µĶ㿪ʼǹ鲢εıߣ
+		ƽеߺϲһߣʱ临ӶO(n+m)
+\param[in]	p, numP		ʱ˳͹
+\param[in]	q, numQ		ʱ˳͹
+\param[out]	result		ʱ˳MinkowskiͣµĶ㿪ʼҪnumP + numQĿռ
+\return	resultжĸ
+*/
+int ConvexMinkowskiSum(const SrPoint2D* p,int numP,const SrPoint2D* q,int numQ,SrPoint2D* result);
+/*
+\brief	еͬһ͹footprintŶ͹Σû˵ϰ
+		i͹vertex[polygonStart[i]],...,vertex[polygonStart[i + 1] - 1]footprint
+		µĶֻһΡ
+\param[out]	result, resultStart		iresult[resultStart[i]],...,result[resultStart[i + 1] - 1]
+\return	resultжĸ
+*/
+int ConvexMinkowskiSumBatch(const SrPoint2D* vertex,const int* polygonStart,int numPolygon,const SrPoint2D* footprint,int numFootprint,
+							std::vector<SrPoint2D>& result,std::vector<int>& resultStart);
+
+/** @} */
+#endif
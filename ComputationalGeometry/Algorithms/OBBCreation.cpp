@@ -0,0 +1,394 @@
+/************************************************************************		
+\link	www.twinklingstar.cn
+\author Twinkling Star
+\date	2014/06/15
+****************************************************************************/
+/************************************************************************		
+\description	Э㷨ƹƸ㼯СΧС
+				İΧ͹ķΪһᣬתǷ
+				᣻DiTO㷨ֻʮѡᣬĿٰ汾
+****************************************************************************/
+#include "OBBCreation.h"
+#include "SrEigen3.h"
+#include "RotatingCalipers.h"
+#include <vector>
+#include <algorithm>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+const SrOBBox3D approximateSmallestOBB(tHull* hull)
+{
+	SrReal *		area = new SrReal[hull->mNumFacet];
+	SrPoint3D*		mass = new SrPoint3D[hull->mNumFacet];
+	SrVector3 normal;
+	SrPoint3D p0,p1,p2;
+	int i;
+	for( i=0 ; i<hull->mNumFacet ; i++ )
+	{
+		p0 = hull->mVertes[hull->mFacet[i].mVInx[0]];
+		p1 = hull->mVertes[hull->mFacet[i].mVInx[1]];
+		p2 = hull->mVertes[hull->mFacet[i].mVInx[2]];
+
+		normal = (p1 - p0).cross(p2 - p0);
+
+		area[i] = normal.magnitude()*(SrReal)0.5;
+		mass[i] = (p0 + p1 + p2) / (SrReal)3.0;
+	}
+
+	SrReal		sumArea = 0.0;
+	SrPoint3D	sumMass = SrPoint3D(0,0,0);
+	for( i=0 ; i<hull->mNumFacet ; i++ )
+	{
+		sumArea += area[i];
+		sumMass += area[i]*mass[i];
+	}
+	sumMass = sumMass/sumArea;
+
+	SrReal covarMatrx[3][3];
+	int j , k;
+	for( i=0 ; i<3 ; i++ )
+	{
+		for( j=i ; j<3 ; j++ )
+		{
+			covarMatrx[i][j] = covarMatrx[j][i] = 0;
+			for( k=0 ; k<hull->mNumFacet ; k++ )
+			{
+				p0 = hull->mVertes[hull->mFacet[k].mVInx[0]];
+				p1 = hull->mVertes[hull->mFacet[k].mVInx[1]];
+				p2 = hull->mVertes[hull->mFacet[k].mVInx[2]];
+				covarMatrx[i][j] += area[k] * (9*mass[k][i]*mass[k][j] + p0[i]*p0[j] + p1[i]*p1[j] + p2[i]*p2[j]);
+			}
+			covarMatrx[i][j] = covarMatrx[i][j] / ((SrReal)12.0*sumArea) - sumMass[i]*sumMass[j];
+			covarMatrx[j][i] = covarMatrx[i][j];
+		}
+	}
+
+	//Jacobi3*3Э
+	SrReal		eigval[3];
+	SrVector3D	eigvec[3];
+	SrEigen3::solve(covarMatrx,eigval,eigvec);
+	SrVector3D x = eigvec[0] , y = eigvec[1] , z = eigvec[2];
+
+	SrVector3D minLen , maxLen;
+	SrVector3D tmpLen;
+	minLen.set(x.dot(hull->mVertes[0]),y.dot(hull->mVertes[0]),z.dot(hull->mVertes[0]));
+	maxLen = minLen;
+	for( i = 1 ; i<hull->mNumVertes ; i++ )
+	{
+		tmpLen.set(x.dot(hull->mVertes[i]),y.dot(hull->mVertes[i]),z.dot(hull->mVertes[i]));
+		minLen.min(tmpLen);
+		maxLen.max(tmpLen);
+	}
+
+
+	SrOBBox3D obb;
+
+	obb.mAxis[0] = x;
+	obb.mAxis[1] = y;
+	obb.mAxis[2] = z;
+
+	obb.mHalfLength[0] = (maxLen.x - minLen.x)*(SrReal)0.5;
+	obb.mHalfLength[1] = (maxLen.y - minLen.y)*(SrReal)0.5;
+	obb.mHalfLength[2] = (maxLen.z - minLen.z)*(SrReal)0.5;
+
+	obb.mCenter = ((minLen.x + maxLen.x)*(SrReal)0.5)*x + ((minLen.y + maxLen.y)*(SrReal)0.5)*y + ((minLen.z + maxLen.z)*(SrReal)0.5)*z;
+
+	delete []area;
+	delete []mass;
+
+	return obb;
+}
+
+SrReal OBBVolume(const SrOBBox3D& obb)
+{
+	return 8*obb.mHalfLength[0]*obb.mHalfLength[1]*obb.mHalfLength[2];
+}
+
+/*
+\brief	ĵλᣬ㼯ϵķΧõΧС
+*/
+static void FitAxes(const SrPoint3D* point,int numPoint,const SrVector3D* axis,SrOBBox3D& obb)
+{
+	SrVector3D minLen(axis[0].dot(point[0]),axis[1].dot(point[0]),axis[2].dot(point[0])) , maxLen = minLen , len;
+	int i;
+	for( i=1 ; i<numPoint ; i++ )
+	{
+		len.set(axis[0].dot(point[i]),axis[1].dot(point[i]),axis[2].dot(point[i]));
+		minLen.min(len);
+		maxLen.max(len);
+	}
+	for( i=0 ; i<3 ; i++ )
+	{
+		obb.mAxis[i] = axis[i];
+		obb.mHalfLength[i] = (maxLen[i] - minLen[i])*(SrReal)0.5;
+	}
+	obb.mCenter = ((minLen.x + maxLen.x)*(SrReal)0.5)*axis[0] + ((minLen.y + maxLen.y)*(SrReal)0.5)*axis[1] + ((minLen.z + maxLen.z)*(SrReal)0.5)*axis[2];
+}
+
+/*
+\brief	directionֱλ߹ϵ
+*/
+static void PerpendicularAxes(const SrVector3D& direction,SrVector3D& u,SrVector3D& v)
+{
+	if( fabs(direction.x)<fabs(direction.y) && fabs(direction.x)<fabs(direction.z) )
+		u = SrVector3D(0,direction.z,-direction.y);
+	else if( fabs(direction.y)<fabs(direction.z) )
+		u = SrVector3D(-direction.z,0,direction.x);
+	else
+		u = SrVector3D(direction.y,-direction.x,0);
+	u.normalize();
+	v = direction.cross(u);
+}
+
+const SrOBBox3D ditoOBB(const SrPoint3D* point,int numPoint)
+{
+	ASSERT(numPoint>=1);
+	//7̶ķϵ14
+	static const SrReal direction[7][3] = {{1,0,0},{0,1,0},{0,0,1},{1,1,1},{1,1,-1},{1,-1,1},{1,-1,-1}};
+	SrPoint3D extreme[14];
+	SrReal minProj[7] , maxProj[7] , proj;
+	int i , j , k;
+	for( j=0 ; j<7 ; j++ )
+	{
+		SrVector3D n(direction[j][0],direction[j][1],direction[j][2]);
+		minProj[j] = maxProj[j] = n.dot(point[0]);
+		extreme[2*j] = extreme[2*j + 1] = point[0];
+		for( i=1 ; i<numPoint ; i++ )
+		{
+			proj = n.dot(point[i]);
+			if( proj<minProj[j] )
+			{
+				minProj[j] = proj;
+				extreme[2*j] = point[i];
+			}
+			if( proj>maxProj[j] )
+			{
+				maxProj[j] = proj;
+				extreme[2*j + 1] = point[i];
+			}
+		}
+	}
+
+	//ԶһԼεĵһߣֱԶļǵ
+	int best = 0;
+	for( j=1 ; j<7 ; j++ )
+	{
+		if( (extreme[2*j + 1] - extreme[2*j]).magnitudeSquared()>(extreme[2*best + 1] - extreme[2*best]).magnitudeSquared() )
+			best = j;
+	}
+	SrPoint3D p0 = extreme[2*best] , p1 = extreme[2*best + 1] , p2 = p0;
+	SrVector3D e0 = p1 - p0 , axis[3];
+	SrOBBox3D obb;
+	if( e0.normalize()<=SR_EPS )
+	{
+		axis[0] = SrVector3D(1,0,0);
+		axis[1] = SrVector3D(0,1,0);
+		axis[2] = SrVector3D(0,0,1);
+		FitAxes(point,numPoint,axis,obb);
+		return obb;
+	}
+	SrReal dist , maxDist = -1;
+	for( k=0 ; k<14 ; k++ )
+	{
+		SrVector3D d = extreme[k] - p0;
+		dist = (d - e0*e0.dot(d)).magnitudeSquared();
+		if( dist>maxDist )
+		{
+			maxDist = dist;
+			p2 = extreme[k];
+		}
+	}
+	SrVector3D n = e0.cross(p2 - p0);
+	if( n.normalize()<=SR_EPS*e0.dot(p1 - p0) )
+	{
+		//еĵƹ
+		axis[0] = e0;
+		PerpendicularAxes(e0,axis[1],axis[2]);
+		FitAxes(point,numPoint,axis,obb);
+		return obb;
+	}
+
+	//ΣԼԶļ㹹ɵ
+	SrPoint3D triangle[7][3];
+	int numTriangle = 1;
+	triangle[0][0] = p0;
+	triangle[0][1] = p1;
+	triangle[0][2] = p2;
+	SrReal minHeight = 0 , maxHeight = 0 , height;
+	SrPoint3D lowest = p0 , highest = p0;
+	for( k=0 ; k<14 ; k++ )
+	{
+		height = n.dot(extreme[k] - p0);
+		if( height<minHeight )
+		{
+			minHeight = height;
+			lowest = extreme[k];
+		}
+		if( height>maxHeight )
+		{
+			maxHeight = height;
+			highest = extreme[k];
+		}
+	}
+	SrPoint3D apex[2] = {lowest,highest};
+	for( k=0 ; k<2 ; k++ )
+	{
+		if( apex[k]==p0 )
+			continue;
+		for( j=0 ; j<3 ; j++ )
+		{
+			triangle[numTriangle][0] = triangle[0][j];
+			triangle[numTriangle][1] = triangle[0][(j + 1) % 3];
+			triangle[numTriangle][2] = apex[k];
+			numTriangle ++;
+		}
+	}
+
+	//ѡ14ϵİ
+	SrReal quality , bestQuality = SR_MAX_F64;
+	SrVector3D bestAxis[3] , normal , edge;
+	SrOBBox3D box;
+	for( k=0 ; k<numTriangle ; k++ )
+	{
+		normal = (triangle[k][1] - triangle[k][0]).cross(triangle[k][2] - triangle[k][0]);
+		if( normal.normalize()<=SR_EPS )
+			continue;
+		for( j=0 ; j<3 ; j++ )
+		{
+			edge = triangle[k][(j + 1) % 3] - triangle[k][j];
+			if( edge.normalize()<=SR_EPS )
+				continue;
+			axis[0] = edge;
+			axis[1] = normal;
+			axis[2] = edge.cross(normal);
+			FitAxes(extreme,14,axis,box);
+			quality = box.mHalfLength[0]*box.mHalfLength[1] + box.mHalfLength[1]*box.mHalfLength[2] + box.mHalfLength[2]*box.mHalfLength[0];
+			if( quality<bestQuality )
+			{
+				bestQuality = quality;
+				bestAxis[0] = axis[0];
+				bestAxis[1] = axis[1];
+				bestAxis[2] = axis[2];
+			}
+		}
+	}
+	FitAxes(point,numPoint,bestAxis,obb);
+	return obb;
+}
+
+/*
+\brief	facetķΪһᣬתǷᡣ͹ϵͶӰɳ
+		渲ǣͶӰ͹ֻҪЩ뱳ڵĶ㣬뷨
+		йأжϳطĸ߶ֱɨж㣬ķܲ׼
+		ɽͣϡ
+\param[in]	normal					ĵλ
+\param[in]	front, point, hull2D	߳ԼĻ
+\return	ͶӰ͹˻3ʱfalseɰΧ
+*/
+static bool FacetOBB(const tHull* hull,const SrVector3D* normal,int facet,
+					 std::vector<char>& front,std::vector<SrPoint2D>& point,std::vector<SrPoint2D>& hull2D,
+					 tCalipersResult& calipers,SrOBBox3D& obb)
+{
+	const SrPoint3D* vertex = hull->mVertes;
+	const SrVector3D& n = normal[facet];
+	SrVector3D u , v;
+	PerpendicularAxes(n,u,v);
+	int i , j , numPoint = 0 , numHull;
+	for( i=0 ; i<hull->mNumFacet ; i++ )
+		front[i] = normal[i].dot(n)>0;
+	for( i=0 ; i<hull->mNumFacet ; i++ )
+	{
+		const tFacet& f = hull->mFacet[i];
+		if( !front[i] || (front[f.mFInx[0]] && front[f.mFInx[1]] && front[f.mFInx[2]]) )
+			continue;
+		for( j=0 ; j<3 ; j++ )
+			point[numPoint++] = SrPoint2D(u.dot(vertex[f.mVInx[j]]),v.dot(vertex[f.mVInx[j]]));
+	}
+	numHull = MonotoneChainHull(&point[0],numPoint,&hull2D[0]);
+	//RotatingCalipersֻASSERT鶥˻ͶӰ빲һ
+	if( numHull<3 )
+		return false;
+	RotatingCalipers(&hull2D[0],numHull,calipers,false);
+	SrReal minHeight = SR_MAX_F64 , maxHeight = -SR_MAX_F64 , height;
+	for( i=0 ; i<hull->mNumVertes ; i++ )
+	{
+		height = n.dot(vertex[i]);
+		minHeight = std::min(minHeight,height);
+		maxHeight = std::max(maxHeight,height);
+	}
+
+	const tCalipersRectangle& rect = calipers.mMinAreaRectangle;
+	obb.mAxis[0] = u*rect.mAxis[0].x + v*rect.mAxis[0].y;
+	obb.mAxis[1] = u*rect.mAxis[1].x + v*rect.mAxis[1].y;
+	obb.mAxis[2] = n;
+	obb.mHalfLength[0] = rect.mHalfLength[0];
+	obb.mHalfLength[1] = rect.mHalfLength[1];
+	obb.mHalfLength[2] = (maxHeight - minHeight)*(SrReal)0.5;
+	obb.mCenter = u*rect.mCenter.x + v*rect.mCenter.y + n*((minHeight + maxHeight)*(SrReal)0.5);
+	return true;
+}
+
+const SrOBBox3D tightSmallestOBB(tHull* hull,bool isFast)
+{
+	SrOBBox3D obb;
+	if( isFast )
+		obb = ditoOBB(hull->mVertes,hull->mNumVertes);
+	else
+	{
+		int i , numFacet = hull->mNumFacet , minFacet = -1;
+		SrReal minVolume = SR_MAX_F64;
+		std::vector<SrVector3D> normal(numFacet,SrVector3D(0,0,0));
+		for( i=0 ; i<numFacet ; i++ )
+		{
+			const tFacet& f = hull->mFacet[i];
+			normal[i] = (hull->mVertes[f.mVInx[1]] - hull->mVertes[f.mVInx[0]]).cross(hull->mVertes[f.mVInx[2]] - hull->mVertes[f.mVInx[0]]);
+			normal[i].normalize();
+		}
+#pragma omp parallel
+		{
+			//ÿ̵߳Ļ棬ԼҵСİΧ
+			std::vector<char> front(numFacet);
+			std::vector<SrPoint2D> point(3*numFacet,SrPoint2D(0,0)) , hull2D(3*numFacet + 1,SrPoint2D(0,0));
+			tCalipersResult calipers;
+			SrOBBox3D box , threadBox;
+			SrReal volume , threadVolume = SR_MAX_F64;
+			int facet , j , threadFacet = -1;
+#pragma omp for schedule(dynamic,16)
+			for( facet=0 ; facet<numFacet ; facet++ )
+			{
+				//һŸС湲ʱΧͬ
+				for( j=0 ; j<3 ; j++ )
+				{
+					if( hull->mFacet[facet].mFInx[j]<facet && normal[facet].dot(normal[hull->mFacet[facet].mFInx[j]])>=1 - SR_EPS )
+						break;
+				}
+				if( j<3 || !FacetOBB(hull,&normal[0],facet,front,point,hull2D,calipers,box) )
+					continue;
+				volume = OBBVolume(box);
+				if( volume<threadVolume || (volume==threadVolume && facet<threadFacet) )
+				{
+					threadVolume = volume;
+					threadFacet = facet;
+					threadBox = box;
+				}
+			}
+#pragma omp critical
+			{
+				if( threadFacet>=0 && (threadVolume<minVolume || (threadVolume==minVolume && threadFacet<minFacet)) )
+				{
+					minVolume = threadVolume;
+					minFacet = threadFacet;
+					obb = threadBox;
+				}
+			}
+		}
+		//е涼ʱûתǵİΧУֻPCAİΧ
+		if( minFacet<0 )
+			return approximateSmallestOBB(hull);
+	}
+	SrOBBox3D pcaBox = approximateSmallestOBB(hull);
+	if( OBBVolume(pcaBox)<OBBVolume(obb) )
+		return pcaBox;
+	return obb;
+}
@@ -0,0 +1,41 @@
+/************************************************************************
+\link	www.twinklingstar.cn
+\author Twinkling Star
+\date	2026/10/19
+****************************************************************************/
+#ifndef SR_ALGORITHMS_OBB_CREATION_H_
+#define SR_ALGORITHMS_OBB_CREATION_H_
+
+/** \addtogroup algorithms
+  @{
+*/
+#include "QuickHull.h"
+#include "SrOBBox3D.h"
+
+/*
+\brief	Э㷨ƹ͹СΧС
+\param[in]	hull	洢͹ݽṹЧ͹塣
+\return	SrOBBox3D	عƳСΧС
+*/
+const SrOBBox3D approximateSmallestOBB(tHull* hull);
+/*
+\brief	DiTO㷨ٵعƵ㼯ΧС7̶14㣬оԶ
+		ֱԶĵ㹹ΣټԶ㹹ɵ壬Щε
+		ߡԼǵĲΪѡᣬȡڼϱСһ飬ʱ临ӶO(n)
+\param[in]	point, numPoint	㼯һ
+*/
+const SrOBBox3D ditoOBB(const SrPoint3D* point,int numPoint);
+/*
+\brief	͹ĽСΧСÿķΪһᣬ͹ͶӰϣ
+		תǷͶӰСӾΣõᣬ̵߳رȽİΧС
+		isFastΪtrueʱditoOBB()ҪЭİΧбȽϣСһ
+\param[in]	hull	Ч͹
+*/
+const SrOBBox3D tightSmallestOBB(tHull* hull,bool isFast = false);
+/*
+\brief	Χе
+*/
+SrReal OBBVolume(const SrOBBox3D& obb);
+
+/** @} */
+#endif
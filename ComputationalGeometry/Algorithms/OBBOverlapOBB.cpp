@@ -0,0 +1,406 @@
+/************************************************************************		
+\link	www.twinklingstar.cn
+\author Twinkling Star
+\date	2014/06/19
+****************************************************************************/
+#include "OBBOverlapOBB.h"
+#include <math.h>
+
+//Case 1طڸеţûзʱ-1
+static int ASeparatingAxis(const SrPoint3D&t , const SrReal aHLen[3],const SrVector3D bFabsAxis[3],const SrReal bHLen[3])
+{
+	if( GREATER(fabs(t.x), aHLen[0] + bHLen[0]*bFabsAxis[0].x + bHLen[1]*bFabsAxis[1].x + bHLen[2]*bFabsAxis[2].x) )
+		return 0;
+	if( GREATER(fabs(t.y), aHLen[1] + bHLen[0]*bFabsAxis[0].y + bHLen[1]*bFabsAxis[1].y + bHLen[2]*bFabsAxis[2].y) )
+		return 1;
+	if( GREATER(fabs(t.z), aHLen[2] + bHLen[0]*bFabsAxis[0].z + bHLen[1]*bFabsAxis[1].z + bHLen[2]*bFabsAxis[2].z) )
+		return 2;
+	return -1;
+}
+
+//Case 2
+static int BSeparatingAxis(const SrPoint3D&t , const SrReal aHLen[3],const SrVector3D bFabsAxis[3],const SrReal bHLen[3])
+{
+	if( GREATER(fabs(t.x), aHLen[0]*bFabsAxis[0].x + aHLen[1]*bFabsAxis[0].y + aHLen[2]*bFabsAxis[0].z + bHLen[0]) )
+		return 0;
+	if( GREATER(fabs(t.y), aHLen[0]*bFabsAxis[1].x + aHLen[1]*bFabsAxis[1].y + aHLen[2]*bFabsAxis[1].z + bHLen[1]) )
+		return 1;
+	if( GREATER(fabs(t.z), aHLen[0]*bFabsAxis[2].x + aHLen[1]*bFabsAxis[2].y + aHLen[2]*bFabsAxis[2].z + bHLen[2]) )
+		return 2;
+	return -1;
+}
+
+static int ABSeparatingAxis(const SrPoint3D&c , const SrReal aHLen[3],const SrVector3D bAxis[3],const SrVector3D bFabsAxis[3],const SrReal bHLen[3])
+{
+	SrReal s , r;
+
+	//X and bAxis[0]
+	s = fabs(-bAxis[0].z*c.y + bAxis[0].y*c.z);
+	r = aHLen[1]*bFabsAxis[0].z + aHLen[2]*bFabsAxis[0].y + bHLen[1]*bFabsAxis[2].x + bHLen[2]*bFabsAxis[1].x;
+	if( GREATER(s,r) )	
+		return 0;
+	//X and bAxis[1]
+	s = fabs(-bAxis[1].z*c.y + bAxis[1].y*c.z);
+	r = aHLen[1]*bFabsAxis[1].z + aHLen[2]*bFabsAxis[1].y + bHLen[0]*bFabsAxis[2].x + bHLen[2]*bFabsAxis[0].x;
+	if( GREATER(s,r) )	
+		return 1;
+	//X and bAxis[2]
+	s = fabs(-bAxis[2].z*c.y + bAxis[2].y*c.z);
+	r = aHLen[1]*bFabsAxis[2].z + aHLen[2]*bFabsAxis[2].y + bHLen[0]*bFabsAxis[1].x + bHLen[1]*bFabsAxis[0].x;
+	if( GREATER(s,r) )
+		return 2;
+
+	//Y and bAxis[0]
+	s = fabs(bAxis[0].z*c.x - bAxis[0].x*c.z);
+	r = aHLen[0]*bFabsAxis[0].z + aHLen[2]*bFabsAxis[0].x + bHLen[1]*bFabsAxis[2].y + bHLen[2]*bFabsAxis[1].y;
+	if( GREATER(s,r) )	
+		return 3;
+	//Y and bAxis[1]
+	s = fabs(bAxis[1].z*c.x - bAxis[1].x*c.z);
+	r = aHLen[0]*bFabsAxis[1].z + aHLen[2]*bFabsAxis[1].x + bHLen[0]*bFabsAxis[2].y + bHLen[2]*bFabsAxis[0].y;
+	if( GREATER(s,r) )	
+		return 4;
+	//Y and bAxis[2]
+	s = fabs(bAxis[2].z*c.x - bAxis[2].x*c.z);
+	r = aHLen[0]*bFabsAxis[2].z + aHLen[2]*bFabsAxis[2].x + bHLen[0]*bFabsAxis[1].y + bHLen[1]*bFabsAxis[0].y;
+	if( GREATER(s,r) )	
+		return 5;
+
+	//Z and bAxis[0]
+	s = fabs(-bAxis[0].y*c.x + bAxis[0].x*c.y);
+	r = aHLen[0]*bFabsAxis[0].y + aHLen[1]*bFabsAxis[0].x + bHLen[1]*bFabsAxis[2].z + bHLen[2]*bFabsAxis[1].z;
+	if( GREATER(s,r) )
+		return 6;
+	//Z and bAxis[1]
+	s = fabs(-bAxis[1].y*c.x + bAxis[1].x*c.y);
+	r = aHLen[0]*bFabsAxis[1].y + aHLen[1]*bFabsAxis[1].x + bHLen[0]*bFabsAxis[2].z + bHLen[2]*bFabsAxis[0].z;
+	if( GREATER(s,r) )	
+		return 7;
+	//Z and bAxis[2]
+	s = fabs(-bAxis[2].y*c.x + bAxis[2].x*c.y);
+	r = aHLen[0]*bFabsAxis[2].y + aHLen[1]*bFabsAxis[2].x + bHLen[0]*bFabsAxis[1].z + bHLen[1]*bFabsAxis[0].z;
+	if( GREATER(s,r) )	
+		return 8;
+
+	return -1;
+}
+
+bool	OBBOverlapTestOBB_OptimizedSeparatingAxisMethod(const SrOBBox3D& obbA, const SrOBBox3D& obbB)
+{
+	SrVector3D bAxis[3], o, c, t;
+
+	o = obbB.mCenter - obbA.mCenter;
+
+	c.x = o.dot(obbA.mAxis[0]);
+	c.y = o.dot(obbA.mAxis[1]);
+	c.z = o.dot(obbA.mAxis[2]);
+
+	bAxis[0].x = obbA.mAxis[0].dot(obbB.mAxis[0]);
+	bAxis[0].y = obbA.mAxis[1].dot(obbB.mAxis[0]);
+	bAxis[0].z = obbA.mAxis[2].dot(obbB.mAxis[0]);
+
+	bAxis[1].x = obbA.mAxis[0].dot(obbB.mAxis[1]);
+	bAxis[1].y = obbA.mAxis[1].dot(obbB.mAxis[1]);
+	bAxis[1].z = obbA.mAxis[2].dot(obbB.mAxis[1]);
+
+	bAxis[2].x = obbA.mAxis[0].dot(obbB.mAxis[2]);
+	bAxis[2].y = obbA.mAxis[1].dot(obbB.mAxis[2]);
+	bAxis[2].z = obbA.mAxis[2].dot(obbB.mAxis[2]);
+
+	SrVector3D bFabsAxis[3];
+	bFabsAxis[0].set(fabs(bAxis[0].x),fabs(bAxis[0].y),fabs(bAxis[0].z));
+	bFabsAxis[1].set(fabs(bAxis[1].x),fabs(bAxis[1].y),fabs(bAxis[1].z));
+	bFabsAxis[2].set(fabs(bAxis[2].x),fabs(bAxis[2].y),fabs(bAxis[2].z));
+	//case 1
+	if( ASeparatingAxis(c, obbA.mHalfLength, bFabsAxis, obbB.mHalfLength)>=0 )
+		return false;
+	//case 2
+	t.set(c.dot(bAxis[0]),c.dot(bAxis[1]),c.dot(bAxis[2]));
+	if( BSeparatingAxis(t, obbA.mHalfLength, bFabsAxis, obbB.mHalfLength)>=0 )
+		return false;
+	////case 3
+	if( ABSeparatingAxis(c,obbA.mHalfLength,bAxis,bFabsAxis,obbB.mHalfLength)>=0 )
+		return false;
+	return true;
+}
+
+/*
+	obbBobbAľֲϵµıʾOBBOverlapTestOBB_OptimizedSeparatingAxisMethodļͬ
+*/
+typedef struct
+{
+	SrVector3D	mCenter;
+	SrVector3D	mAxis[3];
+	SrVector3D	mFabsAxis[3];
+}tOBBRelation;
+
+static void ComputeRelation(const SrOBBox3D& obbA, const SrOBBox3D& obbB, tOBBRelation& relation)
+{
+	SrVector3D o = obbB.mCenter - obbA.mCenter;
+	SrVector3D* bAxis = relation.mAxis;
+	int j;
+
+	relation.mCenter.x = o.dot(obbA.mAxis[0]);
+	relation.mCenter.y = o.dot(obbA.mAxis[1]);
+	relation.mCenter.z = o.dot(obbA.mAxis[2]);
+	for( j=0 ; j<3 ; j++ )
+	{
+		bAxis[j].x = obbA.mAxis[0].dot(obbB.mAxis[j]);
+		bAxis[j].y = obbA.mAxis[1].dot(obbB.mAxis[j]);
+		bAxis[j].z = obbA.mAxis[2].dot(obbB.mAxis[j]);
+		relation.mFabsAxis[j].set(fabs(bAxis[j].x),fabs(bAxis[j].y),fabs(bAxis[j].z));
+	}
+}
+
+/*
+\brief	жΪaxisǷǷᣬʽASeparatingAxisBSeparatingAxisABSeparatingAxisͬ
+*/
+static bool SeparatedOnAxis(const tOBBRelation& relation, const SrReal aHLen[3], const SrReal bHLen[3], int axis)
+{
+	static const int otherAxis1[3] = {1,0,0};
+	static const int otherAxis2[3] = {2,2,1};
+	const SrVector3D& c = relation.mCenter;
+	const SrVector3D* bAxis = relation.mAxis;
+	const SrVector3D* bFabsAxis = relation.mFabsAxis;
+	SrReal s , r;
+	int i , j , j1 , j2;
+
+	if( axis<3 )
+	{//Case 1
+		s = fabs(c[axis]);
+		r = aHLen[axis] + bHLen[0]*bFabsAxis[0][axis] + bHLen[1]*bFabsAxis[1][axis] + bHLen[2]*bFabsAxis[2][axis];
+		return GREATER(s,r);
+	}
+	if( axis<6 )
+	{//Case 2
+		j = axis - 3;
+		s = fabs(c.dot(bAxis[j]));
+		r = aHLen[0]*bFabsAxis[j].x + aHLen[1]*bFabsAxis[j].y + aHLen[2]*bFabsAxis[j].z + bHLen[j];
+		return GREATER(s,r);
+	}
+	//Case 3
+	i  = (axis - 6) / 3;
+	j  = (axis - 6) % 3;
+	j1 = otherAxis1[j];
+	j2 = otherAxis2[j];
+	if( i==0 )
+	{
+		s = fabs(-bAxis[j].z*c.y + bAxis[j].y*c.z);
+		r = aHLen[1]*bFabsAxis[j].z + aHLen[2]*bFabsAxis[j].y + bHLen[j1]*bFabsAxis[j2].x + bHLen[j2]*bFabsAxis[j1].x;
+	}
+	else if( i==1 )
+	{
+		s = fabs(bAxis[j].z*c.x - bAxis[j].x*c.z);
+		r = aHLen[0]*bFabsAxis[j].z + aHLen[2]*bFabsAxis[j].x + bHLen[j1]*bFabsAxis[j2].y + bHLen[j2]*bFabsAxis[j1].y;
+	}
+	else
+	{
+		s = fabs(-bAxis[j].y*c.x + bAxis[j].x*c.y);
+		r = aHLen[0]*bFabsAxis[j].y + aHLen[1]*bFabsAxis[j].x + bHLen[j1]*bFabsAxis[j2].z + bHLen[j2]*bFabsAxis[j1].z;
+	}
+	return GREATER(s,r);
+}
+
+/*
+\brief	ֻobbAobbBһ淨ΪҪĵʽComputeRelationSeparatedOnAxisͬ
+		ķ淨ʱؼOBBȫԹϵ
+\param[in]	axis	0~5
+*/
+static bool SeparatedOnFaceAxis(const SrOBBox3D& obbA, const SrOBBox3D& obbB, int axis)
+{
+	SrVector3D o = obbB.mCenter - obbA.mCenter;
+	const SrReal* aHLen = obbA.mHalfLength;
+	const SrReal* bHLen = obbB.mHalfLength;
+	SrReal s , r;
+	if( axis<3 )
+	{
+		const SrVector3D& a = obbA.mAxis[axis];
+		s = fabs(o.dot(a));
+		r = aHLen[axis] + bHLen[0]*fabs(a.dot(obbB.mAxis[0])) + bHLen[1]*fabs(a.dot(obbB.mAxis[1])) + bHLen[2]*fabs(a.dot(obbB.mAxis[2]));
+		return GREATER(s,r);
+	}
+	const SrVector3D& b = obbB.mAxis[axis - 3];
+	SrVector3D c , bAxis;
+	c.x = o.dot(obbA.mAxis[0]);
+	c.y = o.dot(obbA.mAxis[1]);
+	c.z = o.dot(obbA.mAxis[2]);
+	bAxis.x = obbA.mAxis[0].dot(b);
+	bAxis.y = obbA.mAxis[1].dot(b);
+	bAxis.z = obbA.mAxis[2].dot(b);
+	s = fabs(c.dot(bAxis));
+	r = aHLen[0]*fabs(bAxis.x) + aHLen[1]*fabs(bAxis.y) + aHLen[2]*fabs(bAxis.z) + bHLen[axis - 3];
+	return GREATER(s,r);
+}
+
+int	OBBFindSeparatingAxis(const SrOBBox3D& obbA, const SrOBBox3D& obbB, int firstAxis)
+{
+	ASSERT(firstAxis>=-1 && firstAxis<SR_OBB_NUM_SEPARATING_AXIS);
+	if( firstAxis>=0 && firstAxis<6 && SeparatedOnFaceAxis(obbA,obbB,firstAxis) )
+		return firstAxis;
+	tOBBRelation relation;
+	ComputeRelation(obbA,obbB,relation);
+	if( firstAxis>=6 && SeparatedOnAxis(relation,obbA.mHalfLength,obbB.mHalfLength,firstAxis) )
+		return firstAxis;
+	//OBBOverlapTestOBB_OptimizedSeparatingAxisMethod˳ȫ
+	const SrVector3D& c = relation.mCenter;
+	SrVector3D t;
+	int axis;
+	if( (axis = ASeparatingAxis(c,obbA.mHalfLength,relation.mFabsAxis,obbB.mHalfLength))>=0 )
+		return axis;
+	t.set(c.dot(relation.mAxis[0]),c.dot(relation.mAxis[1]),c.dot(relation.mAxis[2]));
+	if( (axis = BSeparatingAxis(t,obbA.mHalfLength,relation.mFabsAxis,obbB.mHalfLength))>=0 )
+		return axis + 3;
+	if( (axis = ABSeparatingAxis(c,obbA.mHalfLength,relation.mAxis,relation.mFabsAxis,obbB.mHalfLength))>=0 )
+		return axis + 6;
+	return -1;
+}
+
+bool	OBBOverlapTestOBB_OptimizedSeparatingAxisMethod2(const SrOBBox3D& obbA, const SrOBBox3D& obbB)
+{
+	SrVector3D t;
+	t = obbB.mCenter - obbA.mCenter;
+	int i , j , k;
+	SrReal s , r;
+	for( i=0 ; i<3 ; i++ )
+	{
+		s = fabs(obbA.mAxis[i].dot(t));
+		r = obbA.mHalfLength[i];
+		for( j=0 ; j<3 ; j++ )
+			r += obbB.mHalfLength[j]*fabs(obbB.mAxis[j].dot(obbA.mAxis[i]));
+		if( GREATER(s,r) )
+			return false;
+	}
+	for( i=0 ; i<3 ; i++ )
+	{
+		s = fabs(obbB.mAxis[i].dot(t));
+		r = obbB.mHalfLength[i];
+		for( j=0 ; j<3 ; j++ )
+			r += obbA.mHalfLength[j]*fabs(obbA.mAxis[j].dot(obbB.mAxis[i]));
+		if( GREATER(s,r) )
+			return false;
+	}
+	SrVector3D n;
+	for( i=0 ; i<3 ; i++ )
+		for( j=0 ; j<3 ; j++ )
+		{
+			n = obbA.mAxis[i].cross(obbB.mAxis[j]);
+			s = fabs(n.dot(t));
+			r = 0.0;
+			for( k=0 ; k<3 ; k++ )
+				r += obbA.mHalfLength[k]*fabs(obbA.mAxis[k].dot(n)) + obbB.mHalfLength[k]*fabs(obbB.mAxis[k].dot(n));
+			if( GREATER(s,r) )
+				return false;
+		}
+
+	return true;
+}
+
+
+/*
+\brief	ж߶OBBǷص޷㡣
+		οģGregory, A., et al. "H-COLLIDE: A framework for fast and accurate collision detection for haptic interaction."
+\return	true	ص
+		false	ص
+*/
+static bool SegmentOverlapTestOBB(const SrPoint3D& s0, const SrPoint3D& s1, const SrOBBox3D& obb)
+{
+	SrPoint3D point1 , point2;
+	SrVector3D p1 = s0 - obb.mCenter;
+	SrVector3D p2 = s1 - obb.mCenter;
+
+	point1.x = obb.mAxis[0].dot(p1);
+	point1.y = obb.mAxis[1].dot(p1);
+	point1.z = obb.mAxis[2].dot(p1);
+
+	point2.x = obb.mAxis[0].dot(p2);
+	point2.y = obb.mAxis[1].dot(p2);
+	point2.z = obb.mAxis[2].dot(p2);
+
+	SrPoint3D m = (point1 + point2)*0.5;
+	SrVector3D w = m - point1;
+
+	SrReal X = fabs(w.x), Y = fabs(w.y) , Z = fabs(w.z);
+	if( GREATER(fabs(m.x),X+obb.mHalfLength[0]) )
+		return false;
+	if( GREATER(fabs(m.y),Y+obb.mHalfLength[1]) )
+		return false;
+	if( GREATER(fabs(m.z),Z+obb.mHalfLength[2]) )
+		return false;
+	if( GREATER(fabs(m.y*w.z - m.z*w.y),obb.mHalfLength[1]*Z + obb.mHalfLength[2]*Y) )
+		return false;
+	if( GREATER(fabs(m.x*w.z - m.z*w.x),obb.mHalfLength[0]*Z + obb.mHalfLength[2]*X) )
+		return false;
+	if( GREATER(fabs(m.x*w.y - m.y*w.x),obb.mHalfLength[0]*Y + obb.mHalfLength[1]*X) )
+		return false;
+	return true;
+}
+
+static bool SubOBBOverlapTestOBB_NaiveMethod(const SrOBBox3D& obbA, const SrOBBox3D& obbB)
+{
+	SrPoint3D s0 , s1;
+
+	//X Direction
+	s0 = obbA.mCenter + obbA.mHalfLength[0]*obbA.mAxis[0] + obbA.mHalfLength[1]*obbA.mAxis[1] + obbA.mHalfLength[2]*obbA.mAxis[2];
+	s1 = obbA.mCenter - obbA.mHalfLength[0]*obbA.mAxis[0] + obbA.mHalfLength[1]*obbA.mAxis[1] + obbA.mHalfLength[2]*obbA.mAxis[2];
+	if( SegmentOverlapTestOBB(s0,s1,obbB) )
+		return true;
+	s0 = obbA.mCenter + obbA.mHalfLength[0]*obbA.mAxis[0] - obbA.mHalfLength[1]*obbA.mAxis[1] + obbA.mHalfLength[2]*obbA.mAxis[2];
+	s1 = obbA.mCenter - obbA.mHalfLength[0]*obbA.mAxis[0] - obbA.mHalfLength[1]*obbA.mAxis[1] + obbA.mHalfLength[2]*obbA.mAxis[2];
+	if( SegmentOverlapTestOBB(s0,s1,obbB) )
+		return true;
+	s0 = obbA.mCenter + obbA.mHalfLength[0]*obbA.mAxis[0] + obbA.mHalfLength[1]*obbA.mAxis[1] - obbA.mHalfLength[2]*obbA.mAxis[2];
+	s1 = obbA.mCenter - obbA.mHalfLength[0]*obbA.mAxis[0] + obbA.mHalfLength[1]*obbA.mAxis[1] - obbA.mHalfLength[2]*obbA.mAxis[2];
+	if( SegmentOverlapTestOBB(s0,s1,obbB) )
+		return true;
+	s0 = obbA.mCenter + obbA.mHalfLength[0]*obbA.mAxis[0] - obbA.mHalfLength[1]*obbA.mAxis[1] - obbA.mHalfLength[2]*obbA.mAxis[2];
+	s1 = obbA.mCenter - obbA.mHalfLength[0]*obbA.mAxis[0] - obbA.mHalfLength[1]*obbA.mAxis[1] - obbA.mHalfLength[2]*obbA.mAxis[2];
+	if( SegmentOverlapTestOBB(s0,s1,obbB) )
+		return true;
+	//Y Direction
+	s0 = obbA.mCenter + obbA.mHalfLength[0]*obbA.mAxis[0] - obbA.mHalfLength[1]*obbA.mAxis[1] + obbA.mHalfLength[2]*obbA.mAxis[2];
+	s1 = obbA.mCenter + obbA.mHalfLength[0]*obbA.mAxis[0] + obbA.mHalfLength[1]*obbA.mAxis[1] + obbA.mHalfLength[2]*obbA.mAxis[2];
+	if( SegmentOverlapTestOBB(s0,s1,obbB) )
+		return true;
+	s0 = obbA.mCenter - obbA.mHalfLength[0]*obbA.mAxis[0] - obbA.mHalfLength[1]*obbA.mAxis[1] + obbA.mHalfLength[2]*obbA.mAxis[2];
+	s1 = obbA.mCenter - obbA.mHalfLength[0]*obbA.mAxis[0] + obbA.mHalfLength[1]*obbA.mAxis[1] + obbA.mHalfLength[2]*obbA.mAxis[2];
+	if( SegmentOverlapTestOBB(s0,s1,obbB) )
+		return true;
+	s0 = obbA.mCenter + obbA.mHalfLength[0]*obbA.mAxis[0] - obbA.mHalfLength[1]*obbA.mAxis[1] - obbA.mHalfLength[2]*obbA.mAxis[2];
+	s1 = obbA.mCenter + obbA.mHalfLength[0]*obbA.mAxis[0] + obbA.mHalfLength[1]*obbA.mAxis[1] - obbA.mHalfLength[2]*obbA.mAxis[2];
+	if( SegmentOverlapTestOBB(s0,s1,obbB) )
+		return true;
+	s0 = obbA.mCenter - obbA.mHalfLength[0]*obbA.mAxis[0] - obbA.mHalfLength[1]*obbA.mAxis[1] - obbA.mHalfLength[2]*obbA.mAxis[2];
+	s1 = obbA.mCenter - obbA.mHalfLength[0]*obbA.mAxis[0] + obbA.mHalfLength[1]*obbA.mAxis[1] - obbA.mHalfLength[2]*obbA.mAxis[2];
+	if( SegmentOverlapTestOBB(s0,s1,obbB) )
+		return true;
+
+	//Z Direction
+	s0 = obbA.mCenter + obbA.mHalfLength[0]*obbA.mAxis[0] + obbA.mHalfLength[1]*obbA.mAxis[1] - obbA.mHalfLength[2]*obbA.mAxis[2];
+	s1 = obbA.mCenter + obbA.mHalfLength[0]*obbA.mAxis[0] + obbA.mHalfLength[1]*obbA.mAxis[1] + obbA.mHalfLength[2]*obbA.mAxis[2];
+	if( SegmentOverlapTestOBB(s0,s1,obbB) )
+		return true;
+	s0 = obbA.mCenter - obbA.mHalfLength[0]*obbA.mAxis[0] + obbA.mHalfLength[1]*obbA.mAxis[1] - obbA.mHalfLength[2]*obbA.mAxis[2];
+	s1 = obbA.mCenter - obbA.mHalfLength[0]*obbA.mAxis[0] + obbA.mHalfLength[1]*obbA.mAxis[1] + obbA.mHalfLength[2]*obbA.mAxis[2];
+	if( SegmentOverlapTestOBB(s0,s1,obbB) )
+		return true;
+	s0 = obbA.mCenter + obbA.mHalfLength[0]*obbA.mAxis[0] - obbA.mHalfLength[1]*obbA.mAxis[1] - obbA.mHalfLength[2]*obbA.mAxis[2];
+	s1 = obbA.mCenter + obbA.mHalfLength[0]*obbA.mAxis[0] - obbA.mHalfLength[1]*obbA.mAxis[1] + obbA.mHalfLength[2]*obbA.mAxis[2];
+	if( SegmentOverlapTestOBB(s0,s1,obbB) )
+		return true;
+	s0 = obbA.mCenter - obbA.mHalfLength[0]*obbA.mAxis[0] - obbA.mHalfLength[1]*obbA.mAxis[1] - obbA.mHalfLength[2]*obbA.mAxis[2];
+	s1 = obbA.mCenter - obbA.mHalfLength[0]*obbA.mAxis[0] - obbA.mHalfLength[1]*obbA.mAxis[1] + obbA.mHalfLength[2]*obbA.mAxis[2];
+	if( SegmentOverlapTestOBB(s0,s1,obbB) )
+		return true;
+
+	return false;
+}
+
+bool OBBOverlapTestOBB_NaiveMethod(const SrOBBox3D& obbA, const SrOBBox3D& obbB)
+{
+	
+	if( SubOBBOverlapTestOBB_NaiveMethod(obbA,obbB) )
+		return true;
+	if( SubOBBOverlapTestOBB_NaiveMethod(obbB,obbA) )
+		return true;
+	return false;
+}
@@ -0,0 +1,43 @@
+/************************************************************************		
+\link	www.twinklingstar.cn
+\author Twinkling Star
+\date	2014/06/19
+****************************************************************************/
+#ifndef SR_ALGORITHMS_OBB_OVERLAP_OBB_H_
+#define SR_ALGORITHMS_OBB_OVERLAP_OBB_H_
+
+/** \addtogroup algorithms
+  @{
+*/
+#include "SrOBBox3D.h"
+
+/*
+\brief	Żķ᷽жOBBǷصμobbA3ᡢobbB3Լ9ᡣ
+\return	true	ص
+		false	ص
+*/
+bool	OBBOverlapTestOBB_OptimizedSeparatingAxisMethod(const SrOBBox3D& obbA, const SrOBBox3D& obbB);
+/*
+\brief	ֱӰ15ĶжOBBǷص
+*/
+bool	OBBOverlapTestOBB_OptimizedSeparatingAxisMethod2(const SrOBBox3D& obbA, const SrOBBox3D& obbB);
+/*
+\brief	㷨һOBB12ǷһOBBص
+*/
+bool	OBBOverlapTestOBB_NaiveMethod(const SrOBBox3D& obbA, const SrOBBox3D& obbB);
+
+/*
+	ĸ0~2obbAᣬ3~5obbBᣬ6 + 3*i + jobbA.mAxis[i]obbB.mAxis[j]Ĳ
+*/
+#define SR_OBB_NUM_SEPARATING_AXIS		15
+
+/*
+\brief	OBBķᣬȼΪfirstAxisᣬٰ˳ᡣ
+		OBBOverlapTestOBB_OptimizedSeparatingAxisMethodһ¡
+\param[in]	firstAxis	ȼᣬ-1ʾ˳
+\return	-1ʾOBBص
+*/
+int		OBBFindSeparatingAxis(const SrOBBox3D& obbA, const SrOBBox3D& obbB, int firstAxis);
+
+/** @} */
+#endif
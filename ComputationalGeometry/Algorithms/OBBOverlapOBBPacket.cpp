@@ -0,0 +1,261 @@
+/************************************************************************
+\link	www.twinklingstar.cn
+\author Twinkling Star
+\date	2026/10/19
+****************************************************************************/
+#include "OBBOverlapOBBPacket.h"
+#include "SrSimd.h"
+#include <string.h>
+
+#define PACKET_WIDTH	SR_OBB_PACKET_WIDTH
+
+SrOBBox3DSoA::SrOBBox3DSoA()
+{
+	mBuffer = NULL;
+	mNumBox = 0;
+	memset(mCenter,0,sizeof(mCenter));
+	memset(mAxis,0,sizeof(mAxis));
+	memset(mHalfLength,0,sizeof(mHalfLength));
+}
+
+SrOBBox3DSoA::SrOBBox3DSoA(int numBox)
+{
+	mBuffer = NULL;
+	mNumBox = 0;
+	memset(mCenter,0,sizeof(mCenter));
+	memset(mAxis,0,sizeof(mAxis));
+	memset(mHalfLength,0,sizeof(mHalfLength));
+	allocate(numBox);
+}
+
+SrOBBox3DSoA::~SrOBBox3DSoA()
+{
+	if( mBuffer )
+		delete []mBuffer;
+}
+
+void SrOBBox3DSoA::allocate(int numBox)
+{
+	if( mBuffer )
+		delete []mBuffer;
+	int capacity = (numBox + PACKET_WIDTH - 1) / PACKET_WIDTH * PACKET_WIDTH;
+	mBuffer = new SrReal[15*capacity];
+	memset(mBuffer,0,sizeof(SrReal)*15*capacity);
+	int k , c;
+	for( c=0 ; c<3 ; c++ )
+	{
+		mCenter[c]	   = mBuffer + c*capacity;
+		mHalfLength[c] = mBuffer + (3 + c)*capacity;
+	}
+	for( k=0 ; k<3 ; k++ )
+		for( c=0 ; c<3 ; c++ )
+			mAxis[k][c] = mBuffer + (6 + k*3 + c)*capacity;
+	mNumBox = numBox;
+}
+
+void SrOBBox3DSoA::setBox(int i,const SrOBBox3D& obb)
+{
+	ASSERT(i>=0 && i<mNumBox);
+	int k;
+	mCenter[0][i] = obb.mCenter.x;
+	mCenter[1][i] = obb.mCenter.y;
+	mCenter[2][i] = obb.mCenter.z;
+	for( k=0 ; k<3 ; k++ )
+	{
+		mAxis[k][0][i] = obb.mAxis[k].x;
+		mAxis[k][1][i] = obb.mAxis[k].y;
+		mAxis[k][2][i] = obb.mAxis[k].z;
+		mHalfLength[k][i] = obb.mHalfLength[k];
+	}
+}
+
+const SrOBBox3D SrOBBox3DSoA::getBox(int i) const
+{
+	ASSERT(i>=0 && i<mNumBox);
+	SrOBBox3D obb;
+	int k;
+	obb.mCenter = SrPoint3D(mCenter[0][i],mCenter[1][i],mCenter[2][i]);
+	for( k=0 ; k<3 ; k++ )
+	{
+		obb.mAxis[k] = SrVector3D(mAxis[k][0][i],mAxis[k][1][i],mAxis[k][2][i]);
+		obb.mHalfLength[k] = mHalfLength[k][i];
+	}
+	return obb;
+}
+
+
+/*
+	SR_SIMD_WIDTHOBBڼĴ
+*/
+typedef struct
+{
+	SrSimdReal	mCenter[3];
+	SrSimdReal	mAxis[3][3];
+	SrSimdReal	mHalfLength[3];
+}tOBBPacket;
+
+static void SplatPacket(const SrOBBox3D& obb,tOBBPacket& packet)
+{
+	int k;
+	packet.mCenter[0] = SrSimd::splat(obb.mCenter.x);
+	packet.mCenter[1] = SrSimd::splat(obb.mCenter.y);
+	packet.mCenter[2] = SrSimd::splat(obb.mCenter.z);
+	for( k=0 ; k<3 ; k++ )
+	{
+		packet.mAxis[k][0] = SrSimd::splat(obb.mAxis[k].x);
+		packet.mAxis[k][1] = SrSimd::splat(obb.mAxis[k].y);
+		packet.mAxis[k][2] = SrSimd::splat(obb.mAxis[k].z);
+		packet.mHalfLength[k] = SrSimd::splat(obb.mHalfLength[k]);
+	}
+}
+
+static void LoadPacket(const SrOBBox3DSoA& obb,int first,tOBBPacket& packet)
+{
+	int k , c;
+	for( c=0 ; c<3 ; c++ )
+	{
+		packet.mCenter[c]	  = SrSimd::load(obb.mCenter[c] + first);
+		packet.mHalfLength[c] = SrSimd::load(obb.mHalfLength[c] + first);
+	}
+	for( k=0 ; k<3 ; k++ )
+		for( c=0 ; c<3 ; c++ )
+			packet.mAxis[k][c] = SrSimd::load(obb.mAxis[k][c] + first);
+}
+
+static SrSimdReal DotPacket(const SrSimdReal* u,const SrSimdReal* v)
+{
+	return SrSimd::add(SrSimd::add(SrSimd::mul(u[0],v[0]),SrSimd::mul(u[1],v[1])),SrSimd::mul(u[2],v[2]));
+}
+
+static SrSimdReal Sum4(SrSimdReal a,SrSimdReal b,SrSimdReal c,SrSimdReal d)
+{
+	return SrSimd::add(SrSimd::add(SrSimd::add(a,b),c),d);
+}
+
+/*
+\brief	ȫ15ᣬرͨ롣ÿʽ˳
+		OBBOverlapTestOBB_OptimizedSeparatingAxisMethodͬÿͨĽ汾λͬ
+*/
+static SrSimdReal SeparatedPacket(const tOBBPacket& obbA,const tOBBPacket& obbB)
+{
+	SrSimdReal o[3] , c[3] , bAxis[3][3] , bFabsAxis[3][3];
+	SrSimdReal s , r , separated;
+	const SrSimdReal* aHLen = obbA.mHalfLength;
+	const SrSimdReal* bHLen = obbB.mHalfLength;
+	int i , j;
+
+	for( i=0 ; i<3 ; i++ )
+		o[i] = SrSimd::sub(obbB.mCenter[i],obbA.mCenter[i]);
+	for( i=0 ; i<3 ; i++ )
+		c[i] = DotPacket(o,obbA.mAxis[i]);
+	for( j=0 ; j<3 ; j++ )
+		for( i=0 ; i<3 ; i++ )
+		{
+			bAxis[j][i]		= DotPacket(obbA.mAxis[i],obbB.mAxis[j]);
+			bFabsAxis[j][i] = SrSimd::abs(bAxis[j][i]);
+		}
+
+	//case 1: obbA
+	separated = SrSimd::splat(0);
+	for( i=0 ; i<3 ; i++ )
+	{
+		r = Sum4(aHLen[i],SrSimd::mul(bHLen[0],bFabsAxis[0][i]),SrSimd::mul(bHLen[1],bFabsAxis[1][i]),SrSimd::mul(bHLen[2],bFabsAxis[2][i]));
+		separated = SrSimd::orMask(separated,SrSimd::greater(SrSimd::abs(c[i]),r));
+	}
+	//case 2: obbB
+	for( j=0 ; j<3 ; j++ )
+	{
+		s = DotPacket(c,bAxis[j]);
+		r = Sum4(SrSimd::mul(aHLen[0],bFabsAxis[j][0]),SrSimd::mul(aHLen[1],bFabsAxis[j][1]),SrSimd::mul(aHLen[2],bFabsAxis[j][2]),bHLen[j]);
+		separated = SrSimd::orMask(separated,SrSimd::greater(SrSimd::abs(s),r));
+	}
+	//case 3: 9ᣬj1j2obbB
+	static const int otherAxis1[3] = {1,0,0};
+	static const int otherAxis2[3] = {2,2,1};
+	int j1 , j2;
+	for( j=0 ; j<3 ; j++ )
+	{
+		j1 = otherAxis1[j];
+		j2 = otherAxis2[j];
+		//X and bAxis[j]
+		s = SrSimd::add(SrSimd::mul(SrSimd::neg(bAxis[j][2]),c[1]),SrSimd::mul(bAxis[j][1],c[2]));
+		r = Sum4(SrSimd::mul(aHLen[1],bFabsAxis[j][2]),SrSimd::mul(aHLen[2],bFabsAxis[j][1]),
+				 SrSimd::mul(bHLen[j1],bFabsAxis[j2][0]),SrSimd::mul(bHLen[j2],bFabsAxis[j1][0]));
+		separated = SrSimd::orMask(separated,SrSimd::greater(SrSimd::abs(s),r));
+		//Y and bAxis[j]
+		s = SrSimd::sub(SrSimd::mul(bAxis[j][2],c[0]),SrSimd::mul(bAxis[j][0],c[2]));
+		r = Sum4(SrSimd::mul(aHLen[0],bFabsAxis[j][2]),SrSimd::mul(aHLen[2],bFabsAxis[j][0]),
+				 SrSimd::mul(bHLen[j1],bFabsAxis[j2][1]),SrSimd::mul(bHLen[j2],bFabsAxis[j1][1]));
+		separated = SrSimd::orMask(separated,SrSimd::greater(SrSimd::abs(s),r));
+		//Z and bAxis[j]
+		s = SrSimd::add(SrSimd::mul(SrSimd::neg(bAxis[j][1]),c[0]),SrSimd::mul(bAxis[j][0],c[1]));
+		r = Sum4(SrSimd::mul(aHLen[0],bFabsAxis[j][1]),SrSimd::mul(aHLen[1],bFabsAxis[j][0]),
+				 SrSimd::mul(bHLen[j1],bFabsAxis[j2][2]),SrSimd::mul(bHLen[j2],bFabsAxis[j1][2]));
+		separated = SrSimd::orMask(separated,SrSimd::greater(SrSimd::abs(s),r));
+	}
+	return separated;
+}
+
+static int ValidMask(int numBox,int first)
+{
+	int numLane = numBox - first;
+	return numLane>=PACKET_WIDTH ? (1<<PACKET_WIDTH) - 1 : (1<<numLane) - 1;
+}
+
+int OBBOverlapTestOBB_Packet(const SrOBBox3D& obbA,const SrOBBox3DSoA& obbB,int first)
+{
+	ASSERT(first>=0 && first<obbB.mNumBox);
+	tOBBPacket packetA , packetB;
+	int h , separated = 0;
+	SplatPacket(obbA,packetA);
+	for( h=0 ; h<PACKET_WIDTH ; h+=SR_SIMD_WIDTH )
+	{
+		LoadPacket(obbB,first + h,packetB);
+		separated |= SrSimd::moveMask(SeparatedPacket(packetA,packetB)) << h;
+	}
+	return ~separated & ValidMask(obbB.mNumBox,first);
+}
+
+int OBBOverlapTestOBB_PairPacket(const SrOBBox3DSoA& obbA,const SrOBBox3DSoA& obbB,int first)
+{
+	ASSERT(obbA.mNumBox == obbB.mNumBox && first>=0 && first<obbA.mNumBox);
+	tOBBPacket packetA , packetB;
+	int h , separated = 0;
+	for( h=0 ; h<PACKET_WIDTH ; h+=SR_SIMD_WIDTH )
+	{
+		LoadPacket(obbA,first + h,packetA);
+		LoadPacket(obbB,first + h,packetB);
+		separated |= SrSimd::moveMask(SeparatedPacket(packetA,packetB)) << h;
+	}
+	return ~separated & ValidMask(obbA.mNumBox,first);
+}
+
+int OBBOverlapTestOBB_Batch(const SrOBBox3D& obbA,const SrOBBox3DSoA& obbB,int* overlapIndex)
+{
+	int first , mask , lane , count = 0;
+	for( first=0 ; first<obbB.mNumBox ; first+=PACKET_WIDTH )
+	{
+		mask = OBBOverlapTestOBB_Packet(obbA,obbB,first);
+		for( lane=0 ; mask ; lane++ , mask>>=1 )
+		{
+			if( mask & 1 )
+				overlapIndex[count++] = first + lane;
+		}
+	}
+	return count;
+}
+
+int OBBOverlapTestOBB_PairBatch(const SrOBBox3DSoA& obbA,const SrOBBox3DSoA& obbB,int* overlapIndex)
+{
+	int first , mask , lane , count = 0;
+	for( first=0 ; first<obbA.mNumBox ; first+=PACKET_WIDTH )
+	{
+		mask = OBBOverlapTestOBB_PairPacket(obbA,obbB,first);
+		for( lane=0 ; mask ; lane++ , mask>>=1 )
+		{
+			if( mask & 1 )
+				overlapIndex[count++] = first + lane;
+		}
+	}
+	return count;
+}
@@ -0,0 +1,81 @@
+/************************************************************************
+\link	www.twinklingstar.cn
+\author Twinkling Star
+\date	2026/10/19
+****************************************************************************/
+#ifndef SR_ALGORITHMS_OBB_OVERLAP_OBB_PACKET_H_
+#define SR_ALGORITHMS_OBB_OVERLAP_OBB_PACKET_H_
+
+/** \addtogroup algorithms
+  @{
+*/
+#include "SrOBBox3D.h"
+
+/*
+	һݰаOBBĸSSE2ĴĿ
+*/
+#define SR_OBB_PACKET_WIDTH		4
+
+/**
+\brief 3D oriented bounding boxes stored as a structure of arrays (SoA).
+
+mCenter[c][i] is the c-th coordinate of the center of the i-th box,
+mAxis[k][c][i] is the c-th coordinate of its k-th axis and mHalfLength[k][i]
+is its k-th half length. The arrays are padded with zeros to a multiple of
+SR_OBB_PACKET_WIDTH, so a packet can always be loaded as a whole.
+*/
+class SrOBBox3DSoA
+{
+public:
+	SrOBBox3DSoA();
+	SrOBBox3DSoA(int numBox);
+	~SrOBBox3DSoA();
+	/**
+	\brief Allocate the arrays for numBox boxes, the old data is released.
+	*/
+	void				allocate(int numBox);
+	void				setBox(int i,const SrOBBox3D& obb);
+	const SrOBBox3D		getBox(int i) const;
+
+public:
+	SrReal*		mCenter[3];
+	SrReal*		mAxis[3][3];
+	SrReal*		mHalfLength[3];
+	int			mNumBox;
+
+private:
+	SrOBBox3DSoA(const SrOBBox3DSoA&);
+	SrOBBox3DSoA& operator=(const SrOBBox3DSoA&);
+
+	SrReal*		mBuffer;
+};
+
+/*
+\brief	һOBBһݰеOBBص⣬obbAobbB[first],...,obbB[first + SR_OBB_PACKET_WIDTH - 1]Ƚϡ
+		SSE2Ĵмȫ15ᣬûз֧ÿһԵĽOBBOverlapTestOBB_OptimizedSeparatingAxisMethodȫͬ
+\param[in]	obbA	OBB
+\param[in]	obbB	һOBB
+\param[in]	first	ݰеһOBB
+\return	λ룬iλΪ1ʾobbAobbB[first + i]ص
+*/
+int OBBOverlapTestOBB_Packet(const SrOBBox3D& obbA,const SrOBBox3DSoA& obbB,int first);
+/*
+\brief	һݰеOBBԵص⣬obbA[first + i]obbB[first + i]ȽϣֵĺOBBOverlapTestOBB_Packetͬ
+*/
+int OBBOverlapTestOBB_PairPacket(const SrOBBox3DSoA& obbA,const SrOBBox3DSoA& obbB,int first);
+
+/*
+\brief	ݰobbAobbBOBBصϵ
+\param[out]	overlapIndex	obbAصOBBҪobbB.mNumBoxԪ
+\return	صOBBĸ
+*/
+int OBBOverlapTestOBB_Batch(const SrOBBox3D& obbA,const SrOBBox3DSoA& obbB,int* overlapIndex);
+/*
+\brief	ݰеOBB(obbA[i],obbB[i])
+\param[out]	overlapIndex	صOBBԵҪobbA.mNumBoxԪ
+\return	صOBBԵĸ
+*/
+int OBBOverlapTestOBB_PairBatch(const SrOBBox3DSoA& obbA,const SrOBBox3DSoA& obbB,int* overlapIndex);
+
+/** @} */
+#endif
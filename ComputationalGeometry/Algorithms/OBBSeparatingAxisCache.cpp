@@ -0,0 +1,163 @@
+/************************************************************************
+\link	www.twinklingstar.cn
+\author Twinkling Star
+\date	2026/10/19
+****************************************************************************/
+/************************************************************************
+\description	Ỻ棺ÿŶַɢбÿOBBһεķᣬ
+				ʧЧֻҪʱҪɢбɢбһʱ
+				ؽûвѯOBBԣԴСֻÿ֡OBBйء
+****************************************************************************/
+#include "OBBSeparatingAxisCache.h"
+#include <string.h>
+
+/*
+\brief	FibonacciɢУȡ˻ĸλΪλá
+*/
+static int HashPair(int idA,int idB,int shift)
+{
+	SrU32 h = ((SrU32)idA*0x9E3779B1u ^ (SrU32)idB)*0x9E3779B1u;
+	return (int)(h >> shift);
+}
+
+SrSeparatingAxisCache::SrSeparatingAxisCache(int capacity)
+{
+	mCapacity = 16;
+	mShift	  = 28;
+	while( mCapacity<capacity )
+	{
+		mCapacity <<= 1;
+		mShift --;
+	}
+	mEntry = new tEntry[mCapacity];
+	memset(mEntry,0,sizeof(tEntry)*mCapacity);
+	mNumEntry	= 0;
+	mStamp		= 1;
+	mGeneration = 0;
+	resetCounter();
+}
+
+SrSeparatingAxisCache::~SrSeparatingAxisCache()
+{
+	delete []mEntry;
+}
+
+void SrSeparatingAxisCache::resetCounter()
+{
+	mNumQuery = 0;
+	mNumHit	  = 0;
+	mNumMiss  = 0;
+}
+
+SrReal SrSeparatingAxisCache::hitRate() const
+{
+	if( mNumQuery==0 )
+		return 0;
+	return (SrReal)mNumHit / (SrReal)mNumQuery;
+}
+
+void SrSeparatingAxisCache::invalidateAll()
+{
+	mNumEntry = 0;
+	mStamp ++;
+	if( mStamp==0 )
+	{//ʱɢб
+		memset(mEntry,0,sizeof(tEntry)*mCapacity);
+		mStamp = 1;
+	}
+}
+
+void SrSeparatingAxisCache::nextGeneration()
+{
+	mGeneration ++;
+}
+
+void SrSeparatingAxisCache::invalidate(int idA,int idB)
+{
+	tEntry* entry = find(idA,idB,false);
+	if( entry )
+		entry->mAxis = -1;
+}
+
+/*
+\brief	̽OBBԣʱ뻺治ͬλöǿλ
+\param[in]	isInsert	ûҵʱǷһµλ
+*/
+SrSeparatingAxisCache::tEntry* SrSeparatingAxisCache::find(int idA,int idB,bool isInsert)
+{
+	int mask = mCapacity - 1;
+	int i = HashPair(idA,idB,mShift);
+	while( mEntry[i].mStamp==mStamp )
+	{
+		if( mEntry[i].mIdA==idA && mEntry[i].mIdB==idB )
+			return mEntry + i;
+		i = (i + 1) & mask;
+	}
+	if( !isInsert )
+		return NULL;
+	//װӲ0.5
+	if( 2*(mNumEntry + 1)>mCapacity )
+	{
+		rehash();
+		return find(idA,idB,true);
+	}
+	mEntry[i].mIdA	= idA;
+	mEntry[i].mIdB	= idB;
+	mEntry[i].mAxis	= -1;
+	mEntry[i].mStamp= mStamp;
+	mEntry[i].mGeneration = mGeneration;
+	mNumEntry ++;
+	return mEntry + i;
+}
+
+/*
+\brief	ؽɢбֻǰһһѯOBBԡOBBԳ1/4ʱӱ
+		ؽװӲ1/4²ʱٴؽ
+*/
+void SrSeparatingAxisCache::rehash()
+{
+	tEntry* oldEntry = mEntry;
+	int oldCapacity = mCapacity , numLive = 0 , i;
+	SrU32 oldStamp = mStamp;
+
+	for( i=0 ; i<oldCapacity ; i++ )
+	{
+		if( oldEntry[i].mStamp==oldStamp && mGeneration - oldEntry[i].mGeneration<=1 )
+			numLive ++;
+	}
+	if( 4*(numLive + 1)>mCapacity )
+	{
+		mCapacity <<= 1;
+		mShift --;
+	}
+	mEntry	  = new tEntry[mCapacity];
+	memset(mEntry,0,sizeof(tEntry)*mCapacity);
+	mNumEntry = 0;
+	mStamp	  = 1;
+	tEntry* entry;
+	for( i=0 ; i<oldCapacity ; i++ )
+	{
+		if( oldEntry[i].mStamp!=oldStamp || mGeneration - oldEntry[i].mGeneration>1 )
+			continue;
+		entry = find(oldEntry[i].mIdA,oldEntry[i].mIdB,true);
+		entry->mAxis = oldEntry[i].mAxis;
+		entry->mGeneration = oldEntry[i].mGeneration;
+	}
+	delete []oldEntry;
+}
+
+bool SrSeparatingAxisCache::overlap(int idA,const SrOBBox3D& obbA,int idB,const SrOBBox3D& obbB)
+{
+	tEntry* entry = find(idA,idB,true);
+	int cachedAxis = entry->mAxis;
+	int axis = OBBFindSeparatingAxis(obbA,obbB,cachedAxis);
+
+	mNumQuery ++;
+	if( cachedAxis>=0 && axis==cachedAxis )
+		mNumHit ++;
+	else
+		mNumMiss ++;
+	entry->mAxis = axis;
+	entry->mGeneration = mGeneration;
+	return axis<0;
+}
@@ -0,0 +1,91 @@
+/************************************************************************
+\link	www.twinklingstar.cn
+\author Twinkling Star
+\date	2026/10/19
+****************************************************************************/
+#ifndef SR_ALGORITHMS_OBB_SEPARATING_AXIS_CACHE_H_
+#define SR_ALGORITHMS_OBB_SEPARATING_AXIS_CACHE_H_
+
+/** \addtogroup algorithms
+  @{
+*/
+#include "OBBOverlapOBB.h"
+
+/**
+\brief Cache of the last separating axis of OBB pairs, to exploit temporal coherence.
+
+A pair is keyed by the ids (idA,idB) of its boxes, the order matters. When the
+same pair is tested again, the axis that separated it last time is tested first,
+so a pair that stays apart usually exits after a single axis. A stale axis can
+only cost one extra axis test, it never changes the result. The cache is not
+thread safe, use one cache per thread.
+
+Eviction: every entry remembers the generation in which it was last queried, and
+nextGeneration() starts a new one, typically once per frame. When an insertion
+would make the table more than half full, the table is rebuilt and only the pairs
+queried in the current or the previous generation are kept; the capacity doubles
+only if they still fill more than a quarter of it. So, beyond the initial capacity,
+the capacity stays below 8 times the number of pairs queried in two consecutive
+generations, however many pairs have been seen; it never shrinks. Without
+nextGeneration() nothing is ever evicted.
+*/
+class SrSeparatingAxisCache
+{
+public:
+	SrSeparatingAxisCache(int capacity = 1024);
+	~SrSeparatingAxisCache();
+	/**
+	\brief Overlap test of obbA and obbB, with the same result as OBBOverlapTestOBB_OptimizedSeparatingAxisMethod.
+	*/
+	bool		overlap(int idA,const SrOBBox3D& obbA,int idB,const SrOBBox3D& obbB);
+	/**
+	\brief Start a new generation, the pairs not queried in this one or the previous one may be evicted.
+	*/
+	void		nextGeneration();
+	/**
+	\brief Forget the cached axis of one pair.
+	*/
+	void		invalidate(int idA,int idB);
+	/**
+	\brief Forget the cached axes of all the pairs, in constant time.
+	*/
+	void		invalidateAll();
+
+	void		resetCounter();
+	/**
+	\brief The ratio of the queries that were separated by the cached axis.
+	*/
+	SrReal		hitRate() const;
+	int			capacity() const	{ return mCapacity; }
+
+public:
+	SrU32		mNumQuery;		//The number of calls to overlap().
+	SrU32		mNumHit;		//The cached axis still separated the pair.
+	SrU32		mNumMiss;		//There was no cached axis, or it did not separate the pair any more.
+
+private:
+	typedef struct
+	{
+		int		mIdA;
+		int		mIdB;
+		int		mAxis;			//-1 if the pair overlapped last time.
+		SrU32	mStamp;			//The entry is empty if it is not equal to the stamp of the cache.
+		SrU32	mGeneration;	//The generation of the last query.
+	}tEntry;
+
+	SrSeparatingAxisCache(const SrSeparatingAxisCache&);
+	SrSeparatingAxisCache& operator=(const SrSeparatingAxisCache&);
+
+	tEntry*		find(int idA,int idB,bool isInsert);
+	void		rehash();
+
+	tEntry*		mEntry;
+	int			mCapacity;		//A power of two.
+	int			mShift;			//32 - log2(mCapacity).
+	int			mNumEntry;
+	SrU32		mStamp;
+	SrU32		mGeneration;
+};
+
+/** @} */
+#endif
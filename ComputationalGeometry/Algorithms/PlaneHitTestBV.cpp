@@ -0,0 +1,145 @@
+/************************************************************************		
+\link	www.twinklingstar.cn
+\author Twinkling Star
+\date	2014/06/19
+****************************************************************************/
+/************************************************************************		
+\description	ͨѰҰΧӽƽ淨ĶԽߵķ
+				ʵƽAABBOBBཻԣ
+				ͨͶӰΧĵƽľķ
+				ʵƽAABBOBBཻԡ
+****************************************************************************/
+#include "PlaneHitTestBV.h"
+#include <math.h>
+
+/*
+\brief	ͨѰҰΧӽƽ淨ĶԽߣʵƽAABBཻ
+\return	SR_PLANE_TANGENT	ƽAABB
+\return	SR_PLANE_FRONT		AABBƽռ
+\return	SR_PLANE_BACK		AABBƽĸռ
+\return	SR_PLANE_INTERSECTING	ƽAABBཻ
+*/
+int	Plane3DHitTestAABB_DiagonalMethod(const SrPlane3D& plane,const SrAABBox3D& aabb)
+{
+	SrPoint3D minPoint,maxPoint;
+	int i;
+	for( i=0 ; i<3 ; i++ )
+	{
+		if( GEQUAL(plane.mNormal[i],0) )
+		{
+			minPoint[i] = aabb.mMinAABB[i];
+			maxPoint[i] = aabb.mMaxAABB[i];
+		}
+		else
+		{
+			minPoint[i] = aabb.mMaxAABB[i];
+			maxPoint[i] = aabb.mMinAABB[i];
+		}
+	}
+	SrReal tmp ;
+	tmp = plane.mNormal.dot(minPoint) + plane.mD;
+	if( EQUAL(tmp,0) )
+		return SR_PLANE_TANGENT;
+	else if( GREATER(tmp,0) )
+		return SR_PLANE_FRONT;
+	tmp = plane.mNormal.dot(maxPoint) + plane.mD ;
+	if( EQUAL(tmp,0) )
+		return SR_PLANE_TANGENT;
+	else if( LESS(tmp , 0) )
+		return SR_PLANE_BACK;
+	return SR_PLANE_INTERSECTING;
+}
+
+/*
+\brief	ͨͶӰΧĵƽľ룬ʵƽAABBཻ
+\return	SR_PLANE_TANGENT	ƽAABB
+\return	SR_PLANE_FRONT		AABBƽռ
+\return	SR_PLANE_BACK		AABBƽĸռ
+\return	SR_PLANE_INTERSECTING	ƽAABBཻ
+*/
+int	Plane3DHitTestAABB_DistanceMethod(const SrPlane3D& plane,const SrAABBox3D& aabb)
+{
+	SrVector3D v0 = SrVector3D(1.0,0,0);
+	SrVector3D v1 = SrVector3D(0,1.0,0);
+	SrVector3D v2 = SrVector3D(0,0,1.0);
+	SrReal r = 0;
+	r += fabs(plane.mNormal.dot(v0)*(aabb.mMaxAABB[0] - aabb.mMinAABB[0]));
+	r += fabs(plane.mNormal.dot(v1)*(aabb.mMaxAABB[1] - aabb.mMinAABB[1]));
+	r += fabs(plane.mNormal.dot(v2)*(aabb.mMaxAABB[2] - aabb.mMinAABB[2]));
+	SrPoint3D center = aabb.mMinAABB + aabb.mMaxAABB;
+	SrReal tmp = (plane.mNormal.dot(center) + 2*plane.mD) ;
+	if( EQUAL(tmp , r) || EQUAL(tmp , -r) )
+		return SR_PLANE_TANGENT;
+	else if( GREATER(tmp,r) )
+		return SR_PLANE_FRONT;
+	else if( LESS(tmp,-r) )
+		return SR_PLANE_BACK;
+	return SR_PLANE_INTERSECTING;
+}
+
+
+/*
+\brief	ͨѰҰΧӽƽ淨ĶԽߣʵƽOBBཻ
+\return	SR_PLANE_TANGENT	ƽOBB
+\return	SR_PLANE_FRONT		OBBƽռ
+\return	SR_PLANE_BACK		OBBƽĸռ
+\return	SR_PLANE_INTERSECTING	ƽOBBཻ
+*/
+int	Plane3DHitTestOBB_DiagonalMethod(const SrPlane3D& plane,const SrOBBox3D& obb)
+{
+	SrPoint3D minPoint,maxPoint;
+	SrVector3D normal;
+	normal.x = obb.mAxis[0].dot(plane.mNormal);
+	normal.y = obb.mAxis[1].dot(plane.mNormal);
+	normal.z = obb.mAxis[2].dot(plane.mNormal);
+	SrReal d = obb.mCenter.dot(plane.mNormal);
+	int i;
+	for( i=0 ; i<3 ; i++ )
+	{
+		if( GEQUAL(normal[i],0) )
+		{
+			minPoint[i] = - obb.mHalfLength[i];
+			maxPoint[i] =   obb.mHalfLength[i];
+		}
+		else
+		{
+			minPoint[i] =   obb.mHalfLength[i];
+			maxPoint[i] = - obb.mHalfLength[i];
+		}
+	}
+	SrReal tmp ;
+	tmp = normal.dot(minPoint) + d + plane.mD;
+	if( EQUAL(tmp,0) )
+		return SR_PLANE_TANGENT;
+	else if( GREATER(tmp,0) )
+		return SR_PLANE_FRONT;
+	tmp = normal.dot(maxPoint) + d + plane.mD;
+	if( EQUAL(tmp,0) )
+		return SR_PLANE_TANGENT;
+	else if( LESS(tmp , 0) )
+		return SR_PLANE_BACK;
+	return SR_PLANE_INTERSECTING;
+}
+
+/*
+\brief	ͨͶӰΧĵƽľ룬ʵƽOBBཻ
+\return	SR_PLANE_TANGENT	ƽOBB
+\return	SR_PLANE_FRONT		OBBƽռ
+\return	SR_PLANE_BACK		OBBƽĸռ
+\return	SR_PLANE_INTERSECTING	ƽOBBཻ
+*/
+int	Plane3DHitTestOBB_DistanceMethod(const SrPlane3D& plane,const SrOBBox3D& obb)
+{
+	SrReal r = 0;
+	r += fabs(plane.mNormal.dot(obb.mAxis[0])*obb.mHalfLength[0]);
+	r += fabs(plane.mNormal.dot(obb.mAxis[1])*obb.mHalfLength[1]);
+	r += fabs(plane.mNormal.dot(obb.mAxis[2])*obb.mHalfLength[2]);
+	SrReal tmp = (plane.mNormal.dot(obb.mCenter) + plane.mD) ;
+	if( EQUAL(tmp , r) || EQUAL(tmp , -r) )
+		return SR_PLANE_TANGENT;
+	else if( GREATER(tmp,r) )
+		return SR_PLANE_FRONT;
+	else if( LESS(tmp,-r) )
+		return SR_PLANE_BACK;
+	return SR_PLANE_INTERSECTING;
+}
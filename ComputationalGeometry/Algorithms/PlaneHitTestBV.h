@@ -0,0 +1,90 @@
+/************************************************************************		
+\link	www.twinklingstar.cn
+\author Twinkling Star
+\date	2014/06/19
+****************************************************************************/
+#ifndef SR_ALGORITHMS_PLANE_HIT_TEST_BV_H_
+#define SR_ALGORITHMS_PLANE_HIT_TEST_BV_H_
+
+/** \addtogroup algorithms
+  @{
+*/
+#include "SrAABBox3D.h"
+
+/**
+\brief 3D plane class.
+
+This is a 3D plane class with public data members.
+The line is parameterized as ^n*^X+d=0,in which ^n is the 'normal' data,d is the 'd' data.
+The normal isn't normalized.
+*/
+class SrPlane3D
+{
+public:
+	/**
+	\brief Default constructor.
+	*/
+	SrPlane3D()
+	{
+		mNormal.set(0,0,0);
+		mD = 0;
+	}
+	bool init(const SrPoint3D& p0,const SrPoint3D& p1,const SrPoint3D&p2)
+	{
+		SrVector3D norm = (p1-p0).cross(p2-p0);
+		if(EQUAL(norm.x,0)&&EQUAL(norm.y,0)&&EQUAL(norm.z,0))
+			return false;
+		mNormal = norm;
+		mD = -mNormal.dot(p0);
+		return true;
+	}
+	/**
+	\brief  The plane is valid if the normal of the plane is not zero.
+	*/
+	bool	isValid()const
+	{
+		if( EQUAL(mNormal.x,0)&&EQUAL(mNormal.y,0)&&EQUAL(mNormal.z,0) )
+			return false;
+		return true;
+	}
+
+public:
+	SrVector3D	mNormal;
+	SrReal		mD;
+};
+
+/*
+\brief	ͨѰҰΧӽƽ淨ĶԽߣʵƽAABBཻ
+\return	SR_PLANE_TANGENT	ƽAABB
+\return	SR_PLANE_FRONT		AABBƽռ
+\return	SR_PLANE_BACK		AABBƽĸռ
+\return	SR_PLANE_INTERSECTING	ƽAABBཻ
+*/
+int	Plane3DHitTestAABB_DiagonalMethod(const SrPlane3D& plane,const SrAABBox3D& aabb);
+/*
+\brief	ͨͶӰΧĵƽľ룬ʵƽAABBཻ
+\return	SR_PLANE_TANGENT	ƽAABB
+\return	SR_PLANE_FRONT		AABBƽռ
+\return	SR_PLANE_BACK		AABBƽĸռ
+\return	SR_PLANE_INTERSECTING	ƽAABBཻ
+*/
+int	Plane3DHitTestAABB_DistanceMethod(const SrPlane3D& plane,const SrAABBox3D& aabb);
+/*
+\brief	ͨѰҰΧӽƽ淨ĶԽߣʵƽOBBཻ
+\return	SR_PLANE_TANGENT	ƽOBB
+\return	SR_PLANE_FRONT		OBBƽռ
+\return	SR_PLANE_BACK		OBBƽĸռ
+\return	SR_PLANE_INTERSECTING	ƽOBBཻ
+*/
+int	Plane3DHitTestOBB_DiagonalMethod(const SrPlane3D& plane,const SrOBBox3D& obb);
+/*
+\brief	ͨͶӰΧĵƽľ룬ʵƽOBBཻ
+\return	SR_PLANE_TANGENT	ƽOBB
+\return	SR_PLANE_FRONT		OBBƽռ
+\return	SR_PLANE_BACK		OBBƽĸռ
+\return	SR_PLANE_INTERSECTING	ƽOBBཻ
+*/
+int	Plane3DHitTestOBB_DistanceMethod(const SrPlane3D& plane,const SrOBBox3D& obb);
+
+/** @} */
+#endif
@@ -0,0 +1,647 @@
+/************************************************************************
+\link	www.twinklingstar.cn
+\author Twinkling Star
+\date	2026/10/19
+****************************************************************************/
+/************************************************************************
+\description	εĲ㣬Martinez-Rueda-Feitoɨ㷨εı
+				Bentley-Ottmann㷨˳ɨ裬ཻصıڽ㴦
+				ָÿ߽ɨʱ·ıߵõǷڣ
+				ӶõǷǽı߽硢һࡣѽı߰
+				ķβɻ
+****************************************************************************/
+#include "PolygonBoolean.h"
+#include <algorithm>
+#include <math.h>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+static const SrReal TWO_PI = 6.28318530717958647692;
+
+/*
+	㰴SrSweepEvent˳ȲǰҲںʱΪͬһ
+*/
+static bool SamePoint(const SrPoint2D& p,const SrPoint2D& q)
+{
+	return !(SrSweepEvent(p) < SrSweepEvent(q)) && !(SrSweepEvent(q) < SrSweepEvent(p));
+}
+
+/*
+\brief	߶Ƿغϣָʹغϵβһϸ
+*/
+static bool IsSameSegment(const SrPoint2D& left1,const SrPoint2D& right1,const SrPoint2D& left2,const SrPoint2D& right2)
+{
+	return SamePoint(left1,left2) && SamePoint(right1,right2);
+}
+
+static SrReal SignedArea(const SrPoint2D& p0,const SrPoint2D& p1,const SrPoint2D& p2)
+{
+	return (p0.x - p2.x)*(p1.y - p2.y) - (p1.x - p2.x)*(p0.y - p2.y);
+}
+
+static bool Operate(int operation,bool subject,bool clip)
+{
+	switch( operation )
+	{
+	case SR_BOOLEAN_INTERSECTION:
+		return subject && clip;
+	case SR_BOOLEAN_UNION:
+		return subject || clip;
+	case SR_BOOLEAN_DIFFERENCE:
+		return subject && !clip;
+	default:
+		return subject!=clip;
+	}
+}
+
+SrPolygonBoolean::SrPolygonBoolean()
+{
+	mOperation = SR_BOOLEAN_INTERSECTION;
+	mNumEvent  = 0;
+}
+
+SrPolygonBoolean::~SrPolygonBoolean()
+{
+	int i;
+	for( i=0 ; i<(int)mBlock.size() ; i++ )
+		delete []mBlock[i];
+}
+
+/*
+\brief	߶Ƿڵp·˵㵽Ҷ˵㣬p߶ε
+*/
+bool SrPolygonBoolean::isBelow(const tEvent* event,const SrPoint2D& p)
+{
+	if( event->mIsLeft )
+		return SignedArea(event->mPoint,event->mOther->mPoint,p)>0;
+	return SignedArea(event->mOther->mPoint,event->mPoint,p)>0;
+}
+
+/*
+\brief	event1Ƿevent2֮Ȱ˳ͬһȴҶ˵㣻˵߶Ҷ˵ʱ
+		ȴ·߶Σʱȴһε߶Σ󰴴˳
+*/
+bool SrPolygonBoolean::isEventAfter(const tEvent* event1,const tEvent* event2)
+{
+	SrSweepEvent sweep1(event1->mPoint) , sweep2(event2->mPoint);
+	if( sweep1<sweep2 )
+		return false;
+	if( sweep2<sweep1 )
+		return true;
+	if( event1->mIsLeft!=event2->mIsLeft )
+		return event1->mIsLeft;
+	if( SignedArea(event1->mPoint,event1->mOther->mPoint,event2->mOther->mPoint)!=0 )
+		return !isBelow(event1,event2->mOther->mPoint);
+	if( event1->mPolygon!=event2->mPolygon )
+		return event1->mPolygon>event2->mPolygon;
+	return event1->mId>event2->mId;
+}
+
+/*
+\brief	ɨ߶event1Ƿevent2·event1event2߶ε˵㡣޷ʱ
+		ߵ߶ȰΣٰ˳
+*/
+bool SrPolygonBoolean::isSegmentBelow(const tEvent* event1,const tEvent* event2)
+{
+	if( !IsSameSegment(event1->mPoint,event1->mOther->mPoint,event2->mPoint,event2->mOther->mPoint) &&
+		(SignedArea(event1->mPoint,event1->mOther->mPoint,event2->mPoint)!=0 ||
+		 SignedArea(event1->mPoint,event1->mOther->mPoint,event2->mOther->mPoint)!=0) )
+	{
+		//
+		if( SamePoint(event1->mPoint,event2->mPoint) )
+		{
+			//ʱжϿܶߴ
+			if( isBelow(event1,event2->mOther->mPoint) )
+				return true;
+			if( isBelow(event2,event1->mOther->mPoint) )
+				return false;
+		}
+		else if( EQUAL(event1->mPoint.x,event2->mPoint.x) )
+			return event1->mPoint.y<event2->mPoint.y;
+		//event1ʱȽevent1˵event2һ࣬෴
+		else if( isEventAfter(event1,event2) )
+			return !isBelow(event2,event1->mPoint);
+		else
+			return isBelow(event1,event2->mPoint);
+	}
+	//
+	if( event1->mPolygon!=event2->mPolygon )
+		return event1->mPolygon<event2->mPolygon;
+	if( SamePoint(event1->mPoint,event2->mPoint) )
+		return event1->mId<event2->mId;
+	return isEventAfter(event1,event2);
+}
+
+/*
+\brief	ɨ߶ε˳Ǵȴ߶һжϣʹıȽϻìܣ
+		Բͬ߶βȣɨǳɹ
+*/
+bool SrPolygonBoolean::tSegmentLess::operator()(const tEvent* event1,const tEvent* event2) const
+{
+	if( event1==event2 )
+		return false;
+	if( event1->mId>event2->mId )
+		return !isSegmentBelow(event2,event1);
+	return isSegmentBelow(event1,event2);
+}
+
+/*
+\brief	ڴзһ¼ڴڶμ֮䱣
+*/
+SrPolygonBoolean::tEvent* SrPolygonBoolean::newEvent(const SrPoint2D& p,bool isLeft,tEvent* other,int polygon)
+{
+	int block = mNumEvent / SR_BOOLEAN_EVENT_BLOCK;
+	if( block==(int)mBlock.size() )
+		mBlock.push_back(new tEvent[SR_BOOLEAN_EVENT_BLOCK]);
+	tEvent* event = mBlock[block] + mNumEvent % SR_BOOLEAN_EVENT_BLOCK;
+	event->mPoint		= p;
+	event->mOther		= other;
+	event->mPolygon		= polygon;
+	event->mId			= mNumEvent ++;
+	event->mIsLeft		= isLeft;
+	event->mInResult	= false;
+	event->mResultAbove	= false;
+	return event;
+}
+
+/*
+	mQueueһѣѶȴ¼
+*/
+void SrPolygonBoolean::pushEvent(tEvent* event)
+{
+	mQueue.push_back(event);
+	std::push_heap(mQueue.begin(),mQueue.end(),isEventAfter);
+}
+
+SrPolygonBoolean::tEvent* SrPolygonBoolean::popEvent()
+{
+	std::pop_heap(mQueue.begin(),mQueue.end(),isEventAfter);
+	tEvent* event = mQueue.back();
+	mQueue.pop_back();
+	return event;
+}
+
+void SrPolygonBoolean::addPolygon(const tBooleanPolygon& polygon,int index,SrPoint2D& minPoint,SrPoint2D& maxPoint)
+{
+	minPoint.set(SR_MAX_F64,SR_MAX_F64);
+	maxPoint.set(-SR_MAX_F64,-SR_MAX_F64);
+	int ring , i , j , first , last;
+	for( ring=0 ; ring<polygon.mNumRing ; ring++ )
+	{
+		first = polygon.mRingStart[ring];
+		last  = polygon.mRingStart[ring + 1];
+		if( last - first<3 )
+			continue;
+		for( i=first , j=last - 1 ; i<last ; j=i ++ )
+		{
+			const SrPoint2D& p = polygon.mVertex[j];
+			const SrPoint2D& q = polygon.mVertex[i];
+			minPoint.min(q);
+			maxPoint.max(q);
+			if( SamePoint(p,q) )
+				continue;
+			tEvent* event1 = newEvent(p,true,NULL,index);
+			tEvent* event2 = newEvent(q,true,event1,index);
+			event1->mOther = event2;
+			if( SrSweepEvent(p)<SrSweepEvent(q) )
+				event2->mIsLeft = false;
+			else
+				event1->mIsLeft = false;
+			pushEvent(event1);
+			pushEvent(event2);
+		}
+	}
+}
+
+/*
+\brief	ɨϵһpreveventıǣϴeventֻıڵĶε⡣
+		prevغʱprevǽıߣevent·prev·Ȼeventϡ
+		ǷڽУõeventǷǽı߽硢һࡣ
+*/
+void SrPolygonBoolean::computeFields(tEvent* event,tEvent* prev)
+{
+	int i;
+	for( i=0 ; i<2 ; i++ )
+	{
+		event->mInsideBelow[i] = prev ? prev->mInside[i] : false;
+		event->mInside[i] = event->mInsideBelow[i];
+	}
+	event->mInside[event->mPolygon] = !event->mInside[event->mPolygon];
+	if( prev && IsSameSegment(prev->mPoint,prev->mOther->mPoint,event->mPoint,event->mOther->mPoint) )
+	{
+		for( i=0 ; i<2 ; i++ )
+			event->mInsideBelow[i] = prev->mInsideBelow[i];
+		prev->mInResult = false;
+	}
+	bool below = Operate(mOperation,event->mInsideBelow[0],event->mInsideBelow[1]);
+	bool above = Operate(mOperation,event->mInside[0],event->mInside[1]);
+	event->mInResult	= below!=above;
+	event->mResultAbove = above;
+}
+
+/*
+\brief	¼ɨeventϷغϵ߶εıǣÿһһõغϵ߶
+		ڲͬĻʱһıϷغ߶εıǡ
+*/
+void SrPolygonBoolean::computeOverlapFields(tEvent* event)
+{
+	StatusLine::iterator it = event->mPosition;
+	for( ++it ; it!=mStatus.end() && IsSameSegment((*it)->mPoint,(*it)->mOther->mPoint,event->mPoint,event->mOther->mPoint) ; ++it )
+	{
+		computeFields(*it,event);
+		event = *it;
+	}
+}
+
+/*
+\brief	ڵp߶ηֳΣһεҶ˵ұһε˵µ¼
+*/
+void SrPolygonBoolean::splitSegment(tEvent* event,const SrPoint2D& p)
+{
+	tEvent* right = newEvent(p,false,event,event->mPolygon);
+	tEvent* left  = newEvent(p,true,event->mOther,event->mPolygon);
+	//ʹұһεҶ˵p֮ǰ
+	if( isEventAfter(left,event->mOther) )
+	{
+		event->mOther->mIsLeft = true;
+		left->mIsLeft = false;
+	}
+	event->mOther->mOther = left;
+	event->mOther = right;
+	pushEvent(left);
+	pushEvent(right);
+}
+
+/*
+\brief	ָɨϵ߶eventغϵ߶ɨڣҲpָʹȻغϡ
+*/
+void SrPolygonBoolean::divideSegment(tEvent* event,const SrPoint2D& p)
+{
+	SrPoint2D left = event->mPoint , right = event->mOther->mPoint;
+	StatusLine::iterator it = event->mPosition;
+	while( it!=mStatus.begin() )
+	{
+		--it;
+		if( !IsSameSegment((*it)->mPoint,(*it)->mOther->mPoint,left,right) )
+			break;
+		splitSegment(*it,p);
+	}
+	it = event->mPosition;
+	for( ++it ; it!=mStatus.end() && IsSameSegment((*it)->mPoint,(*it)->mOther->mPoint,left,right) ; ++it )
+		splitSegment(*it,p);
+	splitSegment(event,p);
+}
+
+/*
+\brief	pǷ߶εڲǶ˵
+*/
+static bool IsInterior(const SrPoint2D& left,const SrPoint2D& right,const SrPoint2D& p)
+{
+	return SrSweepEvent(left)<SrSweepEvent(p) && SrSweepEvent(p)<SrSweepEvent(right);
+}
+
+static const SrPoint2D& NearestEnd(const SrPoint2D& end1,const SrPoint2D& end2,const SrPoint2D& p)
+{
+	return p.distanceSquared(end1)<=p.distanceSquared(end2) ? end1 : end2;
+}
+
+/*
+\brief	ɨڵ߶Σڽ㴦ָǡ
+\return	0ʾཻ߽ڶ˵㣬1ʾһ㣬2ʾص˵ͬ3ʾص
+*/
+int SrPolygonBoolean::possibleIntersection(tEvent* event1,tEvent* event2)
+{
+	if( IsSameSegment(event1->mPoint,event1->mOther->mPoint,event2->mPoint,event2->mOther->mPoint) )
+		return 2;
+	SrSweepSegment segment1(event1->mPoint,event1->mOther->mPoint);
+	SrSweepSegment segment2(event2->mPoint,event2->mOther->mPoint);
+	SrPoint2D point0 , point1;
+	int numInter = segment1.intersect(segment2,point0,point1);
+	if( numInter==0 )
+		return 0;
+	if( numInter==1 )
+	{
+		bool divide1 = IsInterior(event1->mPoint,event1->mOther->mPoint,point0);
+		bool divide2 = IsInterior(event2->mPoint,event2->mOther->mPoint,point0);
+		//һ߶εĶ˵ʱö˵ָһ߶
+		if( !divide1 && divide2 )
+			point0 = NearestEnd(event1->mPoint,event1->mOther->mPoint,point0);
+		else if( divide1 && !divide2 )
+			point0 = NearestEnd(event2->mPoint,event2->mOther->mPoint,point0);
+		if( divide1 )
+			divideSegment(event1,point0);
+		if( divide2 )
+			divideSegment(event2,point0);
+		return divide1 || divide2 ? 1 : 0;
+	}
+
+	//ص˳߶εĶ˵㣬ͬĶ˵ֻһNULL
+	tEvent* sorted[4];
+	int numSorted = 0;
+	if( SamePoint(event1->mPoint,event2->mPoint) )
+		sorted[numSorted++] = NULL;
+	else if( isEventAfter(event1,event2) )
+	{
+		sorted[numSorted++] = event2;
+		sorted[numSorted++] = event1;
+	}
+	else
+	{
+		sorted[numSorted++] = event1;
+		sorted[numSorted++] = event2;
+	}
+	if( SamePoint(event1->mOther->mPoint,event2->mOther->mPoint) )
+		sorted[numSorted++] = NULL;
+	else if( isEventAfter(event1->mOther,event2->mOther) )
+	{
+		sorted[numSorted++] = event2->mOther;
+		sorted[numSorted++] = event1->mOther;
+	}
+	else
+	{
+		sorted[numSorted++] = event1->mOther;
+		sorted[numSorted++] = event2->mOther;
+	}
+
+	if( numSorted==2 || (numSorted==3 && sorted[2]) )
+	{
+		//߶ͬ˵ָ֮ͬغϵcomputeFields()
+		if( numSorted==3 )
+			divideSegment(sorted[2]->mOther,sorted[1]->mPoint);
+		return 2;
+	}
+	if( numSorted==3 )
+	{
+		//Ҷ˵ͬ
+		divideSegment(sorted[0],sorted[1]->mPoint);
+		return 3;
+	}
+	if( sorted[0]!=sorted[3]->mOther )
+	{
+		//߶βص
+		divideSegment(sorted[0],sorted[1]->mPoint);
+		divideSegment(sorted[1],sorted[2]->mPoint);
+		return 3;
+	}
+	//һ߶ΰһ߶ΣȷָԶһ㣬ʹηָĶɨϵһ
+	divideSegment(sorted[0],sorted[2]->mPoint);
+	divideSegment(sorted[0],sorted[1]->mPoint);
+	return 3;
+}
+
+int SrPolygonBoolean::compute(const tBooleanPolygon& subject,const tBooleanPolygon& clip,int operation,
+							  std::vector<SrPoint2D>& vertex,std::vector<int>& ringStart)
+{
+	if( ringStart.empty() )
+		ringStart.push_back((int)vertex.size());
+	mOperation = operation;
+	mNumEvent  = 0;
+	mQueue.clear();
+	mStatus.clear();
+	mProcessed.clear();
+
+	SrPoint2D minSubject , maxSubject , minClip , maxClip;
+	addPolygon(subject,0,minSubject,maxSubject);
+	addPolygon(clip,1,minClip,maxClip);
+	//ΧвཻʱΪգȻҪѸķͳһ
+	if( operation==SR_BOOLEAN_INTERSECTION &&
+		(minSubject.x>maxClip.x || minClip.x>maxSubject.x || minSubject.y>maxClip.y || minClip.y>maxSubject.y) )
+		return 0;
+	//֮󲻻нı
+	SrReal maxX = SR_MAX_F64;
+	if( operation==SR_BOOLEAN_INTERSECTION )
+		maxX = maxSubject.x<maxClip.x ? maxSubject.x : maxClip.x;
+	else if( operation==SR_BOOLEAN_DIFFERENCE )
+		maxX = maxSubject.x;
+
+	tEvent* event , *prev , *next;
+	StatusLine::iterator it;
+	while( !mQueue.empty() )
+	{
+		event = popEvent();
+		if( GREATER(event->mPoint.x,maxX) )
+			break;
+		if( event->mIsLeft )
+		{
+			mProcessed.push_back(event);
+			std::pair<StatusLine::iterator,bool> inserted = mStatus.insert(event);
+			ASSERT(inserted.second);
+			event->mPosition = inserted.first;
+			it = event->mPosition;
+			prev = it==mStatus.begin() ? NULL : *(--it);
+			it = event->mPosition;
+			++it;
+			next = it==mStatus.end() ? NULL : *it;
+			computeFields(event,prev);
+			if( next && possibleIntersection(event,next)==2 )
+			{
+				computeFields(event,prev);
+				computeOverlapFields(event);
+			}
+			if( prev && possibleIntersection(prev,event)==2 )
+			{
+				it = prev->mPosition;
+				tEvent* prevPrev = it==mStatus.begin() ? NULL : *(--it);
+				computeFields(prev,prevPrev);
+				computeOverlapFields(prev);
+			}
+			//ڵ߶δevent˵ʱһ㱻ָһһ
+			//eventҪһƳɨ֮²룬ܵõȷı
+			if( (prev && SamePoint(prev->mOther->mPoint,event->mPoint)) ||
+				(next && SamePoint(next->mOther->mPoint,event->mPoint)) )
+			{
+				mStatus.erase(event->mPosition);
+				mProcessed.pop_back();
+				pushEvent(event);
+			}
+		}
+		else
+		{
+			event = event->mOther;
+			it = event->mPosition;
+			prev = it==mStatus.begin() ? NULL : *(--it);
+			it = event->mPosition;
+			++it;
+			next = it==mStatus.end() ? NULL : *it;
+			mStatus.erase(event->mPosition);
+			if( prev && next )
+				possibleIntersection(prev,next);
+		}
+	}
+	mStatus.clear();
+	return connectEdges(vertex,ringStart);
+}
+
+/*
+	нı
+*/
+struct EdgeStartLess
+{
+	const SrPoint2D* mEdge;
+	EdgeStartLess(const SrPoint2D* edge):mEdge(edge){}
+	bool operator()(int a,int b) const
+	{
+		return SrSweepEvent(mEdge[2*a])<SrSweepEvent(mEdge[2*b]);
+	}
+	bool operator()(int a,const SrPoint2D& p) const
+	{
+		return SrSweepEvent(mEdge[2*a])<SrSweepEvent(p);
+	}
+	bool operator()(const SrPoint2D& p,int b) const
+	{
+		return SrSweepEvent(p)<SrSweepEvent(mEdge[2*b]);
+	}
+};
+
+/*
+\brief	ѽıɻÿߵķʹࡣһжδʹõĳʱ
+		ѡߵķ˳ʱתĽǶСһֽӵĶ㴦ֳ
+		ȥߵĶ㡣
+*/
+int SrPolygonBoolean::connectEdges(std::vector<SrPoint2D>& vertex,std::vector<int>& ringStart)
+{
+	int i , numEdge = 0 , numRing = 0;
+	mEdge.clear();
+	for( i=0 ; i<(int)mProcessed.size() ; i++ )
+	{
+		const tEvent* event = mProcessed[i];
+		if( !event->mIsLeft || !event->mInResult )
+			continue;
+		if( event->mResultAbove )
+		{
+			mEdge.push_back(event->mPoint);
+			mEdge.push_back(event->mOther->mPoint);
+		}
+		else
+		{
+			mEdge.push_back(event->mOther->mPoint);
+			mEdge.push_back(event->mPoint);
+		}
+		numEdge ++;
+	}
+	if( numEdge==0 )
+		return 0;
+	mEdgeOrder.resize(numEdge);
+	for( i=0 ; i<numEdge ; i++ )
+		mEdgeOrder[i] = i;
+	EdgeStartLess compare(&mEdge[0]);
+	std::sort(mEdgeOrder.begin(),mEdgeOrder.end(),compare);
+	mIsEdgeUsed.assign(numEdge,false);
+
+	int start , current , best , k , first , last , n;
+	SrReal angle , bestAngle;
+	SrVector2D back , direction;
+	for( start=0 ; start<numEdge ; start++ )
+	{
+		if( mIsEdgeUsed[mEdgeOrder[start]] )
+			continue;
+		mRing.clear();
+		current = mEdgeOrder[start];
+		while( true )
+		{
+			mIsEdgeUsed[current] = true;
+			mRing.push_back(mEdge[2*current]);
+			const SrPoint2D& end = mEdge[2*current + 1];
+			if( SamePoint(end,mRing[0]) )
+				break;
+			first = (int)(std::lower_bound(mEdgeOrder.begin(),mEdgeOrder.end(),end,compare) - mEdgeOrder.begin());
+			last  = (int)(std::upper_bound(mEdgeOrder.begin(),mEdgeOrder.end(),end,compare) - mEdgeOrder.begin());
+			back  = mEdge[2*current] - end;
+			best  = -1;
+			bestAngle = 0;
+			for( k=first ; k<last ; k++ )
+			{
+				if( mIsEdgeUsed[mEdgeOrder[k]] )
+					continue;
+				direction = mEdge[2*mEdgeOrder[k] + 1] - mEdge[2*mEdgeOrder[k]];
+				angle = -atan2(back.cross(direction),back.dot(direction));
+				if( angle<=0 )
+					angle += TWO_PI;
+				if( best<0 || angle<bestAngle )
+				{
+					best = mEdgeOrder[k];
+					bestAngle = angle;
+				}
+			}
+			//ֵʹûϿʱ
+			if( best<0 )
+			{
+				mRing.clear();
+				break;
+			}
+			current = best;
+		}
+
+		//ȥߵĶ㣬βӴĶ
+		n = 0;
+		for( k=0 ; k<(int)mRing.size() ; k++ )
+		{
+			while( n>=2 && fabs((mRing[n - 1] - mRing[n - 2]).cross(mRing[k] - mRing[n - 1]))<=
+				SR_EPS*(mRing[n - 1] - mRing[n - 2]).magnitude()*(mRing[k] - mRing[n - 1]).magnitude() )
+				n --;
+			mRing[n++] = mRing[k];
+		}
+		first = 0;
+		while( n - first>=3 )
+		{
+			SrVector2D e1 = mRing[n - 1] - mRing[n - 2] , e2 = mRing[first] - mRing[n - 1];
+			SrVector2D e3 = mRing[first + 1] - mRing[first];
+			if( fabs(e1.cross(e2))<=SR_EPS*e1.magnitude()*e2.magnitude() )
+				n --;
+			else if( fabs(e2.cross(e3))<=SR_EPS*e2.magnitude()*e3.magnitude() )
+				first ++;
+			else
+				break;
+		}
+		if( n - first<3 )
+			continue;
+		vertex.insert(vertex.end(),mRing.begin() + first,mRing.begin() + n);
+		ringStart.push_back((int)vertex.size());
+		numRing ++;
+	}
+	return numRing;
+}
+
+int PolygonBooleanBatch(const tBooleanPolygon* subject,const tBooleanPolygon* clip,int numPair,int operation,
+						std::vector<SrPoint2D>& vertex,std::vector<int>& ringStart,std::vector<int>& pairStart)
+{
+	int numThread = 1 , i , k , offset;
+#ifdef _OPENMP
+	if( numPair>=64 )
+		numThread = omp_get_max_threads();
+#endif
+	std::vector<SrPolygonBoolean*> engine(numThread);
+	std::vector< std::vector<SrPoint2D> > pairVertex(numPair);
+	std::vector< std::vector<int> > pairRing(numPair);
+	for( i=0 ; i<numThread ; i++ )
+		engine[i] = new SrPolygonBoolean();
+
+#pragma omp parallel num_threads(numThread) private(i)
+	{
+		int thread = 0;
+#ifdef _OPENMP
+		thread = omp_get_thread_num();
+#endif
+#pragma omp for schedule(dynamic,16)
+		for( i=0 ; i<numPair ; i++ )
+			engine[thread]->compute(subject[i],clip[i],operation,pairVertex[i],pairRing[i]);
+	}
+	for( i=0 ; i<numThread ; i++ )
+		delete engine[i];
+
+	//ζԵ˳ƴӽ
+	if( ringStart.empty() )
+		ringStart.push_back((int)vertex.size());
+	pairStart.resize(numPair + 1);
+	pairStart[0] = (int)ringStart.size() - 1;
+	for( i=0 ; i<numPair ; i++ )
+	{
+		offset = (int)vertex.size();
+		vertex.insert(vertex.end(),pairVertex[i].begin(),pairVertex[i].end());
+		for( k=1 ; k<(int)pairRing[i].size() ; k++ )
+			ringStart.push_back(offset + pairRing[i][k]);
+		pairStart[i + 1] = (int)ringStart.size() - 1;
+	}
+	return pairStart[numPair] - pairStart[0];
+}
@@ -0,0 +1,137 @@
+/************************************************************************
+\link	www.twinklingstar.cn
+\author Twinkling Star
+\date	2026/10/19
+****************************************************************************/
+#ifndef SR_ALGORITHMS_POLYGON_BOOLEAN_H_
+#define SR_ALGORITHMS_POLYGON_BOOLEAN_H_
+
+/** \addtogroup algorithms
+  @{
+*/
+#include "BentleyOttmann.h"
+#include <vector>
+#include <set>
+
+/*
+	εĲ
+*/
+#define SR_BOOLEAN_INTERSECTION		0
+#define SR_BOOLEAN_UNION			1
+#define SR_BOOLEAN_DIFFERENCE		2
+#define SR_BOOLEAN_XOR				3
+
+/*
+	ɨ¼ڴÿһ¼
+*/
+#define SR_BOOLEAN_EVENT_BLOCK		1024
+
+/**
+\brief A polygon with one or more rings.
+
+The i-th ring is mVertex[mRingStart[i]],...,mVertex[mRingStart[i + 1] - 1], so
+mRingStart has mNumRing + 1 elements. A point is inside of the polygon if a
+ray from it crosses the rings an odd number of times, the orientation of the
+rings does not matter.
+*/
+typedef struct
+{
+	const SrPoint2D*	mVertex;
+	const int*			mRingStart;
+	int					mNumRing;
+}tBooleanPolygon;
+
+/**
+\brief Boolean operations of two polygons by the sweep line algorithm of Martinez, Rueda and Feito.
+
+The edges of both polygons are swept from left to right as in the Bentley-Ottmann
+algorithm: the segments are SrSweepSegment, the events are ordered as
+SrSweepEvent, the crossing and overlapping edges are split at the intersection
+points. When an edge leaves the sweep line, the edge below it tells whether the
+edge is inside of the other polygon, so whether it is on the boundary of the result.
+
+The result is appended to a vertex array and a ring array in the same way as
+tBooleanPolygon: ringStart[i] is the first vertex of the i-th ring and
+ringStart.back() is the number of vertices. The outer rings are counterclockwise
+and the holes are clockwise. The sweep events are allocated from blocks which
+are kept by the object, so an object used for many polygons allocates almost
+nothing after the first ones.
+*/
+class SrPolygonBoolean
+{
+public:
+	SrPolygonBoolean();
+	~SrPolygonBoolean();
+	/**
+	\param[in] operation SR_BOOLEAN_INTERSECTION, SR_BOOLEAN_UNION, SR_BOOLEAN_DIFFERENCE(subject - clip) or SR_BOOLEAN_XOR.
+	\return The number of rings appended.
+	*/
+	int					compute(const tBooleanPolygon& subject,const tBooleanPolygon& clip,int operation,
+								std::vector<SrPoint2D>& vertex,std::vector<int>& ringStart);
+
+private:
+	SrPolygonBoolean(const SrPolygonBoolean&);
+	SrPolygonBoolean& operator=(const SrPolygonBoolean&);
+
+	struct tEvent;
+	struct tSegmentLess
+	{
+		bool operator()(const tEvent* event1,const tEvent* event2) const;
+	};
+	typedef std::set<tEvent*,tSegmentLess>	StatusLine;
+	/*
+		߶εһ˵㣬˵¼߶ɨϵλǡmInsideǽ߶ϷǷڣ
+		mInsideBelowǽ߶·غϵļ߶εmInsideBelowһ߶ε·
+	*/
+	struct tEvent
+	{
+		SrPoint2D			mPoint;
+		tEvent*				mOther;
+		StatusLine::iterator	mPosition;
+		int					mPolygon;
+		int					mId;
+		bool				mIsLeft;
+		bool				mInside[2];
+		bool				mInsideBelow[2];
+		bool				mInResult;
+		bool				mResultAbove;
+	};
+
+	static bool			isEventAfter(const tEvent* event1,const tEvent* event2);
+	static bool			isBelow(const tEvent* event,const SrPoint2D& p);
+	static bool			isSegmentBelow(const tEvent* event1,const tEvent* event2);
+
+	tEvent*				newEvent(const SrPoint2D& p,bool isLeft,tEvent* other,int polygon);
+	void				pushEvent(tEvent* event);
+	tEvent*				popEvent();
+	void				addPolygon(const tBooleanPolygon& polygon,int index,SrPoint2D& minPoint,SrPoint2D& maxPoint);
+	void				computeFields(tEvent* event,tEvent* prev);
+	void				computeOverlapFields(tEvent* event);
+	int					possibleIntersection(tEvent* event1,tEvent* event2);
+	void				splitSegment(tEvent* event,const SrPoint2D& p);
+	void				divideSegment(tEvent* event,const SrPoint2D& p);
+	int					connectEdges(std::vector<SrPoint2D>& vertex,std::vector<int>& ringStart);
+
+	int					mOperation;
+	int					mNumEvent;
+	std::vector<tEvent*>	mBlock;
+	std::vector<tEvent*>	mQueue;
+	StatusLine			mStatus;
+	std::vector<tEvent*>	mProcessed;
+	std::vector<SrPoint2D>	mEdge;
+	std::vector<int>		mEdgeOrder;
+	std::vector<bool>		mIsEdgeUsed;
+	std::vector<SrPoint2D>	mRing;
+};
+
+/*
+\brief	еؼԶεĲ㣬ÿ߳ʹԼSrPolygonBooleanɨ¼ڴ߳ظʹá
+\param[out]	vertex,ringStart	нĻ
+\param[out]	pairStart			kԶεĽǵpairStart[k]pairStart[k + 1] - 1numPair + 1Ԫ
+\return	л
+*/
+int PolygonBooleanBatch(const tBooleanPolygon* subject,const tBooleanPolygon* clip,int numPair,int operation,
+						std::vector<SrPoint2D>& vertex,std::vector<int>& ringStart,std::vector<int>& pairStart);
+
+/** @} */
+#endif
@@ -104,8 +104,9 @@ void QuickHull::findVisibleFacet(cVertex* furPoint,cFacet* f,FacetList& visibleS
 			if( neighbor->mVisitFlag==FACET_NULL )
 			{
 				neighbor->mVisitFlag = FACET_VISITED;
-				ASSERT(plane.initPlane(neighbor->mVertex[0]->mPoint,neighbor->mVertex[1]->mPoint,neighbor->mVertex[2]->mPoint));
-				if( plane.isOnPositiveSide(furPoint->mPoint) )
+				//A degenerate facet has no plane, it's kept as a border facet.
+				if( plane.initPlane(neighbor->mVertex[0]->mPoint,neighbor->mVertex[1]->mPoint,neighbor->mVertex[2]->mPoint) &&
+					plane.isOnPositiveSide(furPoint->mPoint) )
 				{
 
 					visibleSet.push_back(neighbor);
@@ -185,7 +186,9 @@ void QuickHull::determineOutsideSet(FacetList& facetList, VertexList& allVertex)
 	cPlane plane;
 	for( facetIter = facetList.begin(); facetIter != facetList.end(); facetIter ++ )
 	{
-		ASSERT(plane.initPlane((*facetIter)->mVertex[0]->mPoint,(*facetIter)->mVertex[1]->mPoint,(*facetIter)->mVertex[2]->mPoint));
+		//No vertex is outside of a degenerate facet.
+		if( !plane.initPlane((*facetIter)->mVertex[0]->mPoint,(*facetIter)->mVertex[1]->mPoint,(*facetIter)->mVertex[2]->mPoint) )
+			continue;
 		for( vertexIter = allVertex.begin() ; vertexIter!=allVertex.end() ; )
 		{
 			if( plane.isOnPositiveSide((*vertexIter)->mPoint) )
@@ -347,7 +350,8 @@ bool QuickHull::initTetrahedron(VertexList& vertexes,FacetList& tetrahedron)
 		ptIndex3 = miny;
 	}
 	cPlane plane;
-	ASSERT(plane.initPlane((*ptIndex1)->mPoint,(*ptIndex2)->mPoint,(*ptIndex3)->mPoint));
+	if( !plane.initPlane((*ptIndex1)->mPoint,(*ptIndex2)->mPoint,(*ptIndex3)->mPoint) )
+		return false;
 
 	//Find the vertexes that have minimum and maximum distance from the plane.
 	SrReal minDist = plane.distance((*vertexes.begin())->mPoint);
@@ -0,0 +1,74 @@
+/************************************************************************		
+\link	www.twinklingstar.cn
+\author Twinkling Star
+\date	2014/06/18
+****************************************************************************/
+/************************************************************************		
+\description	ò̷Żʵཻԡ
+****************************************************************************/
+#include "Ray3DHitTestSphere.h"
+#include <math.h>
+
+/*
+\brief	ò̷ʵཻԡ
+\param[out]	result	߿òP+tDʾصһеtֵ
+\return	true	ཻУ
+		false	루޽㣩
+
+*/
+bool RayHitTestSphere_Parameter(const SrRay3D& ray,const SrSphere3D& sphere,SrReal& result)
+{
+	SrVector3D e = ray.mBase - sphere.mCenter;
+	SrReal b = e.dot(ray.mDirection), c = e.dot(e)-sphere.mRadius*sphere.mRadius;
+	SrReal delta = b*b - c;
+
+	if( LESS(delta,0) )
+		return false;
+	else if( EQUAL(delta,0) )
+	{
+		if( LESS(-b,0) )
+			return false;
+		result = -b;
+		return true;
+	}
+	else
+	{
+		SrReal d = sqrt(delta);
+		SrReal t1 = -b - d, t2 = -b + d;
+		if( LESS(t2,0) )
+			return false;
+		else if( LESS(t1,0) )
+			result = t2;
+		else
+			result = t1;
+		return true;
+
+	}
+	return true;
+}
+
+/*
+\brief	Żʵཻԡ
+\param[out]	result	߿òP+tDʾصһеtֵ
+\return	true	ཻУ
+		false	루޽㣩
+
+*/
+bool RayHitTestSphere_Optimized(const SrRay3D& ray,const SrSphere3D& sphere,SrReal& result)
+{
+	SrVector3D l = sphere.mCenter - ray.mBase;
+	SrReal s = l.dot(ray.mDirection);
+	SrReal squaredL = l.dot(l);
+	SrReal squaredRadius = sphere.mRadius * sphere.mRadius;
+	if( LESS(s,0) && GREATER(squaredL,squaredRadius) )
+		return false;
+	SrReal squaredM = squaredL - s*s;
+	if( GREATER(squaredM,squaredRadius) )
+		return false;
+	SrReal q = sqrt(squaredRadius - squaredM);
+	if( squaredL > squaredRadius )
+		result = s - q;
+	else
+		result = s + q;
+	return true;
+}
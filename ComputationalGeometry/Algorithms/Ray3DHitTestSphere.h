@@ -0,0 +1,33 @@
+/************************************************************************
+\link	www.twinklingstar.cn
+\author Twinkling Star
+\date	2014/06/18
+****************************************************************************/
+#ifndef SR_ALGORITHMS_RAY3D_HIT_TEST_SPHERE_H_
+#define SR_ALGORITHMS_RAY3D_HIT_TEST_SPHERE_H_
+
+/** \addtogroup algorithms
+  @{
+*/
+#include "SrRay3D.h"
+#include "SrSphere3D.h"
+
+/*
+\brief	ò̷ʵཻԡ
+\param[out]	result	߿òP+tDʾصһеtֵ
+\return	true	ཻУ
+		false	루޽㣩
+
+*/
+bool RayHitTestSphere_Parameter(const SrRay3D& ray,const SrSphere3D& sphere,SrReal& result);
+/*
+\brief	Żʵཻԡ
+\param[out]	result	߿òP+tDʾصһеtֵ
+\return	true	ཻУ
+		false	루޽㣩
+
+*/
+bool RayHitTestSphere_Optimized(const SrRay3D& ray,const SrSphere3D& sphere,SrReal& result);
+
+/** @} */
+#endif
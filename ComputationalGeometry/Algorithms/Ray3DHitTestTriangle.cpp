@@ -0,0 +1,112 @@
+/************************************************************************
+\link	www.twinklingstar.cn
+\author Twinkling Star
+\date	2026/10/19
+****************************************************************************/
+/************************************************************************
+\description	εMoller-Trumbore󽻣һͬʱSoAе8
+				󽻣4SSE2Ĵеһʽ꣬ǰ
+				ųļĴټķ
+****************************************************************************/
+#include "Ray3DHitTestTriangle.h"
+#include "SrSimd.h"
+
+#define PACKET_WIDTH	SR_RAY_TRIANGLE_PACKET_WIDTH
+#define NUM_REGISTER	(SR_RAY_TRIANGLE_PACKET_WIDTH / SR_SIMD_WIDTH)
+
+bool Ray3DHitTestTriangle(const SrRay3D& ray,const SrTriangle3D& triangle,tRayTriangleHit& hit)
+{
+	SrVector3D result;
+	if( triangle.rayHitTest(ray.mBase,ray.mDirection,result)!=SR_INTERSECTING )
+		return false;
+	hit.mU = result.x;
+	hit.mV = result.y;
+	hit.mT = result.z;
+	hit.mTriangle = 0;
+	return true;
+}
+
+int Ray3DHitTestTriangle_Packet(const SrRay3D& ray,const SrTriangle3DSoA& triangle,int first,SrReal* t,SrReal* u,SrReal* v)
+{
+	ASSERT(first>=0 && first%PACKET_WIDTH==0 && first<triangle.mNumTriangle);
+	const SrSimdReal zero = SrSimd::splat(0);
+	const SrSimdReal one  = SrSimd::splat(1);
+	SrSimdReal base[3] , d[3] , p0[3] , e1[3] , e2[3] , p[3] , s[3] , q[3];
+	SrSimdReal tmp , pu , pv , pt , miss;
+	int r , c , index , result = 0;
+	for( c=0 ; c<3 ; c++ )
+	{
+		base[c] = SrSimd::splat(ray.mBase[c]);
+		d[c]	= SrSimd::splat(ray.mDirection[c]);
+	}
+	for( r=0 ; r<NUM_REGISTER ; r++ )
+	{
+		index = first + r*SR_SIMD_WIDTH;
+		for( c=0 ; c<3 ; c++ )
+		{
+			p0[c] = SrSimd::load(triangle.mCoord[0][c] + index);
+			e1[c] = SrSimd::sub(SrSimd::load(triangle.mCoord[1][c] + index),p0[c]);
+			e2[c] = SrSimd::sub(SrSimd::load(triangle.mCoord[2][c] + index),p0[c]);
+		}
+		//p = de2, tmp = pe1
+		p[0] = SrSimd::sub(SrSimd::mul(d[1],e2[2]),SrSimd::mul(d[2],e2[1]));
+		p[1] = SrSimd::sub(SrSimd::mul(d[2],e2[0]),SrSimd::mul(d[0],e2[2]));
+		p[2] = SrSimd::sub(SrSimd::mul(d[0],e2[1]),SrSimd::mul(d[1],e2[0]));
+		tmp  = SrSimd::add(SrSimd::add(SrSimd::mul(p[0],e1[0]),SrSimd::mul(p[1],e1[1])),SrSimd::mul(p[2],e1[2]));
+		miss = SrSimd::equal(tmp,zero);
+		if( SrSimd::moveMask(miss)==SR_SIMD_FULL_MASK )
+			continue;
+		//u = ps/tmp
+		for( c=0 ; c<3 ; c++ )
+			s[c] = SrSimd::sub(base[c],p0[c]);
+		pu	 = SrSimd::div(SrSimd::add(SrSimd::add(SrSimd::mul(p[0],s[0]),SrSimd::mul(p[1],s[1])),SrSimd::mul(p[2],s[2])),tmp);
+		miss = SrSimd::orMask(miss,SrSimd::orMask(SrSimd::less(pu,zero),SrSimd::greater(pu,one)));
+		if( SrSimd::moveMask(miss)==SR_SIMD_FULL_MASK )
+			continue;
+		//q = se1, v = qd/tmp
+		q[0] = SrSimd::sub(SrSimd::mul(s[1],e1[2]),SrSimd::mul(s[2],e1[1]));
+		q[1] = SrSimd::sub(SrSimd::mul(s[2],e1[0]),SrSimd::mul(s[0],e1[2]));
+		q[2] = SrSimd::sub(SrSimd::mul(s[0],e1[1]),SrSimd::mul(s[1],e1[0]));
+		pv	 = SrSimd::div(SrSimd::add(SrSimd::add(SrSimd::mul(q[0],d[0]),SrSimd::mul(q[1],d[1])),SrSimd::mul(q[2],d[2])),tmp);
+		miss = SrSimd::orMask(miss,SrSimd::orMask(SrSimd::less(pv,zero),SrSimd::greater(pv,one)));
+		miss = SrSimd::orMask(miss,SrSimd::greater(SrSimd::add(pu,pv),one));
+		if( SrSimd::moveMask(miss)==SR_SIMD_FULL_MASK )
+			continue;
+		//t = e2q/tmp
+		pt	 = SrSimd::div(SrSimd::add(SrSimd::add(SrSimd::mul(e2[0],q[0]),SrSimd::mul(e2[1],q[1])),SrSimd::mul(e2[2],q[2])),tmp);
+		miss = SrSimd::orMask(miss,SrSimd::less(pt,zero));
+		SrSimd::store(t + r*SR_SIMD_WIDTH,pt);
+		SrSimd::store(u + r*SR_SIMD_WIDTH,pu);
+		SrSimd::store(v + r*SR_SIMD_WIDTH,pv);
+		result |= (~SrSimd::moveMask(miss) & SR_SIMD_FULL_MASK) << (r*SR_SIMD_WIDTH);
+	}
+	if( triangle.mNumTriangle - first<PACKET_WIDTH )
+		result &= (1<<(triangle.mNumTriangle - first)) - 1;
+	return result;
+}
+
+int Ray3DHitTestTriangle_Closest(const SrRay3D& ray,const SrTriangle3DSoA& triangle,tRayTriangleHit& hit)
+{
+	SrReal t[PACKET_WIDTH] , u[PACKET_WIDTH] , v[PACKET_WIDTH];
+	int first , i , mask;
+	hit.mT		  = SR_MAX_F64;
+	hit.mU		  = 0;
+	hit.mV		  = 0;
+	hit.mTriangle = -1;
+	for( first=0 ; first<triangle.mNumTriangle ; first+=PACKET_WIDTH )
+	{
+		mask = Ray3DHitTestTriangle_Packet(ray,triangle,first,t,u,v);
+		//ֻtϸСʱŸ£tͬʱС
+		for( i=0 ; mask ; i++ , mask>>=1 )
+		{
+			if( (mask & 1) && t[i]<hit.mT )
+			{
+				hit.mT		  = t[i];
+				hit.mU		  = u[i];
+				hit.mV		  = v[i];
+				hit.mTriangle = first + i;
+			}
+		}
+	}
+	return hit.mTriangle;
+}
@@ -0,0 +1,56 @@
+/************************************************************************
+\link	www.twinklingstar.cn
+\author Twinkling Star
+\date	2026/10/19
+****************************************************************************/
+#ifndef SR_ALGORITHMS_RAY3D_HIT_TEST_TRIANGLE_H_
+#define SR_ALGORITHMS_RAY3D_HIT_TEST_TRIANGLE_H_
+
+/** \addtogroup algorithms
+  @{
+*/
+#include "SrRay3D.h"
+#include "Tri3DOverlapTri3DPacket.h"
+
+/*
+	һݰεĸռ4SSE2Ĵ
+*/
+#define SR_RAY_TRIANGLE_PACKET_WIDTH	8
+
+/**
+\brief The hit of a ray on a set of triangles.
+
+The hit point is P+mT*d = (1-mU-mV)*V0 + mU*V1 + mV*V2 of the triangle mTriangle,
+mTriangle is -1 and mT is SR_MAX_F64 if the ray misses all the triangles.
+*/
+typedef struct
+{
+	SrReal		mT;
+	SrReal		mU;
+	SrReal		mV;
+	int			mTriangle;
+}tRayTriangleHit;
+
+/*
+\brief	Moller-Trumbore㷨жǷཻSrTriangle3D::rayHitTestͬ
+\param[out]	hit		ཻʱtuvmTriangleΪ0
+\return	true	ཻ
+		false	룬ڵƽϡ
+*/
+bool Ray3DHitTestTriangle(const SrRay3D& ray,const SrTriangle3D& triangle,tRayTriangleHit& hit);
+/*
+\brief	Moller-Trumbore㷨ݰ汾һͬʱ[first, first + SR_RAY_TRIANGLE_PACKET_WIDTH)󽻡
+		ÿεĽRay3DHitTestTriangleȫͬtriangle.mNumTriangleβཻ
+\param[in]	first	ݰеһεSR_RAY_TRIANGLE_PACKET_WIDTHı
+\param[out]	t,u,v	ĵiԪfirst + iĽֻཻ
+\return	λ룬iλΪ1ʾfirst + iཻ
+*/
+int Ray3DHitTestTriangle_Packet(const SrRay3D& ray,const SrTriangle3DSoA& triangle,int first,SrReal* t,SrReal* u,SrReal* v);
+/*
+\brief	ݰΣĽ㣻tͬʱСΡ
+\return	εζཻʱ-1
+*/
+int Ray3DHitTestTriangle_Closest(const SrRay3D& ray,const SrTriangle3DSoA& triangle,tRayTriangleHit& hit);
+
+/** @} */
+#endif
@@ -0,0 +1,182 @@
+/************************************************************************		
+\link	www.twinklingstar.cn
+\author Twinkling Star
+\date	2014/05/15
+****************************************************************************/
+/************************************************************************		
+\description	Cohen-Sutherland㷨Liang-Barsky㷨þβü߶Ρ
+****************************************************************************/
+#include "Rectangle2DClipLinearObject2D.h"
+
+static const int INSIDE = 0; // 0000
+static const int LEFT = 1;   // 0001
+static const int RIGHT = 2;  // 0010
+static const int BOTTOM = 4; // 0100
+static const int TOP = 8;    // 1000
+
+
+
+// Compute the bit code for a point (x, y) using the clip rectangle
+// bounded diagonally by (xMin, yMin), and (xMax, yMax)
+static int computeOutCode(const SrPoint2D& p,const SrVector2D& minW,const SrVector2D& maxW)
+{
+	int code;
+	code = INSIDE;				 // initialised as being inside of clip window
+	if ( LESS(p.x,minW.x) )           // to the left of clip window
+		code |= LEFT;
+	else if ( GREATER(p.x,maxW.x))      // to the right of clip window
+		code |= RIGHT;
+	if ( LESS(p.y , minW.y) )           // below the clip window
+		code |= BOTTOM;
+	else if ( GREATER(p.y , maxW.y) )      // above the clip window
+		code |= TOP;
+	return code;
+}
+
+// CohenCSutherland clipping algorithm clips a line from
+// P0 = (x0, y0) to P1 = (x1, y1) against a rectangle with 
+// diagonal from (xMin, yMin) to (xMax, yMax).
+bool Segment2DClipRectangle_CohenSutherland(const SrPoint2D& inP1, const SrPoint2D& inP2,
+											   const SrVector2D& minRect,const SrVector2D& maxRect,
+											   SrPoint2D& resultP1,SrPoint2D& resultP2)
+{
+
+	if( (LESS(inP1.x,minRect.x)&&LESS(inP2.x,minRect.x))||
+		(GREATER(inP1.x,maxRect.x)&&GREATER(inP2.x,maxRect.x))||
+		(LESS(inP1.y,minRect.y)&&LESS(inP2.y,minRect.y))||
+		(GREATER(inP1.y,maxRect.y)&&GREATER(inP2.y,maxRect.y)) )
+		return false;
+
+	SrPoint2D p1 = inP1;
+	SrPoint2D p2 = inP2;
+	// compute outcodes for P0, P1, and whatever point lies outside the clip rectangle
+	int outcode0 = computeOutCode(p1,minRect,maxRect);
+	int outcode1 = computeOutCode(p2,minRect,maxRect);
+	bool accept = false;
+
+	while (true) 
+	{
+		if (!(outcode0 | outcode1)) 
+		{ // Bitwise OR is 0. Trivially accept and get out of loop
+			accept = true;
+			break;
+		} 
+		else if (outcode0 & outcode1) 
+		{ // Bitwise AND is not 0. Trivially reject and get out of loop
+			break;
+		} 
+		else 
+		{
+			// failed both tests, so calculate the line segment to clip
+			// from an outside point to an intersection with clip edge
+			SrReal x, y;
+			// At least one endpoint is outside the clip rectangle; pick it.
+			int outcodeOut = outcode0 ? outcode0 : outcode1;
+			// Now find the intersection point;
+			// use formulas y = y0 + slope * (x - x0), x = x0 + (1 / slope) * (y - y0)
+			if (outcodeOut & TOP) 
+			{           // point is above the clip rectangle
+				x = p1.x + (p2.x - p1.x) * (maxRect.y - p1.y) / (p2.y - p1.y);
+				y = maxRect.y;
+			} 
+			else if (outcodeOut & BOTTOM) 
+			{ // point is below the clip rectangle
+				x = p1.x + (p2.x - p1.x) * (minRect.y - p1.y) / (p2.y - p1.y);
+				y = minRect.y;
+			} 
+			else if (outcodeOut & RIGHT) 
+			{  // point is to the right of clip rectangle
+				y = p1.y + (p2.y - p1.y) * (maxRect.x - p1.x) / (p2.x - p1.x);
+				x = maxRect.x;
+			} 
+			else if (outcodeOut & LEFT) 
+			{   // point is to the left of clip rectangle
+				y = p1.y + (p2.y - p1.y) * (minRect.x - p1.x) / (p2.x - p1.x);
+				x = minRect.x;
+			}
+			// Now we move outside point to intersection point to clip
+			// and get ready for next pass.
+			if (outcodeOut == outcode0) 
+			{
+				p1.x = x;
+				p1.y = y;
+				outcode0 = computeOutCode(p1,minRect,maxRect);
+			} 
+			else 
+			{
+				p2.x = x;
+				p2.y = y;
+				outcode1 = computeOutCode(p2,minRect,maxRect);
+			}
+		}
+	}
+	if (accept) 
+	{
+		resultP1 = p1;
+		resultP2 = p2;
+		return true;
+	}
+	return false;
+}
+
+static bool clip(SrReal p,SrReal q,SrReal& t0,SrReal& t1)
+{
+	SrReal r;
+	if( LESS(p,0) && LESS(q,0) )
+	{
+		r = q/p;
+		if( GREATER(r,t1) )
+			return false;
+		else if( GREATER(r,t0) )
+			t0 = r;
+	}
+	else if( GREATER(p,0) && LESS(q,p) )
+	{
+		r = q/p;
+		if( LESS(r,t0) )
+			return false;
+		else if( LESS(r,t1) )
+			t1 = r;
+	}
+	else if( LESS(q,0) )
+		return false;
+	return true;
+}
+
+// Liang-Barsky clipping algorithm clips a line from
+// P0 = (x0, y0) to P1 = (x1, y1) against a rectangle with 
+// diagonal from (xMin, yMin) to (xMax, yMax).
+bool Segment2DClipRectangle_LiangBarsky(const SrPoint2D& inP1, const SrPoint2D& inP2,const SrVector2D& minRect,const SrVector2D& maxRect,SrPoint2D& resultP1,SrPoint2D& resultP2)
+{
+	if( (LESS(inP1.x,minRect.x)&&LESS(inP2.x,minRect.x))||
+		(GREATER(inP1.x,maxRect.x)&&GREATER(inP2.x,maxRect.x))||
+		(LESS(inP1.y,minRect.y)&&LESS(inP2.y,minRect.y))||
+		(GREATER(inP1.y,maxRect.y)&&GREATER(inP2.y,maxRect.y)) )
+		return false;
+
+	SrReal t0, t1;
+	t0 = 0.0;
+	t1 = 1.0;
+	SrReal deltaX , deltaY;
+
+	deltaX = inP2.x - inP1.x;
+	if( clip(-deltaX,inP1.x - minRect.x,t0,t1) && clip(deltaX,maxRect.x - inP1.x,t0,t1))
+	{
+		deltaY = inP2.y - inP1.y;
+		if( clip(-deltaY,inP1.y - minRect.y,t0,t1) && clip(deltaY,maxRect.y - inP1.y,t0,t1) )
+		{
+			if( LEQUAL(t1,1) )
+			{
+				resultP2.x = inP1.x + t1*deltaX;
+				resultP2.y = inP1.y + t1*deltaY;
+			}
+			if( GEQUAL(t0,0) )
+			{
+				resultP1.x = inP1.x + t0*deltaX;
+				resultP1.y = inP1.y + t0*deltaY;
+			}
+			return true;
+		}
+	}
+	return false;
+}
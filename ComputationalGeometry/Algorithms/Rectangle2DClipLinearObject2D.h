@@ -0,0 +1,30 @@
+/************************************************************************
+\link	www.twinklingstar.cn
+\author Twinkling Star
+\date	2014/05/15
+****************************************************************************/
+#ifndef SR_ALGORITHMS_RECTANGLE2D_CLIP_LINEAR_OBJECT2D_H_
+#define SR_ALGORITHMS_RECTANGLE2D_CLIP_LINEAR_OBJECT2D_H_
+
+/** \addtogroup algorithms
+  @{
+*/
+#include "SrGeometricTools.h"
+#include "SrDataType.h"
+
+/*
+\brief	Cohen-Sutherlandü㷨öԽǶΪminRectmaxRectľβü߶(inP1,inP2)
+\param[out]	resultP1,resultP2	ü߶
+\return	true	߶ཻ
+		false	߶ھ⡣
+*/
+bool Segment2DClipRectangle_CohenSutherland(const SrPoint2D& inP1, const SrPoint2D& inP2,
+											   const SrVector2D& minRect,const SrVector2D& maxRect,
+											   SrPoint2D& resultP1,SrPoint2D& resultP2);
+/*
+\brief	Liang-Barskyü㷨뷵ֵĺSegment2DClipRectangle_CohenSutherlandͬ
+*/
+bool Segment2DClipRectangle_LiangBarsky(const SrPoint2D& inP1, const SrPoint2D& inP2,const SrVector2D& minRect,const SrVector2D& maxRect,SrPoint2D& resultP1,SrPoint2D& resultP2);
+
+/** @} */
+#endif
@@ -0,0 +1,273 @@
+/************************************************************************
+\link	www.twinklingstar.cn
+\author Twinkling Star
+\date	2026/10/19
+****************************************************************************/
+/************************************************************************
+\description	Liang-Barskyü㷨SSE2ݰ汾8߶ռ4Ĵ
+				ߵĲѡüʱÿݰѱ
+				߶ѹԼλãǰƣõյ
+****************************************************************************/
+#include "Rectangle2DClipLinearObject2DPacket.h"
+#include "SrSimd.h"
+#include <string.h>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#define PACKET_WIDTH	SR_SEGMENT2D_PACKET_WIDTH
+#define NUM_REGISTER	(SR_SEGMENT2D_PACKET_WIDTH / SR_SIMD_WIDTH)
+
+SrSegment2DSoA::SrSegment2DSoA()
+{
+	mBuffer		= NULL;
+	mNumSegment	= 0;
+	memset(mPoint1,0,sizeof(mPoint1));
+	memset(mPoint2,0,sizeof(mPoint2));
+}
+
+SrSegment2DSoA::SrSegment2DSoA(int numSegment)
+{
+	mBuffer		= NULL;
+	mNumSegment	= 0;
+	memset(mPoint1,0,sizeof(mPoint1));
+	memset(mPoint2,0,sizeof(mPoint2));
+	allocate(numSegment);
+}
+
+SrSegment2DSoA::~SrSegment2DSoA()
+{
+	if( mBuffer )
+		delete []mBuffer;
+}
+
+void SrSegment2DSoA::allocate(int numSegment)
+{
+	if( mBuffer )
+		delete []mBuffer;
+	int capacity = (numSegment + PACKET_WIDTH - 1) / PACKET_WIDTH * PACKET_WIDTH;
+	mBuffer = new SrReal[4*capacity];
+	memset(mBuffer,0,sizeof(SrReal)*4*capacity);
+	int c;
+	for( c=0 ; c<2 ; c++ )
+	{
+		mPoint1[c] = mBuffer + c*capacity;
+		mPoint2[c] = mBuffer + (2 + c)*capacity;
+	}
+	mNumSegment = numSegment;
+}
+
+void SrSegment2DSoA::setSegment(int i,const SrPoint2D& p1,const SrPoint2D& p2)
+{
+	ASSERT(i>=0 && i<mNumSegment);
+	mPoint1[0][i] = p1.x;
+	mPoint1[1][i] = p1.y;
+	mPoint2[0][i] = p2.x;
+	mPoint2[1][i] = p2.y;
+}
+
+void SrSegment2DSoA::getSegment(int i,SrPoint2D& p1,SrPoint2D& p2) const
+{
+	ASSERT(i>=0 && i<mNumSegment);
+	p1.x = mPoint1[0][i];
+	p1.y = mPoint1[1][i];
+	p2.x = mPoint2[0][i];
+	p2.y = mPoint2[1][i];
+}
+
+/*
+\brief	Segment2DClipRectangle_LiangBarskyеclip()ͬһ߸²[t0,t1]
+		clip()ֱ֧Ӧ룬ų߶rejectλ
+*/
+static void ClipPacket(SrSimdReal p,SrSimdReal q,SrSimdReal& t0,SrSimdReal& t1,SrSimdReal& reject)
+{
+	const SrSimdReal zero = SrSimd::splat(0);
+	SrSimdReal r , entering , leaving , outside , rejectEntering , rejectLeaving;
+	r		 = SrSimd::div(q,p);
+	entering = SrSimd::andMask(SrSimd::less(p,zero),SrSimd::less(q,zero));
+	leaving	 = SrSimd::andNot(entering,SrSimd::andMask(SrSimd::greater(p,zero),SrSimd::less(q,p)));
+	outside	 = SrSimd::andNot(SrSimd::orMask(entering,leaving),SrSimd::less(q,zero));
+
+	rejectEntering = SrSimd::andMask(entering,SrSimd::greater(r,t1));
+	t0 = SrSimd::select(SrSimd::andNot(rejectEntering,SrSimd::andMask(entering,SrSimd::greater(r,t0))),r,t0);
+	rejectLeaving  = SrSimd::andMask(leaving,SrSimd::less(r,t0));
+	t1 = SrSimd::select(SrSimd::andNot(rejectLeaving,SrSimd::andMask(leaving,SrSimd::less(r,t1))),r,t1);
+	reject = SrSimd::orMask(reject,SrSimd::orMask(outside,SrSimd::orMask(rejectEntering,rejectLeaving)));
+}
+
+int Segment2DClipRectangle_LiangBarskyPacket(const SrSegment2DSoA& segment,int first,const SrVector2D& minRect,const SrVector2D& maxRect,
+											 SrReal result[4][SR_SEGMENT2D_PACKET_WIDTH])
+{
+	ASSERT(first>=0 && first%PACKET_WIDTH==0 && first<segment.mNumSegment);
+	const SrSimdReal minX = SrSimd::splat(minRect.x) , minY = SrSimd::splat(minRect.y);
+	const SrSimdReal maxX = SrSimd::splat(maxRect.x) , maxY = SrSimd::splat(maxRect.y);
+	SrSimdReal x1 , y1 , x2 , y2 , deltaX , deltaY , t0 , t1 , reject;
+	int r , index , mask = 0;
+	for( r=0 ; r<NUM_REGISTER ; r++ )
+	{
+		index = first + r*SR_SIMD_WIDTH;
+		x1 = SrSimd::load(segment.mPoint1[0] + index);
+		y1 = SrSimd::load(segment.mPoint1[1] + index);
+		x2 = SrSimd::load(segment.mPoint2[0] + index);
+		y2 = SrSimd::load(segment.mPoint2[1] + index);
+		//˵ھεͬһߵ
+		reject = SrSimd::andMask(SrSimd::less(x1,minX),SrSimd::less(x2,minX));
+		reject = SrSimd::orMask(reject,SrSimd::andMask(SrSimd::greater(x1,maxX),SrSimd::greater(x2,maxX)));
+		reject = SrSimd::orMask(reject,SrSimd::andMask(SrSimd::less(y1,minY),SrSimd::less(y2,minY)));
+		reject = SrSimd::orMask(reject,SrSimd::andMask(SrSimd::greater(y1,maxY),SrSimd::greater(y2,maxY)));
+		if( SrSimd::moveMask(reject)==SR_SIMD_FULL_MASK )
+			continue;
+
+		t0 = SrSimd::splat(0);
+		t1 = SrSimd::splat(1);
+		deltaX = SrSimd::sub(x2,x1);
+		deltaY = SrSimd::sub(y2,y1);
+		ClipPacket(SrSimd::neg(deltaX),SrSimd::sub(x1,minX),t0,t1,reject);
+		ClipPacket(deltaX,SrSimd::sub(maxX,x1),t0,t1,reject);
+		ClipPacket(SrSimd::neg(deltaY),SrSimd::sub(y1,minY),t0,t1,reject);
+		ClipPacket(deltaY,SrSimd::sub(maxY,y1),t0,t1,reject);
+
+		SrSimd::store(result[0] + r*SR_SIMD_WIDTH,SrSimd::add(x1,SrSimd::mul(t0,deltaX)));
+		SrSimd::store(result[1] + r*SR_SIMD_WIDTH,SrSimd::add(y1,SrSimd::mul(t0,deltaY)));
+		SrSimd::store(result[2] + r*SR_SIMD_WIDTH,SrSimd::add(x1,SrSimd::mul(t1,deltaX)));
+		SrSimd::store(result[3] + r*SR_SIMD_WIDTH,SrSimd::add(y1,SrSimd::mul(t1,deltaY)));
+		mask |= (~SrSimd::moveMask(reject) & SR_SIMD_FULL_MASK) << (r*SR_SIMD_WIDTH);
+	}
+	if( segment.mNumSegment - first<PACKET_WIDTH )
+		mask &= (1<<(segment.mNumSegment - first)) - 1;
+	return mask;
+}
+
+int Segment2DClipRectangle_LiangBarskyBatch(const SrSegment2DSoA& segment,const SrVector2D& minRect,const SrVector2D& maxRect,
+											SrSegment2DSoA& result,int* resultIndex)
+{
+	ASSERT(&result!=&segment && result.mNumSegment>=segment.mNumSegment);
+	int numPacket = (segment.mNumSegment + PACKET_WIDTH - 1) / PACKET_WIDTH;
+	std::vector<unsigned char> numKept(numPacket);
+	int p;
+#pragma omp parallel for schedule(static)
+	for( p=0 ; p<numPacket ; p++ )
+	{
+		SrReal clipped[4][PACKET_WIDTH];
+		int first = p*PACKET_WIDTH , lane , bits , k = 0;
+		bits = Segment2DClipRectangle_LiangBarskyPacket(segment,first,minRect,maxRect,clipped);
+		//ѹݰԼλãfirst + kԭλ
+		for( lane=0 ; bits ; lane++ , bits>>=1 )
+		{
+			if( !(bits & 1) )
+				continue;
+			result.mPoint1[0][first + k] = clipped[0][lane];
+			result.mPoint1[1][first + k] = clipped[1][lane];
+			result.mPoint2[0][first + k] = clipped[2][lane];
+			result.mPoint2[1][first + k] = clipped[3][lane];
+			resultIndex[first + k]		 = first + lane;
+			k ++;
+		}
+		numKept[p] = (unsigned char)k;
+	}
+
+	//ݰĽǰƣĿλòԴλ
+	int count = 0 , first , k , c;
+	for( p=0 ; p<numPacket ; p++ )
+	{
+		first = p*PACKET_WIDTH;
+		if( count!=first )
+		{
+			for( k=0 ; k<numKept[p] ; k++ )
+			{
+				for( c=0 ; c<2 ; c++ )
+				{
+					result.mPoint1[c][count + k] = result.mPoint1[c][first + k];
+					result.mPoint2[c][count + k] = result.mPoint2[c][first + k];
+				}
+				resultIndex[count + k] = resultIndex[first + k];
+			}
+		}
+		count += numKept[p];
+	}
+	return count;
+}
+
+/*
+	һβüõ߶
+*/
+typedef struct
+{
+	std::vector<SrReal>	mCoord[4];
+	std::vector<int>	mIndex;
+}tSegmentBin;
+
+int Segment2DClipRectangle_LiangBarskyBin(const SrSegment2DSoA& segment,const SrVector2D* minRect,const SrVector2D* maxRect,int numRect,
+										  SrSegment2DSoA& result,std::vector<int>& resultIndex,std::vector<int>& binStart)
+{
+	ASSERT(&result!=&segment && numRect>=0);
+	int numPacket = (segment.mNumSegment + PACKET_WIDTH - 1) / PACKET_WIDTH;
+	int p , i , c , first , last;
+
+	//ݰЧ߶εAABB
+	std::vector<SrReal> packetBox(4*numPacket);
+	for( p=0 ; p<numPacket ; p++ )
+	{
+		SrReal* box = &packetBox[4*p];
+		first = p*PACKET_WIDTH;
+		last  = first + PACKET_WIDTH<segment.mNumSegment ? first + PACKET_WIDTH : segment.mNumSegment;
+		box[0] = box[2] = segment.mPoint1[0][first];
+		box[1] = box[3] = segment.mPoint1[1][first];
+		for( i=first ; i<last ; i++ )
+		{
+			for( c=0 ; c<2 ; c++ )
+			{
+				if( segment.mPoint1[c][i]<box[c] )		box[c] = segment.mPoint1[c][i];
+				if( segment.mPoint2[c][i]<box[c] )		box[c] = segment.mPoint2[c][i];
+				if( segment.mPoint1[c][i]>box[2 + c] )	box[2 + c] = segment.mPoint1[c][i];
+				if( segment.mPoint2[c][i]>box[2 + c] )	box[2 + c] = segment.mPoint2[c][i];
+			}
+		}
+	}
+
+	std::vector<tSegmentBin> bin(numRect);
+	int r;
+#pragma omp parallel for schedule(dynamic,1)
+	for( r=0 ; r<numRect ; r++ )
+	{
+		SrReal clipped[4][PACKET_WIDTH];
+		int q , lane , bits , k;
+		for( q=0 ; q<numPacket ; q++ )
+		{
+			//ݰAABBھεһߵʱ߶ζᱻ˵Ĳų
+			const SrReal* box = &packetBox[4*q];
+			if( LESS(box[2],minRect[r].x) || GREATER(box[0],maxRect[r].x) ||
+				LESS(box[3],minRect[r].y) || GREATER(box[1],maxRect[r].y) )
+				continue;
+			bits = Segment2DClipRectangle_LiangBarskyPacket(segment,q*PACKET_WIDTH,minRect[r],maxRect[r],clipped);
+			for( lane=0 ; bits ; lane++ , bits>>=1 )
+			{
+				if( !(bits & 1) )
+					continue;
+				for( k=0 ; k<4 ; k++ )
+					bin[r].mCoord[k].push_back(clipped[k][lane]);
+				bin[r].mIndex.push_back(q*PACKET_WIDTH + lane);
+			}
+		}
+	}
+
+	binStart.resize(numRect + 1);
+	binStart[0] = 0;
+	for( r=0 ; r<numRect ; r++ )
+		binStart[r + 1] = binStart[r] + (int)bin[r].mIndex.size();
+	result.allocate(binStart[numRect]);
+	resultIndex.resize(binStart[numRect]);
+	for( r=0 ; r<numRect ; r++ )
+	{
+		for( i=0 ; i<(int)bin[r].mIndex.size() ; i++ )
+		{
+			first = binStart[r] + i;
+			result.mPoint1[0][first] = bin[r].mCoord[0][i];
+			result.mPoint1[1][first] = bin[r].mCoord[1][i];
+			result.mPoint2[0][first] = bin[r].mCoord[2][i];
+			result.mPoint2[1][first] = bin[r].mCoord[3][i];
+			resultIndex[first]		 = bin[r].mIndex[i];
+		}
+	}
+	return binStart[numRect];
+}
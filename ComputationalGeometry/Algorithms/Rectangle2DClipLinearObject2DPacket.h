@@ -0,0 +1,81 @@
+/************************************************************************
+\link	www.twinklingstar.cn
+\author Twinkling Star
+\date	2026/10/19
+****************************************************************************/
+#ifndef SR_ALGORITHMS_RECTANGLE2D_CLIP_LINEAR_OBJECT2D_PACKET_H_
+#define SR_ALGORITHMS_RECTANGLE2D_CLIP_LINEAR_OBJECT2D_PACKET_H_
+
+/** \addtogroup algorithms
+  @{
+*/
+#include "Rectangle2DClipLinearObject2D.h"
+#include <vector>
+
+/*
+	һݰа߶εĸռ4SSE2Ĵ
+*/
+#define SR_SEGMENT2D_PACKET_WIDTH		8
+
+/**
+\brief 2D segments stored as a structure of arrays (SoA).
+
+mPoint1[c][i] and mPoint2[c][i] are the c-th coordinates of the two endpoints
+of the i-th segment. The arrays are padded with zeros to a multiple of
+SR_SEGMENT2D_PACKET_WIDTH, so a packet can always be loaded as a whole.
+*/
+class SrSegment2DSoA
+{
+public:
+	SrSegment2DSoA();
+	SrSegment2DSoA(int numSegment);
+	~SrSegment2DSoA();
+	/**
+	\brief Allocate the arrays for numSegment segments, the old data is released.
+	*/
+	void				allocate(int numSegment);
+	void				setSegment(int i,const SrPoint2D& p1,const SrPoint2D& p2);
+	void				getSegment(int i,SrPoint2D& p1,SrPoint2D& p2) const;
+
+public:
+	SrReal*		mPoint1[2];
+	SrReal*		mPoint2[2];
+	int			mNumSegment;
+
+private:
+	SrSegment2DSoA(const SrSegment2DSoA&);
+	SrSegment2DSoA& operator=(const SrSegment2DSoA&);
+
+	SrReal*		mBuffer;
+};
+
+/*
+\brief	Liang-Barsky㷨ݰ汾þβüsegment[first],...,segment[first + SR_SEGMENT2D_PACKET_WIDTH - 1]
+		ߵĲüSSE2Ĵѡûз֧ÿ߶εĽSegment2DClipRectangle_LiangBarskyȫͬ
+\param[out]	result	i߶βüĶ˵(result[0][i],result[1][i])(result[2][i],result[3][i])ֻԱ߶
+\return	λ룬iλΪ1ʾsegment[first + i]ཻ
+*/
+int Segment2DClipRectangle_LiangBarskyPacket(const SrSegment2DSoA& segment,int first,const SrVector2D& minRect,const SrVector2D& maxRect,
+											 SrReal result[4][SR_SEGMENT2D_PACKET_WIDTH]);
+/*
+\brief	̵߳ݰü߶Σཻ߶βüԭ˳յر档
+\param[out]	result		ü߶ΣҪsegment.mNumSegment߶εĿռ䣬segmentͬ
+\param[out]	resultIndex	resultÿ߶segmentеҪsegment.mNumSegmentԪ
+\return	ཻ߶εĸ
+*/
+int Segment2DClipRectangle_LiangBarskyBatch(const SrSegment2DSoA& segment,const SrVector2D& minRect,const SrVector2D& maxRect,
+											SrSegment2DSoA& result,int* resultIndex);
+/*
+\brief	öηֱüͬһ߶Σڰ߶ηֵĻĸֿСÿηֵһ̣߳
+		ÿݰAABBųݰݰAABBֻڿʼʱһΡ
+\param[in]	minRect,maxRect	numRectεĶԽǶ
+\param[out]	result			оβüĽrεĽresult[binStart[r], binStart[r + 1])߶
+\param[out]	resultIndex		resultÿ߶segmentе
+\param[out]	binStart		numRect + 1Ԫ
+\return	оβüõ߶ε
+*/
+int Segment2DClipRectangle_LiangBarskyBin(const SrSegment2DSoA& segment,const SrVector2D* minRect,const SrVector2D* maxRect,int numRect,
+										  SrSegment2DSoA& result,std::vector<int>& resultIndex,std::vector<int>& binStart);
+
+/** @} */
+#endif
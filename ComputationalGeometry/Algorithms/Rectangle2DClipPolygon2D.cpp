@@ -0,0 +1,604 @@
+/************************************************************************
+\link	www.twinklingstar.cn
+\author Twinkling Star
+\date	2026/10/19
+****************************************************************************/
+/************************************************************************
+\description	͹ʽزüκߣSutherland-Hodgman㷨Ѵڵ
+				ÿΪˮߵһͨWeiler-Atherton㷨ȼ¼
+				ڴڵĸΣشڱ߽ӳɻֿüȰ
+				εı߷ֵУÿһеĶٷֵһеĸֿС
+****************************************************************************/
+#include "Rectangle2DClipPolygon2D.h"
+#include <math.h>
+#include <string.h>
+#include <algorithm>
+
+SrClipWindow2D::SrClipWindow2D()
+{
+	mNumEdge = 0;
+}
+
+SrClipWindow2D::SrClipWindow2D(const SrVector2D& minRect,const SrVector2D& maxRect)
+{
+	SrPoint2D vertex[4];
+	vertex[0].set(minRect.x,minRect.y);
+	vertex[1].set(maxRect.x,minRect.y);
+	vertex[2].set(maxRect.x,maxRect.y);
+	vertex[3].set(minRect.x,maxRect.y);
+	set(vertex,4);
+}
+
+SrClipWindow2D::SrClipWindow2D(const SrPoint2D& center,const SrPoint2D* axis,const SrReal* halfLength)
+{
+	SrVector2D u = axis[0]*halfLength[0] , v = axis[1]*halfLength[1];
+	SrPoint2D vertex[4];
+	vertex[0] = center - u - v;
+	vertex[1] = center + u - v;
+	vertex[2] = center + u + v;
+	vertex[3] = center - u + v;
+	set(vertex,4);
+}
+
+SrClipWindow2D::SrClipWindow2D(const SrPoint2D* vertex,int numVertex)
+{
+	set(vertex,numVertex);
+}
+
+void SrClipWindow2D::set(const SrPoint2D* vertex,int numVertex)
+{
+	ASSERT(numVertex>=3 && numVertex<=SR_CLIP_MAX_EDGE);
+	SrReal area = 0;
+	int i;
+	for( i=1 ; i<numVertex - 1 ; i++ )
+		area += (vertex[i] - vertex[0]).cross(vertex[i + 1] - vertex[0]);
+	//˳ʱĶ㷴
+	for( i=0 ; i<numVertex ; i++ )
+		mVertex[i] = area>=0 ? vertex[i] : vertex[numVertex - 1 - i];
+	mNumEdge = numVertex;
+	SrVector2D edge;
+	for( i=0 ; i<mNumEdge ; i++ )
+	{
+		edge = mVertex[(i + 1)%mNumEdge] - mVertex[i];
+		mNormal[i].set(edge.y,-edge.x);
+		mNormal[i].normalize();
+		mD[i] = mNormal[i].dot(mVertex[i]);
+	}
+}
+
+SrReal SrClipWindow2D::boundaryParameter(const SrPoint2D& p) const
+{
+	//ڵıı
+	int i , edge = 0;
+	SrReal dist , maxDist = distance(0,p);
+	for( i=1 ; i<mNumEdge ; i++ )
+	{
+		dist = distance(i,p);
+		if( dist>maxDist )
+		{
+			maxDist = dist;
+			edge = i;
+		}
+	}
+	SrVector2D e = mVertex[(edge + 1)%mNumEdge] - mVertex[edge];
+	SrReal u = (p - mVertex[edge]).dot(e) / e.magnitudeSquared();
+	if( u<0 )	u = 0;
+	if( u>1 )	u = 1;
+	return edge + u;
+}
+
+SrPolygonClipper2D::SrPolygonClipper2D()
+{
+	mMode = SR_CLIP_SUTHERLAND_HODGMAN;
+	begin(SR_CLIP_SUTHERLAND_HODGMAN);
+}
+
+SrPolygonClipper2D::SrPolygonClipper2D(const SrClipWindow2D& window)
+{
+	setWindow(window);
+	begin(SR_CLIP_SUTHERLAND_HODGMAN);
+}
+
+void SrPolygonClipper2D::setWindow(const SrClipWindow2D& window)
+{
+	mWindow = window;
+	int i;
+	mInteriorPoint.set(0,0);
+	for( i=0 ; i<mWindow.mNumEdge ; i++ )
+		mInteriorPoint += mWindow.mVertex[i];
+	if( mWindow.mNumEdge>0 )
+		mInteriorPoint /= (SrReal)mWindow.mNumEdge;
+}
+
+void SrPolygonClipper2D::begin(int mode)
+{
+	mMode				= mode;
+	mNumInput			= 0;
+	mIsChainOpen		= false;
+	mIsFirstChainAtStart= false;
+	mArea				= 0;
+	mNumCrossing		= 0;
+	mOutput.clear();
+	mChainVertex.clear();
+	mChain.clear();
+	int i;
+	for( i=0 ; i<SR_CLIP_MAX_EDGE ; i++ )
+		mStage[i].mHasFirst = false;
+}
+
+/*
+\brief	Sutherland-HodgmanˮߣstageڵstageڲĲ֣͵һ
+*/
+void SrPolygonClipper2D::pushStage(int stage,const SrPoint2D& p)
+{
+	if( stage==mWindow.mNumEdge )
+	{
+		if( mOutput.empty() || mOutput.back()!=p )
+			mOutput.push_back(p);
+		return;
+	}
+	tStage& current = mStage[stage];
+	SrReal dist = mWindow.distance(stage,p);
+	if( !current.mHasFirst )
+	{
+		current.mFirst		= p;
+		current.mFirstDist	= dist;
+		current.mHasFirst	= true;
+	}
+	else if( (current.mPrevDist<=0)!=(dist<=0) )
+	{
+		SrReal t = current.mPrevDist / (current.mPrevDist - dist);
+		pushStage(stage + 1,current.mPrev + (p - current.mPrev)*t);
+	}
+	if( dist<=0 )
+		pushStage(stage + 1,p);
+	current.mPrev	  = p;
+	current.mPrevDist = dist;
+}
+
+/*
+\brief	Cyrus-Beck㷨pqڴڵĲ֣ӵǰĶϣ߿ʼµһΡ
+*/
+void SrPolygonClipper2D::clipEdge(const SrPoint2D& p,const SrPoint2D& q,const SrReal* distP,const SrReal* distQ)
+{
+	SrReal tEnter = 0 , tExit = 1 , t;
+	int i;
+	for( i=0 ; i<mWindow.mNumEdge ; i++ )
+	{
+		if( distP[i]>0 && distQ[i]>0 )
+			break;
+		if( distP[i]>0 )
+		{
+			t = distP[i] / (distP[i] - distQ[i]);
+			if( t>tEnter )	tEnter = t;
+		}
+		else if( distQ[i]>0 )
+		{
+			t = distP[i] / (distP[i] - distQ[i]);
+			if( t<tExit )	tExit = t;
+		}
+	}
+	//ֻ봰ڽӴһı߲µһ
+	if( i<mWindow.mNumEdge || tEnter>=tExit )
+	{
+		if( mIsChainOpen )
+			closeChain();
+		return;
+	}
+	SrPoint2D a = tEnter==0 ? p : p + (q - p)*tEnter;
+	SrPoint2D b = tExit==1 ? q : p + (q - p)*tExit;
+	if( !mIsChainOpen )
+	{
+		tChain chain;
+		chain.mFirst = (int)mChainVertex.size();
+		chain.mCount = 1;
+		chain.mEntry = mWindow.boundaryParameter(a);
+		chain.mExit	 = chain.mEntry;
+		//һߴ㿪ʼĶοһεend()ж
+		if( mChain.empty() && mNumInput==1 && tEnter==0 )
+			mIsFirstChainAtStart = true;
+		mChain.push_back(chain);
+		mChainVertex.push_back(a);
+		mIsChainOpen = true;
+	}
+	mChainVertex.push_back(b);
+	mChain.back().mCount ++;
+	if( tExit<1 )
+		closeChain();
+}
+
+void SrPolygonClipper2D::closeChain()
+{
+	mChain.back().mExit = mWindow.boundaryParameter(mChainVertex.back());
+	mIsChainOpen = false;
+}
+
+void SrPolygonClipper2D::addVertex(const SrPoint2D* vertex,int numVertex)
+{
+	ASSERT(mWindow.mNumEdge>0);
+	SrReal dist[SR_CLIP_MAX_EDGE];
+	int i , k;
+	for( i=0 ; i<numVertex ; i++ )
+	{
+		const SrPoint2D& v = vertex[i];
+		if( mMode==SR_CLIP_SUTHERLAND_HODGMAN )
+		{
+			pushStage(0,v);
+			mNumInput ++;
+			continue;
+		}
+		for( k=0 ; k<mWindow.mNumEdge ; k++ )
+			dist[k] = mWindow.distance(k,v);
+		if( mNumInput==0 )
+		{
+			mFirstInput = v;
+			memcpy(mFirstDist,dist,sizeof(SrReal)*mWindow.mNumEdge);
+		}
+		else
+		{
+			mArea += (mPrevInput - mFirstInput).cross(v - mFirstInput);
+			if( (mPrevInput.y>mInteriorPoint.y)!=(v.y>mInteriorPoint.y) &&
+				mInteriorPoint.x<mPrevInput.x + (mInteriorPoint.y - mPrevInput.y)*(v.x - mPrevInput.x)/(v.y - mPrevInput.y) )
+				mNumCrossing ++;
+			clipEdge(mPrevInput,v,mPrevDist,dist);
+		}
+		mPrevInput = v;
+		memcpy(mPrevDist,dist,sizeof(SrReal)*mWindow.mNumEdge);
+		mNumInput ++;
+	}
+}
+
+/*
+\brief	Weiler-Atherton㷨ӣһ뿪֮شڱ߽簴εķߵһεڣ
+		ĴڶӵУֱصʼһΡ
+*/
+int SrPolygonClipper2D::linkChains(std::vector<SrPoint2D>& vertex,std::vector<int>& ringStart)
+{
+	const int numEdge = mWindow.mNumEdge;
+	const bool isCCW = mArea>0;
+	std::vector< std::pair<SrReal,int> > entry;
+	int i , j , k , c , numRing = 0;
+	for( i=0 ; i<(int)mChain.size() ; i++ )
+	{
+		if( mChain[i].mCount>0 )
+			entry.push_back(std::make_pair(mChain[i].mEntry,i));
+	}
+	std::sort(entry.begin(),entry.end());
+
+	std::vector<int> next(mChain.size(),-1);
+	std::vector<bool> isUsed(mChain.size(),false);
+	for( i=0 ; i<(int)entry.size() ; i++ )
+	{
+		j = entry[i].second;
+		std::pair<SrReal,int> key(mChain[j].mExit,-1);
+		if( isCCW )
+		{
+			//ʱ뷽һСڳڵ
+			k = (int)(std::lower_bound(entry.begin(),entry.end(),key) - entry.begin());
+			next[j] = entry[k<(int)entry.size() ? k : 0].second;
+		}
+		else
+		{
+			//˳ʱ뷽һڳڵ
+			key.second = (int)mChain.size();
+			k = (int)(std::upper_bound(entry.begin(),entry.end(),key) - entry.begin()) - 1;
+			next[j] = entry[k>=0 ? k : (int)entry.size() - 1].second;
+		}
+	}
+
+	SrReal ahead , cornerAhead;
+	for( i=0 ; i<(int)entry.size() ; i++ )
+	{
+		int start = entry[i].second , chain = start , first = (int)vertex.size();
+		if( isUsed[start] )
+			continue;
+		do
+		{
+			isUsed[chain] = true;
+			for( k=0 ; k<mChain[chain].mCount ; k++ )
+			{
+				const SrPoint2D& p = mChainVertex[mChain[chain].mFirst + k];
+				if( (int)vertex.size()==first || vertex.back()!=p )
+					vertex.push_back(p);
+			}
+			j = next[chain];
+			//һ֮Ĵڶ
+			SrReal exitParam = mChain[chain].mExit , entryParam = mChain[j].mEntry;
+			ahead = isCCW ? fmod(entryParam - exitParam + numEdge,(SrReal)numEdge) : fmod(exitParam - entryParam + numEdge,(SrReal)numEdge);
+			c = isCCW ? (int)floor(exitParam) + 1 : (int)ceil(exitParam) - 1;
+			for( k=0 ; k<numEdge ; k++ , c+=isCCW ? 1 : -1 )
+			{
+				c = (c + numEdge)%numEdge;
+				cornerAhead = isCCW ? fmod(c - exitParam + numEdge,(SrReal)numEdge) : fmod(exitParam - c + numEdge,(SrReal)numEdge);
+				if( cornerAhead<=0 || cornerAhead>=ahead )
+					break;
+				vertex.push_back(mWindow.mVertex[c]);
+			}
+			chain = j;
+		}while( chain!=start && !isUsed[chain] );
+
+		if( (int)vertex.size() - first>1 && vertex.back()==vertex[first] )
+			vertex.pop_back();
+		if( (int)vertex.size() - first<3 )
+		{
+			vertex.resize(first);
+			continue;
+		}
+		ringStart.push_back((int)vertex.size());
+		numRing ++;
+	}
+	return numRing;
+}
+
+int SrPolygonClipper2D::end(std::vector<SrPoint2D>& vertex,std::vector<int>& ringStart)
+{
+	int i , numRing = 0;
+	if( ringStart.empty() )
+		ringStart.push_back((int)vertex.size());
+
+	if( mMode==SR_CLIP_SUTHERLAND_HODGMAN )
+	{
+		//αպˮߵĸǰһպʱĵһ
+		for( i=0 ; i<mWindow.mNumEdge ; i++ )
+		{
+			tStage& current = mStage[i];
+			if( current.mHasFirst && (current.mPrevDist<=0)!=(current.mFirstDist<=0) )
+			{
+				SrReal t = current.mPrevDist / (current.mPrevDist - current.mFirstDist);
+				pushStage(i + 1,current.mPrev + (current.mFirst - current.mPrev)*t);
+			}
+		}
+		if( mOutput.size()>1 && mOutput.back()==mOutput.front() )
+			mOutput.pop_back();
+		if( mOutput.size()>=3 )
+		{
+			vertex.insert(vertex.end(),mOutput.begin(),mOutput.end());
+			ringStart.push_back((int)vertex.size());
+			numRing = 1;
+		}
+		begin(mMode);
+		return numRing;
+	}
+
+	if( mMode==SR_CLIP_POLYLINE )
+	{
+		for( i=0 ; i<(int)mChain.size() ; i++ )
+		{
+			vertex.insert(vertex.end(),mChainVertex.begin() + mChain[i].mFirst,mChainVertex.begin() + mChain[i].mFirst + mChain[i].mCount);
+			ringStart.push_back((int)vertex.size());
+		}
+		numRing = (int)mChain.size();
+		begin(mMode);
+		return numRing;
+	}
+
+	//պ϶εһ
+	if( mNumInput>=3 )
+	{
+		if( (mPrevInput.y>mInteriorPoint.y)!=(mFirstInput.y>mInteriorPoint.y) &&
+			mInteriorPoint.x<mPrevInput.x + (mInteriorPoint.y - mPrevInput.y)*(mFirstInput.x - mPrevInput.x)/(mFirstInput.y - mPrevInput.y) )
+			mNumCrossing ++;
+		clipEdge(mPrevInput,mFirstInput,mPrevDist,mFirstDist);
+	}
+	if( mIsChainOpen )
+	{
+		if( mChain.size()==1 && mIsFirstChainAtStart )
+		{
+			//ȫڴڣһ
+			vertex.insert(vertex.end(),mChainVertex.begin(),mChainVertex.end() - 1);
+			ringStart.push_back((int)vertex.size());
+			begin(mMode);
+			return 1;
+		}
+		if( mIsFirstChainAtStart )
+		{
+			//һξϵһ
+			tChain& last = mChain.back();
+			for( i=1 ; i<mChain[0].mCount ; i++ )
+				mChainVertex.push_back(mChainVertex[mChain[0].mFirst + i]);
+			last.mCount += mChain[0].mCount - 1;
+			last.mExit	 = mChain[0].mExit;
+			mChain[0].mCount = 0;
+			mIsChainOpen = false;
+		}
+		else
+			closeChain();
+	}
+
+	if( mChain.empty() )
+	{
+		//εı߶ڴڣҪôڶڣҪôη
+		if( mNumInput>=3 && mNumCrossing%2==1 )
+		{
+			for( i=0 ; i<mWindow.mNumEdge ; i++ )
+				vertex.push_back(mWindow.mVertex[mArea>0 ? i : mWindow.mNumEdge - 1 - i]);
+			ringStart.push_back((int)vertex.size());
+			numRing = 1;
+		}
+	}
+	else
+		numRing = linkChains(vertex,ringStart);
+	begin(mMode);
+	return numRing;
+}
+
+/*
+\brief	߶pqƽlo<=p[axis]<=hiеĲ֣üõĶ˵axisϵ꾫ȷصlohi
+*/
+static bool ClipToSlab(const SrPoint2D& p,const SrPoint2D& q,int axis,SrReal lo,SrReal hi,SrPoint2D& a,SrPoint2D& b)
+{
+	SrReal d = q[axis] - p[axis];
+	if( d==0 )
+	{
+		if( p[axis]<lo || p[axis]>hi )
+			return false;
+		a = p;
+		b = q;
+		return true;
+	}
+	SrReal tLo = (lo - p[axis]) / d , tHi = (hi - p[axis]) / d;
+	SrReal t0 = d>0 ? tLo : tHi , t1 = d>0 ? tHi : tLo;
+	if( t0<0 )	t0 = 0;
+	if( t1>1 )	t1 = 1;
+	if( t0>t1 )
+		return false;
+	a = p;
+	b = q;
+	if( t0>0 )
+	{
+		a = p + (q - p)*t0;
+		a[axis] = d>0 ? lo : hi;
+	}
+	if( t1<1 )
+	{
+		b = p + (q - p)*t1;
+		b[axis] = d>0 ? hi : lo;
+	}
+	return true;
+}
+
+/*
+\brief	[a,b]ཻƽķΧλƽ߽ϵĶ˵ƽ塣
+*/
+static void SlabRange(SrReal a,SrReal b,SrReal origin,SrReal size,int numSlab,int& first,int& last)
+{
+	SrReal lo = a<b ? a : b , hi = a<b ? b : a;
+	first = (int)floor((lo - origin)/size) - 1;
+	last  = (int)floor((hi - origin)/size);
+	if( first<0 )			first = 0;
+	if( last>numSlab - 1 )	last = numSlab - 1;
+}
+
+SrTileClipper2D::SrTileClipper2D()
+{
+	mNumTile[0] = mNumTile[1] = 0;
+	mNumInput = 0;
+}
+
+SrTileClipper2D::SrTileClipper2D(const SrPoint2D& origin,const SrVector2D& tileSize,int numTileX,int numTileY)
+{
+	setGrid(origin,tileSize,numTileX,numTileY);
+}
+
+void SrTileClipper2D::setGrid(const SrPoint2D& origin,const SrVector2D& tileSize,int numTileX,int numTileY)
+{
+	ASSERT(tileSize.x>0 && tileSize.y>0 && numTileX>0 && numTileY>0);
+	mOrigin		= origin;
+	mTileSize	= tileSize;
+	mNumTile[0] = numTileX;
+	mNumTile[1] = numTileY;
+	mColumn.resize(numTileX);
+	mTile.resize(numTileX*numTileY);
+	begin();
+}
+
+void SrTileClipper2D::begin()
+{
+	int i;
+	mNumInput = 0;
+	for( i=0 ; i<(int)mColumn.size() ; i++ )
+		mColumn[i].mHasFirst = false;
+	for( i=0 ; i<(int)mTile.size() ; i++ )
+		mTile[i].clear();
+}
+
+void SrTileClipper2D::pushTile(int tile,const SrPoint2D& p)
+{
+	std::vector<SrPoint2D>& ring = mTile[tile];
+	if( ring.empty() || ring.back()!=p )
+		ring.push_back(p);
+}
+
+void SrTileClipper2D::splitColumnEdge(int column,const SrPoint2D& p,const SrPoint2D& q)
+{
+	SrPoint2D a , b;
+	int row , first , last;
+	SlabRange(p.y,q.y,mOrigin.y,mTileSize.y,mNumTile[1],first,last);
+	for( row=first ; row<=last ; row++ )
+	{
+		if( !ClipToSlab(p,q,1,mOrigin.y + row*mTileSize.y,mOrigin.y + (row + 1)*mTileSize.y,a,b) )
+			continue;
+		pushTile(row*mNumTile[0] + column,a);
+		pushTile(row*mNumTile[0] + column,b);
+	}
+}
+
+void SrTileClipper2D::pushColumn(int column,const SrPoint2D& p)
+{
+	tColumn& current = mColumn[column];
+	if( !current.mHasFirst )
+	{
+		current.mFirst	  = p;
+		current.mPrev	  = p;
+		current.mHasFirst = true;
+		return;
+	}
+	if( current.mPrev==p )
+		return;
+	splitColumnEdge(column,current.mPrev,p);
+	current.mPrev = p;
+}
+
+void SrTileClipper2D::splitEdge(const SrPoint2D& p,const SrPoint2D& q)
+{
+	SrPoint2D a , b;
+	int column , first , last;
+	SlabRange(p.x,q.x,mOrigin.x,mTileSize.x,mNumTile[0],first,last);
+	for( column=first ; column<=last ; column++ )
+	{
+		if( !ClipToSlab(p,q,0,mOrigin.x + column*mTileSize.x,mOrigin.x + (column + 1)*mTileSize.x,a,b) )
+			continue;
+		pushColumn(column,a);
+		pushColumn(column,b);
+	}
+}
+
+void SrTileClipper2D::addVertex(const SrPoint2D* vertex,int numVertex)
+{
+	int i;
+	for( i=0 ; i<numVertex ; i++ )
+	{
+		if( mNumInput==0 )
+			mFirstInput = vertex[i];
+		else
+			splitEdge(mPrevInput,vertex[i]);
+		mPrevInput = vertex[i];
+		mNumInput ++;
+	}
+}
+
+int SrTileClipper2D::end(std::vector<SrPoint2D>& vertex,std::vector<int>& ringStart,std::vector<int>& ringTile)
+{
+	int i , k , numRing = 0;
+	if( ringStart.empty() )
+		ringStart.push_back((int)vertex.size());
+	if( mNumInput>=3 )
+	{
+		splitEdge(mPrevInput,mFirstInput);
+		for( i=0 ; i<mNumTile[0] ; i++ )
+		{
+			if( mColumn[i].mHasFirst && mColumn[i].mPrev!=mColumn[i].mFirst )
+				splitColumnEdge(i,mColumn[i].mPrev,mColumn[i].mFirst);
+		}
+		for( i=0 ; i<(int)mTile.size() ; i++ )
+		{
+			std::vector<SrPoint2D>& ring = mTile[i];
+			if( ring.size()>1 && ring.back()==ring.front() )
+				ring.pop_back();
+			if( ring.size()<3 )
+				continue;
+			//ֻʣطֿ߽ص˻ʱΪ0
+			SrReal area = 0;
+			for( k=1 ; k<(int)ring.size() - 1 ; k++ )
+				area += (ring[k] - ring[0]).cross(ring[k + 1] - ring[0]);
+			if( area==0 )
+				continue;
+			vertex.insert(vertex.end(),ring.begin(),ring.end());
+			ringStart.push_back((int)vertex.size());
+			ringTile.push_back(i);
+			numRing ++;
+		}
+	}
+	begin();
+	return numRing;
+}
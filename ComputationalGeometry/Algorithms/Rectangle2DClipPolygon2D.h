@@ -0,0 +1,198 @@
+/************************************************************************
+\link	www.twinklingstar.cn
+\author Twinkling Star
+\date	2026/10/19
+****************************************************************************/
+#ifndef SR_ALGORITHMS_RECTANGLE2D_CLIP_POLYGON2D_H_
+#define SR_ALGORITHMS_RECTANGLE2D_CLIP_POLYGON2D_H_
+
+/** \addtogroup algorithms
+  @{
+*/
+#include "SrGeometricTools.h"
+#include "SrDataType.h"
+#include <vector>
+
+/*
+	üڵ
+*/
+#define SR_CLIP_MAX_EDGE				32
+
+/*
+	ʽüķʽ
+*/
+#define SR_CLIP_SUTHERLAND_HODGMAN		0
+#define SR_CLIP_WEILER_ATHERTON			1
+#define SR_CLIP_POLYLINE				2
+
+/**
+\brief A convex clipping window.
+
+The window is a convex polygon whose vertices mVertex are in counterclockwise
+order. The i-th edge goes from mVertex[i] to mVertex[i+1], its outward normal
+is mNormal[i], and the signed distance of a point p to it is
+mNormal[i].dot(p) - mD[i], which is positive outside of the window. An
+SrRectangle2D r is the window SrClipWindow2D(r.mCenter,r.mAxis,r.mHalfLength).
+*/
+class SrClipWindow2D
+{
+public:
+	SrClipWindow2D();
+	/**
+	\brief An axis aligned rectangle with the diagonal from minRect to maxRect.
+	*/
+	SrClipWindow2D(const SrVector2D& minRect,const SrVector2D& maxRect);
+	/**
+	\brief An oriented rectangle, the same as SrRectangle2D. The axes are unit and perpendicular.
+	*/
+	SrClipWindow2D(const SrPoint2D& center,const SrPoint2D* axis,const SrReal* halfLength);
+	/**
+	\brief A convex polygon with at most SR_CLIP_MAX_EDGE vertices in counterclockwise order.
+	*/
+	SrClipWindow2D(const SrPoint2D* vertex,int numVertex);
+
+	void		set(const SrPoint2D* vertex,int numVertex);
+	SrReal		distance(int edge,const SrPoint2D& p) const	{ return mNormal[edge].dot(p) - mD[edge]; }
+	/**
+	\brief The position of a point on the boundary, it is i+u if the point is mVertex[i]+u*(mVertex[i+1]-mVertex[i]).
+	*/
+	SrReal		boundaryParameter(const SrPoint2D& p) const;
+
+public:
+	SrPoint2D	mVertex[SR_CLIP_MAX_EDGE];
+	SrVector2D	mNormal[SR_CLIP_MAX_EDGE];
+	SrReal		mD[SR_CLIP_MAX_EDGE];
+	int			mNumEdge;
+};
+
+/**
+\brief Streaming clipper of polygons and polylines against a convex window.
+
+The vertices are passed in chunks by addVertex() between begin() and end(), the
+clipper never keeps the input, so a polygon may be larger than the memory for
+it. The results are appended to a vertex array and a ring array:
+ringStart[i] is the first vertex of the i-th ring and ringStart.back() is the
+number of vertices.
+
+SR_CLIP_SUTHERLAND_HODGMAN gives one ring for a polygon, the window edges form
+a pipeline, and a concave polygon may give degenerate edges along the window
+boundary. SR_CLIP_WEILER_ATHERTON keeps the topology: every connected part of
+the clipped polygon is a ring, the pieces of the polygon inside the window are
+linked along the window boundary in end(). Both keep the orientation of the
+polygon, which is a simple polygon. SR_CLIP_POLYLINE gives every connected piece
+of an open polyline inside the window.
+*/
+class SrPolygonClipper2D
+{
+public:
+	SrPolygonClipper2D();
+	SrPolygonClipper2D(const SrClipWindow2D& window);
+
+	void				setWindow(const SrClipWindow2D& window);
+	void				begin(int mode);
+	void				addVertex(const SrPoint2D* vertex,int numVertex);
+	/**
+	\return The number of rings appended.
+	*/
+	int					end(std::vector<SrPoint2D>& vertex,std::vector<int>& ringStart);
+
+private:
+	/*
+		Sutherland-HodgmanˮеһӦڵһ
+	*/
+	typedef struct
+	{
+		SrPoint2D	mFirst;
+		SrPoint2D	mPrev;
+		SrReal		mFirstDist;
+		SrReal		mPrevDist;
+		bool		mHasFirst;
+	}tStage;
+	/*
+		Weiler-Atherton㷨жڴڵһΣmEntry봰ڣmExit뿪
+	*/
+	typedef struct
+	{
+		int			mFirst;
+		int			mCount;
+		SrReal		mEntry;
+		SrReal		mExit;
+	}tChain;
+
+	void				pushStage(int stage,const SrPoint2D& p);
+	void				clipEdge(const SrPoint2D& p,const SrPoint2D& q,const SrReal* distP,const SrReal* distQ);
+	void				closeChain();
+	int					linkChains(std::vector<SrPoint2D>& vertex,std::vector<int>& ringStart);
+
+	SrClipWindow2D		mWindow;
+	int					mMode;
+	int					mNumInput;
+	SrPoint2D			mFirstInput;
+	SrPoint2D			mPrevInput;
+	SrReal				mFirstDist[SR_CLIP_MAX_EDGE];
+	SrReal				mPrevDist[SR_CLIP_MAX_EDGE];
+
+	tStage				mStage[SR_CLIP_MAX_EDGE];
+	std::vector<SrPoint2D>	mOutput;
+
+	std::vector<SrPoint2D>	mChainVertex;
+	std::vector<tChain>		mChain;
+	bool				mIsChainOpen;
+	bool				mIsFirstChainAtStart;
+	SrReal				mArea;
+	SrPoint2D			mInteriorPoint;
+	int					mNumCrossing;
+};
+
+/**
+\brief Streaming clipper that splits one polygon into the tiles of a grid in one pass.
+
+The tile (i,j) is [mOrigin.x + i*mTileSize.x, mOrigin.x + (i+1)*mTileSize.x] x
+[mOrigin.y + j*mTileSize.y, mOrigin.y + (j+1)*mTileSize.y], 0<=i<mNumTile[0],
+0<=j<mNumTile[1], and its index is j*mNumTile[0] + i. The input edges are first
+split into the columns, the vertices of every column go on into its tiles, so
+each edge is only visited for the tiles it crosses. The ring of a tile is the
+same as clipping the polygon against the tile with SR_CLIP_SUTHERLAND_HODGMAN.
+*/
+class SrTileClipper2D
+{
+public:
+	SrTileClipper2D();
+	SrTileClipper2D(const SrPoint2D& origin,const SrVector2D& tileSize,int numTileX,int numTileY);
+
+	void				setGrid(const SrPoint2D& origin,const SrVector2D& tileSize,int numTileX,int numTileY);
+	void				begin();
+	void				addVertex(const SrPoint2D* vertex,int numVertex);
+	/**
+	\param[out] ringTile The tile of every appended ring.
+	\return The number of rings appended, the tiles without area are skipped.
+	*/
+	int					end(std::vector<SrPoint2D>& vertex,std::vector<int>& ringStart,std::vector<int>& ringTile);
+
+public:
+	SrPoint2D			mOrigin;
+	SrVector2D			mTileSize;
+	int					mNumTile[2];
+
+private:
+	typedef struct
+	{
+		SrPoint2D	mFirst;
+		SrPoint2D	mPrev;
+		bool		mHasFirst;
+	}tColumn;
+
+	void				splitEdge(const SrPoint2D& p,const SrPoint2D& q);
+	void				pushColumn(int column,const SrPoint2D& p);
+	void				splitColumnEdge(int column,const SrPoint2D& p,const SrPoint2D& q);
+	void				pushTile(int tile,const SrPoint2D& p);
+
+	int					mNumInput;
+	SrPoint2D			mFirstInput;
+	SrPoint2D			mPrevInput;
+	std::vector<tColumn>				mColumn;
+	std::vector< std::vector<SrPoint2D> >	mTile;
+};
+
+/** @} */
+#endif
@@ -0,0 +1,120 @@
+/************************************************************************
+\link	www.twinklingstar.cn
+\author Twinkling Star
+\date	2026/10/19
+****************************************************************************/
+/************************************************************************
+\description	ԱiΪױʱرߵķԶĶ㡢ױԶĶرߵķ
+				ԶĶ㣬iʱ뵥ǰһֻO(n)i
+				Ǵӱi-1ߵ㵽iߵ֮Ķ㡣
+****************************************************************************/
+#include "RotatingCalipers.h"
+
+/*
+\brief	ԱiΪױߵӾΣǱߵĵλ
+*/
+static void SetRectangle(const SrPoint2D& origin,const SrVector2D& axis,SrReal minDot,SrReal maxDot,SrReal height,tCalipersRectangle& rectangle)
+{
+	SrVector2D normal(-axis.y,axis.x);
+	rectangle.mAxis[0] = axis;
+	rectangle.mAxis[1] = normal;
+	rectangle.mHalfLength[0] = (maxDot - minDot) / 2;
+	rectangle.mHalfLength[1] = height / 2;
+	rectangle.mCenter = origin + axis*((minDot + maxDot) / 2) + normal*(height / 2);
+}
+
+void RotatingCalipers(const SrPoint2D* vertex,int numVertex,tCalipersResult& result,bool isAntipodalPair)
+{
+	ASSERT(numVertex>=3);
+	int n = numVertex , i , k , edge , right , top , left , lastTop;
+	SrVector2D e;
+	SrReal length , minDot , maxDot , height , area , perimeter , dist;
+
+	result.mDiameter = -1;
+	result.mWidth = result.mMinArea = result.mMinPerimeter = SR_MAX_F64;
+	result.mAntipodalPair.clear();
+
+	//ǵֻӣʶʱnȡģn-1ߵ
+	e = vertex[0] - vertex[n - 1];
+	top = n;
+	while( top<2*n - 1 && e.cross(vertex[(top + 1) % n] - vertex[top % n])>0 )
+		top ++;
+	top -= n;
+	right = left = 0;
+	for( i=0 ; i<n ; i++ )
+	{
+		e = vertex[Next(i,n)] - vertex[i];
+		lastTop = top;
+		if( right<i )
+			right = i;
+		while( right<i + n && e.dot(vertex[(right + 1) % n] - vertex[right % n])>0 )
+			right ++;
+		if( top<right )
+			top = right;
+		while( top<i + n && e.cross(vertex[(top + 1) % n] - vertex[top % n])>0 )
+			top ++;
+		if( left<top )
+			left = top;
+		while( left<i + n && e.dot(vertex[(left + 1) % n] - vertex[left % n])<0 )
+			left ++;
+
+		//iĶ㣬iƽеıߵһ˵Ҳ
+		for( k=lastTop ; k<=top ; k++ )
+		{
+			dist = (vertex[k % n] - vertex[i]).magnitudeSquared();
+			if( dist>result.mDiameter )
+			{
+				result.mDiameter = dist;
+				result.mDiameterPair[0] = i;
+				result.mDiameterPair[1] = k % n;
+			}
+			if( isAntipodalPair )
+			{
+				result.mAntipodalPair.push_back(i);
+				result.mAntipodalPair.push_back(k % n);
+			}
+		}
+		if( e.cross(vertex[(top + 1) % n] - vertex[top % n])==0 )
+		{
+			edge = (top + 1) % n;
+			dist = (vertex[edge] - vertex[i]).magnitudeSquared();
+			if( dist>result.mDiameter )
+			{
+				result.mDiameter = dist;
+				result.mDiameterPair[0] = i;
+				result.mDiameterPair[1] = edge;
+			}
+			if( isAntipodalPair )
+			{
+				result.mAntipodalPair.push_back(i);
+				result.mAntipodalPair.push_back(edge);
+			}
+		}
+
+		//ԱiΪױߵӾΣǵױߵߵľ
+		length = e.magnitude();
+		e *= 1 / length;
+		minDot = e.dot(vertex[left % n] - vertex[i]);
+		maxDot = e.dot(vertex[right % n] - vertex[i]);
+		height = e.cross(vertex[top % n] - vertex[i]);
+		if( height<result.mWidth )
+		{
+			result.mWidth = height;
+			result.mWidthEdge = i;
+			result.mWidthVertex = top % n;
+		}
+		area = (maxDot - minDot)*height;
+		if( area<result.mMinArea )
+		{
+			result.mMinArea = area;
+			SetRectangle(vertex[i],e,minDot,maxDot,height,result.mMinAreaRectangle);
+		}
+		perimeter = 2*(maxDot - minDot + height);
+		if( perimeter<result.mMinPerimeter )
+		{
+			result.mMinPerimeter = perimeter;
+			SetRectangle(vertex[i],e,minDot,maxDot,height,result.mMinPerimeterRectangle);
+		}
+	}
+	result.mDiameter = sqrt(result.mDiameter);
+}
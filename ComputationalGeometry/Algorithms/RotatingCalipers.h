@@ -0,0 +1,60 @@
+/************************************************************************
+\link	www.twinklingstar.cn
+\author Twinkling Star
+\date	2026/10/19
+****************************************************************************/
+#ifndef SR_ALGORITHMS_ROTATING_CALIPERS_H_
+#define SR_ALGORITHMS_ROTATING_CALIPERS_H_
+
+/** \addtogroup algorithms
+  @{
+*/
+#include "ConvexPolygon.h"
+#include <vector>
+
+/**
+\brief An oriented rectangle, the same as SrRectangle2D. The axes are unit and perpendicular.
+*/
+typedef struct
+{
+	SrPoint2D	mCenter;
+	SrVector2D	mAxis[2];
+	SrReal		mHalfLength[2];
+}tCalipersRectangle;
+
+/**
+\brief Everything measured by one walk of the rotating calipers on a convex polygon.
+
+The diameter is the largest distance of two vertices, the width is the smallest
+distance of two parallel lines enclosing the polygon, and one of the lines
+contains the edge mWidthEdge. The enclosing rectangles of the minimum area and
+of the minimum perimeter both have a side containing an edge of the polygon.
+mAntipodalPair keeps the antipodal pairs of vertices i and j as the integers
+i, j one after another, a pair may appear twice.
+*/
+typedef struct
+{
+	SrReal				mDiameter;
+	int					mDiameterPair[2];
+	SrReal				mWidth;
+	int					mWidthEdge;
+	int					mWidthVertex;
+	SrReal				mMinArea;
+	tCalipersRectangle	mMinAreaRectangle;
+	SrReal				mMinPerimeter;
+	tCalipersRectangle	mMinPerimeterRectangle;
+	std::vector<int>	mAntipodalPair;
+}tCalipersResult;
+
+/*
+\brief	תǷÿΪױߣͬʱתҡǣֻһ͹Σ
+		ֱȡССܳӾԼԣʱ临ӶO(n)
+		ֻõȽϿǵλãҪнǡ
+\param[in]	vertex, numVertex	ʱ˳͹ΣûظĶ
+\param[out]	result				Ľ
+\param[in]	isAntipodalPair		Ƿ񱣴
+*/
+void RotatingCalipers(const SrPoint2D* vertex,int numVertex,tCalipersResult& result,bool isAntipodalPair = true);
+
+/** @} */
+#endif
@@ -0,0 +1,195 @@
+/************************************************************************
+\link	www.twinklingstar.cn
+\author Twinkling Star
+\date	2026/10/19
+****************************************************************************/
+/************************************************************************
+\description	СӾΡΰCSRʽţÿ߳Լ
+				㼯͹Ļ棬ֻĶʱSoAʽд
+				λϣ֮߳䲻ҪͬתֻСȡģҲ
+				߳ʱҲRotatingCalipers()졣
+****************************************************************************/
+#include "RotatingCalipersBatch.h"
+#include <string.h>
+#include <algorithm>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+SrRectangle2DSoA::SrRectangle2DSoA()
+{
+	mBuffer			= NULL;
+	mNumRectangle	= 0;
+	memset(mCenter,0,sizeof(mCenter));
+	memset(mAxis,0,sizeof(mAxis));
+	memset(mHalfLength,0,sizeof(mHalfLength));
+}
+
+SrRectangle2DSoA::SrRectangle2DSoA(int numRectangle)
+{
+	mBuffer			= NULL;
+	mNumRectangle	= 0;
+	memset(mCenter,0,sizeof(mCenter));
+	memset(mAxis,0,sizeof(mAxis));
+	memset(mHalfLength,0,sizeof(mHalfLength));
+	allocate(numRectangle);
+}
+
+SrRectangle2DSoA::~SrRectangle2DSoA()
+{
+	if( mBuffer )
+		delete []mBuffer;
+}
+
+void SrRectangle2DSoA::allocate(int numRectangle)
+{
+	if( mBuffer )
+		delete []mBuffer;
+	mBuffer = new SrReal[8*numRectangle];
+	int c;
+	for( c=0 ; c<2 ; c++ )
+	{
+		mCenter[c]		= mBuffer + c*numRectangle;
+		mAxis[0][c]		= mBuffer + (2 + c)*numRectangle;
+		mAxis[1][c]		= mBuffer + (4 + c)*numRectangle;
+		mHalfLength[c]	= mBuffer + (6 + c)*numRectangle;
+	}
+	mNumRectangle = numRectangle;
+}
+
+void SrRectangle2DSoA::setRectangle(int i,const tCalipersRectangle& rectangle)
+{
+	ASSERT(i>=0 && i<mNumRectangle);
+	mCenter[0][i]		= rectangle.mCenter.x;
+	mCenter[1][i]		= rectangle.mCenter.y;
+	mAxis[0][0][i]		= rectangle.mAxis[0].x;
+	mAxis[0][1][i]		= rectangle.mAxis[0].y;
+	mAxis[1][0][i]		= rectangle.mAxis[1].x;
+	mAxis[1][1][i]		= rectangle.mAxis[1].y;
+	mHalfLength[0][i]	= rectangle.mHalfLength[0];
+	mHalfLength[1][i]	= rectangle.mHalfLength[1];
+}
+
+void SrRectangle2DSoA::getRectangle(int i,tCalipersRectangle& rectangle) const
+{
+	ASSERT(i>=0 && i<mNumRectangle);
+	rectangle.mCenter.x			= mCenter[0][i];
+	rectangle.mCenter.y			= mCenter[1][i];
+	rectangle.mAxis[0].x		= mAxis[0][0][i];
+	rectangle.mAxis[0].y		= mAxis[0][1][i];
+	rectangle.mAxis[1].x		= mAxis[1][0][i];
+	rectangle.mAxis[1].y		= mAxis[1][1][i];
+	rectangle.mHalfLength[0]	= mHalfLength[0][i];
+	rectangle.mHalfLength[1]	= mHalfLength[1][i];
+}
+
+/*
+\brief	͹ֻһʱľΡ
+*/
+static void DegenerateRectangle(const SrPoint2D* hull,int numHull,tCalipersRectangle& rectangle)
+{
+	rectangle.mAxis[0] = SrVector2D(1,0);
+	rectangle.mHalfLength[0] = 0;
+	if( numHull==2 )
+	{
+		rectangle.mAxis[0] = hull[1] - hull[0];
+		rectangle.mHalfLength[0] = rectangle.mAxis[0].normalize() / 2;
+	}
+	rectangle.mAxis[1] = SrVector2D(-rectangle.mAxis[0].y,rectangle.mAxis[0].x);
+	rectangle.mHalfLength[1] = 0;
+	rectangle.mCenter = numHull==2 ? (hull[0] + hull[1])*0.5 : hull[0];
+}
+
+/*
+\brief	ֻСӾεתǣRotatingCalipers()ͬǰǲֱȡ
+		Сܳԡhull[n],...,hull[2n]ظһ͹ǵŲҪnȡģ߲λ
+		ԱiΪױߵnumerator/|e|^2˵رȽϣֻѡеı߿
+*/
+static void MinAreaCalipers(const SrPoint2D* hull,int n,tCalipersRectangle& rectangle)
+{
+	int i , right = 0 , top , left = 0 , best = 0;
+	SrVector2D e;
+	SrReal minDot , maxDot , height , numerator , lengthSquared;
+	SrReal bestMin = 0 , bestMax = 0 , bestHeight = 0 , bestNumerator = SR_MAX_F64 , bestLength = 1;
+
+	e = hull[n] - hull[n - 1];
+	top = n;
+	while( top<2*n - 1 && e.cross(hull[top + 1] - hull[top])>0 )
+		top ++;
+	top -= n;
+	for( i=0 ; i<n ; i++ )
+	{
+		e = hull[i + 1] - hull[i];
+		if( right<i )
+			right = i;
+		while( right<i + n && e.dot(hull[right + 1] - hull[right])>0 )
+			right ++;
+		if( top<right )
+			top = right;
+		while( top<i + n && e.cross(hull[top + 1] - hull[top])>0 )
+			top ++;
+		if( left<top )
+			left = top;
+		while( left<i + n && e.dot(hull[left + 1] - hull[left])<0 )
+			left ++;
+		minDot = e.dot(hull[left] - hull[i]);
+		maxDot = e.dot(hull[right] - hull[i]);
+		height = e.cross(hull[top] - hull[i]);
+		numerator = (maxDot - minDot)*height;
+		lengthSquared = e.magnitudeSquared();
+		if( numerator*bestLength<bestNumerator*lengthSquared )
+		{
+			best = i;
+			bestMin = minDot;
+			bestMax = maxDot;
+			bestHeight = height;
+			bestNumerator = numerator;
+			bestLength = lengthSquared;
+		}
+	}
+	//˱ߵĳ
+	SrReal length = sqrt(bestLength);
+	SrVector2D axis = (hull[best + 1] - hull[best])*(1 / length) , normal(-axis.y,axis.x);
+	bestMin /= length;
+	bestMax /= length;
+	bestHeight /= length;
+	rectangle.mAxis[0] = axis;
+	rectangle.mAxis[1] = normal;
+	rectangle.mHalfLength[0] = (bestMax - bestMin) / 2;
+	rectangle.mHalfLength[1] = bestHeight / 2;
+	rectangle.mCenter = hull[best] + axis*((bestMin + bestMax) / 2) + normal*(bestHeight / 2);
+}
+
+void MinAreaRectangleBatch(const SrPoint2D* vertex,const int* polygonStart,int numPolygon,SrRectangle2DSoA& result)
+{
+	result.allocate(numPolygon);
+#pragma omp parallel
+	{
+		//ÿ̵߳Ļ
+		std::vector<SrPoint2D> point , hull;
+		tCalipersRectangle rectangle;
+		int i , numVertex , numHull;
+#pragma omp for schedule(dynamic,256)
+		for( i=0 ; i<numPolygon ; i++ )
+		{
+			numVertex = polygonStart[i + 1] - polygonStart[i];
+			ASSERT(numVertex>=1);
+			if( (int)point.size()<numVertex )
+			{
+				point.resize(numVertex);
+				hull.resize(2*numVertex + 1);
+			}
+			std::copy(vertex + polygonStart[i],vertex + polygonStart[i + 1],point.begin());
+			numHull = MonotoneChainHull(&point[0],numVertex,&hull[0]);
+			if( numHull>=3 )
+			{
+				std::copy(hull.begin(),hull.begin() + numHull,hull.begin() + numHull);
+				hull[2*numHull] = hull[0];
+				MinAreaCalipers(&hull[0],numHull,rectangle);
+			}
+			else
+				DegenerateRectangle(&hull[0],numHull,rectangle);
+			result.setRectangle(i,rectangle);
+		}
+	}
+}
@@ -0,0 +1,58 @@
+/************************************************************************
+\link	www.twinklingstar.cn
+\author Twinkling Star
+\date	2026/10/19
+****************************************************************************/
+#ifndef SR_ALGORITHMS_ROTATING_CALIPERS_BATCH_H_
+#define SR_ALGORITHMS_ROTATING_CALIPERS_BATCH_H_
+
+/** \addtogroup algorithms
+  @{
+*/
+#include "RotatingCalipers.h"
+
+/**
+\brief 2D oriented rectangles stored as a structure of arrays (SoA).
+
+The i-th rectangle has the center (mCenter[0][i],mCenter[1][i]), the unit axes
+(mAxis[a][0][i],mAxis[a][1][i]) for a = 0,1 and the half lengths
+mHalfLength[a][i] along them.
+*/
+class SrRectangle2DSoA
+{
+public:
+	SrRectangle2DSoA();
+	SrRectangle2DSoA(int numRectangle);
+	~SrRectangle2DSoA();
+	/**
+	\brief Allocate the arrays for numRectangle rectangles, the old data is released.
+	*/
+	void				allocate(int numRectangle);
+	void				setRectangle(int i,const tCalipersRectangle& rectangle);
+	void				getRectangle(int i,tCalipersRectangle& rectangle) const;
+
+public:
+	SrReal*		mCenter[2];
+	SrReal*		mAxis[2][2];
+	SrReal*		mHalfLength[2];
+	int			mNumRectangle;
+
+private:
+	SrRectangle2DSoA(const SrRectangle2DSoA&);
+	SrRectangle2DSoA& operator=(const SrRectangle2DSoA&);
+
+	SrReal*		mBuffer;
+};
+
+/*
+\brief	̵߳εСӾΣ罨ÿõ㷨͹
+		תǷСӾΡÿ̵߳͹ж֮ظʹá
+		͹˻һһ߶ʱεİ볤0
+\param[in]	vertex, polygonStart	ivertex[polygonStart[i]],...,vertex[polygonStart[i + 1] - 1]
+									ĵ㼯һ
+\param[out]	result					iǵiεĽᱻ·ΪnumPolygon
+*/
+void MinAreaRectangleBatch(const SrPoint2D* vertex,const int* polygonStart,int numPolygon,SrRectangle2DSoA& result);
+
+/** @} */
+#endif
@@ -0,0 +1,115 @@
+/************************************************************************		
+\link	www.twinklingstar.cn
+\author Twinkling Star
+\date	2014/06/19
+****************************************************************************/
+/************************************************************************		
+\description	ַж߶ΧǷص
+****************************************************************************/
+#include "SegmentOverlapOBB.h"
+#include <math.h>
+
+/*
+\brief	ж߶OBBǷص޷㡣
+		οģGregory, A., et al. "H-COLLIDE: A framework for fast and accurate collision detection for haptic interaction."
+\return	true	ص
+		false	ص
+
+ĳЩƽ̨ϣfabs()Ŀϴ󣬵¿ٷȺ巨
+*/
+bool SegmentOverlapTestOBB_FastTesting(const SrSegment3D& segment, const SrOBBox3D& obb)
+{
+	SrPoint3D point1 , point2;
+	SrVector3D p1 = segment.mPoint1 - obb.mCenter;
+	SrVector3D p2 = segment.mPoint2 - obb.mCenter;
+
+	point1.x = obb.mAxis[0].dot(p1);
+	point1.y = obb.mAxis[1].dot(p1);
+	point1.z = obb.mAxis[2].dot(p1);
+
+	point2.x = obb.mAxis[0].dot(p2);
+	point2.y = obb.mAxis[1].dot(p2);
+	point2.z = obb.mAxis[2].dot(p2);
+
+	SrPoint3D m = (point1 + point2)*0.5;
+	SrVector3D w = m - point1;
+
+	SrReal X = fabs(w.x), Y = fabs(w.y) , Z = fabs(w.z);
+	if( GREATER(fabs(m.x),X+obb.mHalfLength[0]) )
+		return false;
+	if( GREATER(fabs(m.y),Y+obb.mHalfLength[1]) )
+		return false;
+	if( GREATER(fabs(m.z),Z+obb.mHalfLength[2]) )
+		return false;
+	if( GREATER(fabs(m.y*w.z - m.z*w.y),obb.mHalfLength[1]*Z + obb.mHalfLength[2]*Y) )
+		return false;
+	if( GREATER(fabs(m.x*w.z - m.z*w.x),obb.mHalfLength[0]*Z + obb.mHalfLength[2]*X) )
+		return false;
+	if( GREATER(fabs(m.x*w.y - m.y*w.x),obb.mHalfLength[0]*Y + obb.mHalfLength[1]*X) )
+		return false;
+	return true;
+}
+
+
+/*
+\brief	ú巨ж߶OBBǷصַԼ㡣
+\return	true	ص
+		false	ص
+*/
+bool SegmentOverlapTestOBB_SlabsMethod(const SrSegment3D& segment, const SrOBBox3D& obb)
+{
+	SrPoint3D point1 , point2;
+	SrVector3D p1 = segment.mPoint1 - obb.mCenter;
+	SrVector3D p2 = segment.mPoint2 - obb.mCenter;
+
+	point1.x = obb.mAxis[0].dot(p1);
+	point1.y = obb.mAxis[1].dot(p1);
+	point1.z = obb.mAxis[2].dot(p1);
+
+	point2.x = obb.mAxis[0].dot(p2);
+	point2.y = obb.mAxis[1].dot(p2);
+	point2.z = obb.mAxis[2].dot(p2);
+	
+	//ж߶ζ˵ǷڰΧ
+	if( GEQUAL(point1.x,-obb.mHalfLength[0])&&LEQUAL(point1.x, obb.mHalfLength[0])&&
+		GEQUAL(point1.y,-obb.mHalfLength[1])&&LEQUAL(point1.y, obb.mHalfLength[1])&&
+		GEQUAL(point1.z,-obb.mHalfLength[2])&&LEQUAL(point1.z, obb.mHalfLength[2]))
+		return true;
+	if( GEQUAL(point2.x,-obb.mHalfLength[0])&&LEQUAL(point2.x, obb.mHalfLength[0])&&
+		GEQUAL(point2.y,-obb.mHalfLength[1])&&LEQUAL(point2.y, obb.mHalfLength[1])&&
+		GEQUAL(point2.z,-obb.mHalfLength[2])&&LEQUAL(point2.z, obb.mHalfLength[2]))
+		return true;
+
+	//ж߶ǷΧཻ
+	SrVector3D direction = point2 - point1, base = point1;
+	SrReal tNear = SR_MIN_F32;
+	SrReal tFar = SR_MAX_F32;
+	SrReal t0,t1,tmp;
+	int i;
+	for( i=0 ; i<3 ; i++ )
+	{
+		if( EQUAL(direction[i],0) )
+		{
+			if( LESS(base[i],-obb.mHalfLength[i]) || GREATER(base[i], obb.mHalfLength[i]) )
+				return false;
+			continue;
+		}
+		t0 = (-obb.mHalfLength[i] - base[i]) / direction[i];
+		t1 = ( obb.mHalfLength[i] - base[i]) / direction[i];
+
+		if( GREATER(t0,t1) )
+		{
+			tmp = t0;
+			t0 = t1;
+			t1 = tmp;
+		}
+		if( GREATER(t0,tNear) )
+			tNear = t0;
+		if( LESS(t1,tFar) )
+			tFar = t1;
+		if( GREATER(tNear,tFar) || LESS(tFar,0) || GREATER(tNear,1.0) )
+			return false;
+	}
+
+	return true;
+}
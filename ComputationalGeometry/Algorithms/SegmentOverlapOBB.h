@@ -0,0 +1,68 @@
+/************************************************************************		
+\link	www.twinklingstar.cn
+\author Twinkling Star
+\date	2014/06/19
+****************************************************************************/
+#ifndef SR_ALGORITHMS_SEGMENT_OVERLAP_OBB_H_
+#define SR_ALGORITHMS_SEGMENT_OVERLAP_OBB_H_
+
+/** \addtogroup algorithms
+  @{
+*/
+#include "SrOBBox3D.h"
+
+/**
+\brief 3D segment class.
+This is a 3D segment class with public data members,two endpoints.
+*/
+class SrSegment3D
+{
+public:
+	/**
+	\brief Default constructor, the two endpoints is set to (0,0,0).
+	*/
+	SrSegment3D()
+	{
+		mPoint1.set(0,0,0);
+		mPoint2.set(0,0,0);
+	}
+	/**
+	\brief The segment is initialized by two points.
+	*/
+	SrSegment3D(const SrPoint3D& p1,const SrPoint3D& p2)
+	{
+		mPoint1 = p1;
+		mPoint2 = p2;
+	}
+	/**
+	\brief  true if the line is valid.
+	*/
+	bool isValid()const
+	{
+		if( EQUAL(mPoint1.x,mPoint2.x)&&EQUAL(mPoint1.y,mPoint2.y)&&EQUAL(mPoint1.z,mPoint2.z) )
+			return false;
+		return true;
+	}
+public:
+	SrPoint3D mPoint1;
+	SrPoint3D mPoint2;
+};
+
+/*
+\brief	ж߶OBBǷص޷㡣
+		οģGregory, A., et al. "H-COLLIDE: A framework for fast and accurate collision detection for haptic interaction."
+\return	true	ص
+		false	ص
+
+ĳЩƽ̨ϣfabs()Ŀϴ󣬵¿ٷȺ巨
+*/
+bool SegmentOverlapTestOBB_FastTesting(const SrSegment3D& segment, const SrOBBox3D& obb);
+/*
+\brief	ú巨ж߶OBBǷصַԼ㡣
+\return	true	ص
+		false	ص
+*/
+bool SegmentOverlapTestOBB_SlabsMethod(const SrSegment3D& segment, const SrOBBox3D& obb);
+
+/** @} */
+#endif
@@ -0,0 +1,393 @@
+/************************************************************************
+\link	www.twinklingstar.cn
+\author Twinkling Star
+\date	2026/10/19
+****************************************************************************/
+/************************************************************************
+\description	ٷͺ巨SSE2ݰ汾ж߶OBBǷصַԿ
+				봦йأʱһ߶βѡϿķ
+****************************************************************************/
+#include "SegmentOverlapOBBPacket.h"
+#include "SrSimd.h"
+#include <string.h>
+#include <time.h>
+#include <vector>
+
+#define PACKET_WIDTH		SR_SEGMENT_PACKET_WIDTH
+/*
+	ʱʹõ߶εĸظĴ
+*/
+#define BENCH_SEGMENT		1024
+#define BENCH_REPEAT		32
+#define BENCH_ROUND			4
+
+SrSegment3DSoA::SrSegment3DSoA()
+{
+	mBuffer		= NULL;
+	mNumSegment = 0;
+	memset(mPoint1,0,sizeof(mPoint1));
+	memset(mPoint2,0,sizeof(mPoint2));
+}
+
+SrSegment3DSoA::SrSegment3DSoA(int numSegment)
+{
+	mBuffer		= NULL;
+	mNumSegment = 0;
+	memset(mPoint1,0,sizeof(mPoint1));
+	memset(mPoint2,0,sizeof(mPoint2));
+	allocate(numSegment);
+}
+
+SrSegment3DSoA::~SrSegment3DSoA()
+{
+	if( mBuffer )
+		delete []mBuffer;
+}
+
+void SrSegment3DSoA::allocate(int numSegment)
+{
+	if( mBuffer )
+		delete []mBuffer;
+	int capacity = (numSegment + PACKET_WIDTH - 1) / PACKET_WIDTH * PACKET_WIDTH;
+	mBuffer = new SrReal[6*capacity];
+	memset(mBuffer,0,sizeof(SrReal)*6*capacity);
+	int c;
+	for( c=0 ; c<3 ; c++ )
+	{
+		mPoint1[c] = mBuffer + c*capacity;
+		mPoint2[c] = mBuffer + (3 + c)*capacity;
+	}
+	mNumSegment = numSegment;
+}
+
+void SrSegment3DSoA::setSegment(int i,const SrSegment3D& segment)
+{
+	ASSERT(i>=0 && i<mNumSegment);
+	int c;
+	for( c=0 ; c<3 ; c++ )
+	{
+		mPoint1[c][i] = segment.mPoint1[c];
+		mPoint2[c][i] = segment.mPoint2[c];
+	}
+}
+
+const SrSegment3D SrSegment3DSoA::getSegment(int i) const
+{
+	ASSERT(i>=0 && i<mNumSegment);
+	return SrSegment3D(SrPoint3D(mPoint1[0][i],mPoint1[1][i],mPoint1[2][i]),SrPoint3D(mPoint2[0][i],mPoint2[1][i],mPoint2[2][i]));
+}
+
+
+/*
+	SR_SIMD_WIDTH߶λOBBװĴ
+*/
+typedef struct
+{
+	SrSimdReal	mPoint1[3];
+	SrSimdReal	mPoint2[3];
+}tSegmentPacket;
+
+typedef struct
+{
+	SrSimdReal	mCenter[3];
+	SrSimdReal	mAxis[3][3];
+	SrSimdReal	mHalfLength[3];
+}tOBBPacket;
+
+static void LoadPacket(const SrSegment3DSoA& segment,int first,tSegmentPacket& packet)
+{
+	int c;
+	for( c=0 ; c<3 ; c++ )
+	{
+		packet.mPoint1[c] = SrSimd::load(segment.mPoint1[c] + first);
+		packet.mPoint2[c] = SrSimd::load(segment.mPoint2[c] + first);
+	}
+}
+
+static void LoadPacket(const SrOBBox3DSoA& obb,int first,tOBBPacket& packet)
+{
+	int k , c;
+	for( c=0 ; c<3 ; c++ )
+	{
+		packet.mCenter[c]	  = SrSimd::load(obb.mCenter[c] + first);
+		packet.mHalfLength[c] = SrSimd::load(obb.mHalfLength[c] + first);
+	}
+	for( k=0 ; k<3 ; k++ )
+		for( c=0 ; c<3 ; c++ )
+			packet.mAxis[k][c] = SrSimd::load(obb.mAxis[k][c] + first);
+}
+
+static void SplatPacket(const SrOBBox3D& obb,tOBBPacket& packet)
+{
+	int k , c;
+	for( c=0 ; c<3 ; c++ )
+		packet.mCenter[c] = SrSimd::splat(obb.mCenter[c]);
+	for( k=0 ; k<3 ; k++ )
+	{
+		for( c=0 ; c<3 ; c++ )
+			packet.mAxis[k][c] = SrSimd::splat(obb.mAxis[k][c]);
+		packet.mHalfLength[k] = SrSimd::splat(obb.mHalfLength[k]);
+	}
+}
+
+static SrSimdReal DotPacket(const SrSimdReal* u,const SrSimdReal* v)
+{
+	return SrSimd::add(SrSimd::add(SrSimd::mul(u[0],v[0]),SrSimd::mul(u[1],v[1])),SrSimd::mul(u[2],v[2]));
+}
+
+/*
+\brief	߶ε˵任OBBľֲϵУ汾ļ˳ͬ
+*/
+static void ToLocal(const tSegmentPacket& segment,const tOBBPacket& obb,SrSimdReal* point1,SrSimdReal* point2)
+{
+	SrSimdReal p1[3] , p2[3];
+	int k;
+	for( k=0 ; k<3 ; k++ )
+	{
+		p1[k] = SrSimd::sub(segment.mPoint1[k],obb.mCenter[k]);
+		p2[k] = SrSimd::sub(segment.mPoint2[k],obb.mCenter[k]);
+	}
+	for( k=0 ; k<3 ; k++ )
+	{
+		point1[k] = DotPacket(obb.mAxis[k],p1);
+		point2[k] = DotPacket(obb.mAxis[k],p2);
+	}
+}
+
+/*
+\brief	SegmentOverlapTestOBB_FastTestingļĴ汾صͨ롣
+*/
+static int FastTestingPacket(const tSegmentPacket& segment,const tOBBPacket& obb)
+{
+	SrSimdReal point1[3] , point2[3] , m[3] , w[3] , a[3] , separated;
+	const SrSimdReal* h = obb.mHalfLength;
+	SrSimdReal half = SrSimd::splat(0.5);
+	int k;
+	ToLocal(segment,obb,point1,point2);
+	for( k=0 ; k<3 ; k++ )
+	{
+		m[k] = SrSimd::mul(SrSimd::add(point1[k],point2[k]),half);
+		w[k] = SrSimd::sub(m[k],point1[k]);
+		a[k] = SrSimd::abs(w[k]);
+	}
+	separated = SrSimd::greater(SrSimd::abs(m[0]),SrSimd::add(a[0],h[0]));
+	separated = SrSimd::orMask(separated,SrSimd::greater(SrSimd::abs(m[1]),SrSimd::add(a[1],h[1])));
+	separated = SrSimd::orMask(separated,SrSimd::greater(SrSimd::abs(m[2]),SrSimd::add(a[2],h[2])));
+	separated = SrSimd::orMask(separated,SrSimd::greater(SrSimd::abs(SrSimd::sub(SrSimd::mul(m[1],w[2]),SrSimd::mul(m[2],w[1]))),
+														 SrSimd::add(SrSimd::mul(h[1],a[2]),SrSimd::mul(h[2],a[1]))));
+	separated = SrSimd::orMask(separated,SrSimd::greater(SrSimd::abs(SrSimd::sub(SrSimd::mul(m[0],w[2]),SrSimd::mul(m[2],w[0]))),
+														 SrSimd::add(SrSimd::mul(h[0],a[2]),SrSimd::mul(h[2],a[0]))));
+	separated = SrSimd::orMask(separated,SrSimd::greater(SrSimd::abs(SrSimd::sub(SrSimd::mul(m[0],w[1]),SrSimd::mul(m[1],w[0]))),
+														 SrSimd::add(SrSimd::mul(h[0],a[1]),SrSimd::mul(h[1],a[0]))));
+	return ~SrSimd::moveMask(separated) & SR_SIMD_FULL_MASK;
+}
+
+static SrSimdReal InsidePacket(const SrSimdReal* point,const SrSimdReal* h)
+{
+	SrSimdReal inside = SrSimd::andMask(SrSimd::gequal(point[0],SrSimd::neg(h[0])),SrSimd::lequal(point[0],h[0]));
+	inside = SrSimd::andMask(inside,SrSimd::andMask(SrSimd::gequal(point[1],SrSimd::neg(h[1])),SrSimd::lequal(point[1],h[1])));
+	inside = SrSimd::andMask(inside,SrSimd::andMask(SrSimd::gequal(point[2],SrSimd::neg(h[2])),SrSimd::lequal(point[2],h[2])));
+	return inside;
+}
+
+/*
+\brief	SegmentOverlapTestOBB_SlabsMethodļĴ汾صͨ롣汾ǰص
+		ۻrejectedУΪ0ͨtNeartFar䣬ֻǷںڡ
+*/
+static int SlabsPacket(const tSegmentPacket& segment,const tOBBPacket& obb)
+{
+	SrSimdReal point1[3] , point2[3];
+	const SrSimdReal* h = obb.mHalfLength;
+	ToLocal(segment,obb,point1,point2);
+	SrSimdReal inside = SrSimd::orMask(InsidePacket(point1,h),InsidePacket(point2,h));
+
+	SrSimdReal zero = SrSimd::splat(0) , one = SrSimd::splat(1.0);
+	SrSimdReal tNear = SrSimd::splat(SR_MIN_F32) , tFar = SrSimd::splat(SR_MAX_F32);
+	SrSimdReal rejected = zero;
+	SrSimdReal direction , base , parallel , outside , t0 , t1 , swap , lo , hi , reject;
+	int i;
+	for( i=0 ; i<3 ; i++ )
+	{
+		direction = SrSimd::sub(point2[i],point1[i]);
+		base	  = point1[i];
+		parallel  = SrSimd::equal(direction,zero);
+		outside	  = SrSimd::orMask(SrSimd::less(base,SrSimd::neg(h[i])),SrSimd::greater(base,h[i]));
+
+		t0 = SrSimd::div(SrSimd::sub(SrSimd::neg(h[i]),base),direction);
+		t1 = SrSimd::div(SrSimd::sub(h[i],base),direction);
+		swap = SrSimd::greater(t0,t1);
+		lo = SrSimd::select(swap,t1,t0);
+		hi = SrSimd::select(swap,t0,t1);
+		lo = SrSimd::select(SrSimd::greater(lo,tNear),lo,tNear);
+		hi = SrSimd::select(SrSimd::less(hi,tFar),hi,tFar);
+		tNear = SrSimd::select(parallel,tNear,lo);
+		tFar  = SrSimd::select(parallel,tFar,hi);
+
+		reject = SrSimd::orMask(SrSimd::greater(tNear,tFar),SrSimd::orMask(SrSimd::less(tFar,zero),SrSimd::greater(tNear,one)));
+		rejected = SrSimd::orMask(rejected,SrSimd::select(parallel,outside,reject));
+	}
+	return SrSimd::moveMask(SrSimd::orMask(inside,SrSimd::andNot(rejected,SrSimd::splat(-0.0)))) & SR_SIMD_FULL_MASK;
+}
+
+static int ValidMask(int num,int first)
+{
+	int numLane = num - first;
+	return numLane>=PACKET_WIDTH ? (1<<PACKET_WIDTH) - 1 : (1<<numLane) - 1;
+}
+
+static int TestPacket(const SrSegment3DSoA& segment,int first,const tOBBPacket& obb,int kernel)
+{
+	tSegmentPacket packet;
+	int h , overlap = 0;
+	for( h=0 ; h<PACKET_WIDTH ; h+=SR_SIMD_WIDTH )
+	{
+		LoadPacket(segment,first + h,packet);
+		overlap |= (kernel==SR_SEGMENT_KERNEL_FAST ? FastTestingPacket(packet,obb) : SlabsPacket(packet,obb)) << h;
+	}
+	return overlap & ValidMask(segment.mNumSegment,first);
+}
+
+static int TestPairPacket(const SrSegment3DSoA& segment,const SrOBBox3DSoA& obb,int first,int kernel)
+{
+	tSegmentPacket packet;
+	tOBBPacket obbPacket;
+	int h , overlap = 0;
+	for( h=0 ; h<PACKET_WIDTH ; h+=SR_SIMD_WIDTH )
+	{
+		LoadPacket(segment,first + h,packet);
+		LoadPacket(obb,first + h,obbPacket);
+		overlap |= (kernel==SR_SEGMENT_KERNEL_FAST ? FastTestingPacket(packet,obbPacket) : SlabsPacket(packet,obbPacket)) << h;
+	}
+	return overlap & ValidMask(segment.mNumSegment,first);
+}
+
+int SegmentOverlapTestOBB_Packet(const SrSegment3DSoA& segment,int first,const SrOBBox3D& obb,int kernel)
+{
+	ASSERT(first>=0 && first<segment.mNumSegment);
+	ASSERT(kernel==SR_SEGMENT_KERNEL_FAST || kernel==SR_SEGMENT_KERNEL_SLABS);
+	tOBBPacket obbPacket;
+	SplatPacket(obb,obbPacket);
+	return TestPacket(segment,first,obbPacket,kernel);
+}
+
+int SegmentOverlapTestOBB_PairPacket(const SrSegment3DSoA& segment,const SrOBBox3DSoA& obb,int first,int kernel)
+{
+	ASSERT(segment.mNumSegment==obb.mNumBox && first>=0 && first<segment.mNumSegment);
+	ASSERT(kernel==SR_SEGMENT_KERNEL_FAST || kernel==SR_SEGMENT_KERNEL_SLABS);
+	return TestPairPacket(segment,obb,first,kernel);
+}
+
+/*
+\brief	ͬırand()״̬
+*/
+static SrReal BenchRandom(SrU32& seed,SrReal range)
+{
+	seed = seed*1664525u + 1013904223u;
+	return (seed>>8) * (range / 16777216.0);
+}
+
+/*
+\brief	߶εĶ˵[0,2000]ֲOBBλ벢бģTest_SegmentOverlapTestOBBơ
+		ز㷨֣ʱӾȺ̵Ӱ졣
+*/
+static int MeasureKernel()
+{
+	SrSegment3DSoA segment(BENCH_SEGMENT);
+	SrU32 seed = 12345;
+	int i , k , c , round , repeat , first;
+	for( i=0 ; i<BENCH_SEGMENT ; i++ )
+	{
+		for( c=0 ; c<3 ; c++ )
+		{
+			segment.mPoint1[c][i] = BenchRandom(seed,2000);
+			segment.mPoint2[c][i] = BenchRandom(seed,2000);
+		}
+	}
+	SrVector3D axis[3];
+	axis[0] = SrVector3D(2,1,0);
+	axis[1] = SrVector3D(-1,2,1);
+	axis[0].normalize();
+	axis[1] = axis[1] - axis[0]*axis[0].dot(axis[1]);
+	axis[1].normalize();
+	axis[2] = axis[0].cross(axis[1]);
+	SrReal halfLength[3] = {250,200,300};
+	tOBBPacket obb;
+	SplatPacket(SrOBBox3D(SrPoint3D(1000,1000,1000),axis,halfLength),obb);
+
+	clock_t time[2] = {0,0} , start;
+	volatile int sink = 0;
+	for( round=0 ; round<BENCH_ROUND ; round++ )
+	{
+		for( k=0 ; k<2 ; k++ )
+		{
+			start = clock();
+			for( repeat=0 ; repeat<BENCH_REPEAT ; repeat++ )
+				for( first=0 ; first<BENCH_SEGMENT ; first+=PACKET_WIDTH )
+					sink += TestPacket(segment,first,obb,k);
+			time[k] += clock() - start;
+		}
+	}
+	return time[SR_SEGMENT_KERNEL_SLABS]<time[SR_SEGMENT_KERNEL_FAST] ? SR_SEGMENT_KERNEL_SLABS : SR_SEGMENT_KERNEL_FAST;
+}
+
+/*
+\brief	ٽУ߳ͬʱһεʱֻһΣ̵߳ȴĽ
+*/
+int SegmentOverlapTestOBB_SelectKernel()
+{
+	static int selected = SR_SEGMENT_KERNEL_AUTO;
+	int kernel;
+#pragma omp critical(SegmentOverlapTestOBB_SelectKernel)
+	{
+		if( selected==SR_SEGMENT_KERNEL_AUTO )
+			selected = MeasureKernel();
+		kernel = selected;
+	}
+	return kernel;
+}
+
+/*
+\brief	ÿݰչ
+*/
+static int CompactMask(const std::vector<unsigned char>& mask,int* overlapIndex)
+{
+	int i , lane , bits , count = 0;
+	for( i=0 ; i<(int)mask.size() ; i++ )
+	{
+		for( lane=0 , bits=mask[i] ; bits ; lane++ , bits>>=1 )
+		{
+			if( bits & 1 )
+				overlapIndex[count++] = i*PACKET_WIDTH + lane;
+		}
+	}
+	return count;
+}
+
+int SegmentOverlapTestOBB_Batch(const SrSegment3DSoA& segment,const SrOBBox3D& obb,int* overlapIndex,int kernel)
+{
+	if( kernel==SR_SEGMENT_KERNEL_AUTO )
+		kernel = SegmentOverlapTestOBB_SelectKernel();
+	tOBBPacket obbPacket;
+	SplatPacket(obb,obbPacket);
+	int numPacket = (segment.mNumSegment + PACKET_WIDTH - 1) / PACKET_WIDTH;
+	std::vector<unsigned char> mask(numPacket);
+	int i;
+#pragma omp parallel for schedule(static)
+	for( i=0 ; i<numPacket ; i++ )
+		mask[i] = (unsigned char)TestPacket(segment,i*PACKET_WIDTH,obbPacket,kernel);
+	return CompactMask(mask,overlapIndex);
+}
+
+int SegmentOverlapTestOBB_PairBatch(const SrSegment3DSoA& segment,const SrOBBox3DSoA& obb,int* overlapIndex,int kernel)
+{
+	ASSERT(segment.mNumSegment==obb.mNumBox);
+	if( kernel==SR_SEGMENT_KERNEL_AUTO )
+		kernel = SegmentOverlapTestOBB_SelectKernel();
+	int numPacket = (segment.mNumSegment + PACKET_WIDTH - 1) / PACKET_WIDTH;
+	std::vector<unsigned char> mask(numPacket);
+	int i;
+#pragma omp parallel for schedule(static)
+	for( i=0 ; i<numPacket ; i++ )
+		mask[i] = (unsigned char)TestPairPacket(segment,obb,i*PACKET_WIDTH,kernel);
+	return CompactMask(mask,overlapIndex);
+}
@@ -0,0 +1,94 @@
+/************************************************************************
+\link	www.twinklingstar.cn
+\author Twinkling Star
+\date	2026/10/19
+****************************************************************************/
+#ifndef SR_ALGORITHMS_SEGMENT_OVERLAP_OBB_PACKET_H_
+#define SR_ALGORITHMS_SEGMENT_OVERLAP_OBB_PACKET_H_
+
+/** \addtogroup algorithms
+  @{
+*/
+#include "SegmentOverlapOBB.h"
+#include "OBBOverlapOBBPacket.h"
+
+/*
+	һݰа߶εĸSR_OBB_PACKET_WIDTHͬ
+*/
+#define SR_SEGMENT_PACKET_WIDTH		SR_OBB_PACKET_WIDTH
+
+/*
+	ʹõ㷨SR_SEGMENT_KERNEL_AUTOʾʹSegmentOverlapTestOBB_SelectKernel()ѡ㷨
+*/
+#define SR_SEGMENT_KERNEL_AUTO		-1
+#define SR_SEGMENT_KERNEL_FAST		0
+#define SR_SEGMENT_KERNEL_SLABS		1
+
+/**
+\brief 3D segments stored as a structure of arrays (SoA).
+
+mPoint1[c][i] and mPoint2[c][i] are the c-th coordinates of the two endpoints
+of the i-th segment. The arrays are padded with zeros to a multiple of
+SR_SEGMENT_PACKET_WIDTH, so a packet can always be loaded as a whole.
+*/
+class SrSegment3DSoA
+{
+public:
+	SrSegment3DSoA();
+	SrSegment3DSoA(int numSegment);
+	~SrSegment3DSoA();
+	/**
+	\brief Allocate the arrays for numSegment segments, the old data is released.
+	*/
+	void				allocate(int numSegment);
+	void				setSegment(int i,const SrSegment3D& segment);
+	const SrSegment3D	getSegment(int i) const;
+
+public:
+	SrReal*		mPoint1[3];
+	SrReal*		mPoint2[3];
+	int			mNumSegment;
+
+private:
+	SrSegment3DSoA(const SrSegment3DSoA&);
+	SrSegment3DSoA& operator=(const SrSegment3DSoA&);
+
+	SrReal*		mBuffer;
+};
+
+/*
+\brief	һݰе߶һOBBص⣬segment[first],...,segment[first + SR_SEGMENT_PACKET_WIDTH - 1]obbȽϡ
+		kernelΪSR_SEGMENT_KERNEL_FASTSR_SEGMENT_KERNEL_SLABSSSE2Ĵм㣬ûз֧
+		ÿ߶εĽSegmentOverlapTestOBB_FastTestingSegmentOverlapTestOBB_SlabsMethodȫͬ
+\return	λ룬iλΪ1ʾsegment[first + i]obbص
+*/
+int SegmentOverlapTestOBB_Packet(const SrSegment3DSoA& segment,int first,const SrOBBox3D& obb,int kernel);
+/*
+\brief	һݰе߶OBBԵص⣬segment[first + i]obb[first + i]ȽϣֵĺSegmentOverlapTestOBB_Packetͬ
+*/
+int SegmentOverlapTestOBB_PairPacket(const SrSegment3DSoA& segment,const SrOBBox3DSoA& obb,int first,int kernel);
+
+/*
+\brief	һ߶ηֱ㷨ݰ汾ʱ䣬ؽϿ㷨һεʱԺֱӷؽ
+		Ҫ룬ڳʱһΡ
+		߳̿ͬʱãֻһΡ
+\return	SR_SEGMENT_KERNEL_FASTSR_SEGMENT_KERNEL_SLABS
+*/
+int SegmentOverlapTestOBB_SelectKernel();
+
+/*
+\brief	̵߳ݰ߶obbصϵ
+\param[out]	overlapIndex	obbص߶εС˳Ҫsegment.mNumSegmentԪ
+\param[in]	kernel			ʹõ㷨ĬΪSegmentOverlapTestOBB_SelectKernel()ѡ㷨
+\return	ص߶εĸ
+*/
+int SegmentOverlapTestOBB_Batch(const SrSegment3DSoA& segment,const SrOBBox3D& obb,int* overlapIndex,int kernel = SR_SEGMENT_KERNEL_AUTO);
+/*
+\brief	̵߳ݰе߶OBB(segment[i],obb[i])
+\param[out]	overlapIndex	ص߶OBBԵС˳Ҫsegment.mNumSegmentԪ
+\return	ص߶OBBԵĸ
+*/
+int SegmentOverlapTestOBB_PairBatch(const SrSegment3DSoA& segment,const SrOBBox3DSoA& obb,int* overlapIndex,int kernel = SR_SEGMENT_KERNEL_AUTO);
+
+/** @} */
+#endif
@@ -0,0 +1,399 @@
+/************************************************************************
+\link	www.twinklingstar.cn
+\author Twinkling Star
+\date	2026/10/19
+****************************************************************************/
+/************************************************************************
+\description	弯ϵİΧݰ󽻣8һݰ
+				SSE2ĴͬʱڵAABBҶе󽻣Բ
+				RayHitTestSphere_Optimizedǰųݰָ̡߳
+****************************************************************************/
+#include "SphereBVH.h"
+#include "SrSimd.h"
+#include <math.h>
+#include <string.h>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#define PACKET_WIDTH	SR_RAY_PACKET_WIDTH
+#define NUM_REGISTER	(SR_RAY_PACKET_WIDTH / SR_SIMD_WIDTH)
+
+/*
+	AABBչľ롣RayHitTestSphere_OptimizedGREATERݲSR_EPS
+	ҲΪཻʱߵĵľ벻sqrt(r*r + SR_EPS) <= r + sqrt(SR_EPS)
+	չ߲֮ڰΧд޳
+*/
+static const SrReal BOX_PADDING = 1e-6;
+/*
+	Ϊ0ʱڴļСֵ0*inf
+*/
+static const SrReal TINY_DIRECTION = 1e-300;
+
+static SrReal InverseDirection(SrReal d)
+{
+	return 1.0 / (d==0 ? TINY_DIRECTION : d);
+}
+
+SrRay3DSoA::SrRay3DSoA()
+{
+	mBuffer	= NULL;
+	mNumRay	= 0;
+	memset(mBase,0,sizeof(mBase));
+	memset(mDirection,0,sizeof(mDirection));
+}
+
+SrRay3DSoA::SrRay3DSoA(int numRay)
+{
+	mBuffer	= NULL;
+	mNumRay	= 0;
+	memset(mBase,0,sizeof(mBase));
+	memset(mDirection,0,sizeof(mDirection));
+	allocate(numRay);
+}
+
+SrRay3DSoA::~SrRay3DSoA()
+{
+	if( mBuffer )
+		delete []mBuffer;
+}
+
+void SrRay3DSoA::allocate(int numRay)
+{
+	if( mBuffer )
+		delete []mBuffer;
+	int capacity = (numRay + PACKET_WIDTH - 1) / PACKET_WIDTH * PACKET_WIDTH;
+	mBuffer = new SrReal[6*capacity];
+	memset(mBuffer,0,sizeof(SrReal)*6*capacity);
+	int c;
+	for( c=0 ; c<3 ; c++ )
+	{
+		mBase[c]	  = mBuffer + c*capacity;
+		mDirection[c] = mBuffer + (3 + c)*capacity;
+	}
+	mNumRay = numRay;
+}
+
+void SrRay3DSoA::setRay(int i,const SrRay3D& ray)
+{
+	ASSERT(i>=0 && i<mNumRay);
+	int c;
+	for( c=0 ; c<3 ; c++ )
+	{
+		mBase[c][i]		 = ray.mBase[c];
+		mDirection[c][i] = ray.mDirection[c];
+	}
+}
+
+const SrRay3D SrRay3DSoA::getRay(int i) const
+{
+	ASSERT(i>=0 && i<mNumRay);
+	SrRay3D ray;
+	ray.mBase.set(mBase[0][i],mBase[1][i],mBase[2][i]);
+	ray.mDirection.set(mDirection[0][i],mDirection[1][i],mDirection[2][i]);
+	return ray;
+}
+
+SrSphereBVH::SrSphereBVH()
+{
+}
+
+SrSphereBVH::~SrSphereBVH()
+{
+	release();
+}
+
+void SrSphereBVH::release()
+{
+	mNode.clear();
+	mSphere.clear();
+	mSphereIndex.clear();
+}
+
+void SrSphereBVH::build(const SrSphere3D* sphere,int numSphere,int maxLeafSize)
+{
+	ASSERT(maxLeafSize>0);
+	release();
+	if( numSphere<=0 )
+		return;
+
+	SrPoint3D* minPoint = new SrPoint3D[numSphere];
+	SrPoint3D* maxPoint = new SrPoint3D[numSphere];
+	SrPoint3D* centroid = new SrPoint3D[numSphere];
+	int i;
+	SrReal r;
+	mSphereIndex.resize(numSphere);
+	for( i=0 ; i<numSphere ; i++ )
+	{
+		r = sphere[i].mRadius + BOX_PADDING;
+		minPoint[i] = sphere[i].mCenter - SrVector3D(r,r,r);
+		maxPoint[i] = sphere[i].mCenter + SrVector3D(r,r,r);
+		centroid[i] = sphere[i].mCenter;
+		mSphereIndex[i] = i;
+	}
+
+	mNode.reserve(2*numSphere);
+	mNode.resize(1);
+	buildNode(0,0,numSphere,0,maxLeafSize,minPoint,maxPoint,centroid);
+
+	mSphere.resize(numSphere);
+	for( i=0 ; i<numSphere ; i++ )
+		mSphere[i] = sphere[mSphereIndex[i]];
+
+	delete []minPoint;
+	delete []maxPoint;
+	delete []centroid;
+}
+
+void SrSphereBVH::buildNode(int node,int first,int count,int depth,int maxLeafSize,
+							const SrPoint3D* minPoint,const SrPoint3D* maxPoint,const SrPoint3D* centroid)
+{
+	const int* index = &mSphereIndex[0] + first;
+	SrPoint3D boxMin = minPoint[index[0]] , boxMax = maxPoint[index[0]];
+	int i , axis;
+	for( i=1 ; i<count ; i++ )
+	{
+		boxMin.min(minPoint[index[i]]);
+		boxMax.max(maxPoint[index[i]]);
+	}
+	tSphereBVHNode& current = mNode[node];
+	for( i=0 ; i<3 ; i++ )
+	{
+		current.mMin[i] = boxMin[i];
+		current.mMax[i] = boxMax[i];
+	}
+	current.mFirst = first;
+	current.mCount = count;
+	current.mAxis  = 0;
+	if( count<=maxLeafSize || depth>=SR_SPHERE_BVH_MAX_DEPTH - 1 )
+		return;
+
+	int numLeft = BVHPartitionSAH(&mSphereIndex[0] + first,count,minPoint,maxPoint,centroid,&axis);
+	int child = (int)mNode.size();
+	mNode.resize(child + 2);
+	mNode[node].mFirst = child;
+	mNode[node].mCount = 0;
+	mNode[node].mAxis  = axis;
+	buildNode(child,first,numLeft,depth + 1,maxLeafSize,minPoint,maxPoint,centroid);
+	buildNode(child + 1,first + numLeft,count - numLeft,depth + 1,maxLeafSize,minPoint,maxPoint,centroid);
+}
+
+/*
+\brief	ڵAABBĺ巨ԣֻ[0,best]֮䴩AABB߲Ҫڵ㡣
+*/
+static bool RayHitNode(const SrReal* base,const SrReal* invDirection,SrReal best,const tSphereBVHNode& node)
+{
+	SrReal t1 , t2 , tNear = -SR_MAX_F64 , tFar = SR_MAX_F64;
+	int c;
+	for( c=0 ; c<3 ; c++ )
+	{
+		t1 = (node.mMin[c] - base[c])*invDirection[c];
+		t2 = (node.mMax[c] - base[c])*invDirection[c];
+		if( t1>t2 )
+		{
+			SrReal tmp = t1;
+			t1 = t2;
+			t2 = tmp;
+		}
+		if( t1>tNear )	tNear = t1;
+		if( t2<tFar )	tFar  = t2;
+	}
+	return tNear<=tFar && tFar>=0 && tNear<=best;
+}
+
+/*
+\brief	tСtͬСʱµĽ
+*/
+static bool IsCloser(SrReal t,int sphere,SrReal best,int bestSphere)
+{
+	return t<best || (t==best && sphere<bestSphere);
+}
+
+int SrSphereBVH::intersect(const SrRay3D& ray,SrReal& t) const
+{
+	int bestSphere = -1;
+	t = SR_MAX_F64;
+	if( mNode.empty() )
+		return -1;
+	SrReal base[3] , invDirection[3] , hit;
+	int c , i , top = 0 , near;
+	int stack[SR_SPHERE_BVH_MAX_DEPTH + 1];
+	for( c=0 ; c<3 ; c++ )
+	{
+		base[c]			= ray.mBase[c];
+		invDirection[c] = InverseDirection(ray.mDirection[c]);
+	}
+	stack[top++] = 0;
+	while( top>0 )
+	{
+		const tSphereBVHNode& current = mNode[stack[--top]];
+		if( !RayHitNode(base,invDirection,t,current) )
+			continue;
+		if( current.mCount>0 )
+		{
+			for( i=current.mFirst ; i<current.mFirst + current.mCount ; i++ )
+			{
+				if( RayHitTestSphere_Optimized(ray,mSphere[i],hit) && IsCloser(hit,mSphereIndex[i],t,bestSphere) )
+				{
+					t		   = hit;
+					bestSphere = mSphereIndex[i];
+				}
+			}
+			continue;
+		}
+		//ȷ߷ϽϽӽڵ㣬Զӽڵջ
+		near = ray.mDirection[current.mAxis]<0 ? 1 : 0;
+		stack[top++] = current.mFirst + 1 - near;
+		stack[top++] = current.mFirst + near;
+	}
+	return bestSphere;
+}
+
+/*
+	һݰڼĴеݣrĴ2r2r+1
+*/
+typedef struct
+{
+	SrSimdReal	mBase[3][NUM_REGISTER];
+	SrSimdReal	mDirection[3][NUM_REGISTER];
+	SrSimdReal	mInvDirection[3][NUM_REGISTER];
+	SrSimdReal	mBest[NUM_REGISTER];
+	SrSimdReal	mBestSphere[NUM_REGISTER];
+}tRayPacket;
+
+/*
+\brief	ݰڵAABBĺ巨ԣRayHitNodeļͬ
+\return	λ룬iλΪ1ʾiҪڵ
+*/
+static int PacketHitNode(const tRayPacket& packet,int validMask,const tSphereBVHNode& node)
+{
+	const SrSimdReal zero = SrSimd::splat(0);
+	SrSimdReal t1 , t2 , tNear , tFar , mask;
+	int r , c , result = 0;
+	for( r=0 ; r<NUM_REGISTER ; r++ )
+	{
+		if( ((validMask >> (r*SR_SIMD_WIDTH)) & SR_SIMD_FULL_MASK)==0 )
+			continue;
+		tNear = SrSimd::splat(-SR_MAX_F64);
+		tFar  = SrSimd::splat(SR_MAX_F64);
+		for( c=0 ; c<3 ; c++ )
+		{
+			t1 = SrSimd::mul(SrSimd::sub(SrSimd::splat(node.mMin[c]),packet.mBase[c][r]),packet.mInvDirection[c][r]);
+			t2 = SrSimd::mul(SrSimd::sub(SrSimd::splat(node.mMax[c]),packet.mBase[c][r]),packet.mInvDirection[c][r]);
+			tNear = SrSimd::max(tNear,SrSimd::min(t1,t2));
+			tFar  = SrSimd::min(tFar,SrSimd::max(t1,t2));
+		}
+		mask = SrSimd::andMask(SrSimd::cmpLEqual(tNear,tFar),SrSimd::cmpGEqual(tFar,zero));
+		mask = SrSimd::andMask(mask,SrSimd::cmpLEqual(tNear,packet.mBest[r]));
+		result |= SrSimd::moveMask(mask) << (r*SR_SIMD_WIDTH);
+	}
+	return result & validMask;
+}
+
+/*
+\brief	ݰһ󽻣ÿߵļRayHitTestSphere_Optimizedͬ
+		һĴе߶ǰųʱټƽ
+*/
+static void PacketHitSphere(tRayPacket& packet,int nodeMask,const SrSphere3D& sphere,int sphereIndex)
+{
+	const SrSimdReal zero		   = SrSimd::splat(0);
+	const SrSimdReal squaredRadius = SrSimd::splat(sphere.mRadius*sphere.mRadius);
+	const SrSimdReal index		   = SrSimd::splat((SrReal)sphereIndex);
+	SrSimdReal l[3] , s , squaredL , squaredM , miss , q , t , closer;
+	int r , c;
+	for( r=0 ; r<NUM_REGISTER ; r++ )
+	{
+		if( ((nodeMask >> (r*SR_SIMD_WIDTH)) & SR_SIMD_FULL_MASK)==0 )
+			continue;
+		for( c=0 ; c<3 ; c++ )
+			l[c] = SrSimd::sub(SrSimd::splat(sphere.mCenter[c]),packet.mBase[c][r]);
+		s = SrSimd::add(SrSimd::add(SrSimd::mul(l[0],packet.mDirection[0][r]),SrSimd::mul(l[1],packet.mDirection[1][r])),SrSimd::mul(l[2],packet.mDirection[2][r]));
+		squaredL = SrSimd::add(SrSimd::add(SrSimd::mul(l[0],l[0]),SrSimd::mul(l[1],l[1])),SrSimd::mul(l[2],l[2]));
+		miss	 = SrSimd::andMask(SrSimd::less(s,zero),SrSimd::greater(squaredL,squaredRadius));
+		squaredM = SrSimd::sub(squaredL,SrSimd::mul(s,s));
+		miss	 = SrSimd::orMask(miss,SrSimd::greater(squaredM,squaredRadius));
+		if( SrSimd::moveMask(miss)==SR_SIMD_FULL_MASK )
+			continue;
+		q = SrSimd::sqrt(SrSimd::sub(squaredRadius,squaredM));
+		t = SrSimd::select(SrSimd::cmpGreater(squaredL,squaredRadius),SrSimd::sub(s,q),SrSimd::add(s,q));
+		closer = SrSimd::andMask(SrSimd::cmpGEqual(t,packet.mBest[r]),SrSimd::cmpLEqual(t,packet.mBest[r]));
+		closer = SrSimd::andMask(closer,SrSimd::cmpLess(index,packet.mBestSphere[r]));
+		closer = SrSimd::orMask(closer,SrSimd::cmpLess(t,packet.mBest[r]));
+		closer = SrSimd::andNot(miss,closer);
+		packet.mBest[r]		  = SrSimd::select(closer,t,packet.mBest[r]);
+		packet.mBestSphere[r] = SrSimd::select(closer,index,packet.mBestSphere[r]);
+	}
+}
+
+int SrSphereBVH::intersectPacket(const SrRay3DSoA& ray,int first,SrReal* t,int* sphere) const
+{
+	ASSERT(first>=0 && first%PACKET_WIDTH==0 && first<ray.mNumRay);
+	int numValid = ray.mNumRay - first < PACKET_WIDTH ? ray.mNumRay - first : PACKET_WIDTH;
+	int validMask = (1<<numValid) - 1;
+	int i , r , c , top = 0 , mask , near , numHit = 0;
+
+	tRayPacket packet;
+	SrReal invDirection[PACKET_WIDTH];
+	for( c=0 ; c<3 ; c++ )
+	{
+		for( i=0 ; i<PACKET_WIDTH ; i++ )
+			invDirection[i] = InverseDirection(ray.mDirection[c][first + i]);
+		for( r=0 ; r<NUM_REGISTER ; r++ )
+		{
+			packet.mBase[c][r]		   = SrSimd::load(ray.mBase[c] + first + r*SR_SIMD_WIDTH);
+			packet.mDirection[c][r]	   = SrSimd::load(ray.mDirection[c] + first + r*SR_SIMD_WIDTH);
+			packet.mInvDirection[c][r] = SrSimd::load(invDirection + r*SR_SIMD_WIDTH);
+		}
+	}
+	for( r=0 ; r<NUM_REGISTER ; r++ )
+	{
+		packet.mBest[r]		  = SrSimd::splat(SR_MAX_F64);
+		packet.mBestSphere[r] = SrSimd::splat(-1);
+	}
+
+	//ݰе߷ͬõһߵķӽڵķ˳
+	int stack[SR_SPHERE_BVH_MAX_DEPTH + 1];
+	if( !mNode.empty() )
+		stack[top++] = 0;
+	while( top>0 )
+	{
+		const tSphereBVHNode& current = mNode[stack[--top]];
+		mask = PacketHitNode(packet,validMask,current);
+		if( !mask )
+			continue;
+		if( current.mCount>0 )
+		{
+			for( i=current.mFirst ; i<current.mFirst + current.mCount ; i++ )
+				PacketHitSphere(packet,mask,mSphere[i],mSphereIndex[i]);
+			continue;
+		}
+		near = ray.mDirection[current.mAxis][first]<0 ? 1 : 0;
+		stack[top++] = current.mFirst + 1 - near;
+		stack[top++] = current.mFirst + near;
+	}
+
+	SrReal best[PACKET_WIDTH] , bestSphere[PACKET_WIDTH];
+	for( r=0 ; r<NUM_REGISTER ; r++ )
+	{
+		SrSimd::store(best + r*SR_SIMD_WIDTH,packet.mBest[r]);
+		SrSimd::store(bestSphere + r*SR_SIMD_WIDTH,packet.mBestSphere[r]);
+	}
+	for( i=0 ; i<numValid ; i++ )
+	{
+		t[first + i]	  = best[i];
+		sphere[first + i] = (int)bestSphere[i];
+		if( sphere[first + i]>=0 )
+			numHit ++;
+	}
+	return numHit;
+}
+
+int SrSphereBVH::intersectBatch(const SrRay3DSoA& ray,SrReal* t,int* sphere) const
+{
+	int numPacket = (ray.mNumRay + PACKET_WIDTH - 1) / PACKET_WIDTH;
+	int p , numHit = 0;
+#pragma omp parallel for schedule(dynamic,SR_RAY_TILE_PACKET) reduction(+:numHit)
+	for( p=0 ; p<numPacket ; p++ )
+		numHit += intersectPacket(ray,p*PACKET_WIDTH,t,sphere);
+	return numHit;
+}
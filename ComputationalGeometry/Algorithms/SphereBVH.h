@@ -0,0 +1,133 @@
+/************************************************************************
+\link	www.twinklingstar.cn
+\author Twinkling Star
+\date	2026/10/19
+****************************************************************************/
+#ifndef SR_ALGORITHMS_SPHERE_BVH_H_
+#define SR_ALGORITHMS_SPHERE_BVH_H_
+
+/** \addtogroup algorithms
+  @{
+*/
+#include "Ray3DHitTestSphere.h"
+#include "MeshBVH.h"
+#include <vector>
+
+/*
+	һݰߵĸռ4SSE2Ĵ
+*/
+#define SR_RAY_PACKET_WIDTH			8
+/*
+	߳ʱÿηָһ̵߳ݰĸڵݰӦͼڵأ
+	һ߳ͬһߣʵĽڵͬ
+*/
+#define SR_RAY_TILE_PACKET			8
+/*
+	ΧεȣȵĽڵֱΪҶӽڵ㣬ʱջ
+*/
+#define SR_SPHERE_BVH_MAX_DEPTH		64
+
+/**
+\brief A node of the sphere hierarchy, the box is an AABB.
+
+A leaf has mCount>0 spheres, which are mSphere[mFirst],...,mSphere[mFirst+mCount-1]
+of the hierarchy. An internal node has mCount==0, its two children are
+mNode[mFirst] and mNode[mFirst+1], and mAxis is the axis perpendicular to the
+splitting plane.
+*/
+typedef struct
+{
+	SrReal		mMin[3];
+	SrReal		mMax[3];
+	int			mFirst;
+	int			mCount;
+	int			mAxis;
+}tSphereBVHNode;
+
+/**
+\brief 3D rays stored as a structure of arrays (SoA).
+
+mBase[c][i] and mDirection[c][i] are the c-th coordinates of the base and the
+direction of the i-th ray. The arrays are padded with zeros to a multiple of
+SR_RAY_PACKET_WIDTH, so a packet can always be loaded as a whole.
+*/
+class SrRay3DSoA
+{
+public:
+	SrRay3DSoA();
+	SrRay3DSoA(int numRay);
+	~SrRay3DSoA();
+	/**
+	\brief Allocate the arrays for numRay rays, the old data is released.
+	*/
+	void			allocate(int numRay);
+	void			setRay(int i,const SrRay3D& ray);
+	const SrRay3D	getRay(int i) const;
+
+public:
+	SrReal*		mBase[3];
+	SrReal*		mDirection[3];
+	int			mNumRay;
+
+private:
+	SrRay3DSoA(const SrRay3DSoA&);
+	SrRay3DSoA& operator=(const SrRay3DSoA&);
+
+	SrReal*		mBuffer;
+};
+
+/**
+\brief Bounding volume hierarchy over a set of spheres for ray casting, built with binned SAH.
+
+The spheres are copied into mSphere in the order of the leaves, mSphereIndex
+maps them back to the indices of the array passed to build(). The nearest hit
+of a ray is the same as testing the ray against all the spheres with
+RayHitTestSphere_Optimized and keeping the smallest t, if several spheres have
+the same t the one with the smallest index is kept.
+*/
+class SrSphereBVH
+{
+public:
+	SrSphereBVH();
+	~SrSphereBVH();
+	/**
+	\brief Build the hierarchy, the old one is released.
+	\param[in] maxLeafSize The maximum number of spheres in a leaf.
+	*/
+	void					build(const SrSphere3D* sphere,int numSphere,int maxLeafSize = 4);
+	void					release();
+
+	bool					isLeaf(int node) const	{ return mNode[node].mCount>0; }
+	/**
+	\brief The nearest hit of one ray.
+	\param[out] t The parameter of the hit point, SR_MAX_F64 if the ray misses all the spheres.
+	\return The index of the sphere, -1 if the ray misses all the spheres.
+	*/
+	int						intersect(const SrRay3D& ray,SrReal& t) const;
+	/**
+	\brief The nearest hits of the packet ray[first],...,ray[first + SR_RAY_PACKET_WIDTH - 1].
+	The packet goes down the hierarchy as a whole, a node is visited if one of
+	the rays hits its box before its current nearest hit.
+	\param[out] t,sphere The results of the i-th ray are t[first + i] and sphere[first + i], the same as intersect().
+	\return The number of rays in the packet that hit a sphere.
+	*/
+	int						intersectPacket(const SrRay3DSoA& ray,int first,SrReal* t,int* sphere) const;
+	/**
+	\brief The nearest hits of all the rays, the packets are distributed over the threads in tiles of SR_RAY_TILE_PACKET packets.
+	\param[out] t,sphere Arrays of ray.mNumRay elements, the same as intersect().
+	\return The number of rays that hit a sphere.
+	*/
+	int						intersectBatch(const SrRay3DSoA& ray,SrReal* t,int* sphere) const;
+
+public:
+	std::vector<tSphereBVHNode>	mNode;
+	std::vector<SrSphere3D>		mSphere;
+	std::vector<int>			mSphereIndex;
+
+private:
+	void					buildNode(int node,int first,int count,int depth,int maxLeafSize,
+									  const SrPoint3D* minPoint,const SrPoint3D* maxPoint,const SrPoint3D* centroid);
+};
+
+/** @} */
+#endif
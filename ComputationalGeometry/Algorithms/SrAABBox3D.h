@@ -0,0 +1,63 @@
+/************************************************************************
+\link	www.twinklingstar.cn
+\author Twinkling Star
+\date	2026/10/19
+****************************************************************************/
+#ifndef SR_ALGORITHMS_AABBOX3D_H_
+#define SR_ALGORITHMS_AABBOX3D_H_
+
+/** \addtogroup algorithms
+  @{
+*/
+#include "SrOBBox3D.h"
+#include <math.h>
+
+/**
+\brief 3D axis-aligned bounding box (AABB) class.
+*/
+class SrAABBox3D
+{
+public:
+	SrAABBox3D()
+	{
+		mMinAABB.set(0,0,0);
+		mMaxAABB.set(0,0,0);
+	}
+	SrAABBox3D(const SrPoint3D& mn,const SrPoint3D& mx)
+	{
+		mMinAABB = mn;
+		mMaxAABB = mx;
+	}
+	/**
+	\brief The AABB is valid if the three components in "minAABB" are greater to those in "maxAABB".
+	*/
+	bool	isValid() const
+	{
+		if( GEQUAL(mMinAABB.x,mMaxAABB.x) ||
+			GEQUAL(mMinAABB.y,mMaxAABB.y) ||
+			GEQUAL(mMinAABB.z,mMaxAABB.z))
+			return false;
+		return true;
+	}
+	/**
+	\brief The AABB enclosing an OBB.
+	*/
+	void	setOBB(const SrOBBox3D& obb)
+	{
+		SrReal extent;
+		int c;
+		for( c=0 ; c<3 ; c++ )
+		{
+			extent = obb.mHalfLength[0]*fabs(obb.mAxis[0][c]) + obb.mHalfLength[1]*fabs(obb.mAxis[1][c]) + obb.mHalfLength[2]*fabs(obb.mAxis[2][c]);
+			mMinAABB[c] = obb.mCenter[c] - extent;
+			mMaxAABB[c] = obb.mCenter[c] + extent;
+		}
+	}
+
+public:
+	SrPoint3D mMinAABB;
+	SrPoint3D mMaxAABB;
+};
+
+/** @} */
+#endif
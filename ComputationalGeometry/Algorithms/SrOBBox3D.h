@@ -0,0 +1,70 @@
+/************************************************************************
+\link	www.twinklingstar.cn
+\author Twinkling Star
+\date	2026/10/19
+****************************************************************************/
+#ifndef SR_ALGORITHMS_OBBOX3D_H_
+#define SR_ALGORITHMS_OBBOX3D_H_
+
+/** \addtogroup algorithms
+  @{
+*/
+#include "SrGeometricTools.h"
+#include "SrDataType.h"
+
+/**
+\brief 3D oriented bounding box (OBB) class.
+*/
+class SrOBBox3D
+{
+public:
+	SrOBBox3D()
+	{
+		mCenter = SrVector3D(0,0,0);
+		mAxis[0] = mAxis[1] = mAxis[2] = SrVector3D(0,0,0);
+		mHalfLength[0]	= mHalfLength[1] = mHalfLength[2] = 0;
+	}
+	SrOBBox3D(const SrPoint3D& c,const SrVector3D* pAxis,const SrReal* pHalfLength)
+	{
+		mCenter = c;
+
+		mAxis[0] = pAxis[0];
+		mAxis[1] = pAxis[1];
+		mAxis[2] = pAxis[2];
+
+		mHalfLength[0] = pHalfLength[0];
+		mHalfLength[1] = pHalfLength[1];
+		mHalfLength[2] = pHalfLength[2];
+	}
+	/**
+	\brief  The OBB is valid if one of the three axis is unit length,
+			the length of them is greater than 0, and the axis should
+			be perpendicular to each other.
+	*/
+	bool	isValid() const
+	{
+		if( UNEQUAL(mAxis[0].dot(mAxis[1]),0) ||
+			UNEQUAL(mAxis[0].dot(mAxis[2]),0)||
+			UNEQUAL(mAxis[1].dot(mAxis[2]),0))
+			return false;
+
+		if( LEQUAL(mHalfLength[0],0) ||
+			LEQUAL(mHalfLength[1],0) ||
+			LEQUAL(mHalfLength[2],0))
+			return false;
+		if( UNEQUAL(mAxis[0].magnitudeSquared(),1.0) ||
+			UNEQUAL(mAxis[1].magnitudeSquared(),1.0) ||
+			UNEQUAL(mAxis[2].magnitudeSquared(),1.0) )
+			return false;
+
+		return true;
+	}
+
+public:
+	SrPoint3D	mCenter;
+	SrVector3D	mAxis[3];
+	SrReal		mHalfLength[3];
+};
+
+/** @} */
+#endif
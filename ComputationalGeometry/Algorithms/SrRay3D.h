@@ -0,0 +1,58 @@
+/************************************************************************
+\link	www.twinklingstar.cn
+\author Twinkling Star
+\date	2026/10/19
+****************************************************************************/
+#ifndef SR_ALGORITHMS_RAY3D_H_
+#define SR_ALGORITHMS_RAY3D_H_
+
+/** \addtogroup algorithms
+  @{
+*/
+#include "SrGeometricTools.h"
+#include "SrDataType.h"
+
+/**
+\brief 3D ray class.
+
+This is a 3D ray class with public data members.
+The ray is parameterized as X(t) = P+t*d,in which P is the 'base' data,d is the 'direction' data,t>=0.
+the 'direction' is unit length.
+*/
+class SrRay3D
+{
+public:
+	/**
+	\brief Default constructor, base and direction is set to (0,0).
+	*/
+	SrRay3D()
+	{
+		mBase.set(0,0,0);
+		mDirection.set(0,0,0);
+	}
+	/**
+	\brief The line is initialized by two points.The point p1 is the endpoint of the ray.
+	*/
+	SrRay3D(const SrPoint3D& p1,const SrPoint3D& p2)
+	{
+		mBase = p1;
+		mDirection = p2 - p1;
+		mDirection.normalize();
+	}
+	/**
+	\brief  The ray is valid if the direction of the line is unit.
+	*/
+	bool isValid()const
+	{
+		if( EQUAL(mDirection.magnitudeSquared(),1.0) )
+			return true;
+		return false;
+	}
+
+public:
+	SrPoint3D	mBase;
+	SrVector3D	mDirection;
+};
+
+/** @} */
+#endif
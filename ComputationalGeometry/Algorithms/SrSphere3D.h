@@ -0,0 +1,46 @@
+/************************************************************************
+\link	www.twinklingstar.cn
+\author Twinkling Star
+\date	2026/10/19
+****************************************************************************/
+#ifndef SR_ALGORITHMS_SPHERE3D_H_
+#define SR_ALGORITHMS_SPHERE3D_H_
+
+/** \addtogroup algorithms
+  @{
+*/
+#include "SrGeometricTools.h"
+#include "SrDataType.h"
+
+/**
+\brief 3D sphere class.
+
+This is a 3D sphere class with public data members.
+It includes center and radius.
+*/
+class SrSphere3D
+{
+public:
+	/**
+	\brief Default constructor. Set center to (0,0) and radius to 0.
+	*/
+	SrSphere3D()
+	{
+		mCenter.set(0,0,0);
+		mRadius = -1.0;
+	}
+	/**
+	\brief The circle is initialized by center and radius.
+	*/
+	SrSphere3D(const SrPoint3D& ct ,SrReal rd)
+	{
+		mCenter = ct;
+		mRadius = rd;
+	}
+public:
+	SrPoint3D	mCenter;
+	SrReal		mRadius;
+};
+
+/** @} */
+#endif
@@ -0,0 +1,431 @@
+/************************************************************************
+\link	www.twinklingstar.cn
+\author Twinkling Star
+\date	2026/10/19
+****************************************************************************/
+/************************************************************************
+\description	ɨ裨Sweep and Prune㷨οף
+				Baraff, D. "Dynamic simulation of non-penetrating rigid bodies." PhD thesis, Cornell University, 1992.
+				Cohen, J. D., et al. "I-COLLIDE: An interactive and exact collision detection system for large-scale environments."
+****************************************************************************/
+#include "SweepAndPrune.h"
+#include <math.h>
+#include <algorithm>
+
+#define IS_MAX(data)		((data) & 1)
+#define BOX_ID(data)		((data) >> 1)
+
+/*
+\brief	˵˳ֵͬʱС˵˵ǰ棬еAABBҲصġ
+*/
+static bool EndPointLess(SrReal value1,int data1,SrReal value2,int data2)
+{
+	return value1<value2 || (value1==value2 && !IS_MAX(data1) && IS_MAX(data2));
+}
+
+static int HashPair(int box1,int box2,int shift)
+{
+	SrU32 h = ((SrU32)box1*0x9E3779B1u ^ (SrU32)box2)*0x9E3779B1u;
+	return (int)(h >> shift);
+}
+
+SrSweepAndPrune::SrSweepAndPrune(int numAxis)
+{
+	ASSERT(numAxis>=1 && numAxis<=3);
+	mNumAxis = numAxis;
+	mNumSwap = 0;
+	rehashPair(256);
+}
+
+SrSweepAndPrune::~SrSweepAndPrune()
+{
+}
+
+void SrSweepAndPrune::release()
+{
+	int axis;
+	mBox.clear();
+	mOBB.clear();
+	mFreeBox.clear();
+	for( axis=0 ; axis<3 ; axis++ )
+		mEndPoint[axis].clear();
+	mPair.clear();
+	mPairNext.clear();
+	rehashPair(256);
+	mNumSwap = 0;
+}
+
+void SrSweepAndPrune::setBox(int id,const SrOBBox3D& obb)
+{
+	tSAPBox& box = mBox[id];
+	SrReal extent;
+	int c;
+	mOBB[id] = obb;
+	for( c=0 ; c<3 ; c++ )
+	{
+		extent = obb.mHalfLength[0]*fabs(obb.mAxis[0][c]) + obb.mHalfLength[1]*fabs(obb.mAxis[1][c]) + obb.mHalfLength[2]*fabs(obb.mAxis[2][c]);
+		box.mMin[c] = obb.mCenter[c] - extent;
+		box.mMax[c] = obb.mCenter[c] + extent;
+	}
+}
+
+bool SrSweepAndPrune::overlapSorted(int box1,int box2) const
+{
+	const tSAPBox& b1 = mBox[box1];
+	const tSAPBox& b2 = mBox[box2];
+	int axis;
+	for( axis=0 ; axis<mNumAxis ; axis++ )
+	{
+		if( b1.mMin[axis]>b2.mMax[axis] || b2.mMin[axis]>b1.mMax[axis] )
+			return false;
+	}
+	return true;
+}
+
+bool SrSweepAndPrune::overlapUnsorted(int box1,int box2) const
+{
+	const tSAPBox& b1 = mBox[box1];
+	const tSAPBox& b2 = mBox[box2];
+	int axis;
+	for( axis=mNumAxis ; axis<3 ; axis++ )
+	{
+		if( b1.mMin[axis]>b2.mMax[axis] || b2.mMin[axis]>b1.mMax[axis] )
+			return false;
+	}
+	return true;
+}
+
+void SrSweepAndPrune::setIndex(int axis,int index)
+{
+	int data = mEndPoint[axis][index].mData;
+	if( IS_MAX(data) )
+		mBox[BOX_ID(data)].mMaxIndex[axis] = index;
+	else
+		mBox[BOX_ID(data)].mMinIndex[axis] = index;
+}
+
+/*
+\brief	Ѷ˵ƶȷλáС˵ԽһAABB˵ʱAABBϿʼص
+		˵ԽһAABBС˵ʱAABBϷ롣
+*/
+void SrSweepAndPrune::sortDown(int axis,int index)
+{
+	std::vector<tEndPoint>& endPoint = mEndPoint[axis];
+	tEndPoint e = endPoint[index];
+	int data;
+	while( index>0 && EndPointLess(e.mValue,e.mData,endPoint[index - 1].mValue,endPoint[index - 1].mData) )
+	{
+		data = endPoint[index - 1].mData;
+		if( BOX_ID(data)!=BOX_ID(e.mData) )
+		{
+			if( !IS_MAX(e.mData) && IS_MAX(data) )
+			{
+				if( overlapSorted(BOX_ID(e.mData),BOX_ID(data)) )
+					addPair(BOX_ID(e.mData),BOX_ID(data));
+			}
+			else if( IS_MAX(e.mData) && !IS_MAX(data) )
+				removePair(BOX_ID(e.mData),BOX_ID(data));
+		}
+		endPoint[index] = endPoint[index - 1];
+		setIndex(axis,index);
+		index --;
+		mNumSwap ++;
+	}
+	endPoint[index] = e;
+	setIndex(axis,index);
+}
+
+/*
+\brief	Ѷ˵ƶȷλãsortDownԳơ
+*/
+void SrSweepAndPrune::sortUp(int axis,int index)
+{
+	std::vector<tEndPoint>& endPoint = mEndPoint[axis];
+	int last = (int)endPoint.size() - 1;
+	tEndPoint e = endPoint[index];
+	int data;
+	while( index<last && EndPointLess(endPoint[index + 1].mValue,endPoint[index + 1].mData,e.mValue,e.mData) )
+	{
+		data = endPoint[index + 1].mData;
+		if( BOX_ID(data)!=BOX_ID(e.mData) )
+		{
+			if( IS_MAX(e.mData) && !IS_MAX(data) )
+			{
+				if( overlapSorted(BOX_ID(e.mData),BOX_ID(data)) )
+					addPair(BOX_ID(e.mData),BOX_ID(data));
+			}
+			else if( !IS_MAX(e.mData) && IS_MAX(data) )
+				removePair(BOX_ID(e.mData),BOX_ID(data));
+		}
+		endPoint[index] = endPoint[index + 1];
+		setIndex(axis,index);
+		index ++;
+		mNumSwap ++;
+	}
+	endPoint[index] = e;
+	setIndex(axis,index);
+}
+
+typedef struct
+{
+	bool operator()(const std::pair<SrReal,int>& e1,const std::pair<SrReal,int>& e2) const
+	{
+		return EndPointLess(e1.first,e1.second,e2.first,e2.second);
+	}
+}tEndPointCompare;
+
+void SrSweepAndPrune::build(const SrOBBox3D* obb,int numBox)
+{
+	release();
+	mBox.resize(numBox);
+	mOBB.resize(numBox);
+	int i , axis;
+	for( i=0 ; i<numBox ; i++ )
+		setBox(i,obb[i]);
+
+	std::vector< std::pair<SrReal,int> > sorted(2*numBox);
+	for( axis=0 ; axis<mNumAxis ; axis++ )
+	{
+		for( i=0 ; i<numBox ; i++ )
+		{
+			sorted[2*i]		= std::make_pair(mBox[i].mMin[axis],i << 1);
+			sorted[2*i + 1]	= std::make_pair(mBox[i].mMax[axis],(i << 1) | 1);
+		}
+		std::sort(sorted.begin(),sorted.end(),tEndPointCompare());
+		mEndPoint[axis].resize(2*numBox);
+		for( i=0 ; i<2*numBox ; i++ )
+		{
+			mEndPoint[axis][i].mValue = sorted[i].first;
+			mEndPoint[axis][i].mData  = sorted[i].second;
+			setIndex(axis,i);
+		}
+	}
+
+	//صһɨ裬С˵Ѿ֡˵㻹ûгֵAABB
+	std::vector<int> active , activePos(numBox);
+	int data , box , last;
+	for( i=0 ; i<2*numBox ; i++ )
+	{
+		data = mEndPoint[0][i].mData;
+		box	 = BOX_ID(data);
+		if( IS_MAX(data) )
+		{
+			last = active.back();
+			active[activePos[box]] = last;
+			activePos[last] = activePos[box];
+			active.pop_back();
+		}
+		else
+		{
+			for( int k=0 ; k<(int)active.size() ; k++ )
+			{
+				if( overlapSorted(active[k],box) )
+					addPair(active[k],box);
+			}
+			activePos[box] = (int)active.size();
+			active.push_back(box);
+		}
+	}
+}
+
+int SrSweepAndPrune::addBox(const SrOBBox3D& obb)
+{
+	int id , axis;
+	if( mFreeBox.empty() )
+	{
+		id = (int)mBox.size();
+		mBox.push_back(tSAPBox());
+		mOBB.push_back(obb);
+	}
+	else
+	{
+		id = mFreeBox.back();
+		mFreeBox.pop_back();
+	}
+	setBox(id,obb);
+	tEndPoint e;
+	//µAABBĩβAABB룬ƶʱصAABB
+	for( axis=0 ; axis<mNumAxis ; axis++ )
+	{
+		std::vector<tEndPoint>& endPoint = mEndPoint[axis];
+		e.mValue = mBox[id].mMin[axis];
+		e.mData	 = id << 1;
+		endPoint.push_back(e);
+		e.mValue = mBox[id].mMax[axis];
+		e.mData	 = (id << 1) | 1;
+		endPoint.push_back(e);
+		mBox[id].mMinIndex[axis] = (int)endPoint.size() - 2;
+		mBox[id].mMaxIndex[axis] = (int)endPoint.size() - 1;
+		sortDown(axis,mBox[id].mMinIndex[axis]);
+		sortDown(axis,mBox[id].mMaxIndex[axis]);
+	}
+	return id;
+}
+
+void SrSweepAndPrune::removeBox(int id)
+{
+	ASSERT(id>=0 && id<(int)mBox.size() && mBox[id].mMinIndex[0]>=0);
+	tSAPBox& box = mBox[id];
+	int axis , c;
+	//AABBƶԶAABBԶɾĶ˵㶼ĩβ
+	for( c=0 ; c<3 ; c++ )
+	{
+		box.mMin[c] = SR_MAX_F64;
+		box.mMax[c] = SR_MAX_F64;
+	}
+	for( axis=0 ; axis<mNumAxis ; axis++ )
+	{
+		std::vector<tEndPoint>& endPoint = mEndPoint[axis];
+		endPoint[box.mMaxIndex[axis]].mValue = SR_MAX_F64;
+		sortUp(axis,box.mMaxIndex[axis]);
+		endPoint[box.mMinIndex[axis]].mValue = SR_MAX_F64;
+		sortUp(axis,box.mMinIndex[axis]);
+		ASSERT(box.mMinIndex[axis]==(int)endPoint.size() - 2 && box.mMaxIndex[axis]==(int)endPoint.size() - 1);
+		endPoint.pop_back();
+		endPoint.pop_back();
+		box.mMinIndex[axis] = -1;
+		box.mMaxIndex[axis] = -1;
+	}
+	mFreeBox.push_back(id);
+}
+
+void SrSweepAndPrune::updateBox(int id,const SrOBBox3D& obb)
+{
+	ASSERT(id>=0 && id<(int)mBox.size() && mBox[id].mMinIndex[0]>=0);
+	setBox(id,obb);
+	tSAPBox& box = mBox[id];
+	int axis , minIndex , maxIndex;
+	bool minDown , maxDown;
+	for( axis=0 ; axis<mNumAxis ; axis++ )
+	{
+		std::vector<tEndPoint>& endPoint = mEndPoint[axis];
+		minIndex = box.mMinIndex[axis];
+		maxIndex = box.mMaxIndex[axis];
+		minDown = box.mMin[axis]<endPoint[minIndex].mValue;
+		maxDown = box.mMax[axis]<endPoint[maxIndex].mValue;
+		endPoint[minIndex].mValue = box.mMin[axis];
+		endPoint[maxIndex].mValue = box.mMax[axis];
+		//С˵㲻ԽԼ˵
+		if( minDown )
+			sortDown(axis,minIndex);
+		if( !maxDown )
+			sortUp(axis,maxIndex);
+		if( !minDown )
+			sortUp(axis,box.mMinIndex[axis]);
+		if( maxDown )
+			sortDown(axis,box.mMaxIndex[axis]);
+	}
+}
+
+void SrSweepAndPrune::findPairs(BoxPairArray& pairs) const
+{
+	pairs.clear();
+	int i;
+	for( i=0 ; i<(int)mPair.size() ; i++ )
+	{
+		if( overlapUnsorted(mPair[i].mBox1,mPair[i].mBox2) )
+			pairs.push_back(mPair[i]);
+	}
+}
+
+void SrSweepAndPrune::findOverlapPairs(BoxPairArray& pairs,SrSeparatingAxisCache* cache) const
+{
+	pairs.clear();
+	int i , box1 , box2;
+	bool isOverlap;
+	if( cache )
+		cache->nextGeneration();
+	for( i=0 ; i<(int)mPair.size() ; i++ )
+	{
+		box1 = mPair[i].mBox1;
+		box2 = mPair[i].mBox2;
+		if( !overlapUnsorted(box1,box2) )
+			continue;
+		if( cache )
+			isOverlap = cache->overlap(box1,mOBB[box1],box2,mOBB[box2]);
+		else
+			isOverlap = OBBOverlapTestOBB_OptimizedSeparatingAxisMethod(mOBB[box1],mOBB[box2]);
+		if( isOverlap )
+			pairs.push_back(mPair[i]);
+	}
+}
+
+int SrSweepAndPrune::findPair(int box1,int box2,int& prev) const
+{
+	int i = mPairBucket[HashPair(box1,box2,mPairShift)];
+	prev = -1;
+	while( i>=0 && (mPair[i].mBox1!=box1 || mPair[i].mBox2!=box2) )
+	{
+		prev = i;
+		i	 = mPairNext[i];
+	}
+	return i;
+}
+
+void SrSweepAndPrune::addPair(int box1,int box2)
+{
+	if( box1>box2 )
+		std::swap(box1,box2);
+	int prev;
+	if( findPair(box1,box2,prev)>=0 )
+		return;
+	if( mPair.size()>=mPairBucket.size() )
+		rehashPair(2*(int)mPairBucket.size());
+	tBoxPair pair;
+	pair.mBox1 = box1;
+	pair.mBox2 = box2;
+	int bucket = HashPair(box1,box2,mPairShift);
+	mPair.push_back(pair);
+	mPairNext.push_back(mPairBucket[bucket]);
+	mPairBucket[bucket] = (int)mPair.size() - 1;
+}
+
+/*
+\brief	ɾһAABBԣһAABBλá
+*/
+void SrSweepAndPrune::removePair(int box1,int box2)
+{
+	if( box1>box2 )
+		std::swap(box1,box2);
+	int prev , i = findPair(box1,box2,prev);
+	if( i<0 )
+		return;
+	if( prev<0 )
+		mPairBucket[HashPair(box1,box2,mPairShift)] = mPairNext[i];
+	else
+		mPairNext[prev] = mPairNext[i];
+
+	int last = (int)mPair.size() - 1;
+	if( i!=last )
+	{
+		int lastPrev , bucket = HashPair(mPair[last].mBox1,mPair[last].mBox2,mPairShift);
+		findPair(mPair[last].mBox1,mPair[last].mBox2,lastPrev);
+		if( lastPrev<0 )
+			mPairBucket[bucket] = i;
+		else
+			mPairNext[lastPrev] = i;
+		mPair[i]	 = mPair[last];
+		mPairNext[i] = mPairNext[last];
+	}
+	mPair.pop_back();
+	mPairNext.pop_back();
+}
+
+void SrSweepAndPrune::rehashPair(int numBucket)
+{
+	mPairShift = 32;
+	int size = 1;
+	while( size<numBucket )
+	{
+		size <<= 1;
+		mPairShift --;
+	}
+	mPairBucket.assign(size,-1);
+	int i , bucket;
+	for( i=0 ; i<(int)mPair.size() ; i++ )
+	{
+		bucket = HashPair(mPair[i].mBox1,mPair[i].mBox2,mPairShift);
+		mPairNext[i] = mPairBucket[bucket];
+		mPairBucket[bucket] = i;
+	}
+}
@@ -0,0 +1,121 @@
+/************************************************************************
+\link	www.twinklingstar.cn
+\author Twinkling Star
+\date	2026/10/19
+****************************************************************************/
+#ifndef SR_ALGORITHMS_SWEEP_AND_PRUNE_H_
+#define SR_ALGORITHMS_SWEEP_AND_PRUNE_H_
+
+/** \addtogroup algorithms
+  @{
+*/
+#include "SrOBBox3D.h"
+#include "OBBSeparatingAxisCache.h"
+#include <vector>
+
+/**
+\brief A pair of boxes of the sweep and prune, mBox1<mBox2.
+*/
+typedef struct
+{
+	int			mBox1;
+	int			mBox2;
+}tBoxPair;
+
+typedef std::vector<tBoxPair>		BoxPairArray;
+
+/**
+\brief Incremental sweep and prune over the world AABBs of a set of OBBs.
+
+The minimum and maximum endpoints of the AABBs are kept sorted on the first
+numAxis coordinate axes. When a box moves, its endpoints are moved by insertion
+sort, which only costs the number of swaps because of temporal coherence, and
+every swap of a minimum with a maximum endpoint adds or removes a pair. So the
+pair set always holds the pairs overlapping on all the sorted axes, the other
+axes are checked when the pairs are reported. Fewer sorted axes means fewer
+swaps but a larger pair set.
+
+A box is identified by the id returned by addBox(), or its index for build().
+*/
+class SrSweepAndPrune
+{
+public:
+	SrSweepAndPrune(int numAxis = 3);
+	~SrSweepAndPrune();
+	/**
+	\brief Build the structure from scratch with std::sort, the ids of the boxes are 0,...,numBox-1.
+
+	Use it instead of addBox() to insert a large number of boxes at once.
+	*/
+	void				build(const SrOBBox3D* obb,int numBox);
+	void				release();
+
+	int					addBox(const SrOBBox3D& obb);
+	/**
+	\brief Remove a box, it costs O(n) swaps since its endpoints are moved to the end of the arrays.
+	*/
+	void				removeBox(int id);
+	void				updateBox(int id,const SrOBBox3D& obb);
+	const SrOBBox3D&	getBox(int id) const	{ return mOBB[id]; }
+
+	/**
+	\brief The candidate pairs, whose AABBs overlap.
+	*/
+	void				findPairs(BoxPairArray& pairs) const;
+	/**
+	\brief The candidate pairs that pass the OBB overlap test, the test goes through the cache if it is not NULL.
+	Every call starts a new generation of the cache, so the pairs that are no longer candidates are evicted.
+	*/
+	void				findOverlapPairs(BoxPairArray& pairs,SrSeparatingAxisCache* cache = NULL) const;
+
+	int					numBox() const	{ return (int)mEndPoint[0].size()/2; }
+	int					numPair() const	{ return (int)mPair.size(); }
+
+public:
+	int					mNumAxis;
+	int					mNumSwap;		//The number of swaps since the last build().
+
+private:
+	typedef struct
+	{
+		SrReal			mValue;
+		int				mData;			//The box id shifted left by one, the lowest bit is set for a maximum endpoint.
+	}tEndPoint;
+
+	typedef struct
+	{
+		SrReal			mMin[3];
+		SrReal			mMax[3];
+		int				mMinIndex[3];	//The positions of the endpoints on the sorted axes, -1 for a removed box.
+		int				mMaxIndex[3];
+	}tSAPBox;
+
+	SrSweepAndPrune(const SrSweepAndPrune&);
+	SrSweepAndPrune& operator=(const SrSweepAndPrune&);
+
+	void				setBox(int id,const SrOBBox3D& obb);
+	bool				overlapSorted(int box1,int box2) const;
+	bool				overlapUnsorted(int box1,int box2) const;
+	void				sortDown(int axis,int index);
+	void				sortUp(int axis,int index);
+	void				setIndex(int axis,int index);
+
+	void				addPair(int box1,int box2);
+	void				removePair(int box1,int box2);
+	int					findPair(int box1,int box2,int& prev) const;
+	void				rehashPair(int numBucket);
+
+	std::vector<tSAPBox>	mBox;
+	std::vector<SrOBBox3D>	mOBB;			//Kept apart from mBox, which is accessed at every swap.
+	std::vector<int>		mFreeBox;
+	std::vector<tEndPoint>	mEndPoint[3];	//Only the first mNumAxis arrays are used.
+
+	//The pair set is a hash table with chaining, mPairNext links the pairs in a bucket.
+	BoxPairArray			mPair;
+	std::vector<int>		mPairNext;
+	std::vector<int>		mPairBucket;
+	int						mPairShift;
+};
+
+/** @} */
+#endif
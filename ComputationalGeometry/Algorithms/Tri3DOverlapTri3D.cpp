@@ -0,0 +1,787 @@
+/************************************************************************
+\link	www.twinklingstar.cn
+\author Twinkling Star
+\date	2014/04/20
+****************************************************************************/
+#include "Tri3DOverlapTri3D.h"
+
+#define Real		SrReal
+#define Point2D		SrPoint2D
+#define Vector2D	SrVector2D
+#define Point3D		SrPoint3D
+#define Vector3D	SrVector3D
+
+
+#define INSIDE		0x01
+#define OUTSIDE		0x02
+#define ON_EDGE		0x03
+
+#define AXIS_X		0x01
+#define AXIS_Y		0x02
+#define AXIS_Z		0x04
+
+#define  Triangle3D			SrTriangle3D
+
+
+/*
+*\brief  ڶάռϣж߶Ƿཻ.
+*\return true		ཻ.
+		 false		ཻ.
+*/
+static bool Seg2DIntersectSeg2D(const Point2D& p0, const Point2D& p1, const Point2D& q0, const Point2D& q1 )
+{
+	SrVector2D A = p1 - p0;
+	SrVector2D B = q0 - q1;
+	SrVector2D C = p0 - q0;
+	SrReal a = B.y*C.x - B.x*C.y;
+	SrReal b;
+	SrReal denom = A.y*B.x - A.x*B.y;
+	if( GREATER( denom,0 ) )
+	{
+		if( LESS(a,0) || GREATER(a,denom) )
+			return false;
+		b = A.x*C.y - A.y*C.x;
+		if( LESS(b,0) || GREATER(b,denom) )
+			return false;
+		return true;
+	}
+	else if (LESS( denom,0 ))
+	{
+		if( GREATER(a,0) || LESS(a,denom) )
+			return false;
+		b = A.x*C.y - A.y*C.x;
+		if( GREATER(b,0) || LESS(b,denom) )
+			return false;
+		return true;
+	}
+	else
+	{
+		if( !EQUAL(a,0) )
+			return false;
+
+		SrReal denom , t0, t1;
+		if( GREATER(fabs(A.x),fabs(A.y)) )
+		{
+			t0 = q0.x - p0.x;
+			t1 = q1.x - p0.x;
+			denom = A.x;
+		}
+		else
+		{
+			t0 = q0.y - p0.y;
+			t1 = q1.y - p0.y;
+			denom = A.y;
+		}
+		if( LESS(denom,0) )
+		{
+			denom = -denom;
+			t0    = -t0;
+			t1	  = -t1;
+		}
+		SrReal tmp;
+		if( t0>t1 )
+		{
+			tmp = t0;
+			t0 = t1;
+			t1 = tmp;
+		}
+		if( GREATER(t0,denom) || LESS(t1,0) )
+			return false;
+		else if( EQUAL(t1,0) || EQUAL(t0,1) )
+			return true;
+
+		return true;
+	}
+	return false;
+}
+
+/**
+\brief  ڶάռϣжһεĹϵ
+\return ON_EDGE		εı; 
+		INSIDE		ڲ; 
+		OUTSIDE		ⲿ.
+*/
+static int		PointTriangleRelation(const Point2D* tri, const Point2D& p) 
+{
+	Real d0 = (tri[1] - tri[0]).cross(p - tri[0]);
+	Real d1 = (tri[2] - tri[1]).cross(p - tri[1]);
+	Real d2 = (tri[0] - tri[2]).cross(p - tri[2]);
+	//ĳߵӳʱ˻d0*d1d1*d2Ϊ0ó˻ķж
+	bool hasNegative = LESS(d0,0) || LESS(d1,0) || LESS(d2,0);
+	bool hasPositive = GREATER(d0,0) || GREATER(d1,0) || GREATER(d2,0);
+
+	if( hasNegative && hasPositive )
+		return OUTSIDE;
+	else if( EQUAL(d0,0) || EQUAL(d1,0) || EQUAL(d2,0) )
+		return ON_EDGE;
+	return INSIDE;
+}
+/**
+\brief  ڶάռϣεص
+\return true		ص;
+		false		.
+*/
+static bool Tri2DOverlapTestTri2D(const Point2D* tri1, const Point2D* tri2)
+{
+	int i , j;
+	for( i = 0 ; i < 3 ; i++ )
+	{
+		for( j = 0 ; j < 3 ; j++ )
+		{
+			if( Seg2DIntersectSeg2D(tri1[i],tri1[(i + 1) % 3],tri2[j],tri2[(j + 1) % 3]) )
+				return true;
+		}
+	}
+	if(PointTriangleRelation(tri1,tri2[0]) != OUTSIDE)
+		return true;
+	else if(PointTriangleRelation(tri2,tri1[0]) != OUTSIDE )
+		return true;
+	return false;
+}
+
+static int GetMaximumAxis(const Vector3D& normal)
+{
+	Vector3D tm = Vector3D(fabs(normal.x),fabs(normal.y),fabs(normal.z));
+	if( GEQUAL(tm.x,tm.y) && GEQUAL(tm.x,tm.z) )
+		return AXIS_X;
+	else if( GEQUAL(tm.y,tm.x) && GEQUAL(tm.y,tm.z) )
+		return AXIS_Y;
+	return AXIS_Z;
+}
+
+/**
+\brief  άĵ㣬Ƴһõάĵ
+*/
+static void Point3DToPoint2D(const Point3D& point,Point2D& result,int axis)
+{
+	if(axis == AXIS_X)
+	{
+		result.x = point.y;
+		result.y = point.z;
+	}
+	else if(axis == AXIS_Y)
+	{
+		result.x = point.z;
+		result.y = point.x;
+	}
+	else
+	{
+		result.x = point.x;
+		result.y = point.y;
+	}
+}
+
+static void Point3DToPoint2D(const SrPoint3D*point,int number,SrPoint2D* result,int axisRemoved)
+{
+	int i = 0;
+	for( i=0 ; i<number ; i++ )
+	{
+		Point3DToPoint2D(point[i],result[i],axisRemoved);
+	}
+}
+
+static bool Tri3DCoplanarTri3D(const SrTriangle3D& tri1,const SrTriangle3D& tri2,int axis)
+{
+	Point2D tmpTri1[3],tmpTri2[3];
+	Point3DToPoint2D(tri1.mPoint,3,tmpTri1,axis);
+	Point3DToPoint2D(tri2.mPoint,3,tmpTri2,axis);
+	return Tri2DOverlapTestTri2D(tmpTri1,tmpTri2);
+}
+
+/*
+\brief	ιʱص⣬ͶӰtri1NormalֱƽϽж
+*/
+static bool Tri3DOverlapTestTri3D_Coplanar(const SrTriangle3D& tri1,const SrTriangle3D& tri2,const SrVector3D& tri1Normal)
+{
+	int axis = GetMaximumAxis(tri1Normal);
+	return Tri3DCoplanarTri3D(tri1,tri2,axis);
+}
+
+static void ComputeInterval(const Triangle3D& triangle,const Vector3D& direction,int maxAxis,Real* distTriToPlane,Real* t)
+{
+	Real p[3], tm;
+	int indx[3];
+	//sort the dist by using the index table.
+	int minIndex = 0 , tmpIndx;
+	if( LESS(distTriToPlane[1],distTriToPlane[minIndex]) )
+		minIndex = 1;
+	if( LESS(distTriToPlane[2],distTriToPlane[minIndex]) )
+		minIndex = 2;
+	int tmp1 = (minIndex + 1)%3, tmp2 = (minIndex + 2)%3;
+	indx[0] = minIndex;
+	if( LESS(distTriToPlane[tmp1],distTriToPlane[tmp2]) )
+	{
+		indx[1] = tmp1;
+		indx[2] = tmp2;
+	}
+	else
+	{
+		indx[1] = tmp2;
+		indx[2] = tmp1;;
+	}
+
+	if( EQUAL(distTriToPlane[indx[0]],0) && EQUAL(distTriToPlane[indx[1]],0) )
+	{
+		t[0] = triangle.mPoint[indx[0]][maxAxis];
+		t[1] = triangle.mPoint[indx[1]][maxAxis];
+	}
+	else if( EQUAL(distTriToPlane[indx[1]],0) && EQUAL(distTriToPlane[indx[2]],0) )
+	{
+		t[0] = triangle.mPoint[indx[1]][maxAxis];
+		t[1] = triangle.mPoint[indx[2]][maxAxis];
+	}
+	else
+	{
+		if( LESS(distTriToPlane[indx[1]],0) )
+		{
+			tmpIndx = indx[0];
+			indx[0] = indx[2];
+			indx[2] = tmpIndx;
+		}
+		p[0] = triangle.mPoint[indx[0]][maxAxis];
+		p[1] = triangle.mPoint[indx[1]][maxAxis];
+		p[2] = triangle.mPoint[indx[2]][maxAxis];
+
+		t[0] = p[1] + (p[0] - p[1])*distTriToPlane[indx[1]] / (distTriToPlane[indx[1]] - distTriToPlane[indx[0]]);
+		t[1] = p[2] + (p[0] - p[2])*distTriToPlane[indx[2]] / (distTriToPlane[indx[2]] - distTriToPlane[indx[0]]);
+	}
+
+	if( GREATER(t[0] , t[1]) )
+	{
+		tm	 = t[0];
+		t[0] = t[1];
+		t[1] = tm;
+	}
+}
+
+/*
+\brief	Moller㷨ĺ벿֣ζԽ˶Էڵƽ棬ȽֱཻϵǷص
+*/
+static bool Tri3DOverlapTestTri3D_MollerInterval(const Triangle3D& tri1,const Triangle3D& tri2,const Vector3D& tri1Normal,const Vector3D& tri2Normal,Real* distTri1ToPlane,Real* distTri2ToPlane)
+{
+	//ֱཻߵķ
+	Vector3D direction = tri1Normal.cross(tri2Normal);
+	Real t0[2] , t1[2];
+	int maxAxis = 0 ;
+	Vector3D tmpDirection = Vector3D(fabs(direction.x),fabs(direction.y),fabs(direction.z));
+	if( GREATER(tmpDirection.x,tmpDirection.y) )
+	{
+		if( GREATER(tmpDirection.z , tmpDirection.x)  )
+			maxAxis = 2;
+		else
+			maxAxis = 0;
+	}
+	else
+	{
+		if( GREATER(tmpDirection.z , tmpDirection.y) )
+			maxAxis = 2;
+		else
+			maxAxis = 1;
+	}
+
+	ComputeInterval(tri1,direction,maxAxis,distTri1ToPlane,t0);
+	ComputeInterval(tri2,direction,maxAxis,distTri2ToPlane,t1);
+
+	if( GREATER(t0[0] , t1[1]) || LESS(t0[1] , t1[0]) )
+		return false;
+	return true;
+}
+
+/*
+	صжǷص
+*/
+
+bool Tri3DOverlapTestTri3D_Moller(const Triangle3D& tri1,const Triangle3D& tri2)
+{
+	Vector3D tri1Normal,tri2Normal;
+	Real d, d0, d1;
+
+	//ʼtri1ڵƽ
+	tri1Normal = (tri1.mPoint[1] - tri1.mPoint[0]).cross(tri1.mPoint[2] - tri1.mPoint[0]);
+	d = -tri1Normal.dot(tri1.mPoint[0]);
+
+	Real distTri2ToPlane[3] , distTri1ToPlane[3];
+	//tri2ϵ㵽tri1ڵƽзž
+	distTri2ToPlane[0] = tri1Normal.dot(tri2.mPoint[0]) + d;
+	distTri2ToPlane[1] = tri1Normal.dot(tri2.mPoint[1]) + d;
+	distTri2ToPlane[2] = tri1Normal.dot(tri2.mPoint[2]) + d;
+
+	//жзžǷǸ
+	d0 = distTri2ToPlane[0]*distTri2ToPlane[1];
+	d1 = distTri2ToPlane[1]*distTri2ToPlane[2];
+	if( GREATER(d0,0) && GREATER(d1,0) )
+		return false;
+
+	if( EQUAL(distTri2ToPlane[0],0) && EQUAL(distTri2ToPlane[1],0) && EQUAL(distTri2ToPlane[2],0) )
+	{//The two triangles are coplanar.
+		return Tri3DOverlapTestTri3D_Coplanar(tri1,tri2,tri1Normal);
+	}
+	//ʼtri2ڵƽ
+	tri2Normal = (tri2.mPoint[1] - tri2.mPoint[0]).cross(tri2.mPoint[2] - tri2.mPoint[0]);
+	d = -tri2Normal.dot(tri2.mPoint[0]);
+
+	//tri1ϵ㵽tri2ڵƽзž
+	distTri1ToPlane[0] = tri2Normal.dot(tri1.mPoint[0]) + d;
+	distTri1ToPlane[1] = tri2Normal.dot(tri1.mPoint[1]) + d;
+	distTri1ToPlane[2] = tri2Normal.dot(tri1.mPoint[2]) + d;
+
+	//жзžǷ
+	d0 = distTri1ToPlane[0]*distTri1ToPlane[1];
+	d1 = distTri1ToPlane[1]*distTri1ToPlane[2];
+	if( GREATER(d0,0) && GREATER(d1,0) )
+		return false;
+
+	return Tri3DOverlapTestTri3D_MollerInterval(tri1,tri2,tri1Normal,tri2Normal,distTri1ToPlane,distTri2ToPlane);
+}
+
+
+static Real Determinant(const Point3D& p0,const Point3D& p1,const Point3D& p2,const Point3D& p3)
+{
+	return (p3-p0).dot((p1-p0).cross(p2-p0));
+}
+
+static void ReorderVertex(Real* distTriToPlane, int* index)
+{
+	index[0] = 0;index[1] = 1;index[2] = 2;
+	//sort the dist by using the index table.
+	int sole = 0 ;
+	if( LESS(distTriToPlane[1],distTriToPlane[sole]) )
+		sole = 1;
+	if( LESS(distTriToPlane[2],distTriToPlane[sole]) )
+		sole = 2;
+	int tmp1 = (sole + 1) % 3, tmp2 = (sole + 2) % 3;
+
+	if( EQUAL(distTriToPlane[sole],0) )
+	{
+		if( EQUAL(distTriToPlane[tmp1],0) )
+			sole = tmp2;
+		else if( EQUAL(distTriToPlane[tmp2],0) )
+			sole = tmp1;
+	}
+	else
+	{
+		if( LESS(distTriToPlane[tmp1],0) )
+			sole = tmp2;
+		else if( LESS(distTriToPlane[tmp2],0) )
+			sole = tmp1;
+	}
+
+	index[0] =  sole;
+	index[1] = (sole + 1) % 3;
+	index[2] = (sole + 2) % 3;
+}
+
+
+static void Transposition(Real*distTri1ToPlane,int *tri1Index,
+				   Real*distTri2ToPlane,int* tri2Index)
+{
+	int tmpIndex;
+	if( EQUAL(distTri1ToPlane[tri1Index[0]],0) )
+	{
+		if( GREATER(distTri1ToPlane[tri1Index[1]] , 0) )
+		{
+			tmpIndex = tri2Index[1];
+			tri2Index[1] = tri2Index[2];
+			tri2Index[2] = tmpIndex;
+		}
+	}
+	else
+	{
+		if( LESS(distTri1ToPlane[tri1Index[0]] , 0) )
+		{
+			tmpIndex = tri2Index[1];
+			tri2Index[1] = tri2Index[2];
+			tri2Index[2] = tmpIndex;
+		}
+	}
+
+	if( EQUAL(distTri2ToPlane[tri2Index[0]],0) )
+	{
+		if( GREATER(distTri2ToPlane[tri2Index[1]] , 0) )
+		{
+			tmpIndex = tri1Index[1];
+			tri1Index[1] = tri1Index[2];
+			tri1Index[2] = tmpIndex;
+		}
+	}
+	else
+	{
+		if( LESS(distTri2ToPlane[tri2Index[0]] , 0) )
+		{
+			tmpIndex = tri1Index[1];
+			tri1Index[1] = tri1Index[2];
+			tri1Index[2] = tmpIndex;
+		}
+	}
+}
+
+/*
+\brief	Guigue㷨ĶţεĶ˳ʹindexTri[0]ǵλƽһĶ
+*/
+static void Tri3DOverlapTestTri3D_GuigueOrder(Real* distTri1ToPlane,int* indexTri1,Real* distTri2ToPlane,int* indexTri2)
+{
+	ReorderVertex(distTri1ToPlane,indexTri1);
+	ReorderVertex(distTri2ToPlane,indexTri2);
+	Transposition(distTri1ToPlane,indexTri1,distTri2ToPlane,indexTri2);
+}
+
+bool Tri3DOverlapTestTri3D_Guigue(const Triangle3D& tri1,const Triangle3D& tri2)
+{
+	Vector3D tri1Normal,tri2Normal;
+	tri1Normal = (tri1.mPoint[1] - tri1.mPoint[0]).cross(tri1.mPoint[2] - tri1.mPoint[0]);
+	Real distTri2ToPlane[3] , distTri1ToPlane[3];
+	distTri2ToPlane[0] = tri1Normal.dot(tri2.mPoint[0] - tri1.mPoint[0]);
+	distTri2ToPlane[1] = tri1Normal.dot(tri2.mPoint[1] - tri1.mPoint[0]);
+	distTri2ToPlane[2] = tri1Normal.dot(tri2.mPoint[2] - tri1.mPoint[0]);
+	Real d0 = distTri2ToPlane[0]*distTri2ToPlane[1];
+	Real d1 = distTri2ToPlane[1]*distTri2ToPlane[2];
+	if( GREATER(d0,0) && GREATER(d1,0) )
+		return false;
+
+	if( EQUAL(distTri2ToPlane[0],0) && EQUAL(distTri2ToPlane[1],0) && EQUAL(distTri2ToPlane[2],0) )
+	{//The two triangles are coplanar.
+		return Tri3DOverlapTestTri3D_Coplanar(tri1,tri2,tri1Normal);
+	}
+	tri2Normal = (tri2.mPoint[1] - tri2.mPoint[0]).cross(tri2.mPoint[2] - tri2.mPoint[0]);
+	distTri1ToPlane[0] = tri2Normal.dot(tri1.mPoint[0] - tri2.mPoint[0]);
+	distTri1ToPlane[1] = tri2Normal.dot(tri1.mPoint[1] - tri2.mPoint[0]);
+	distTri1ToPlane[2] = tri2Normal.dot(tri1.mPoint[2] - tri2.mPoint[0]);
+
+	d0 = distTri1ToPlane[0]*distTri1ToPlane[1];
+	d1 = distTri1ToPlane[1]*distTri1ToPlane[2];
+	if( GREATER(d0,0) && GREATER(d1,0) )
+		return false;
+
+	int indexTri1[3] , indexTri2[3];
+	Tri3DOverlapTestTri3D_GuigueOrder(distTri1ToPlane,indexTri1,distTri2ToPlane,indexTri2);
+
+	Real d;
+	d = Determinant(tri2.mPoint[indexTri2[0]],tri2.mPoint[indexTri2[1]],tri1.mPoint[indexTri1[0]],tri1.mPoint[indexTri1[1]]);
+	if( GREATER(d,0) )
+		return false;
+	d = Determinant(tri2.mPoint[indexTri2[0]],tri2.mPoint[indexTri2[2]],tri1.mPoint[indexTri1[2]],tri1.mPoint[indexTri1[0]]);
+	if( GREATER(d,0) )
+		return false;
+	return true;
+}
+
+bool Tri3DOverlapTestTri3D_Naive(const SrTriangle3D& tri1,const SrTriangle3D& tri2)
+{
+	SrVector3D tri1Normal,tri2Normal;
+	SrReal d;
+	tri1Normal = (tri1.mPoint[1] - tri1.mPoint[0]).cross(tri1.mPoint[2] - tri1.mPoint[0]);
+	d = -tri1Normal.dot(tri1.mPoint[0]);
+
+	SrReal distTri2ToPlane[3],distTri1ToPlane[3];
+	distTri2ToPlane[0] = tri1Normal.dot(tri2.mPoint[0]) + d;
+	distTri2ToPlane[1] = tri1Normal.dot(tri2.mPoint[1]) + d;
+	distTri2ToPlane[2] = tri1Normal.dot(tri2.mPoint[2]) + d;
+	SrReal d0 = distTri2ToPlane[0] * distTri2ToPlane[1];
+	SrReal d1 = distTri2ToPlane[1] * distTri2ToPlane[2];
+	//The three vertex of triangle tri2 is on the same side of the plane initialized by triangle tri1.
+	if( GREATER(d0,0) && GREATER(d1,0) )
+		return false;
+
+	if( EQUAL(distTri2ToPlane[0],0) && EQUAL(distTri2ToPlane[1],0) && EQUAL(distTri2ToPlane[2],0) )
+	{//The two triangles are coplanar.
+		return Tri3DOverlapTestTri3D_Coplanar(tri1,tri2,tri1Normal);
+	}
+
+	tri2Normal = (tri2.mPoint[1] - tri2.mPoint[0]).cross(tri2.mPoint[2] - tri2.mPoint[0]);
+	d = -tri2Normal.dot(tri2.mPoint[0]);
+	distTri1ToPlane[0] = tri2Normal.dot(tri1.mPoint[0]) + d;
+	distTri1ToPlane[1] = tri2Normal.dot(tri1.mPoint[1]) + d;
+	distTri1ToPlane[2] = tri2Normal.dot(tri1.mPoint[2]) + d;
+
+	d0 = distTri1ToPlane[0]*distTri1ToPlane[1];
+	d1 = distTri1ToPlane[1]*distTri1ToPlane[2];
+
+	if( GREATER(d0,0) && GREATER(d1,0) )
+		return false;
+	int i;
+	for( i=0 ; i<3 ; i++ )
+	{
+		if( tri2.segmentHitTest(tri1.mPoint[i], tri1.mPoint[(i+1)%3]) == SR_INTERSECTING )
+			return true;
+	}
+	for( i=0 ; i<3 ; i++ )
+	{
+		if( tri1.segmentHitTest(tri2.mPoint[i], tri2.mPoint[(i+1)%3])==SR_INTERSECTING )
+			return true;
+	}
+	return false;
+}
+
+
+static void ComputeIntersection(const SrTriangle3D& triangle,SrReal* distTriToPlane,const SrVector3D& normal,SrReal d,SrPoint3D* outPoint)
+{
+	int indx[3];
+	//sort the dist by using the index table.
+	int minIndex = 0 , tmpIndx;
+	if( LESS(distTriToPlane[1],distTriToPlane[minIndex]) )
+		minIndex = 1;
+	if( LESS(distTriToPlane[2],distTriToPlane[minIndex]) )
+		minIndex = 2;
+	int tmp1 = (minIndex + 1)%3, tmp2 = (minIndex + 2)%3;
+	indx[0] = minIndex;
+	if( LESS(distTriToPlane[tmp1],distTriToPlane[tmp2]) )
+	{
+		indx[1] = tmp1;
+		indx[2] = tmp2;
+	}
+	else
+	{
+		indx[1] = tmp2;
+		indx[2] = tmp1;;
+	}
+
+	if( EQUAL(distTriToPlane[indx[1]],0) )
+	{
+		if( EQUAL(distTriToPlane[indx[0]],0) )
+		{
+			outPoint[0] = triangle.mPoint[indx[0]];
+			outPoint[1] = triangle.mPoint[indx[1]];
+			return;
+		}
+		else if( EQUAL(distTriToPlane[indx[2]],0) )
+		{
+			outPoint[0] = triangle.mPoint[indx[1]];
+			outPoint[1] = triangle.mPoint[indx[2]];
+			return;
+		}
+	}
+	else if( LESS(distTriToPlane[indx[1]],0) )
+	{
+		tmpIndx = indx[0];
+		indx[0] = indx[2];
+		indx[2] = tmpIndx;
+	}
+	SrVector3D direction = triangle.mPoint[indx[1]] - triangle.mPoint[indx[0]];
+	SrReal denom = direction.dot(normal);
+	SrReal t = -(d + normal.dot(triangle.mPoint[indx[0]])) / denom;
+	outPoint[0] = triangle.mPoint[indx[0]] + t*direction;
+
+	direction = triangle.mPoint[indx[2]] - triangle.mPoint[indx[0]];
+	denom = direction.dot(normal);
+	t = -(d + normal.dot(triangle.mPoint[indx[0]])) / denom;
+	outPoint[1] = triangle.mPoint[indx[0]] + t*direction;
+}
+bool Tri3DOverlapTestTri3D_ERIT(const SrTriangle3D& tri1,const SrTriangle3D& tri2)
+{
+	SrVector3D tri1Normal,tri2Normal;
+	SrReal tri1d,tri2d;
+	tri1Normal = (tri1.mPoint[1] - tri1.mPoint[0]).cross(tri1.mPoint[2] - tri1.mPoint[0]);
+	tri1d = -tri1Normal.dot(tri1.mPoint[0]);
+
+	SrReal distTri2ToPlane[3] , distTri1ToPlane[3];
+	distTri2ToPlane[0] = tri1Normal.dot(tri2.mPoint[0]) + tri1d;
+	distTri2ToPlane[1] = tri1Normal.dot(tri2.mPoint[1]) + tri1d;
+	distTri2ToPlane[2] = tri1Normal.dot(tri2.mPoint[2]) + tri1d;
+
+	SrReal d0 = distTri2ToPlane[0] * distTri2ToPlane[1];
+	SrReal d1 = distTri2ToPlane[1] * distTri2ToPlane[2];
+	//The three vertex of triangle tri2 is on the same side of the plane initialized by triangle tri1.
+	if( GREATER(d0,0) && GREATER(d1,0) )
+	{
+		//printf("first\n");
+		return false;
+	}
+
+	if( EQUAL(distTri2ToPlane[0],0) && EQUAL(distTri2ToPlane[1],0) && EQUAL(distTri2ToPlane[2],0) )
+	{//The two triangles are coplanar.
+		return Tri3DOverlapTestTri3D_Coplanar(tri1,tri2,tri1Normal);
+	}
+	tri2Normal = (tri2.mPoint[1] - tri2.mPoint[0]).cross(tri2.mPoint[2] - tri2.mPoint[0]);
+	tri2d = -tri2Normal.dot(tri2.mPoint[0]);
+	distTri1ToPlane[0] = tri2Normal.dot(tri1.mPoint[0]) + tri2d;
+	distTri1ToPlane[1] = tri2Normal.dot(tri1.mPoint[1]) + tri2d;
+	distTri1ToPlane[2] = tri2Normal.dot(tri1.mPoint[2]) + tri2d;
+
+	d0 = distTri1ToPlane[0]*distTri1ToPlane[1];
+	d1 = distTri1ToPlane[1]*distTri1ToPlane[2];
+
+	if( GREATER(d0,0) && GREATER(d1,0) )
+	{
+		//printf("GREATER(d0,0) && GREATER(d1,0)\n");
+		return false;
+	}
+
+	SrPoint3D inPoint[2];
+	SrPoint2D point[3];
+	SrPoint2D p0, p1;
+	ComputeIntersection(tri2,distTri2ToPlane,tri1Normal,tri1d,inPoint);
+	int axis = GetMaximumAxis(tri1Normal) , i;
+	Point3DToPoint2D(inPoint[0],p0,axis);
+	Point3DToPoint2D(inPoint[1],p1,axis);
+	Point3DToPoint2D(tri1.mPoint,3,point,axis);
+	int status = PointTriangleRelation(point,p0);
+	if( status != OUTSIDE )
+		return true;
+	for( i=0 ; i<3 ; i++ )
+	{
+		if(Seg2DIntersectSeg2D(p0,p1,point[i],point[(i+1)%3]))
+			return true;
+	}
+	//printf("return false;\n");
+	return false;
+}
+
+/**
+\brief  ƽϵĶά㻹ԭƽnormal.dot(p) + d = 0ϵά㣬Point3DToPoint2D
+*/
+static void Point2DToPoint3D(const Point2D& point,const Vector3D& normal,Real d,int axis,Point3D& result)
+{
+	if(axis == AXIS_X)
+	{
+		result.y = point.x;
+		result.z = point.y;
+		result.x = -(d + normal.y*result.y + normal.z*result.z) / normal.x;
+	}
+	else if(axis == AXIS_Y)
+	{
+		result.z = point.x;
+		result.x = point.y;
+		result.y = -(d + normal.z*result.z + normal.x*result.x) / normal.y;
+	}
+	else
+	{
+		result.x = point.x;
+		result.y = point.y;
+		result.z = -(d + normal.x*result.x + normal.y*result.y) / normal.z;
+	}
+}
+
+/*
+	üжζÿüʹӱ
+*/
+#define MAX_CLIP_VERTEX		(8*SR_TRI3D_MAX_INTERSECTION)
+
+/*
+\brief	ڶάռϣtri1ütri2Sutherland-Hodgman㷨õص͹Ρ
+\return	صεĶ0ʾص
+*/
+static int Tri2DClipTri2D(const Point2D* tri1,const Point2D* tri2,Point2D* result)
+{
+	Point2D buffer[2][MAX_CLIP_VERTEX];
+	Point2D *input = buffer[0] , *output = buffer[1] , *tmp;
+	Vector2D edge;
+	Real orient = (tri1[1] - tri1[0]).cross(tri1[2] - tri1[0])>0 ? (Real)1.0 : (Real)-1.0;
+	Real dp , dq;
+	int numInput = 3 , numOutput , i , j;
+	input[0] = tri2[0];
+	input[1] = tri2[1];
+	input[2] = tri2[2];
+	for( i=0 ; i<3 && numInput>0 ; i++ )
+	{
+		edge = tri1[(i+1)%3] - tri1[i];
+		numOutput = 0;
+		for( j=0 ; j<numInput ; j++ )
+		{
+			const Point2D& p = input[j];
+			const Point2D& q = input[(j+1)%numInput];
+			dp = orient*edge.cross(p - tri1[i]);
+			dq = orient*edge.cross(q - tri1[i]);
+			if( GEQUAL(dp,0) )
+				output[numOutput++] = p;
+			if( GEQUAL(dp,0) != GEQUAL(dq,0) )
+				output[numOutput++] = p + (q - p)*(dp/(dp - dq));
+		}
+		tmp = input;
+		input = output;
+		output = tmp;
+		numInput = numOutput;
+	}
+
+	//ȥظĶ
+	int numResult = 0;
+	for( i=0 ; i<numInput ; i++ )
+	{
+		if( numResult>0 && EQUAL(input[i].x,result[numResult-1].x) && EQUAL(input[i].y,result[numResult-1].y) )
+			continue;
+		ASSERT(numResult<SR_TRI3D_MAX_INTERSECTION);
+		if( numResult==SR_TRI3D_MAX_INTERSECTION )
+			break;
+		result[numResult++] = input[i];
+	}
+	while( numResult>1 && EQUAL(result[0].x,result[numResult-1].x) && EQUAL(result[0].y,result[numResult-1].y) )
+		numResult --;
+	return numResult;
+}
+
+static int Tri3DIntersectTri3D_Coplanar(const SrTriangle3D& tri1,const SrTriangle3D& tri2,const SrVector3D& tri1Normal,SrReal tri1d,SrPoint3D* result,int& numPoint)
+{
+	Point2D point1[3] , point2[3] , polygon[SR_TRI3D_MAX_INTERSECTION];
+	int axis = GetMaximumAxis(tri1Normal) , i;
+	Point3DToPoint2D(tri1.mPoint,3,point1,axis);
+	Point3DToPoint2D(tri2.mPoint,3,point2,axis);
+	numPoint = Tri2DClipTri2D(point1,point2,polygon);
+	if( numPoint==0 )
+		return SR_DISJOINT;
+	for( i=0 ; i<numPoint ; i++ )
+		Point2DToPoint3D(polygon[i],tri1Normal,tri1d,axis,result[i]);
+	return SR_OVERLAPPING;
+}
+
+int Tri3DIntersectTri3D(const SrTriangle3D& tri1,const SrTriangle3D& tri2,SrPoint3D* result,int& numPoint)
+{
+	numPoint = 0;
+	SrVector3D tri1Normal,tri2Normal;
+	SrReal tri1d,tri2d;
+	tri1Normal = (tri1.mPoint[1] - tri1.mPoint[0]).cross(tri1.mPoint[2] - tri1.mPoint[0]);
+	tri1d = -tri1Normal.dot(tri1.mPoint[0]);
+
+	SrReal distTri2ToPlane[3] , distTri1ToPlane[3];
+	distTri2ToPlane[0] = tri1Normal.dot(tri2.mPoint[0]) + tri1d;
+	distTri2ToPlane[1] = tri1Normal.dot(tri2.mPoint[1]) + tri1d;
+	distTri2ToPlane[2] = tri1Normal.dot(tri2.mPoint[2]) + tri1d;
+
+	SrReal d0 = distTri2ToPlane[0] * distTri2ToPlane[1];
+	SrReal d1 = distTri2ToPlane[1] * distTri2ToPlane[2];
+	if( GREATER(d0,0) && GREATER(d1,0) )
+		return SR_DISJOINT;
+
+	if( EQUAL(distTri2ToPlane[0],0) && EQUAL(distTri2ToPlane[1],0) && EQUAL(distTri2ToPlane[2],0) )
+	{//The two triangles are coplanar.
+		return Tri3DIntersectTri3D_Coplanar(tri1,tri2,tri1Normal,tri1d,result,numPoint);
+	}
+	tri2Normal = (tri2.mPoint[1] - tri2.mPoint[0]).cross(tri2.mPoint[2] - tri2.mPoint[0]);
+	tri2d = -tri2Normal.dot(tri2.mPoint[0]);
+	distTri1ToPlane[0] = tri2Normal.dot(tri1.mPoint[0]) + tri2d;
+	distTri1ToPlane[1] = tri2Normal.dot(tri1.mPoint[1]) + tri2d;
+	distTri1ToPlane[2] = tri2Normal.dot(tri1.mPoint[2]) + tri2d;
+
+	d0 = distTri1ToPlane[0]*distTri1ToPlane[1];
+	d1 = distTri1ToPlane[1]*distTri1ToPlane[2];
+	if( GREATER(d0,0) && GREATER(d1,0) )
+		return SR_DISJOINT;
+
+	//ԷƽĽ߶Σλƽֱཻ
+	SrPoint3D seg1[2] , seg2[2] , tmpPoint;
+	ComputeIntersection(tri1,distTri1ToPlane,tri2Normal,tri2d,seg1);
+	ComputeIntersection(tri2,distTri2ToPlane,tri1Normal,tri1d,seg2);
+
+	//ѽ߶ͶӰֱཻϣȽǷص
+	SrVector3D direction = tri1Normal.cross(tri2Normal);
+	SrReal t1[2] , t2[2] , tm;
+	t1[0] = direction.dot(seg1[0]);
+	t1[1] = direction.dot(seg1[1]);
+	t2[0] = direction.dot(seg2[0]);
+	t2[1] = direction.dot(seg2[1]);
+	if( t1[0]>t1[1] )
+	{
+		tm = t1[0]; t1[0] = t1[1]; t1[1] = tm;
+		tmpPoint = seg1[0]; seg1[0] = seg1[1]; seg1[1] = tmpPoint;
+	}
+	if( t2[0]>t2[1] )
+	{
+		tm = t2[0]; t2[0] = t2[1]; t2[1] = tm;
+		tmpPoint = seg2[0]; seg2[0] = seg2[1]; seg2[1] = tmpPoint;
+	}
+	if( GREATER(t1[0],t2[1]) || GREATER(t2[0],t1[1]) )
+		return SR_DISJOINT;
+
+	result[0] = t1[0]>t2[0] ? seg1[0] : seg2[0];
+	result[1] = t1[1]<t2[1] ? seg1[1] : seg2[1];
+	numPoint = 2;
+	return SR_INTERSECTING;
+}
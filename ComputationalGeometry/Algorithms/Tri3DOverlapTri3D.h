@@ -0,0 +1,201 @@
+/************************************************************************
+\link	www.twinklingstar.cn
+\author Twinkling Star
+\date	2014/04/20
+****************************************************************************/
+#ifndef SR_ALGORITHMS_TRI3D_OVERLAP_TRI3D_H_
+#define SR_ALGORITHMS_TRI3D_OVERLAP_TRI3D_H_
+
+/** \addtogroup algorithms
+  @{
+*/
+#include "SrGeometricTools.h"
+#include "SrDataType.h"
+
+/**
+\brief 3D triangle class.
+This is a 3D triangle class with public data members.
+*/
+class SrTriangle3D
+{
+public:
+	SrTriangle3D()
+	{
+		mPoint[0].set(0,0,0);
+		mPoint[1].set(0,0,0);
+		mPoint[2].set(0,0,0);
+	}
+	SrTriangle3D(const SrPoint3D& p0,const SrPoint3D& p1,const SrPoint3D& p2)
+	{
+		mPoint[0] = p0;
+		mPoint[1] = p1;
+		mPoint[2] = p2;
+	}
+	/**
+	\brief The triangle is valid if the three points are not on a line.
+	*/
+	bool isValid()
+	{
+		SrVector3D norm = (mPoint[1]-mPoint[0]).cross(mPoint[2]-mPoint[0]);
+		if( EQUAL(norm.x,0)&&EQUAL(norm.y,0)&&EQUAL(norm.z,0) )
+			return false;
+		return true;
+	}
+	/**
+	\brief  Judge whether the point is in the triangle or not.
+	\return SR_POSITION_ON		 if the point is on the edge; 
+			SR_POSITION_INSIDE  if inside the triangle and on the same plane; 
+			SR_POSITION_OUTSIDE if outside the triangle and on the same plane.
+			SR_POSITION_INVALID if not on the same plane.
+	*/
+	int		pointLocation(const SrPoint3D& p) const
+	{
+		//Judge whether the three points determine a plane or not.
+		SrVector3D norm = (mPoint[1] - mPoint[0]).cross(mPoint[2] - mPoint[0]);
+		if(EQUAL(norm.x,0) && EQUAL(norm.y,0) && EQUAL(norm.z,0))
+			return SR_POSITION_INVALID;
+		SrReal d = -norm.dot(mPoint[0]);
+		if( EQUAL(norm.dot(p) + d, 0) )
+			return SR_POSITION_INVALID;
+
+		SrReal flag1 = norm.dot((mPoint[1]-mPoint[0]).cross(p-mPoint[0]));
+		if( LESS(flag1,0) )
+			return SR_POSITION_OUTSIDE;
+		SrReal flag2 = norm.dot((mPoint[2]-mPoint[1]).cross(p-mPoint[1]));
+		if( LESS(flag2,0) )
+			return SR_POSITION_OUTSIDE;
+		SrVector3D tmp = (mPoint[0]-mPoint[2]).cross(p-mPoint[2]);
+		SrReal flag3 = norm.dot((mPoint[0]-mPoint[2]).cross(p-mPoint[2]));
+		if( LESS(flag3,0) )
+			return SR_POSITION_OUTSIDE;
+		if( EQUAL(flag1,0) || EQUAL(flag2,0) || EQUAL(flag3,0) )
+			return SR_POSITION_ON;
+		return SR_POSITION_INSIDE;
+	}
+	/**
+	\brief  Judge whether or not the segment hits the triangle.
+	\return SR_OVERLAPPING		 if the segment is on the plane where the triangle lies;
+			SR_PARALLEL			 if the segment is parallel to the triangle.
+			SR_SEPARATING		 if the segment misses the triangle;
+			SR_INTERSECTING		 if the segment intersects with the triangle and intersection point is not on the edge.
+	*/
+	int segmentHitTest(const SrPoint3D& p0, const SrPoint3D& p1)const
+	{
+		SrVector3D ret;
+		SrVector3D direction = p1 - p0;
+		int retFlag = linearIntersectTriangle(p0,direction,ret);
+		if( retFlag!=SR_INTERSECTING )
+			return retFlag;
+		//check t. 0<= t <=1
+		if( LESS(ret.z,0) || GREATER(ret.z,1) )
+			return SR_DISJOINT;
+		//check whether the intersection point is on the edge.
+		return SR_INTERSECTING;
+	}
+	/**
+	\brief  Judge whether or not the ray P+t*d (t>=0) hits the triangle.
+	\param[out] result (u,v,t), u and v are the barycentric coordinates of the hit point with respect to V1 and V2.
+	\return The same as segmentHitTest().
+	*/
+	int rayHitTest(const SrPoint3D& base,const SrVector3D& direction,SrVector3D& result)const
+	{
+		int retFlag = linearIntersectTriangle(base,direction,result);
+		if( retFlag!=SR_INTERSECTING )
+			return retFlag;
+		//check t. t>=0
+		if( LESS(result.z,0) )
+			return SR_DISJOINT;
+		return SR_INTERSECTING;
+	}
+public:
+	SrPoint3D mPoint[3];
+private:
+	/*
+	--------------------------------------------------------------------------
+	Devised by Moller and Trumbore,1997. <Fast,minimum storage ray-triangle 
+	intersection>
+	Any point in a triangle can be defined in terms of its position relative
+	to the triangles vertices:
+			Qu,v = (1-u-v)V0 + uV1 + vV2 ,0<=u<=1,0<=v<=1,0<=u+v<=1
+	For the linear componentCtriangle intersection,
+			P + t*^d = Qu,v
+	which can be expanded and applied Cramers rule to:
+			|t|							| |P-V0  V1-V0  V2-V0| |
+			|u| = 1/|-^d  V1-V0  V2-V0| | |-^d   P-V0   V2-V0| |
+			|v|							| |-^d   V1-V0   P-V0| |
+										
+											| ((P-V0)(V1-V0))(V2-V0) |
+				= 1/(^d(V2-v0))(V1-V0)	|    (^d(V2-V0))(P-V0)   |
+											|    ((P-V0)(V1-V0))^d	 |
+	--------------------------------------------------------------------------
+	*/
+	int linearIntersectTriangle(const SrPoint3D& base,const SrVector3D& direction,SrVector3D& result)const
+	{
+		SrReal u,v,tmp;
+		SrVector3D e1,e2,p,s,q;
+		e1 = mPoint[1] - mPoint[0];
+		e2 = mPoint[2] - mPoint[0];
+		p = direction.cross(e2);
+		tmp = p.dot(e1);
+		//If the line is perpendicular to the normal of triangle.
+		if( EQUAL(tmp,0) )
+		{
+			//The line is on the plane.
+			p = e1.cross(e2);
+			if( EQUAL(p.dot(base - mPoint[0]),0) )
+				return SR_OVERLAPPING;
+			//The line is parallel to the plane.
+			return SR_PARALLEL;
+		}
+		s=base - mPoint[0];
+		u = p.dot(s)/tmp;
+		if( LESS(u,0) || GREATER(u,1) )
+			return SR_DISJOINT;
+		q = s.cross(e1);
+		v = q.dot(direction)/tmp;
+		if( LESS(v,0) || GREATER(v,1) || GREATER(u+v,1) )
+			return SR_DISJOINT;
+
+		result.x = u;
+		result.y = v;
+		result.z = e2.dot(q)/tmp;
+		return SR_INTERSECTING;
+	}
+};
+
+/*
+	εĽ󶥵
+*/
+#define SR_TRI3D_MAX_INTERSECTION		6
+
+/*
+\brief	㷨жǷص
+*/
+bool Tri3DOverlapTestTri3D_Naive(const SrTriangle3D& tri1,const SrTriangle3D& tri2);
+/*
+\brief	ص(Moller㷨)жǷص
+*/
+bool Tri3DOverlapTestTri3D_Moller(const SrTriangle3D& tri1,const SrTriangle3D& tri2);
+/*
+\brief	Guigue㷨жǷص
+*/
+bool Tri3DOverlapTestTri3D_Guigue(const SrTriangle3D& tri1,const SrTriangle3D& tri2);
+/*
+\brief	ERIT㷨жǷص
+*/
+bool Tri3DOverlapTestTri3D_ERIT(const SrTriangle3D& tri1,const SrTriangle3D& tri2);
+/*
+\brief	εĽƽMoller㷨ͬβཻʱûжļ㣻
+		ͬһμеõʱԷƽĽ߶ֱཻϵص־ǽ߶Σ
+		ʱtri1ütri2õص͹Ρ
+\param[out]	result		㣬ҪSR_TRI3D_MAX_INTERSECTIONԪءSR_INTERSECTINGʱǽ߶ε˵㣬
+						˵ͬʾֻһ㣻SR_OVERLAPPINGʱصεĶ
+\param[out]	numPoint	ĸ
+\return	SR_DISJOINT		ཻ
+		SR_INTERSECTING	ཻ
+		SR_OVERLAPPING	ص
+*/
+int Tri3DIntersectTri3D(const SrTriangle3D& tri1,const SrTriangle3D& tri2,SrPoint3D* result,int& numPoint);
+
+/** @} */
+#endif
@@ -0,0 +1,245 @@
+/************************************************************************
+\link	www.twinklingstar.cn
+\author Twinkling Star
+\date	2026/10/19
+****************************************************************************/
+#include "Tri3DOverlapTri3DPacket.h"
+#include "SrSimd.h"
+#include <string.h>
+
+#define PACKET_WIDTH	SR_TRIANGLE_PACKET_WIDTH
+
+SrTriangle3DSoA::SrTriangle3DSoA()
+{
+	mBuffer		 = NULL;
+	mNumTriangle = 0;
+	memset(mCoord,0,sizeof(mCoord));
+}
+
+SrTriangle3DSoA::SrTriangle3DSoA(int numTriangle)
+{
+	mBuffer		 = NULL;
+	mNumTriangle = 0;
+	memset(mCoord,0,sizeof(mCoord));
+	allocate(numTriangle);
+}
+
+SrTriangle3DSoA::~SrTriangle3DSoA()
+{
+	if( mBuffer )
+		delete []mBuffer;
+}
+
+void SrTriangle3DSoA::allocate(int numTriangle)
+{
+	if( mBuffer )
+		delete []mBuffer;
+	int capacity = (numTriangle + SR_TRIANGLE_SOA_PADDING - 1) / SR_TRIANGLE_SOA_PADDING * SR_TRIANGLE_SOA_PADDING;
+	mBuffer = new SrReal[9*capacity];
+	memset(mBuffer,0,sizeof(SrReal)*9*capacity);
+	int v , c;
+	for( v=0 ; v<3 ; v++ )
+		for( c=0 ; c<3 ; c++ )
+			mCoord[v][c] = mBuffer + (v*3 + c)*capacity;
+	mNumTriangle = numTriangle;
+}
+
+void SrTriangle3DSoA::setTriangle(int i,const SrTriangle3D& tri)
+{
+	ASSERT(i>=0 && i<mNumTriangle);
+	int v;
+	for( v=0 ; v<3 ; v++ )
+	{
+		mCoord[v][0][i] = tri.mPoint[v].x;
+		mCoord[v][1][i] = tri.mPoint[v].y;
+		mCoord[v][2][i] = tri.mPoint[v].z;
+	}
+}
+
+const SrTriangle3D SrTriangle3DSoA::getTriangle(int i) const
+{
+	ASSERT(i>=0 && i<mNumTriangle);
+	return SrTriangle3D(SrPoint3D(mCoord[0][0][i],mCoord[0][1][i],mCoord[0][2][i]),
+						SrPoint3D(mCoord[1][0][i],mCoord[1][1][i],mCoord[1][2][i]),
+						SrPoint3D(mCoord[2][0][i],mCoord[2][1][i],mCoord[2][2][i]));
+}
+
+
+static SR_INLINE void CrossPacket(const SrSimdReal* u,const SrSimdReal* v,SrSimdReal* result)
+{
+	result[0] = SrSimd::sub(SrSimd::mul(u[1],v[2]),SrSimd::mul(u[2],v[1]));
+	result[1] = SrSimd::sub(SrSimd::mul(u[2],v[0]),SrSimd::mul(u[0],v[2]));
+	result[2] = SrSimd::sub(SrSimd::mul(u[0],v[1]),SrSimd::mul(u[1],v[0]));
+}
+
+static SR_INLINE SrSimdReal DotPacket(const SrSimdReal* u,const SrSimdReal* v)
+{
+	return SrSimd::add(SrSimd::add(SrSimd::mul(u[0],v[0]),SrSimd::mul(u[1],v[1])),SrSimd::mul(u[2],v[2]));
+}
+
+/*
+\brief	tri[k]tri[k + SR_SIMD_WIDTH - 1]ĵv
+*/
+static SR_INLINE void LoadVertexPacket(const SrTriangle3DSoA& tri,int v,int k,SrSimdReal* point)
+{
+	point[0] = SrSimd::load(tri.mCoord[v][0] + k);
+	point[1] = SrSimd::load(tri.mCoord[v][1] + k);
+	point[2] = SrSimd::load(tri.mCoord[v][2] + k);
+}
+
+static SR_INLINE void SubPacket(const SrSimdReal* u,const SrSimdReal* v,SrSimdReal* result)
+{
+	result[0] = SrSimd::sub(u[0],v[0]);
+	result[1] = SrSimd::sub(u[1],v[1]);
+	result[2] = SrSimd::sub(u[2],v[2]);
+}
+
+/*
+\brief	qƽзž롣Guigue㷨ʹnormal.dot(q - p0)Moller㷨ʹnormal.dot(q) + d
+		ֱ㷨ıʽ㣬Ա֤汾Ľλͬ
+*/
+template<bool isGuigue>
+static SR_INLINE SrSimdReal SignedDistancePacket(const SrSimdReal* normal,const SrSimdReal* p0,SrSimdReal d,SrSimdReal* q)
+{
+	if( !isGuigue )
+		return SrSimd::add(DotPacket(normal,q),d);
+	SubPacket(q,p0,q);
+	return DotPacket(normal,q);
+}
+
+/*
+\brief	other[k]㵽tri[k]ƽзž룬SR_SIMD_WIDTHζһ㡣
+		ѭչемԱڼĴС
+*/
+template<bool isGuigue>
+static SR_INLINE void PlaneDistancePacket(const SrTriangle3DSoA& tri,const SrTriangle3DSoA& other,int k,SrSimdReal* dist)
+{
+	SrSimdReal p0[3] , e1[3] , e2[3] , normal[3] , q[3] , d;
+	LoadVertexPacket(tri,0,k,p0);
+	LoadVertexPacket(tri,1,k,e1);
+	LoadVertexPacket(tri,2,k,e2);
+	SubPacket(e1,p0,e1);
+	SubPacket(e2,p0,e2);
+	CrossPacket(e1,e2,normal);
+	d = SrSimd::neg(DotPacket(normal,p0));
+
+	LoadVertexPacket(other,0,k,q);
+	dist[0] = SignedDistancePacket<isGuigue>(normal,p0,d,q);
+	LoadVertexPacket(other,1,k,q);
+	dist[1] = SignedDistancePacket<isGuigue>(normal,p0,d,q);
+	LoadVertexPacket(other,2,k,q);
+	dist[2] = SignedDistancePacket<isGuigue>(normal,p0,d,q);
+}
+
+/*
+\brief	㶼ƽͬһ࣬GREATER(d0,0) && GREATER(d1,0)
+*/
+static SR_INLINE SrSimdReal SameSidePacket(const SrSimdReal* dist)
+{
+	SrSimdReal zero = SrSimd::splat(0);
+	SrSimdReal d0 = SrSimd::mul(dist[0],dist[1]);
+	SrSimdReal d1 = SrSimd::mul(dist[1],dist[2]);
+	return SrSimd::andMask(SrSimd::greater(d0,zero),SrSimd::greater(d1,zero));
+}
+
+/*
+\brief	һݰƽ⣬ֻ汾зfalse֮ǰжϡ
+		ͨڱ汾веڶƽ⣬Ҳᱻڶμų
+		汾ֻͬеһμʣµͨʱżڶڵƽ档
+\return	ûбųͨЩζҪñ汾
+*/
+template<bool isGuigue>
+static SR_INLINE int PlaneFilterPacket(const SrTriangle3DSoA& tri1,const SrTriangle3DSoA& tri2,int first)
+{
+	SrSimdReal dist[3] , coplanar;
+	SrSimdReal zero = SrSimd::splat(0);
+	int result = 0 , h , k , numLane , live;
+	for( h=0 ; h<PACKET_WIDTH ; h+=SR_SIMD_WIDTH )
+	{
+		k = first + h;
+		numLane = tri1.mNumTriangle - k;
+		if( numLane<=0 )
+			break;
+		//tri2㵽tri1ƽзž
+		PlaneDistancePacket<isGuigue>(tri1,tri2,k,dist);
+		live = ~SrSimd::moveMask(SameSidePacket(dist));
+		if( numLane<SR_SIMD_WIDTH )
+			live &= (1<<numLane) - 1;
+		if( !(live & SR_SIMD_FULL_MASK) )
+			continue;
+		coplanar = SrSimd::andMask(SrSimd::andMask(SrSimd::equal(dist[0],zero),SrSimd::equal(dist[1],zero)),SrSimd::equal(dist[2],zero));
+		//tri1㵽tri2ƽзž
+		PlaneDistancePacket<isGuigue>(tri2,tri1,k,dist);
+		live &= ~SrSimd::moveMask(SrSimd::andNot(coplanar,SameSidePacket(dist)));
+		result |= (live & SR_SIMD_FULL_MASK) << h;
+	}
+	return result;
+}
+
+/*
+\brief	ݰûбƽųζ汾
+*/
+template<bool isGuigue>
+static int OverlapPacket(const SrTriangle3DSoA& tri1,const SrTriangle3DSoA& tri2,int first)
+{
+	ASSERT(tri1.mNumTriangle == tri2.mNumTriangle && first>=0 && first<tri1.mNumTriangle);
+	int mask = PlaneFilterPacket<isGuigue>(tri1,tri2,first);
+	int result = 0 , lane;
+	for( lane=0 ; mask ; lane++ , mask>>=1 )
+	{
+		if( !(mask & 1) )
+			continue;
+		if( isGuigue ? Tri3DOverlapTestTri3D_Guigue(tri1.getTriangle(first + lane),tri2.getTriangle(first + lane))
+					 : Tri3DOverlapTestTri3D_Moller(tri1.getTriangle(first + lane),tri2.getTriangle(first + lane)) )
+			result |= 1<<lane;
+	}
+	return result;
+}
+
+int Tri3DOverlapTestTri3D_GuiguePacket(const SrTriangle3DSoA& tri1,const SrTriangle3DSoA& tri2,int first)
+{
+	return OverlapPacket<true>(tri1,tri2,first);
+}
+
+int Tri3DOverlapTestTri3D_MollerPacket(const SrTriangle3DSoA& tri1,const SrTriangle3DSoA& tri2,int first)
+{
+	return OverlapPacket<false>(tri1,tri2,first);
+}
+
+/*
+\brief	һݰƽ⣬ʣµζԵѹoverlapIndexУ
+		ڶЩζԽб⣬صԭдoverlapIndexǰ档
+*/
+template<bool isGuigue>
+static int OverlapBatch(const SrTriangle3DSoA& tri1,const SrTriangle3DSoA& tri2,int* overlapIndex)
+{
+	ASSERT(tri1.mNumTriangle == tri2.mNumTriangle);
+	int first , mask , lane , i , k , numCandidate = 0 , count = 0;
+	for( first=0 ; first<tri1.mNumTriangle ; first+=PACKET_WIDTH )
+	{
+		mask = PlaneFilterPacket<isGuigue>(tri1,tri2,first);
+		for( lane=0 ; mask ; lane++ , mask>>=1 )
+		{
+			if( mask & 1 )
+				overlapIndex[numCandidate++] = first + lane;
+		}
+	}
+	for( k=0 ; k<numCandidate ; k++ )
+	{
+		i = overlapIndex[k];
+		if( isGuigue ? Tri3DOverlapTestTri3D_Guigue(tri1.getTriangle(i),tri2.getTriangle(i))
+					 : Tri3DOverlapTestTri3D_Moller(tri1.getTriangle(i),tri2.getTriangle(i)) )
+			overlapIndex[count++] = i;
+	}
+	return count;
+}
+
+int Tri3DOverlapTestTri3D_GuigueBatch(const SrTriangle3DSoA& tri1,const SrTriangle3DSoA& tri2,int* overlapIndex)
+{
+	return OverlapBatch<true>(tri1,tri2,overlapIndex);
+}
+
+int Tri3DOverlapTestTri3D_MollerBatch(const SrTriangle3DSoA& tri1,const SrTriangle3DSoA& tri2,int* overlapIndex)
+{
+	return OverlapBatch<false>(tri1,tri2,overlapIndex);
+}
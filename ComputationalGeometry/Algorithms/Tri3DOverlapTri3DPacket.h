@@ -0,0 +1,83 @@
+/************************************************************************
+\link	www.twinklingstar.cn
+\author Twinkling Star
+\date	2026/10/19
+****************************************************************************/
+#ifndef SR_ALGORITHMS_TRI3D_OVERLAP_TRI3D_PACKET_H_
+#define SR_ALGORITHMS_TRI3D_OVERLAP_TRI3D_PACKET_H_
+
+/** \addtogroup algorithms
+  @{
+*/
+#include "Tri3DOverlapTri3D.h"
+
+/*
+	һݰаζԵĸSSE2ĴĿ
+*/
+#define SR_TRIANGLE_PACKET_WIDTH		4
+/*
+	SoA鲹ȣ󽻵ݰһζ8
+*/
+#define SR_TRIANGLE_SOA_PADDING			8
+
+/**
+\brief 3D triangles stored as a structure of arrays (SoA).
+
+mCoord[v][c][i] is the c-th coordinate (0:x,1:y,2:z) of the v-th vertex of
+the i-th triangle. The arrays are padded with zeros to a multiple of
+SR_TRIANGLE_SOA_PADDING, so a packet can always be loaded as a whole.
+*/
+class SrTriangle3DSoA
+{
+public:
+	SrTriangle3DSoA();
+	SrTriangle3DSoA(int numTriangle);
+	~SrTriangle3DSoA();
+	/**
+	\brief Allocate the arrays for numTriangle triangles, the old data is released.
+	*/
+	void				allocate(int numTriangle);
+	void				setTriangle(int i,const SrTriangle3D& tri);
+	const SrTriangle3D	getTriangle(int i) const;
+
+public:
+	SrReal*		mCoord[3][3];
+	int			mNumTriangle;
+
+private:
+	SrTriangle3DSoA(const SrTriangle3DSoA&);
+	SrTriangle3DSoA& operator=(const SrTriangle3DSoA&);
+
+	SrReal*		mBuffer;
+};
+
+/*
+\brief	Guigue㷨ݰ汾ͬʱζ[first, first + SR_TRIANGLE_PACKET_WIDTH)Ƿص
+		εƽżSSE2ĴжݰУųζͨѹ
+		ʣµζTri3DOverlapTestTri3D_GuigueÿζԵĽ汾ȫͬ
+\param[in]	tri1	һ
+\param[in]	tri2	ڶΣtri1ĸͬ
+\param[in]	first	ݰеһζԵ
+\return	λ룬iλΪ1ʾζfirst + iص
+*/
+int Tri3DOverlapTestTri3D_GuiguePacket(const SrTriangle3DSoA& tri1,const SrTriangle3DSoA& tri2,int first);
+/*
+\brief	Moller㷨ݰ汾ʣµζԵTri3DOverlapTestTri3D_Mollerֵĺ
+		Tri3DOverlapTestTri3D_GuiguePacketͬ
+*/
+int Tri3DOverlapTestTri3D_MollerPacket(const SrTriangle3DSoA& tri1,const SrTriangle3DSoA& tri2,int first);
+
+/*
+\brief	еζ(tri1[i],tri2[i])Guigue㷨ݰƽ⣬ûбųζԵ
+		ѹoverlapIndexУٶЩζб⡣
+\param[out]	overlapIndex	صζԵСУҪtri1.mNumTriangleԪ
+\return	صζԵĸ
+*/
+int Tri3DOverlapTestTri3D_GuigueBatch(const SrTriangle3DSoA& tri1,const SrTriangle3DSoA& tri2,int* overlapIndex);
+/*
+\brief	еζ(tri1[i],tri2[i])Moller㷨
+*/
+int Tri3DOverlapTestTri3D_MollerBatch(const SrTriangle3DSoA& tri1,const SrTriangle3DSoA& tri2,int* overlapIndex);
+
+/** @} */
+#endif
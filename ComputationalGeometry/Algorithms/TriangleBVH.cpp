@@ -0,0 +1,250 @@
+/************************************************************************
+\link	www.twinklingstar.cn
+\author Twinkling Star
+\date	2026/10/19
+****************************************************************************/
+/************************************************************************
+\description	İΧΣʰȡɼԲѯ÷ͰSAH죬
+				ÿҶӽڵSoAռһݰߵҶʱ
+				Ray3DHitTestTriangle_PacketһβҶӣָ̡߰߳
+****************************************************************************/
+#include "TriangleBVH.h"
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#define PACKET_WIDTH	SR_RAY_TRIANGLE_PACKET_WIDTH
+
+/*
+	εAABBչıRay3DHitTestTriangleݲSR_EPS
+	ҲΪཻ㵽εľ벻SR_EPSԱ߳չ֮
+	߲ڰΧд޳
+*/
+static const SrReal BOX_PADDING = 1e-9;
+/*
+	Ϊ0ʱڴļСֵ0*inf
+*/
+static const SrReal TINY_DIRECTION = 1e-300;
+
+static SrReal InverseDirection(SrReal d)
+{
+	return 1.0 / (d==0 ? TINY_DIRECTION : d);
+}
+
+SrTriangleBVH::SrTriangleBVH()
+{
+}
+
+SrTriangleBVH::~SrTriangleBVH()
+{
+	release();
+}
+
+void SrTriangleBVH::release()
+{
+	mNode.clear();
+	mTriangle.allocate(0);
+	mTriangleIndex.clear();
+}
+
+void SrTriangleBVH::build(const SrPoint3D* vertex,const int* index,int numTriangle,int maxLeafSize)
+{
+	if( numTriangle<=0 )
+	{
+		release();
+		return;
+	}
+	SrTriangle3D* triangle = new SrTriangle3D[numTriangle];
+	int i;
+	for( i=0 ; i<numTriangle ; i++ )
+		triangle[i] = SrTriangle3D(vertex[index[3*i]],vertex[index[3*i + 1]],vertex[index[3*i + 2]]);
+	build(triangle,numTriangle,maxLeafSize);
+	delete []triangle;
+}
+
+void SrTriangleBVH::build(const SrTriangle3D* triangle,int numTriangle,int maxLeafSize)
+{
+	ASSERT(maxLeafSize>0 && maxLeafSize<=PACKET_WIDTH);
+	release();
+	if( numTriangle<=0 )
+		return;
+
+	SrPoint3D* minPoint = new SrPoint3D[numTriangle];
+	SrPoint3D* maxPoint = new SrPoint3D[numTriangle];
+	SrPoint3D* centroid = new SrPoint3D[numTriangle];
+	std::vector<int> order(numTriangle);
+	SrVector3D extent;
+	SrReal pad;
+	int i , node , slot , numSlot;
+	for( i=0 ; i<numTriangle ; i++ )
+	{
+		minPoint[i] = triangle[i].mPoint[0];
+		maxPoint[i] = triangle[i].mPoint[0];
+		minPoint[i].min(triangle[i].mPoint[1]);
+		maxPoint[i].max(triangle[i].mPoint[1]);
+		minPoint[i].min(triangle[i].mPoint[2]);
+		maxPoint[i].max(triangle[i].mPoint[2]);
+		extent = maxPoint[i] - minPoint[i];
+		pad = BOX_PADDING*(1 + extent.x + extent.y + extent.z);
+		minPoint[i] -= SrVector3D(pad,pad,pad);
+		maxPoint[i] += SrVector3D(pad,pad,pad);
+		centroid[i] = (triangle[i].mPoint[0] + triangle[i].mPoint[1] + triangle[i].mPoint[2])/3;
+		order[i] = i;
+	}
+
+	mNode.reserve(2*numTriangle);
+	mNode.resize(1);
+	buildNode(0,0,numTriangle,0,maxLeafSize,order,minPoint,maxPoint,centroid);
+
+	//Ҷӽڵռöݰݰ˻β
+	numSlot = 0;
+	for( node=0 ; node<(int)mNode.size() ; node++ )
+	{
+		if( isLeaf(node) )
+			numSlot += (mNode[node].mCount + PACKET_WIDTH - 1) / PACKET_WIDTH * PACKET_WIDTH;
+	}
+	mTriangle.allocate(numSlot);
+	mTriangleIndex.assign(numSlot,-1);
+	slot = 0;
+	for( node=0 ; node<(int)mNode.size() ; node++ )
+	{
+		tTriangleBVHNode& current = mNode[node];
+		if( current.mCount==0 )
+			continue;
+		for( i=0 ; i<current.mCount ; i++ )
+		{
+			mTriangleIndex[slot + i] = order[current.mFirst + i];
+			mTriangle.setTriangle(slot + i,triangle[order[current.mFirst + i]]);
+		}
+		current.mFirst = slot;
+		slot += (current.mCount + PACKET_WIDTH - 1) / PACKET_WIDTH * PACKET_WIDTH;
+	}
+
+	delete []minPoint;
+	delete []maxPoint;
+	delete []centroid;
+}
+
+/*
+	ʱҶӽڵmFirstorderеλãbuild()ٻmTriangleеλ
+*/
+void SrTriangleBVH::buildNode(int node,int first,int count,int depth,int maxLeafSize,std::vector<int>& order,
+							  const SrPoint3D* minPoint,const SrPoint3D* maxPoint,const SrPoint3D* centroid)
+{
+	const int* index = &order[0] + first;
+	SrPoint3D boxMin = minPoint[index[0]] , boxMax = maxPoint[index[0]];
+	int i , axis;
+	for( i=1 ; i<count ; i++ )
+	{
+		boxMin.min(minPoint[index[i]]);
+		boxMax.max(maxPoint[index[i]]);
+	}
+	tTriangleBVHNode& current = mNode[node];
+	for( i=0 ; i<3 ; i++ )
+	{
+		current.mMin[i] = boxMin[i];
+		current.mMax[i] = boxMax[i];
+	}
+	current.mFirst = first;
+	current.mCount = count;
+	current.mAxis  = 0;
+	if( count<=maxLeafSize || depth>=SR_TRIANGLE_BVH_MAX_DEPTH - 1 )
+		return;
+
+	int numLeft = BVHPartitionSAH(&order[0] + first,count,minPoint,maxPoint,centroid,&axis);
+	int child = (int)mNode.size();
+	mNode.resize(child + 2);
+	mNode[node].mFirst = child;
+	mNode[node].mCount = 0;
+	mNode[node].mAxis  = axis;
+	buildNode(child,first,numLeft,depth + 1,maxLeafSize,order,minPoint,maxPoint,centroid);
+	buildNode(child + 1,first + numLeft,count - numLeft,depth + 1,maxLeafSize,order,minPoint,maxPoint,centroid);
+}
+
+/*
+\brief	ڵAABBĺ巨ԣֻ[0,best]֮䴩AABB߲Ҫڵ㡣
+*/
+static bool RayHitNode(const SrReal* base,const SrReal* invDirection,SrReal best,const tTriangleBVHNode& node)
+{
+	SrReal t1 , t2 , tNear = -SR_MAX_F64 , tFar = SR_MAX_F64;
+	int c;
+	for( c=0 ; c<3 ; c++ )
+	{
+		t1 = (node.mMin[c] - base[c])*invDirection[c];
+		t2 = (node.mMax[c] - base[c])*invDirection[c];
+		if( t1>t2 )
+		{
+			SrReal tmp = t1;
+			t1 = t2;
+			t2 = tmp;
+		}
+		if( t1>tNear )	tNear = t1;
+		if( t2<tFar )	tFar  = t2;
+	}
+	return tNear<=tFar && tFar>=0 && tNear<=best;
+}
+
+int SrTriangleBVH::intersect(const SrRay3D& ray,tRayTriangleHit& hit) const
+{
+	hit.mT		  = SR_MAX_F64;
+	hit.mU		  = 0;
+	hit.mV		  = 0;
+	hit.mTriangle = -1;
+	if( mNode.empty() )
+		return -1;
+	SrReal base[3] , invDirection[3];
+	SrReal t[PACKET_WIDTH] , u[PACKET_WIDTH] , v[PACKET_WIDTH];
+	int c , i , first , last , mask , top = 0 , near;
+	int stack[SR_TRIANGLE_BVH_MAX_DEPTH + 1];
+	for( c=0 ; c<3 ; c++ )
+	{
+		base[c]			= ray.mBase[c];
+		invDirection[c] = InverseDirection(ray.mDirection[c]);
+	}
+	stack[top++] = 0;
+	while( top>0 )
+	{
+		const tTriangleBVHNode& current = mNode[stack[--top]];
+		if( !RayHitNode(base,invDirection,hit.mT,current) )
+			continue;
+		if( current.mCount>0 )
+		{
+			last = current.mFirst + current.mCount;
+			for( first=current.mFirst ; first<last ; first+=PACKET_WIDTH )
+			{
+				mask = Ray3DHitTestTriangle_Packet(ray,mTriangle,first,t,u,v);
+				if( last - first<PACKET_WIDTH )
+					mask &= (1<<(last - first)) - 1;
+				//tСtͬεСʱµĽ
+				for( i=0 ; mask ; i++ , mask>>=1 )
+				{
+					if( (mask & 1) && (t[i]<hit.mT || (t[i]==hit.mT && mTriangleIndex[first + i]<hit.mTriangle)) )
+					{
+						hit.mT		  = t[i];
+						hit.mU		  = u[i];
+						hit.mV		  = v[i];
+						hit.mTriangle = mTriangleIndex[first + i];
+					}
+				}
+			}
+			continue;
+		}
+		//ȷ߷ϽϽӽڵ㣬Զӽڵջ
+		near = ray.mDirection[current.mAxis]<0 ? 1 : 0;
+		stack[top++] = current.mFirst + 1 - near;
+		stack[top++] = current.mFirst + near;
+	}
+	return hit.mTriangle;
+}
+
+int SrTriangleBVH::intersectBatch(const SrRay3D* ray,int numRay,tRayTriangleHit* hit) const
+{
+	int i , numHit = 0;
+#pragma omp parallel for schedule(dynamic,SR_RAY_TRIANGLE_TILE) reduction(+:numHit)
+	for( i=0 ; i<numRay ; i++ )
+	{
+		if( intersect(ray[i],hit[i])>=0 )
+			numHit ++;
+	}
+	return numHit;
+}
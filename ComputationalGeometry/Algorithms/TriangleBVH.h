@@ -0,0 +1,96 @@
+/************************************************************************
+\link	www.twinklingstar.cn
+\author Twinkling Star
+\date	2026/10/19
+****************************************************************************/
+#ifndef SR_ALGORITHMS_TRIANGLE_BVH_H_
+#define SR_ALGORITHMS_TRIANGLE_BVH_H_
+
+/** \addtogroup algorithms
+  @{
+*/
+#include "Ray3DHitTestTriangle.h"
+#include "MeshBVH.h"
+#include <vector>
+
+/*
+	ΧεȣȵĽڵֱΪҶӽڵ㣬ʱջ
+*/
+#define SR_TRIANGLE_BVH_MAX_DEPTH	64
+/*
+	߳ʱÿηָһ̵߳ߵĸڵӦͼڵ
+*/
+#define SR_RAY_TRIANGLE_TILE		64
+
+/**
+\brief A node of the triangle hierarchy, the box is an AABB.
+
+A leaf has mCount>0 triangles, which are the triangles mFirst,...,mFirst+mCount-1
+of mTriangle, mFirst is a multiple of SR_RAY_TRIANGLE_PACKET_WIDTH so the leaf
+starts a packet. Only the leaves at SR_TRIANGLE_BVH_MAX_DEPTH may have more than
+one packet. An internal node has mCount==0, its two children are mNode[mFirst]
+and mNode[mFirst+1], and mAxis is the axis perpendicular to the splitting plane.
+*/
+typedef struct
+{
+	SrReal		mMin[3];
+	SrReal		mMax[3];
+	int			mFirst;
+	int			mCount;
+	int			mAxis;
+}tTriangleBVHNode;
+
+/**
+\brief Bounding volume hierarchy over a triangle mesh for ray casting, built with binned SAH.
+
+Unlike SrMeshBVH, which is for the overlap test of two meshes, every leaf holds
+one packet of triangles in the SoA mTriangle, and the rays are tested against
+the whole leaf with Ray3DHitTestTriangle_Packet. mTriangleIndex maps the slots of
+mTriangle back to the indices of the array passed to build(), the padding slots
+of a leaf are -1. The nearest hit of a ray is the same as
+Ray3DHitTestTriangle_Closest on all the triangles.
+*/
+class SrTriangleBVH
+{
+public:
+	SrTriangleBVH();
+	~SrTriangleBVH();
+	/**
+	\brief Build the hierarchy, the old one is released.
+	\param[in] maxLeafSize The maximum number of triangles in a leaf, at most SR_RAY_TRIANGLE_PACKET_WIDTH.
+	*/
+	void					build(const SrTriangle3D* triangle,int numTriangle,int maxLeafSize = SR_RAY_TRIANGLE_PACKET_WIDTH);
+	/**
+	\brief Build the hierarchy of an indexed mesh, the i-th triangle is vertex[index[3i]],vertex[index[3i+1]],vertex[index[3i+2]].
+	*/
+	void					build(const SrPoint3D* vertex,const int* index,int numTriangle,int maxLeafSize = SR_RAY_TRIANGLE_PACKET_WIDTH);
+	void					release();
+
+	bool					isLeaf(int node) const	{ return mNode[node].mCount>0; }
+	/**
+	\brief The nearest hit of one ray.
+	\return The index of the triangle, -1 if the ray misses all the triangles.
+	*/
+	int						intersect(const SrRay3D& ray,tRayTriangleHit& hit) const;
+	/**
+	\brief The nearest hits of all the rays, the rays are distributed over the threads in tiles of SR_RAY_TRIANGLE_TILE rays.
+	\param[out] hit An array of numRay elements.
+	\return The number of rays that hit a triangle.
+	*/
+	int						intersectBatch(const SrRay3D* ray,int numRay,tRayTriangleHit* hit) const;
+
+public:
+	std::vector<tTriangleBVHNode>	mNode;
+	SrTriangle3DSoA					mTriangle;
+	std::vector<int>				mTriangleIndex;
+
+private:
+	SrTriangleBVH(const SrTriangleBVH&);
+	SrTriangleBVH& operator=(const SrTriangleBVH&);
+
+	void					buildNode(int node,int first,int count,int depth,int maxLeafSize,std::vector<int>& order,
+									  const SrPoint3D* minPoint,const SrPoint3D* maxPoint,const SrPoint3D* centroid);
+};
+
+/** @} */
+#endif
@@ -0,0 +1,280 @@
+/************************************************************************		
+\link	www.twinklingstar.cn
+\author Twinkling Star
+\date	2014/06/19
+****************************************************************************/
+/************************************************************************		
+\description	ַжΧǷص
+****************************************************************************/
+#include "TriangleOverlapTestBV.h"
+#include <math.h>
+
+static void GetMinMax(SrReal t0, SrReal t1, SrReal t2,SrReal& minValue,SrReal& maxValue)
+{
+	minValue = maxValue = t0;
+	if( LESS(t1,minValue) )		minValue = t1;
+	if( GREATER(t1,maxValue))	maxValue = t1;
+	if( LESS(t2,minValue) )		minValue = t2;
+	if( GREATER(t2,maxValue) )	maxValue = t2;
+}
+
+static void GetMinMax(SrReal t0, SrReal t1,SrReal& minValue,SrReal& maxValue)
+{
+	if( LESS(t0,t1) )
+	{
+		minValue = t0;
+		maxValue = t1;
+	}
+	else
+	{
+		minValue = t1;
+		maxValue = t0;
+	}
+}
+
+static bool IsSeparatingAxis(SrReal p0, SrReal p1,SrReal r)
+{
+	SrReal mn,mx;
+	GetMinMax(p0,p1,mn,mx);
+	if( LESS(mx,-r) || GREATER(mn,r) )
+		return true;
+	return false;
+}
+
+/*
+	The expression "n[dot]v" is the dot product of the two vectors.
+	The expression "n[cross]v" is the cross production of the two vectors.
+	Let n = axis[cross](v(i+1)-v(i)), pi = n[dot]v(i).
+	For edge v(1)-v(0), p0 == p1.
+	For edge v(2)-v(1), p1 == p2.
+	For edge v(0)-v(2), p2 == p0.
+*/
+static bool TestAxisCrossEdge(const SrPoint3D* v,const SrVector3D& e,const SrOBBox3D& obb)
+{
+	SrReal fex , fey , fez , r;
+	fex = fabs(e.x);
+	fey = fabs(e.y);
+	fez = fabs(e.z);
+	SrReal p0 , p2;
+	//e and Axis X
+	//n = (1,0,0)[cross]e = (0, -e.z, e.y)
+	p0 = -e.z*v[0].y + e.y*v[0].z;
+	p2 = -e.z*v[2].y + e.y*v[2].z;
+	r = fez*obb.mHalfLength[1] + fey*obb.mHalfLength[2];
+	if( IsSeparatingAxis(p0,p2,r) )
+		return false;
+	//e and Axis Y
+	//n = (0,1,0)[cross]e = (e.z,0,-e.x)
+	p0 = e.z*v[0].x - e.x*v[0].z;
+	p2 = e.z*v[2].x - e.x*v[2].z;
+	r = fez*obb.mHalfLength[0] + fex*obb.mHalfLength[2];
+	if( IsSeparatingAxis(p0,p2,r) )
+		return false;
+	//e and Axis Z
+	//n = (0,0,1)[cross]e = (-e.y,e.x,0)
+	p0 = -e.y*v[0].x + e.x*v[0].y;
+	p2 = -e.y*v[2].x + e.x*v[2].y;
+	r = fey*obb.mHalfLength[0] + fex*obb.mHalfLength[1];
+	if( IsSeparatingAxis(p0,p2,r) )
+		return false;
+	return true;
+}
+
+
+/*
+\brief	ۣжΧǷص
+\return	true	ص
+		false	ص
+*/
+bool TriangleIntersectionOBB_SeparatingAxisMethod(const SrTriangle3D& triangle,const SrOBBox3D& obb)
+{
+	int i;
+	SrVector3D v[3] ;
+	SrPoint3D p;
+	for( i=0 ; i<3 ; i++ )
+	{ 
+		p = triangle.mPoint[i] - obb.mCenter;
+		v[i].x = obb.mAxis[0].dot(p);
+		v[i].y = obb.mAxis[1].dot(p);
+		v[i].z = obb.mAxis[2].dot(p);
+	}
+	SrReal mn,mx;
+	//Test the 9 tests first
+	//Edge e0
+	const SrVector3D e0 = v[1] - v[0];
+	SrPoint3D u[3];
+	u[0] = v[0]; u[1] = v[1]; u[2] = v[2];
+	if( !TestAxisCrossEdge(v,e0,obb) )
+		return false;
+	//Edge e1
+	u[0] = v[1]; u[1] = v[2]; u[2] = v[0];
+	const SrVector3D e1 = v[2] - v[1];
+	if( !TestAxisCrossEdge(u,e1,obb) )
+		return false;
+	//Edge e2
+	const SrVector3D e2 = v[2] - v[0];
+	u[0] = v[2]; u[1] = v[0]; u[2] = v[1];
+	if( !TestAxisCrossEdge(u,e2,obb) )
+		return false;
+	//Test overlap in the {x,y,z}-directions.
+	//Find min, max of the triangle each direction, 
+	//and test for overlap in that direction.
+	//Axis X
+	GetMinMax(v[0].x,v[1].x,v[2].x,mn,mx);
+	if( GREATER(mn,obb.mHalfLength[0]) || LESS(mx,-obb.mHalfLength[0]) )
+		return false;
+	//Axis Y
+	GetMinMax(v[0].y,v[1].y,v[2].y,mn,mx);
+	if( GREATER(mn,obb.mHalfLength[1]) || LESS(mx,-obb.mHalfLength[1]) )
+		return false;
+	//Axis Z
+	GetMinMax(v[0].z,v[1].z,v[2].z,mn,mx);
+	if( GREATER(mn,obb.mHalfLength[2]) || LESS(mx,-obb.mHalfLength[2]) )
+		return false;
+
+	//Test if the box intersects the plane of the triangle.
+	//Compute the plane equation of triangle: normal*x+d=0.
+	SrVector3D normal = (v[1] - v[0]).cross(v[2] - v[0]);
+	SrReal d = - normal.dot(v[0]);
+	SrPoint3D minPoint,maxPoint;
+	for( i=0 ; i<3 ; i++ )
+	{
+		if( GREATER(normal[i],0) )
+		{
+			minPoint[i] = -obb.mHalfLength[i];
+			maxPoint[i] =  obb.mHalfLength[i];
+		}
+		else
+		{
+			minPoint[i] =  obb.mHalfLength[i];
+			maxPoint[i] = -obb.mHalfLength[i];
+		}
+	}
+	SrReal t;
+	t = normal.dot(minPoint) + d;
+	if( GREATER(t,0) )
+		return false;
+	t = normal.dot(maxPoint) + d;
+	if( LESS(t , 0) )
+		return false;
+
+	return true;
+}
+
+/*
+\brief	жεУǷһAABBڡ
+\return	true	
+		false	
+*/
+static bool TestVertexInsideAABB(const SrPoint3D* v,const SrPoint3D& minAABB,const SrPoint3D& maxAABB)
+{
+	int i;
+	for( i=0 ; i<3 ; i++ )
+	{
+		if( GEQUAL(v[i].x,minAABB.x)&&LEQUAL(v[i].x,maxAABB.x)&&
+			GEQUAL(v[i].y,minAABB.y)&&LEQUAL(v[i].y,maxAABB.y)&&
+			GEQUAL(v[i].z,minAABB.z)&&LEQUAL(v[i].z,maxAABB.z))
+			return true;
+	}
+	return false;
+}
+
+/*
+\brief	ж߶AABBǷཻ
+\return	true	ཻ
+		false	ཻ
+*/
+static bool TestSegmentIntersectionAABB(const SrPoint3D& p0,const SrPoint3D& p1, const SrOBBox3D& obb)
+{
+	SrPoint3D m = (p0 + p1) / 2.0;
+	SrVector3D w = m - p0;
+	SrReal X = fabs(w.x), Y = fabs(w.y) , Z = fabs(w.z);
+	if( GREATER(fabs(m.x),X+obb.mHalfLength[0]) )
+		return false;
+	if( GREATER(fabs(m.y),Y+obb.mHalfLength[1]) )
+		return false;
+	if( GREATER(fabs(m.z),Z+obb.mHalfLength[2]) )
+		return false;
+	if( GREATER(fabs(m.y*w.z - m.z*w.y),obb.mHalfLength[1]*Z + obb.mHalfLength[2]*Y) )
+		return false;
+	if( GREATER(fabs(m.x*w.z - m.z*w.x),obb.mHalfLength[0]*Z + obb.mHalfLength[2]*X) )
+		return false;
+	if( GREATER(fabs(m.x*w.y - m.y*w.x),obb.mHalfLength[0]*Y + obb.mHalfLength[1]*X) )
+		return false;
+	return true;
+}
+
+/*
+\brief	ж߶Ƿཻ߶ڵƽʱҲཻ
+\return	true	ཻ
+		false	ཻ
+*/
+static bool SegmentHitTriangle(const SrTriangle3D& triangle,const SrPoint3D& point1,const SrPoint3D& point2)
+{
+	int flag = triangle.segmentHitTest(point1,point2);
+	return flag==SR_INTERSECTING || flag==SR_OVERLAPPING;
+}
+
+/*
+\brief	жΧǷصҪ3
+		1εĶǷڰΧڣ
+		2εıǷ볤ཻ
+		3ΧеԽǷཻ
+		οDouglas Voorhies. "Triangle-cube intersection." Graphics Gems III. Academic Press Professional, Inc., 1992.
+\return	true	ص
+		false	ص
+*/
+bool TriangleIntersectionOBB_Voorhies(const SrTriangle3D& triangle,const SrOBBox3D& obb)
+{
+	int i;
+	SrVector3D v[3];
+	for( i=0 ; i<3 ; i++ )
+	{
+		v[i].x = obb.mAxis[0].dot(triangle.mPoint[i] - obb.mCenter);
+		v[i].y = obb.mAxis[1].dot(triangle.mPoint[i] - obb.mCenter);
+		v[i].z = obb.mAxis[2].dot(triangle.mPoint[i] - obb.mCenter);
+	}
+
+	SrPoint3D minAABB , maxAABB;
+	minAABB.x = -obb.mHalfLength[0];
+	minAABB.y = -obb.mHalfLength[1];
+	minAABB.z = -obb.mHalfLength[2];
+
+	maxAABB.x =  obb.mHalfLength[0];
+	maxAABB.y =  obb.mHalfLength[1];
+	maxAABB.z =  obb.mHalfLength[2];
+
+	if( TestVertexInsideAABB(v,minAABB,maxAABB) )
+		return true;
+
+	if( TestSegmentIntersectionAABB(v[1],v[0],obb) )
+		return true;
+	if( TestSegmentIntersectionAABB(v[2],v[1],obb) )
+		return true;
+	if( TestSegmentIntersectionAABB(v[0],v[2],obb) )
+		return true;
+
+	SrTriangle3D tri;
+	tri.mPoint[0] = v[0];
+	tri.mPoint[1] = v[1];
+	tri.mPoint[2] = v[2];
+
+	SrPoint3D diagonal1 , diagonal2;
+	diagonal1 = minAABB;diagonal2 = maxAABB;
+	if( SegmentHitTriangle(tri,diagonal1,diagonal2) )
+		return true;
+
+	diagonal1.y = maxAABB.y;diagonal2.y = minAABB.y;
+	if( SegmentHitTriangle(tri,diagonal1,diagonal2) )
+		return true;
+
+	diagonal1 = minAABB;diagonal2 = maxAABB;
+	diagonal1.z = maxAABB.z;diagonal2.z = minAABB.z;
+	if( SegmentHitTriangle(tri,diagonal1,diagonal2) )
+		return true;
+
+	diagonal1.y = maxAABB.y;diagonal2.y = minAABB.y;
+	if( SegmentHitTriangle(tri,diagonal1,diagonal2) )
+		return true;
+	return false;
+}
@@ -0,0 +1,33 @@
+/************************************************************************
+\link	www.twinklingstar.cn
+\author Twinkling Star
+\date	2014/06/19
+****************************************************************************/
+#ifndef SR_ALGORITHMS_TRIANGLE_OVERLAP_TEST_BV_H_
+#define SR_ALGORITHMS_TRIANGLE_OVERLAP_TEST_BV_H_
+
+/** \addtogroup algorithms
+  @{
+*/
+#include "SrOBBox3D.h"
+#include "Tri3DOverlapTri3D.h"
+
+/*
+\brief	ۣжΧǷص
+\return	true	ص
+		false	ص
+*/
+bool TriangleIntersectionOBB_SeparatingAxisMethod(const SrTriangle3D& triangle,const SrOBBox3D& obb);
+/*
+\brief	жΧǷصҪ3
+		1εĶǷڰΧڣ
+		2εıǷ볤ཻ
+		3ΧеԽǷཻ
+		οDouglas Voorhies. "Triangle-cube intersection." Graphics Gems III. Academic Press Professional, Inc., 1992.
+\return	true	ص
+		false	ص
+*/
+bool TriangleIntersectionOBB_Voorhies(const SrTriangle3D& triangle,const SrOBBox3D& obb);
+
+/** @} */
+#endif
@@ -5,6 +5,8 @@
 ****************************************************************************/
 #include "SrGeometricTools.h"
 #include "SrDataType.h"
+#include "../Algorithms/HullExtremePoint.h"
+#include "../Algorithms/ConvexExtremePoint.h"
 #include <time.h>
 #include <stdio.h>
 
@@ -131,7 +133,6 @@ int ExtremePoint_BinarySearch( const Point2D* p, int n, const Vector2D& u)
 int ExtremePoint_Naive( const Point2D* p, int n, const Vector2D& u)
 {
 	int i , mxI = 0;
-	int count = 0;
 	Real mx = u.dot(p[0]);
 	for( i=1 ; i<n ; i++ )
 	{
@@ -148,19 +149,255 @@ void TestExtremePoint()
 {
 	int i , r = 10000 , mx = 1000;
 	Point2D*	p;
-	Vector2D u = Vector2D(0,1.0);
 	p = new Point2D[mx];
 	for( i=3 ; i<mx ; i++ )
 	{
 		GenerateConvex(i,r,Point2D(0,0),p);
-		ASSERT(ExtremePoint_Naive(p,i,u)==ExtremePoint_BinarySearch(p,i,u));
+		ASSERT(ExtremePoint_Naive(p,i,Vector2D(0,1.0))==ExtremePoint_BinarySearch(p,i,Vector2D(0,1.0)));
 	}
 	delete []p;
 }
 
+/*
+\brief 㷨q͹εе㣬͹ʱ˳ģqڶ⡣
+*/
+bool Tangent_Naive( const Point2D* p, int n, const Point2D& q, int& right, int& left)
+{
+	int i;
+	right = left = -1;
+	for( i=0 ; i<n ; i++ )
+	{
+		bool lastVisible = (p[i] - p[(i+n-1)%n]).cross(q - p[(i+n-1)%n]) < 0;
+		bool visible = (p[(i+1)%n] - p[i]).cross(q - p[i]) < 0;
+		if( !lastVisible && visible )
+			left = i;
+		if( lastVisible && !visible )
+			right = i;
+	}
+	return left>=0;
+}
+
+void TestConvexExtremePoint()
+{
+	int i , k , r = 10000;
+	int size[] = {3,4,17,1000,100000};
+	int batch[] = {1,50,1000,100000};
+	for( int s=0 ; s<5 ; s++ )
+	{
+		int n = size[s];
+		Point2D* p = new Point2D[n];
+		GenerateConvex(n,r,Point2D(0,0),p);
+		SrConvexExtremePoint extremePoint;
+		extremePoint.build(p,n);
+		for( int b=0 ; b<4 ; b++ )
+		{
+			int numDirection = batch[b];
+			Vector2D* u = new Vector2D[numDirection];
+			int* result = new int[numDirection];
+			for( i=0 ; i<numDirection ; i++ )
+			{
+				u[i] = Vector2D(rand() % 2001 - 1000,rand() % 2001 - 1000);
+				//һЩǡǱߵķ
+				if( i%7==0 )
+				{
+					k = rand() % n;
+					u[i] = Vector2D(p[(k+1)%n].y - p[k].y,p[k].x - p[(k+1)%n].x);
+				}
+			}
+			extremePoint.extremeVertexBatch(u,numDirection,result);
+#ifdef _DEBUG
+			for( i=0 ; i<numDirection && n<=1000 ; i++ )
+			{
+				Real mx = u[i].dot(p[ExtremePoint_Naive(p,n,u[i])]);
+				ASSERT(fabs(u[i].dot(p[result[i]]) - mx) <= 1e-9*r*u[i].magnitude());
+				ASSERT(fabs(u[i].dot(p[extremePoint.extremeVertex(u[i])]) - mx) <= 1e-9*r*u[i].magnitude());
+			}
+#endif
+			for( i=0 ; i<numDirection ; i++ )
+				ASSERT(result[i]==extremePoint.extremeVertex(u[i]) || fabs(u[i].dot(p[result[i]] - p[extremePoint.extremeVertex(u[i])])) <= 1e-9*r*u[i].magnitude());
+			delete []u;
+			delete []result;
+		}
+
+		int numPoint = 10000;
+		Point2D* q = new Point2D[numPoint];
+		int* rightBatch = new int[numPoint];
+		int* leftBatch = new int[numPoint];
+		for( i=0 ; i<numPoint ; i++ )
+			q[i] = Point2D(rand() % (6*r) - 3*r,rand() % (6*r) - 3*r);
+		extremePoint.tangentVertexBatch(q,numPoint,rightBatch,leftBatch);
+#ifdef _DEBUG
+		int right , left , naiveRight , naiveLeft;
+		for( i=0 ; i<numPoint ; i++ )
+		{
+			bool isOutside = extremePoint.tangentVertex(q[i],right,left);
+			ASSERT(right==rightBatch[i] && left==leftBatch[i]);
+			if( n>1000 )
+				continue;
+			ASSERT(isOutside==Tangent_Naive(p,n,q[i],naiveRight,naiveLeft));
+			ASSERT(right==naiveRight && left==naiveLeft);
+		}
+#endif
+		delete []q;
+		delete []rightBatch;
+		delete []leftBatch;
+		delete []p;
+	}
+
+	//y=x*xϵĶΣһߣⷨۼ(1,0)ѯķҲۼ
+	//ͬһͰмеı
+	int n = 100000 , numDirection = 100000 , numFrame = 20;
+	Point2D* p = new Point2D[n];
+	Vector2D* u = new Vector2D[numDirection];
+	int* result = new int[numDirection];
+	for( i=0 ; i<n ; i++ )
+		p[i] = Point2D(i,(Real)i*i);
+	SrConvexExtremePoint extremePoint;
+	extremePoint.build(p,n);
+	for( i=0 ; i<numDirection ; i++ )
+	{
+		k = ((rand() % 1000)*1000 + rand() % 1000) % (n - 1);
+		u[i] = Vector2D(2*k + 1 + (i%2)*0.5,-1);
+	}
+	double mTime = clock();
+	extremePoint.extremeVertexBatch(u,numDirection,result);
+	printf("Extreme Point-Clustered Batch     :\t%f\n",(clock() - mTime) / CLOCKS_PER_SEC);
+	for( i=0 ; i<numDirection ; i++ )
+		ASSERT(u[i].dot(p[result[i]])==u[i].dot(p[extremePoint.extremeVertex(u[i])]));
+	delete []p;
+	delete []u;
+	delete []result;
+
+	//ͬһΣÿ֡ѯܶ෽
+	n = 2000;
+	p = new Point2D[n];
+	GenerateConvex(n,r,Point2D(0,0),p);
+	extremePoint.build(p,n);
+	u = new Vector2D[numDirection];
+	result = new int[numDirection];
+	for( i=0 ; i<numDirection ; i++ )
+		u[i] = Vector2D(rand() % 2001 - 1000,rand() % 2001 - 1000);
+	mTime = clock();
+	for( k=0 ; k<numFrame ; k++ )
+		for( i=0 ; i<numDirection ; i++ )
+			result[i] = ExtremePoint_BinarySearch(p,n,u[i]);
+	printf("Extreme Point-Binary Search       :\t%f\n",(clock() - mTime) / CLOCKS_PER_SEC);
+	mTime = clock();
+	for( k=0 ; k<numFrame ; k++ )
+		for( i=0 ; i<numDirection ; i++ )
+			result[i] = extremePoint.extremeVertex(u[i]);
+	printf("Extreme Point-Angle Search        :\t%f\n",(clock() - mTime) / CLOCKS_PER_SEC);
+	mTime = clock();
+	for( k=0 ; k<numFrame ; k++ )
+		extremePoint.extremeVertexBatch(u,numDirection,result);
+	printf("Extreme Point-Batch CPU Time      :\t%f\n",(clock() - mTime) / CLOCKS_PER_SEC);
+	delete []p;
+	delete []u;
+	delete []result;
+}
+
+/*
+\brief 㷨͹Ϸuļ㡣
+*/
+int HullExtremePoint_Naive(const tHull* hull, const SrVector3D& u)
+{
+	int i , mxI = 0;
+	Real mx = u.dot(hull->mVertes[0]);
+	for( i=1 ; i<hull->mNumVertes ; i++ )
+	{
+		if( u.dot(hull->mVertes[i]) > mx )
+		{
+			mx = u.dot(hull->mVertes[i]);
+			mxI = i;
+		}
+	}
+	return mxI;
+}
+
+void TestHullExtremePoint()
+{
+	int numPoint = 20000 , numDirection = 100000 , i;
+	SrPoint3D* point = new SrPoint3D[numPoint];
+	for( i=0 ; i<numPoint ; i++ )
+	{
+		do
+		{
+			point[i] = SrPoint3D(rand() % 2001 - 1000,rand() % 2001 - 1000,rand() % 2001 - 1000);
+		} while( point[i].magnitude()<1 );
+		point[i] *= 1000 / point[i].magnitude();
+	}
+	QuickHull quickHull;
+	tHull hull;
+	if( !quickHull.quickHull(point,numPoint,&hull) )
+	{
+		delete []point;
+		return;
+	}
+	SrHullExtremePoint extremePoint;
+	extremePoint.build(&hull,true);
+	printf("%d vertices, %d levels\n",hull.mNumVertes,extremePoint.numLevel());
+
+	//һر仯ɽһ㿪ʼ
+	SrVector3D* u = new SrVector3D[numDirection];
+	int* naive = new int[numDirection];
+	int* result = new int[numDirection];
+	for( i=0 ; i<numDirection ; i++ )
+	{
+		Real t = i / (Real)numDirection;
+		u[i] = SrVector3D(cos(200*t)*sin(SrPiF32*t),sin(200*t)*sin(SrPiF32*t),cos(SrPiF32*t));
+	}
+
+	double mTime = clock();
+	for( i=0 ; i<numDirection ; i++ )
+		naive[i] = HullExtremePoint_Naive(&hull,u[i]);
+	printf("Hull Extreme Point-Naive          :\t%f\n",(clock() - mTime) / CLOCKS_PER_SEC);
+
+	int start = 0;
+	mTime = clock();
+	for( i=0 ; i<numDirection ; i++ )
+		result[i] = start = extremePoint.extremeVertex(u[i],start);
+	printf("Hull Extreme Point-Hill Climbing  :\t%f\n",(clock() - mTime) / CLOCKS_PER_SEC);
+	for( i=0 ; i<numDirection ; i++ )
+		ASSERT(EQUAL(u[i].dot(hull.mVertes[result[i]]),u[i].dot(hull.mVertes[naive[i]])));
+
+	mTime = clock();
+	for( i=0 ; i<numDirection ; i++ )
+		result[i] = extremePoint.extremeVertexHierarchy(u[i]);
+	printf("Hull Extreme Point-Hierarchy      :\t%f\n",(clock() - mTime) / CLOCKS_PER_SEC);
+	for( i=0 ; i<numDirection ; i++ )
+		ASSERT(EQUAL(u[i].dot(hull.mVertes[result[i]]),u[i].dot(hull.mVertes[naive[i]])));
+
+	mTime = clock();
+	extremePoint.extremeVertexBatch(u,numDirection,result);
+	printf("Hull Extreme Point-Batch CPU Time :\t%f\n",(clock() - mTime) / CLOCKS_PER_SEC);
+	for( i=0 ; i<numDirection ; i++ )
+		ASSERT(EQUAL(u[i].dot(hull.mVertes[result[i]]),u[i].dot(hull.mVertes[naive[i]])));
+
+	//ķɽÿζӵ0㿪ʼ
+	for( i=0 ; i<numDirection ; i++ )
+	{
+		u[i] = SrVector3D(rand() % 2001 - 1000,rand() % 2001 - 1000,rand() % 2001 - 1000);
+		naive[i] = HullExtremePoint_Naive(&hull,u[i]);
+	}
+	extremePoint.extremeVertexBatch(u,numDirection,result,true);
+	for( i=0 ; i<numDirection ; i++ )
+	{
+		ASSERT(EQUAL(u[i].dot(hull.mVertes[result[i]]),u[i].dot(hull.mVertes[naive[i]])));
+		ASSERT(EQUAL(u[i].dot(hull.mVertes[extremePoint.extremeVertex(u[i])]),u[i].dot(hull.mVertes[naive[i]])));
+	}
+
+	delete []point;
+	delete []u;
+	delete []naive;
+	delete []result;
+	delete []hull.mVertes;
+	delete []hull.mFacet;
+}
 
 int main( )
 {
 	TestExtremePoint();
+	TestConvexExtremePoint();
+	TestHullExtremePoint();
 	return 0;
 }
\ No newline at end of file
@@ -5,12 +5,15 @@
 ****************************************************************************/
 #include "SrGeometricTools.h"
 #include "SrDataType.h"
+#include "../Algorithms/ConvexPolygon.h"
+#include "../Algorithms/MinkowskiSum.h"
 
 #include <stdio.h>
 #include <algorithm>
 #include <cmath>
 #include <vector>
 #include <set>
+#include <time.h>
 
 #define Real		SrReal
 #define Point2D		SrPoint2D
@@ -50,66 +53,131 @@ void GenerateConvex(int numPoint, Real radius, const Point2D& center,Point2D* pt
 }
 
 
-int CompareVertex(const Point2D& p0 , const Point2D& p1)
+void TestGenConvexPolygon()
 {
-	if(p0.x < p1.x) return  1;
-	if(p0.x > p1.x) return -1;
-	if(p0.y < p1.y) return  1;
-	if(p0.y > p1.y) return -1;
-	return 0;
+	gNumConvexPolygon = 50;
+	gConvexPolygon = new SrPoint2D[gNumConvexPolygon];
+	GenerateConvex(gNumConvexPolygon,200.0f,SrPoint2D(200,200),gConvexPolygon);
+	ASSERT(IsConvex(gConvexPolygon,gNumConvexPolygon));
+	//˳ʱĶתĶ
+	std::reverse(gConvexPolygon,gConvexPolygon + gNumConvexPolygon);
+	ASSERT(!IsConvex(gConvexPolygon,gNumConvexPolygon));
+
+	//ǵĶ㴦תȦֵ4
+	SrPoint2D star[5];
+	int i;
+	for( i=0 ; i<5 ; i++ )
+	{
+		star[i].x = -sin(4*SrPiF32*i/5)*100;
+		star[i].y =  cos(4*SrPiF32*i/5)*100;
+	}
+	ASSERT(!IsConvex(star,5));
+
+	delete []gConvexPolygon;
+}
+
+static bool IsLeftTurn(const Point2D& p0,const Point2D& p1,const Point2D& p2)
+{
+	Vector2D d1 = p1 - p0 , d2 = p2 - p0;
+	Real cross = d1.cross(d2);
+	return cross>0 && cross*cross>SR_EPS*SR_EPS*d1.magnitudeSquared()*d2.magnitudeSquared();
 }
 
 /*
-\brief	жһǷ͹ΣĶʱ˳
-\param[in]	p, n		涨Ķ
+\brief	صMinkowskiͣжӣõ͹ߵĵ㲻ʱ临ӶO(nmlog(nm))
 */
-bool IsConvex( const Point2D* p,int n)
+int NaiveMinkowskiSum(const Point2D* p,int numP,const Point2D* q,int numQ,std::vector<Point2D>& result)
 {
-	int last , current , next;
-	int sign , tmpSign;
-	int signChange = 0;
-	sign = CompareVertex(p[n - 1],p[0]);
-	for( last = 0 , current = 1; current < n ; last = current, current ++ )
+	std::vector<Point2D> sum;
+	int i , j , k = 0;
+	for( i=0 ; i<numP ; i++ )
+		for( j=0 ; j<numQ ; j++ )
+			sum.push_back(p[i] + q[j]);
+	std::sort(sum.begin(),sum.end());
+	result.resize(2*sum.size());
+	for( i=0 ; i<(int)sum.size() ; i++ )
 	{
-		tmpSign = CompareVertex(p[last], p[current]);
-		if( tmpSign == 0 )
-			return false;
-		if( tmpSign != signChange )
-		{
-			signChange = tmpSign;
-			signChange ++;
-			if( signChange > 2 )
-				return false;
-		}
+		while( k>=2 && !IsLeftTurn(result[k - 2],result[k - 1],sum[i]) )
+			k --;
+		result[k++] = sum[i];
 	}
-	bool isGreater = false;
-	Real angle;
-	for( last = n - 2, current = n - 1, next = 0 ; next < n ; last = current, current = next, next++)
+	for( i=(int)sum.size() - 2 , j=k + 1 ; i>=0 ; i-- )
 	{
-		angle = (p[next] - p[current]).cross(p[last] - p[current]);
-		if( angle < 0 )
-			return false;
-		else if( !isGreater && angle > 0 )
-			isGreater = true;
+		while( k>=j && !IsLeftTurn(result[k - 2],result[k - 1],sum[i]) )
+			k --;
+		result[k++] = sum[i];
 	}
-	if( isGreater )
-		return true;
-	//Degenerate case.
-	return false;
+	result.resize(k - 1);
+	return k - 1;
 }
 
-void TestGenConvexPolygon()
+void TestMinkowskiSum()
 {
-	gNumConvexPolygon = 50;
-	gConvexPolygon = new SrPoint2D[gNumConvexPolygon];
-	GenerateConvex(gNumConvexPolygon,200.0f,SrPoint2D(200,200),gConvexPolygon);
-	ASSERT(IsConvex(gConvexPolygon,gNumConvexPolygon));
+	int numCase = 1000 , i , j , numP , numQ , numResult;
+	Point2D p[64] , q[64] , result[128];
+	std::vector<Point2D> naive;
+	for( i=0 ; i<numCase ; i++ )
+	{
+		numP = 3 + rand()%60;
+		numQ = 3 + rand()%60;
+		GenerateConvex(numP,10 + rand()%100,Point2D(rand()%100,rand()%100),p);
+		GenerateConvex(numQ,10 + rand()%100,Point2D(rand()%100,rand()%100),q);
+		//ƽеı
+		if( i%3==0 )
+		{
+			numQ = numP;
+			for( j=0 ; j<numP ; j++ )
+				q[j] = p[j]*0.5 + Vector2D(7,-3);
+		}
+		numResult = ConvexMinkowskiSum(p,numP,q,numQ,result);
+		ASSERT(IsConvex(result,numResult));
+		ASSERT(numResult==NaiveMinkowskiSum(p,numP,q,numQ,naive));
+		for( j=0 ; j<numResult ; j++ )
+			ASSERT(result[j].distance(naive[j])<1e-9);
+	}
 
-	delete []gConvexPolygon;
+	//û˵Ŵϰ
+	int numObstacle = 100000 , numFootprint = 8;
+	Point2D footprint[8];
+	GenerateConvex(numFootprint,2,Point2D(0,0),footprint);
+	std::vector<Point2D> vertex;
+	std::vector<int> polygonStart(1,0);
+	for( i=0 ; i<numObstacle ; i++ )
+	{
+		numP = 3 + rand()%10;
+		GenerateConvex(numP,1 + rand()%5,Point2D(rand()%1000,rand()%1000),p);
+		vertex.insert(vertex.end(),p,p + numP);
+		polygonStart.push_back((int)vertex.size());
+	}
+
+	double seconds = clock();
+	for( i=0 ; i<numObstacle ; i++ )
+		NaiveMinkowskiSum(&vertex[polygonStart[i]],polygonStart[i + 1] - polygonStart[i],footprint,numFootprint,naive);
+	seconds = (clock() - seconds)/CLOCKS_PER_SEC;
+	printf("Naive Minkowski Sum Time:	%.6lf\n",seconds);
+
+	std::vector<Point2D> sum , batch;
+	std::vector<int> sumStart(1,0) , batchStart;
+	seconds = clock();
+	for( i=0 ; i<numObstacle ; i++ )
+	{
+		numResult = ConvexMinkowskiSum(&vertex[polygonStart[i]],polygonStart[i + 1] - polygonStart[i],footprint,numFootprint,result);
+		sum.insert(sum.end(),result,result + numResult);
+		sumStart.push_back((int)sum.size());
+	}
+	seconds = (clock() - seconds)/CLOCKS_PER_SEC;
+	printf("Minkowski Sum Time:	%.6lf\n",seconds);
+
+	seconds = clock();
+	ConvexMinkowskiSumBatch(&vertex[0],&polygonStart[0],numObstacle,footprint,numFootprint,batch,batchStart);
+	seconds = (clock() - seconds)/CLOCKS_PER_SEC;
+	printf("Minkowski Sum Batch CPU Time:	%.6lf\n",seconds);
+	ASSERT(batch==sum && batchStart==sumStart);
 }
 
 int main(int argc, char** argv)
 {
 	TestGenConvexPolygon();
+	TestMinkowskiSum();
 	return 0;
 }
@@ -0,0 +1,181 @@
+/************************************************************************		
+\link	www.twinklingstar.cn
+\author Twinkling Star
+\date	2026/10/19
+****************************************************************************/
+#include "../Algorithms/MeshBVH.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <algorithm>
+
+bool operator<(const tTrianglePair& pair1,const tTrianglePair& pair2)
+{
+	if( pair1.mTri1!=pair2.mTri1 )
+		return pair1.mTri1<pair2.mTri1;
+	return pair1.mTri2<pair2.mTri2;
+}
+
+/*
+	汻ֳnumSlice*numStackıΣÿıαֳ
+*/
+SrTriangle3D* GenerateSphere(const SrPoint3D& center,SrReal radius,int numSlice,int numStack,int& numTriangle)
+{
+	SrPoint3D* vertex = new SrPoint3D[(numSlice + 1)*(numStack + 1)];
+	int i , j , k;
+	SrReal theta , phi;
+	for( j=0 ; j<=numStack ; j++ )
+	{
+		phi = SrPiF64*j/numStack;
+		for( i=0 ; i<=numSlice ; i++ )
+		{
+			theta = SrTwoPiF64*i/numSlice;
+			vertex[j*(numSlice + 1) + i] = center + radius*SrVector3D(sin(phi)*cos(theta),sin(phi)*sin(theta),cos(phi));
+		}
+		//The seam and the poles share exactly the same vertices, so that adjacent triangles can be found by coordinates.
+		vertex[j*(numSlice + 1) + numSlice] = vertex[j*(numSlice + 1)];
+	}
+	for( i=0 ; i<=numSlice ; i++ )
+	{
+		vertex[i] = center + SrVector3D(0,0,radius);
+		vertex[numStack*(numSlice + 1) + i] = center - SrVector3D(0,0,radius);
+	}
+	SrTriangle3D* triangle = new SrTriangle3D[2*numSlice*numStack];
+	SrTriangle3D tri;
+	numTriangle = 0;
+	for( j=0 ; j<numStack ; j++ )
+	{
+		for( i=0 ; i<numSlice ; i++ )
+		{
+			k = j*(numSlice + 1) + i;
+			tri = SrTriangle3D(vertex[k],vertex[k + 1],vertex[k + numSlice + 2]);
+			if( tri.isValid() )
+				triangle[numTriangle++] = tri;
+			tri = SrTriangle3D(vertex[k],vertex[k + numSlice + 2],vertex[k + numSlice + 1]);
+			if( tri.isValid() )
+				triangle[numTriangle++] = tri;
+		}
+	}
+	delete []vertex;
+	return triangle;
+}
+
+void Test_MeshIntersectMesh(int boxType)
+{
+	int numTri1 , numTri2 , i , j;
+	SrTriangle3D* tri1 = GenerateSphere(SrPoint3D(0,0,0),10,64,32,numTri1);
+	SrTriangle3D* tri2 = GenerateSphere(SrPoint3D(7,3,1),8,48,24,numTri2);
+
+	SrMeshBVH bvh1 , bvh2;
+	double seconds = clock();
+	bvh1.build(tri1,numTri1,boxType);
+	bvh2.build(tri2,numTri2,boxType);
+	seconds = (clock() - seconds)/CLOCKS_PER_SEC;
+	printf("Build Time:	%.6lf\n",seconds);
+
+	TrianglePairArray pairs;
+	seconds = clock();
+	MeshIntersectMesh(bvh1,bvh2,pairs);
+	seconds = (clock() - seconds)/CLOCKS_PER_SEC;
+	printf("BVH Time:	%.6lf\n",seconds);
+
+	//The result must be the same as testing all the n*m triangle pairs.
+	TrianglePairArray naivePairs;
+	tTrianglePair pair;
+	seconds = clock();
+	for( i=0 ; i<numTri1 ; i++ )
+		for( j=0 ; j<numTri2 ; j++ )
+		{
+			if( Tri3DOverlapTestTri3D_Guigue(tri1[i],tri2[j]) )
+			{
+				pair.mTri1 = i;
+				pair.mTri2 = j;
+				naivePairs.push_back(pair);
+			}
+		}
+	seconds = (clock() - seconds)/CLOCKS_PER_SEC;
+	printf("Naive Time:	%.6lf\n",seconds);
+
+	std::sort(pairs.begin(),pairs.end());
+	ASSERT(pairs.size()==naivePairs.size());
+	for( i=0 ; i<(int)pairs.size() ; i++ )
+		ASSERT(pairs[i].mTri1==naivePairs[i].mTri1 && pairs[i].mTri2==naivePairs[i].mTri2);
+	printf("Overlapping Pairs:	%d\n",(int)pairs.size());
+
+	delete []tri1;
+	delete []tri2;
+}
+
+void Test_MeshSelfIntersect()
+{
+	int numTri1 , numTri2 , numTriangle , i , j;
+	SrTriangle3D* tri1 = GenerateSphere(SrPoint3D(0,0,0),10,64,32,numTri1);
+	SrTriangle3D* tri2 = GenerateSphere(SrPoint3D(7,3,1),8,48,24,numTri2);
+	numTriangle = numTri1 + numTri2;
+	SrTriangle3D* triangle = new SrTriangle3D[numTriangle];
+	for( i=0 ; i<numTri1 ; i++ )
+		triangle[i] = tri1[i];
+	for( i=0 ; i<numTri2 ; i++ )
+		triangle[numTri1 + i] = tri2[i];
+
+	SrMeshBVH bvh;
+	TrianglePairArray pairs , crossPairs;
+	//A closed sphere does not intersect itself.
+	bvh.build(tri1,numTri1);
+	MeshSelfIntersect(bvh,NULL,pairs);
+	ASSERT(pairs.empty());
+
+	//The self intersections of the union of two spheres are the intersections between them.
+	bvh.build(triangle,numTriangle);
+	double seconds = clock();
+	MeshSelfIntersect(bvh,NULL,pairs);
+	seconds = (clock() - seconds)/CLOCKS_PER_SEC;
+	printf("BVH Time:	%.6lf\n",seconds);
+
+	SrMeshBVH bvh1 , bvh2;
+	bvh1.build(tri1,numTri1);
+	bvh2.build(tri2,numTri2);
+	MeshIntersectMesh(bvh1,bvh2,crossPairs);
+	for( i=0 ; i<(int)crossPairs.size() ; i++ )
+		crossPairs[i].mTri2 += numTri1;
+	std::sort(pairs.begin(),pairs.end());
+	std::sort(crossPairs.begin(),crossPairs.end());
+	ASSERT(pairs.size()==crossPairs.size());
+	for( i=0 ; i<(int)pairs.size() ; i++ )
+		ASSERT(pairs[i].mTri1==crossPairs[i].mTri1 && pairs[i].mTri2==crossPairs[i].mTri2);
+	printf("Intersecting Pairs:	%d\n",(int)pairs.size());
+	delete []triangle;
+	delete []tri1;
+	delete []tri2;
+
+	//A large mesh with about one million triangles. The tests use the absolute tolerance SR_EPS,
+	//so the spheres are scaled up to keep the small triangles well above it.
+	tri1 = GenerateSphere(SrPoint3D(0,0,0),1000,1000,300,numTri1);
+	tri2 = GenerateSphere(SrPoint3D(700,300,100),800,1000,200,numTri2);
+	numTriangle = numTri1 + numTri2;
+	triangle = new SrTriangle3D[numTriangle];
+	for( i=0 ; i<numTri1 ; i++ )
+		triangle[i] = tri1[i];
+	for( j=0 ; j<numTri2 ; j++ )
+		triangle[numTri1 + j] = tri2[j];
+	seconds = clock();
+	bvh.build(triangle,numTriangle);
+	MeshSelfIntersect(bvh,NULL,pairs);
+	seconds = (clock() - seconds)/CLOCKS_PER_SEC;
+	printf("%d Triangles, Intersecting Pairs:	%d, Time:	%.6lf\n",numTriangle,(int)pairs.size(),seconds);
+	delete []triangle;
+	delete []tri1;
+	delete []tri2;
+}
+
+int main( )
+{
+	printf("AABB Hierarchy:\n");
+	Test_MeshIntersectMesh(SR_BVH_AABB);
+	printf("OBB Hierarchy:\n");
+	Test_MeshIntersectMesh(SR_BVH_OBB);
+	printf("Self Intersection:\n");
+	Test_MeshSelfIntersect();
+	return 0;
+}
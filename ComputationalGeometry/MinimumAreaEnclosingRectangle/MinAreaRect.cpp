@@ -5,11 +5,17 @@
 ****************************************************************************/
 #include "SrGeometricTools.h"
 #include "SrDataType.h"
+#include "../Algorithms/RotatingCalipersBatch.h"
 
 #include <stdio.h>
 #include <algorithm>
 #include <stdlib.h>
 #include <list>
+#include <vector>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+#include <time.h>
 
 
 #define Real		SrReal
@@ -188,8 +194,237 @@ void TestMinAreaRect()
 	delete []points;
 }
 
+/*
+\brief	ÿΪױӾΣͬʱȡССܳ
+*/
+void Calipers_Naive(const Point2D* pts, int n, Real& diameter, Real& width, Real& minArea, Real& minPerimeter)
+{
+	int i , j;
+	diameter = 0;
+	width = minArea = minPerimeter = SR_MAX_F64;
+	for( i=0 ; i<n ; i++ )
+	{
+		Vector2D e = pts[(i+1)%n] - pts[i];
+		e.normalize();
+		Real minDot = 0 , maxDot = 0 , height = 0;
+		for( j=0 ; j<n ; j++ )
+		{
+			minDot = std::min(minDot,e.dot(pts[j] - pts[i]));
+			maxDot = std::max(maxDot,e.dot(pts[j] - pts[i]));
+			height = std::max(height,e.cross(pts[j] - pts[i]));
+			diameter = std::max(diameter,(pts[j] - pts[i]).magnitude());
+		}
+		width = std::min(width,height);
+		minArea = std::min(minArea,(maxDot - minDot)*height);
+		minPerimeter = std::min(minPerimeter,2*(maxDot - minDot + height));
+	}
+}
+
+/*
+\brief	ΰеĶ㣬ܳȷ
+*/
+bool CheckRectangle(const Point2D* pts, int n, const tCalipersRectangle& rect, Real area, Real perimeter, Real tolerance)
+{
+	if( fabs(rect.mAxis[0].dot(rect.mAxis[1]))>=1e-9 ||
+		fabs(4*rect.mHalfLength[0]*rect.mHalfLength[1] - area)>tolerance*tolerance ||
+		fabs(4*(rect.mHalfLength[0] + rect.mHalfLength[1]) - perimeter)>tolerance )
+		return false;
+	for( int i=0 ; i<n ; i++ )
+	{
+		Vector2D d = pts[i] - rect.mCenter;
+		if( fabs(d.dot(rect.mAxis[0]))>rect.mHalfLength[0] + tolerance || fabs(d.dot(rect.mAxis[1]))>rect.mHalfLength[1] + tolerance )
+			return false;
+	}
+	return true;
+}
+
+void CheckCalipers(const Point2D* pts, int n, Real scale)
+{
+	tCalipersResult result;
+	RotatingCalipers(pts,n,result);
+	Real diameter , width , minArea , minPerimeter , tolerance = 1e-9*scale;
+	Calipers_Naive(pts,n,diameter,width,minArea,minPerimeter);
+	ASSERT(fabs(result.mDiameter - diameter)<=tolerance);
+	ASSERT(fabs((pts[result.mDiameterPair[0]] - pts[result.mDiameterPair[1]]).magnitude() - diameter)<=tolerance);
+	ASSERT(fabs(result.mWidth - width)<=tolerance);
+	ASSERT(fabs(result.mMinArea - minArea)<=tolerance*scale);
+	ASSERT(fabs(result.mMinPerimeter - minPerimeter)<=tolerance);
+	ASSERT(CheckRectangle(pts,n,result.mMinAreaRectangle,result.mMinArea,2*(result.mMinAreaRectangle.mHalfLength[0] + result.mMinAreaRectangle.mHalfLength[1])*2,tolerance));
+	ASSERT(CheckRectangle(pts,n,result.mMinPerimeterRectangle,4*result.mMinPerimeterRectangle.mHalfLength[0]*result.mMinPerimeterRectangle.mHalfLength[1],result.mMinPerimeter,tolerance));
+	//аֱԵĸO(n)
+	int numPair = (int)result.mAntipodalPair.size() / 2;
+	ASSERT(numPair>=n && numPair<=3*n);
+	int i;
+	for( i=0 ; i<numPair ; i++ )
+		if( fabs((pts[result.mAntipodalPair[2*i]] - pts[result.mAntipodalPair[2*i + 1]]).magnitude() - diameter)<=tolerance )
+			break;
+	ASSERT(i<numPair);
+}
+
+void TestRotatingCalipers()
+{
+	int i , n;
+	//ƽбߵĶ
+	Point2D square[] = {Point2D(0,0),Point2D(1,0),Point2D(1,1),Point2D(0,1)};
+	CheckCalipers(square,4,1);
+	Point2D octagon[] = {Point2D(1,0),Point2D(2,0),Point2D(3,1),Point2D(3,2),Point2D(2,3),Point2D(1,3),Point2D(0,2),Point2D(0,1)};
+	CheckCalipers(octagon,8,3);
+	Point2D rectangle[] = {Point2D(0,0),Point2D(5,0),Point2D(5,2),Point2D(0,2)};
+	CheckCalipers(rectangle,4,5);
+	Point2D triangle[] = {Point2D(0,0),Point2D(4,1),Point2D(1,3)};
+	CheckCalipers(triangle,3,4);
+	for( n=3 ; n<300 ; n++ )
+	{
+		Point2D* points = new Point2D[n];
+		GenerateConvex(n,1000.0,Point2D(rand() % 100,rand() % 100),points);
+		CheckCalipers(points,n,1000);
+		//ΣԵıƽ
+		for( i=0 ; i<n ; i++ )
+			points[i] = Point2D(-sin(2*SrPiF64*i / n),cos(2*SrPiF64*i / n))*1000.0;
+		CheckCalipers(points,n,1000);
+		delete []points;
+	}
+
+	n = 100000;
+	Point2D* points = new Point2D[n];
+	GenerateConvex(n,100000.0,Point2D(0,0),points);
+	tCalipersResult result;
+	double mTime = clock();
+	Real minArea = MinAreaRectangle(points,n);
+	printf("Minimum Area Rectangle          :\t%f, area %f\n",(clock() - mTime) / CLOCKS_PER_SEC,minArea);
+	mTime = clock();
+	RotatingCalipers(points,n,result);
+	printf("Rotating Calipers, All Measures :\t%f\n",(clock() - mTime) / CLOCKS_PER_SEC);
+	ASSERT(fabs(result.mMinArea - minArea)<=1e-6*minArea);
+	delete []points;
+}
+
+/*
+\brief	ǽʱ䣬߳ʱclock()ص̵߳CPUʱ֮͡
+*/
+double WallTime()
+{
+#ifdef _OPENMP
+	return omp_get_wtime();
+#else
+	return clock() / (double)CLOCKS_PER_SEC;
+#endif
+}
+
+/*
+\brief	ɽתľΡLΣζΣCSRʽ׷ӵvertexС
+*/
+void GenerateFootprint(std::vector<Point2D>& vertex, std::vector<int>& polygonStart)
+{
+	Point2D center(rand() % 100000,rand() % 100000);
+	Real angle = (rand() % 3600) * SrPiF64 / 1800 , c = cos(angle) , s = sin(angle);
+	Real a = rand() % 40 + 5 , b = rand() % 40 + 5;
+	int type = rand() % 4 , i , n;
+	std::vector<Point2D> local;
+	if( type==0 )
+	{
+		local.push_back(Point2D(-a,-b));
+		local.push_back(Point2D(a,-b));
+		local.push_back(Point2D(a,b));
+		local.push_back(Point2D(-a,b));
+	}
+	else if( type==1 )
+	{
+		local.push_back(Point2D(-a,-b));
+		local.push_back(Point2D(a,-b));
+		local.push_back(Point2D(a,0));
+		local.push_back(Point2D(0,0));
+		local.push_back(Point2D(0,b));
+		local.push_back(Point2D(-a,b));
+	}
+	else
+	{
+		n = rand() % 30 + 3;
+		for( i=0 ; i<n ; i++ )
+		{
+			Real r = (rand() % 1000 + 100) / 1100.0 * a , t = 2*SrPiF64*i / n;
+			local.push_back(Point2D(r*cos(t),r*sin(t)*b / a));
+		}
+	}
+	for( i=0 ; i<(int)local.size() ; i++ )
+	{
+		Point2D p = local[i] + Point2D(rand() % 11 - 5,rand() % 11 - 5)*0.01;
+		vertex.push_back(center + Point2D(c*p.x - s*p.y,s*p.x + c*p.y));
+	}
+	polygonStart.push_back((int)vertex.size());
+}
+
+void TestMinAreaRectangleBatch()
+{
+	int numPolygon = 200000 , i;
+	std::vector<Point2D> vertex;
+	std::vector<int> polygonStart(1,0);
+	//˻ĶΣһ㣬ظĵ㣬ߵĵ
+	vertex.push_back(Point2D(3,4));
+	polygonStart.push_back((int)vertex.size());
+	vertex.push_back(Point2D(1,1));
+	vertex.push_back(Point2D(1,1));
+	polygonStart.push_back((int)vertex.size());
+	for( i=0 ; i<5 ; i++ )
+		vertex.push_back(Point2D(i,2*i));
+	polygonStart.push_back((int)vertex.size());
+	for( i=3 ; i<numPolygon ; i++ )
+		GenerateFootprint(vertex,polygonStart);
+
+	SrRectangle2DSoA result;
+	double mTime = WallTime();
+	MinAreaRectangleBatch(&vertex[0],&polygonStart[0],numPolygon,result);
+	mTime = WallTime() - mTime;
+	printf("Minimum Area Rectangle Batch     :\t%f, %.0f polygons per second\n",mTime,numPolygon / mTime);
+
+	ASSERT(result.mHalfLength[0][0]==0 && result.mHalfLength[1][0]==0 && result.mCenter[0][0]==3);
+	ASSERT(result.mHalfLength[0][1]==0 && result.mCenter[1][1]==1);
+	ASSERT(fabs(result.mHalfLength[0][2] - sqrt(80.0) / 2)<1e-9 && result.mHalfLength[1][2]==0);
+
+	//͹תǣʱֻⱾں浥
+	std::vector<Point2D> point , hull;
+	std::vector<Real> minArea(numPolygon,0);
+	tCalipersResult calipers;
+	tCalipersRectangle rect;
+	mTime = WallTime();
+	for( i=3 ; i<numPolygon ; i++ )
+	{
+		int n = polygonStart[i + 1] - polygonStart[i];
+		point.assign(vertex.begin() + polygonStart[i],vertex.begin() + polygonStart[i + 1]);
+		hull.resize(n + 1);
+		int numHull = MonotoneChainHull(&point[0],n,&hull[0]);
+		RotatingCalipers(&hull[0],numHull,calipers,false);
+		minArea[i] = calipers.mMinArea;
+	}
+	mTime = WallTime() - mTime;
+	printf("Minimum Area Rectangle One by One:\t%f, %.0f polygons per second\n",mTime,numPolygon / mTime);
+
+	//ӦͬҵڱС
+	for( i=3 ; i<numPolygon ; i++ )
+	{
+		result.getRectangle(i,rect);
+		ASSERT(fabs(4*rect.mHalfLength[0]*rect.mHalfLength[1] - minArea[i])<=1e-9*minArea[i]);
+#ifdef _DEBUG
+		if( i%100==0 )
+		{
+			int n = polygonStart[i + 1] - polygonStart[i];
+			point.assign(vertex.begin() + polygonStart[i],vertex.begin() + polygonStart[i + 1]);
+			hull.resize(n + 1);
+			int numHull = MonotoneChainHull(&point[0],n,&hull[0]);
+			Real diameter , width , naiveArea , minPerimeter;
+			ASSERT(IsConvex(&hull[0],numHull));
+			Calipers_Naive(&hull[0],numHull,diameter,width,naiveArea,minPerimeter);
+			ASSERT(fabs(minArea[i] - naiveArea)<=1e-9*naiveArea);
+			ASSERT(CheckRectangle(&vertex[polygonStart[i]],n,rect,minArea[i],4*(rect.mHalfLength[0] + rect.mHalfLength[1]),1e-4));
+		}
+#endif
+	}
+}
+
 int main( )
 {
 	TestMinAreaRect();
+	TestRotatingCalipers();
+	TestMinAreaRectangleBatch();
 	return 0;
 }
\ No newline at end of file
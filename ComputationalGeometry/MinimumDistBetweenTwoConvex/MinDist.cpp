@@ -5,6 +5,8 @@
 //****************************************************************************/
 #include "SrGeometricTools.h"
 #include "SrDataType.h"
+#include "../Algorithms/ConvexPolygon.h"
+#include "../Algorithms/GJK.h"
 #include <time.h>
 #include <stdio.h>
 
@@ -39,16 +41,6 @@ void GenerateConvex(int numPoint, Real radius, const Point2D& center,Point2D* pt
 	delete []angle;
 }
 
-/*
-\brief	͹϶indxһ
-*/
-int Next(int indx, int n)
-{
-	if( indx==n-1 )
-		return 0;
-	else
-		return indx + 1;
-}
 /*
 \brief	ȽĴСؽСֵ
 */
@@ -211,6 +203,106 @@ void Test()
 	delete []pts2;
 }
 
+/*
+\brief	ᶨཻ͹εĴ͸ȣбߵķصȵСֵ
+*/
+Real PenetrationDepth_Naive(const Point2D* pts1,int n1, const Point2D* pts2, int n2)
+{
+	Real depth = SR_MAX_F32;
+	int i , j , k;
+	for( k=0 ; k<2 ; k++ )
+	{
+		const Point2D* pts = k==0 ? pts1 : pts2;
+		int n = k==0 ? n1 : n2;
+		for( i=0 ; i<n ; i++ )
+		{
+			Vector2D edge = pts[Next(i,n)] - pts[i];
+			Vector2D normal(edge.y,-edge.x);
+			normal.normalize();
+			Real min1 = SR_MAX_F32 , max1 = -SR_MAX_F32 , min2 = SR_MAX_F32 , max2 = -SR_MAX_F32;
+			for( j=0 ; j<n1 ; j++ )
+			{
+				min1 = Min(min1,normal.dot(pts1[j]));
+				max1 = -Min(-max1,-normal.dot(pts1[j]));
+			}
+			for( j=0 ; j<n2 ; j++ )
+			{
+				min2 = Min(min2,normal.dot(pts2[j]));
+				max2 = -Min(-max2,-normal.dot(pts2[j]));
+			}
+			depth = Min(depth,Min(max1 - min2,max2 - min1));
+		}
+	}
+	return depth;
+}
+
+void TestGJK()
+{
+	int numCase = 1000 , i , n1 , n2;
+	Point2D pts1[100] , pts2[100];
+	SrGJK2D gjk;
+	tGJKResult2D result;
+	for( i=0 ; i<numCase ; i++ )
+	{
+		n1 = 3 + rand()%97;
+		n2 = 3 + rand()%97;
+		GenerateConvex(n1,100 + rand()%100,Point2D(0,0),pts1);
+		GenerateConvex(n2,100 + rand()%100,Point2D(rand()%600 - 300,rand()%600 - 300),pts2);
+		SrPolygonShape2D shape1(pts1,n1) , shape2(pts2,n2);
+		if( !gjk.penetration(shape1,shape2,result) )
+		{
+			ASSERT(fabs(result.mDistance - MinimumDist_Naive(pts1,n1,pts2,n2))<1e-6);
+		}
+		else
+		{
+			ASSERT(fabs(result.mDistance + PenetrationDepth_Naive(pts1,n1,pts2,n2))<1e-6);
+		}
+		ASSERT((result.mPointB - result.mPointA - result.mNormal*result.mDistance).magnitude()<1e-6);
+	}
+
+	//͹ÿһ֡ƶһ㣬һ֡ĵοʼGJK
+	n1 = 200;
+	n2 = 300;
+	Point2D* polygon1 = new Point2D[n1];
+	Point2D* polygon2 = new Point2D[n2];
+	Point2D* moved = new Point2D[n2];
+	GenerateConvex(n1,1000,Point2D(0,0),polygon1);
+	GenerateConvex(n2,1000,Point2D(3000,0),polygon2);
+	int numFrame = 2000 , numSupport = 0 , numWarmSupport = 0 , j;
+	double timeCalipers = 0 , timeGJK = 0 , timeWarm = 0 , mTime;
+	SrGJKCache2D cache;
+	tGJKResult2D warmResult;
+	for( i=0 ; i<numFrame ; i++ )
+	{
+		Real angle = 2*SrPiF32*i / numFrame;
+		for( j=0 ; j<n2 ; j++ )
+			moved[j] = polygon2[j] + Vector2D(cos(angle) - 1,sin(angle))*500;
+		SrPolygonShape2D shape1(polygon1,n1) , shape2(moved,n2);
+
+		mTime = clock();
+		Real dist = MinimumDist_RotatingCalipers(polygon1,n1,moved,n2);
+		timeCalipers += clock() - mTime;
+		mTime = clock();
+		gjk.distance(shape1,shape2,result);
+		timeGJK += clock() - mTime;
+		mTime = clock();
+		gjk.distance(shape1,shape2,warmResult,&cache);
+		timeWarm += clock() - mTime;
+
+		ASSERT(fabs(result.mDistance - dist)<1e-6 && fabs(warmResult.mDistance - dist)<1e-6);
+		numSupport += result.mNumSupport;
+		numWarmSupport += warmResult.mNumSupport;
+	}
+	printf("Minimum Distance Time-Rotating Calipers:\t%f\n",timeCalipers / CLOCKS_PER_SEC);
+	printf("Minimum Distance Time-GJK              :\t%f\n",timeGJK / CLOCKS_PER_SEC);
+	printf("Minimum Distance Time-GJK Warm Start   :\t%f\n",timeWarm / CLOCKS_PER_SEC);
+	printf("Support Queries Per Frame-GJK          :\t%f\n",numSupport / (double)numFrame);
+	printf("Support Queries Per Frame-Warm Start   :\t%f\n",numWarmSupport / (double)numFrame);
+	delete []polygon1;
+	delete []polygon2;
+	delete []moved;
+}
+
 int main()
 {
 	int cntCas = 100;
@@ -220,5 +312,6 @@ int main()
 		printf("Case %d:\n",total-cntCas);
 		Test();
 	}
+	TestGJK();
 	return 0;
 }
\ No newline at end of file
@@ -6,140 +6,273 @@
 /************************************************************************		
 \description	Э㷨ƹƸ㼯СΧС
 ****************************************************************************/
-#include "SrGeometricTools.h"
-#include "SrDataType.h"
-#include "QuickHull.h"
+#include "../Algorithms/OBBCreation.h"
+
+
+/************************************************************************		
+							ΧеĴ
+****************************************************************************/
+#include <stdlib.h>
+#include <stdio.h>
+#include <time.h>
+#include <math.h>
+#include <algorithm>
+#include "SrEigen3.h"
 #include "gmm/gmm_dense_qr.h"
-/**
-\brief 3D oriented bounding box (OBB) class.
+
+/*
+\brief	ΧеĵλҰеĵ㡣
 */
-class SrOBBox3D
+void CheckOBB(const SrOBBox3D& obb,const SrPoint3D* point,int numPoint,SrReal tolerance)
 {
-public:
-	SrOBBox3D()
+	int i , j;
+	for( i=0 ; i<3 ; i++ )
 	{
-		mCenter = SrVector3D(0,0,0);
-		mAxis[0] = mAxis[1] = mAxis[2] = SrVector3D(0,0,0);
-		mHalfLength[0]	= mHalfLength[1] = mHalfLength[2] = 0;
+		ASSERT(fabs(obb.mAxis[i].magnitude() - 1)<1e-9);
+		ASSERT(fabs(obb.mAxis[i].dot(obb.mAxis[(i + 1) % 3]))<1e-9);
 	}
-	SrOBBox3D(const SrPoint3D& c,const SrVector3D* pAxis,const float* pHalfLength)
+	for( i=0 ; i<numPoint ; i++ )
+		for( j=0 ; j<3 ; j++ )
+			ASSERT(fabs(obb.mAxis[j].dot(point[i] - obb.mCenter))<=obb.mHalfLength[j] + tolerance);
+}
+
+/*
+\brief	һתĳɵ㣬8㡣
+*/
+void GenerateBoxPoints(SrPoint3D* point,int numPoint,const SrVector3D& halfLength)
+{
+	SrVector3D axis[3];
+	axis[0] = SrVector3D(rand() % 200 - 100,rand() % 200 - 100,rand() % 200 - 100);
+	if( axis[0].normalize()<1e-6 )
+		axis[0] = SrVector3D(1,0,0);
+	axis[1] = axis[0].cross(SrVector3D(rand() % 200 - 100,rand() % 200 - 100,rand() % 200 - 100));
+	if( axis[1].normalize()<1e-6 )
+		axis[1] = axis[0].cross(SrVector3D(0.3,-0.7,0.2));
+	axis[1].normalize();
+	axis[2] = axis[0].cross(axis[1]);
+	SrPoint3D center(rand() % 100,rand() % 100,rand() % 100);
+	int i , j;
+	for( i=0 ; i<numPoint ; i++ )
 	{
-		mCenter = c;
+		point[i] = center;
+		for( j=0 ; j<3 ; j++ )
+		{
+			SrReal t = i<8 ? (((i>>j)&1) ? 1 : -1) : (rand() % 2001 - 1000) / 1000.0;
+			point[i] += axis[j]*(t*halfLength[j]);
+		}
+	}
+}
 
-		mAxis[0] = pAxis[0];
-		mAxis[1] = pAxis[1];
-		mAxis[2] = pAxis[2];
+void TestOBBCreation()
+{
+	int numPoint = 2000 , numBox = 0 , i , k;
+	SrPoint3D* point = new SrPoint3D[numPoint];
+	QuickHull quickHull;
+	tHull hull;
+	SrOBBox3D pca , dito , tight;
+	double pcaTime = 0 , ditoTime = 0 , tightTime = 0 , mTime;
+	SrReal pcaVolume = 0 , ditoVolume = 0 , tightVolume = 0;
+	for( k=0 ; k<20 ; k++ )
+	{
+		//͹棬İΧо
+		SrVector3D halfLength(rand() % 20 + 1,rand() % 20 + 1,rand() % 20 + 1);
+		GenerateBoxPoints(point,numPoint,halfLength);
+		if( quickHull.quickHull(point,numPoint,&hull) )
+		{
+			pca = approximateSmallestOBB(&hull);
+			dito = tightSmallestOBB(&hull,true);
+			tight = tightSmallestOBB(&hull);
+			CheckOBB(pca,point,numPoint,1e-6);
+			CheckOBB(dito,point,numPoint,1e-6);
+			CheckOBB(tight,point,numPoint,1e-6);
+			SrReal volume = 8*halfLength.x*halfLength.y*halfLength.z;
+			ASSERT(fabs(OBBVolume(tight) - volume)<=1e-6*volume);
+			ASSERT(OBBVolume(tight)<=OBBVolume(pca)*(1 + 1e-9) && OBBVolume(dito)<=OBBVolume(pca)*(1 + 1e-9));
+			pcaVolume += OBBVolume(pca) / volume;
+			ditoVolume += OBBVolume(dito) / volume;
+			tightVolume += OBBVolume(tight) / volume;
+			delete []hull.mVertes;
+			delete []hull.mFacet;
+			numBox ++;
+		}
 
-		mHalfLength[0] = pHalfLength[0];
-		mHalfLength[1] = pHalfLength[1];
-		mHalfLength[2] = pHalfLength[2];
+		//ϵ㣬͹кܶ
+		for( i=0 ; i<numPoint ; i++ )
+		{
+			do
+			{
+				point[i] = SrPoint3D(rand() % 2001 - 1000,rand() % 2001 - 1000,rand() % 2001 - 1000);
+			} while( point[i].magnitude()<1 );
+			point[i] *= 10 / point[i].magnitude();
+		}
+		if( quickHull.quickHull(point,numPoint,&hull) )
+		{
+			mTime = clock();
+			pca = approximateSmallestOBB(&hull);
+			pcaTime += clock() - mTime;
+			mTime = clock();
+			dito = ditoOBB(point,numPoint);
+			ditoTime += clock() - mTime;
+			mTime = clock();
+			tight = tightSmallestOBB(&hull);
+			tightTime += clock() - mTime;
+			CheckOBB(pca,point,numPoint,1e-6);
+			CheckOBB(tight,point,numPoint,1e-6);
+			CheckOBB(dito,point,numPoint,1e-6);
+			ASSERT(OBBVolume(tight)<=OBBVolume(pca)*(1 + 1e-9));
+			delete []hull.mVertes;
+			delete []hull.mFacet;
+		}
 	}
-
-public:
-	SrPoint3D	mCenter;
-	SrVector3D	mAxis[3];
-	SrReal		mHalfLength[3];
-};
+	printf("Volume / Box: PCA %f, DiTO %f, Face Calipers %f\n",pcaVolume / numBox,ditoVolume / numBox,tightVolume / numBox);
+	printf("PCA OBB        :\t%f\n",pcaTime / CLOCKS_PER_SEC);
+	printf("DiTO OBB       :\t%f\n",ditoTime / CLOCKS_PER_SEC);
+	printf("Face Calipers  :\t%f\n",tightTime / CLOCKS_PER_SEC);
+	delete []point;
+}
 
 
 /*
-\brief	Э㷨ƹ͹СΧС
-\param[in]	hull	洢͹ݽṹЧ͹塣
-\return	SrOBBox3D	عƳСΧС
+\brief	ֵӴСУϵĵλAv = v
 */
-const SrOBBox3D approximateSmallestOBB(tHull* hull)
+void CheckEigen3(const SrReal matrix[3][3],const SrReal* eigenvalue,const SrVector3D* eigenvector)
 {
-	SrReal *		area = new SrReal[hull->mNumFacet];
-	SrPoint3D*		mass = new SrPoint3D[hull->mNumFacet];
-	SrVector3 normal;
-	SrPoint3D p0,p1,p2,tmp;
-	int i;
-	for( i=0 ; i<hull->mNumFacet ; i++ )
+	int i , j , k;
+	SrReal norm = 0 , residual;
+	for( i=0 ; i<3 ; i++ )
+		for( j=0 ; j<3 ; j++ )
+			norm += matrix[i][j]*matrix[i][j];
+	norm = sqrt(norm) + 1e-300;
+	ASSERT(eigenvalue[0]>=eigenvalue[1] && eigenvalue[1]>=eigenvalue[2]);
+	ASSERT((eigenvector[0].cross(eigenvector[1]) - eigenvector[2]).magnitude()<1e-12);
+	for( i=0 ; i<3 ; i++ )
 	{
-		p0 = hull->mVertes[hull->mFacet[i].mVInx[0]];
-		p1 = hull->mVertes[hull->mFacet[i].mVInx[1]];
-		p2 = hull->mVertes[hull->mFacet[i].mVInx[2]];
-
-		normal = (p1 - p0).cross(p2 - p0);
-		tmp = p0.cross(p1) + p1.cross(p2) + p2.cross(p0);
-
-		area[i] = tmp.dot(normal)*(SrReal)0.5;
-		mass[i] = (p0 + p1 + p2) / (SrReal)3.0;
+		ASSERT(fabs(eigenvector[i].magnitude() - 1)<1e-12);
+		ASSERT(fabs(eigenvector[i].dot(eigenvector[(i + 1) % 3]))<1e-12);
+		for( j=0 ; j<3 ; j++ )
+		{
+			residual = -eigenvalue[i]*eigenvector[i][j];
+			for( k=0 ; k<3 ; k++ )
+				residual += (j<=k ? matrix[j][k] : matrix[k][j])*eigenvector[i][k];
+			ASSERT(fabs(residual)<=1e-12*norm);
+		}
 	}
+}
 
-	SrReal		sumArea = 0.0;
-	SrPoint3D	sumMass = SrPoint3D(0,0,0);
-	for( i=0 ; i<hull->mNumFacet ; i++ )
+/*
+\brief	ĶԳƾһظֵѾǶԽ
+*/
+void GenerateSymmetric3(SrReal matrix[3][3])
+{
+	int i , j , type = rand() % 4;
+	SrReal value[3] , scale = pow(10.0,rand() % 13 - 6);
+	SrVector3D axis[3];
+	for( i=0 ; i<3 ; i++ )
+		value[i] = (rand() % 2001 - 1000)*scale;
+	if( type==1 )
+		value[1] = value[0];
+	else if( type==2 )
+		value[1] = value[2] = value[0];
+	do
+	{
+		axis[0] = SrVector3D(rand() % 2001 - 1000,rand() % 2001 - 1000,rand() % 2001 - 1000);
+	} while( axis[0].normalize()<1 );
+	do
 	{
-		sumArea += area[i];
-		sumMass += area[i]*mass[i];
+		axis[1] = axis[0].cross(SrVector3D(rand() % 2001 - 1000,rand() % 2001 - 1000,rand() % 2001 - 1000));
+	} while( axis[1].normalize()<1 );
+	axis[2] = axis[0].cross(axis[1]);
+	for( i=0 ; i<3 ; i++ )
+	{
+		for( j=0 ; j<3 ; j++ )
+		{
+			if( type==3 )
+				matrix[i][j] = i==j ? value[i] : 0;
+			else
+				matrix[i][j] = value[0]*axis[0][i]*axis[0][j] + value[1]*axis[1][i]*axis[1][j] + value[2]*axis[2][i]*axis[2][j];
+		}
 	}
-	sumMass = sumMass/sumArea;
-	SrPoint3D t = SrPoint3D(0,0,0);
+	for( i=0 ; i<3 ; i++ )
+		for( j=0 ; j<i ; j++ )
+			matrix[i][j] = matrix[j][i];
+}
 
-	SrReal covarMatrx[3][3];
-	int j , k;
+void TestSymmetricEigen3()
+{
+	int numMatrix = 100001 , i , j , k;
+	SrReal (*matrix)[3][3] = new SrReal[numMatrix][3][3];
+	SrReal* soa = new SrReal[18*numMatrix];
+	const SrReal* matrixSoA[6];
+	SrReal* eigenvalue[3];
+	SrReal* eigenvector[9];
+	for( i=0 ; i<6 ; i++ )
+		matrixSoA[i] = soa + i*numMatrix;
 	for( i=0 ; i<3 ; i++ )
+		eigenvalue[i] = soa + (6 + i)*numMatrix;
+	for( i=0 ; i<9 ; i++ )
+		eigenvector[i] = soa + (9 + i)*numMatrix;
+	for( i=0 ; i<numMatrix ; i++ )
 	{
-		for( j=i ; j<3 ; j++ )
+		GenerateSymmetric3(matrix[i]);
+		soa[i] = matrix[i][0][0];
+		soa[numMatrix + i] = matrix[i][0][1];
+		soa[2*numMatrix + i] = matrix[i][0][2];
+		soa[3*numMatrix + i] = matrix[i][1][1];
+		soa[4*numMatrix + i] = matrix[i][1][2];
+		soa[5*numMatrix + i] = matrix[i][2][2];
+	}
+	SrReal value[3] , batchValue[3];
+	SrVector3D vector[3] , batchVector[3];
+	double mTime , gmmTime , jacobiTime , batchTime;
+	SrEigen3::solveBatch(matrixSoA,numMatrix,eigenvalue,eigenvector);
+	for( i=0 ; i<numMatrix ; i++ )
+	{
+		SrEigen3::solve(matrix[i],value,vector);
+		CheckEigen3(matrix[i],value,vector);
+		for( k=0 ; k<3 ; k++ )
 		{
-			covarMatrx[i][j] = covarMatrx[j][i] = 0;
-			for( k=0 ; k<hull->mNumFacet ; k++ )
-			{
-				p0 = hull->mVertes[hull->mFacet[i].mVInx[0]];
-				p1 = hull->mVertes[hull->mFacet[i].mVInx[1]];
-				p2 = hull->mVertes[hull->mFacet[i].mVInx[2]];
-				covarMatrx[i][j] += area[k] * (9*mass[k][i]*mass[k][j] + p0[i]*p0[j] + p1[i]*p1[j] + p2[i]*p2[j]);
-			}
-			covarMatrx[i][j] = sumArea * covarMatrx[i][j] / (SrReal)12.0 - sumMass[i]*sumMass[j];
-			covarMatrx[j][i] = covarMatrx[i][j];
+			batchValue[k] = eigenvalue[k][i];
+			batchVector[k] = SrVector3D(eigenvector[3*k][i],eigenvector[3*k + 1][i],eigenvector[3*k + 2][i]);
 		}
+		CheckEigen3(matrix[i],batchValue,batchVector);
+		for( k=0 ; k<3 ; k++ )
+			ASSERT(fabs(value[k] - batchValue[k])<=1e-12*(fabs(value[0]) + fabs(value[2])));
 	}
 
-	gmm::dense_matrix<SrReal> cMatrix(3,3);
-
-	cMatrix(0,0) = covarMatrx[0][0]; cMatrix(0,1) = covarMatrx[0][1]; cMatrix(0,2) = covarMatrx[0][2];
-	cMatrix(1,0) = covarMatrx[1][0]; cMatrix(1,1) = covarMatrx[1][1]; cMatrix(1,2) = covarMatrx[1][2];
-	cMatrix(2,0) = covarMatrx[2][0]; cMatrix(2,1) = covarMatrx[2][1]; cMatrix(2,2) = covarMatrx[2][2];
-
-	//GMM++еĶԳQR㷨3*3Э
-	gmm::dense_matrix<SrReal>	eigvec(3,3);
-	std::vector<SrReal>			eigval(3);
-	gmm::symmetric_qr_algorithm( cMatrix, eigval, eigvec );
-
-	SrVector3D x( eigvec(0,0), eigvec(1,0), eigvec(2,0) );
-	SrVector3D y( eigvec(0,1), eigvec(1,1), eigvec(2,1) );
-	SrVector3D z( eigvec(0,2), eigvec(1,2), eigvec(2,2) );
-	x.normalize(); y.normalize();z.normalize();
-
-	SrVector3D minLen , maxLen;
-	SrVector3D tmpLen;
-	minLen.set(x.dot(hull->mVertes[0]),y.dot(hull->mVertes[0]),z.dot(hull->mVertes[0]));
-	maxLen = minLen;
-	for( i = 1 ; i<hull->mNumVertes ; i++ )
+	//GMM++ĶԳQR㷨Ƚֵ
+	gmm::dense_matrix<SrReal> cMatrix(3,3) , eigvec(3,3);
+	std::vector<SrReal> eigval(3);
+	mTime = clock();
+	for( i=0 ; i<numMatrix ; i++ )
 	{
-		tmpLen.set(x.dot(hull->mVertes[i]),y.dot(hull->mVertes[i]),z.dot(hull->mVertes[i]));
-		minLen.min(tmpLen);
-		maxLen.max(tmpLen);
+		for( j=0 ; j<3 ; j++ )
+			for( k=0 ; k<3 ; k++ )
+				cMatrix(j,k) = matrix[i][j][k];
+		gmm::symmetric_qr_algorithm(cMatrix,eigval,eigvec);
+		std::sort(eigval.begin(),eigval.end());
+		eigenvalue[0][i] = eigval[2];
+		eigenvalue[1][i] = eigval[1];
+		eigenvalue[2][i] = eigval[0];
 	}
-
-
-	SrOBBox3D obb;
-
-	obb.mAxis[0] = x;
-	obb.mAxis[1] = y;
-	obb.mAxis[2] = z;
-
-	obb.mHalfLength[0] = (maxLen.x - minLen.x)*(SrReal)0.5;
-	obb.mHalfLength[1] = (maxLen.y - minLen.y)*(SrReal)0.5;
-	obb.mHalfLength[2] = (maxLen.z - minLen.z)*(SrReal)0.5;
-
-	obb.mCenter = ((minLen.x + maxLen.x)*(SrReal)0.5)*x + ((minLen.y + maxLen.y)*(SrReal)0.5)*y + ((minLen.z + maxLen.z)*(SrReal)0.5)*z;
-
-	delete []area;
-	delete []mass;
-
-	return obb;
+	gmmTime = clock() - mTime;
+	for( i=0 ; i<numMatrix ; i++ )
+	{
+		SrEigen3::solve(matrix[i],value,vector);
+		for( k=0 ; k<3 ; k++ )
+			ASSERT(fabs(value[k] - eigenvalue[k][i])<=1e-9*(fabs(value[0]) + fabs(value[2])));
+	}
+	mTime = clock();
+	for( i=0 ; i<numMatrix ; i++ )
+		SrEigen3::solve(matrix[i],value,vector);
+	jacobiTime = clock() - mTime;
+	mTime = clock();
+	SrEigen3::solveBatch(matrixSoA,numMatrix,eigenvalue,eigenvector);
+	batchTime = clock() - mTime;
+	printf("GMM++ QR       :\t%f\n",gmmTime / CLOCKS_PER_SEC);
+	printf("Jacobi         :\t%f\n",jacobiTime / CLOCKS_PER_SEC);
+	printf("Jacobi Batch   :\t%f\n",batchTime / CLOCKS_PER_SEC);
+	delete []matrix;
+	delete []soa;
 }
 
 
@@ -363,6 +496,9 @@ void keyMessage(unsigned char key, int x, int y)
 
 int main(int argc,char ** argv)
 {
+	TestOBBCreation();
+	TestSymmetricEigen3();
+
 	glutInit(&argc,argv);
 	glutInitDisplayMode(GLUT_SINGLE|GLUT_RGB);
 	glutInitWindowSize(400,400);
@@ -6,332 +6,17 @@
 /************************************************************************		
 \description	
 ****************************************************************************/
-#include "../include/SrGeometricTools.h"
-#include "../include/SrDataType.h"
+#include "../Algorithms/OBBOverlapOBB.h"
+#include "../Algorithms/OBBOverlapOBBPacket.h"
+#include "../Algorithms/OBBSeparatingAxisCache.h"
+#include "../Algorithms/SweepAndPrune.h"
+#include "../Algorithms/GJK.h"
 #include <stdio.h>
-#include <math.h>
+#include <stdlib.h>
 #include <time.h>
-
-/**
-\brief 3D oriented bounding box (OBB) class.
-*/
-class SrOBBox3D
-{
-public:
-	SrOBBox3D()
-	{
-		mCenter = SrVector3D(0,0,0);
-		mAxis[0] = mAxis[1] = mAxis[2] = SrVector3D(0,0,0);
-		mHalfLength[0]	= mHalfLength[1] = mHalfLength[2] = 0;
-	}
-	SrOBBox3D(const SrPoint3D& c,const SrVector3D* pAxis,const SrReal* pHalfLength)
-	{
-		mCenter = c;
-		mAxis[0] = pAxis[0];
-		mAxis[1] = pAxis[1];
-		mAxis[2] = pAxis[2];
-
-		mHalfLength[0] = pHalfLength[0];
-		mHalfLength[1] = pHalfLength[1];
-		mHalfLength[2] = pHalfLength[2];
-	}
-	/**
-	\brief  The OBB is valid if one of the three axis is unit length, 
-			the length of them is greater than 0, and the axis should 
-			be perpendicular to each other.
-	*/
-	bool	isValid() const
-	{
-		if( UNEQUAL(mAxis[0].dot(mAxis[1]),0) ||
-			UNEQUAL(mAxis[0].dot(mAxis[2]),0)||
-			UNEQUAL(mAxis[1].dot(mAxis[2]),0))
-			return false;
-
-		if( LEQUAL(mHalfLength[0],0) || 
-			LEQUAL(mHalfLength[1],0) ||
-			LEQUAL(mHalfLength[2],0))
-			return false;
-		if( UNEQUAL(mAxis[0].magnitudeSquared(),1.0) ||
-			UNEQUAL(mAxis[1].magnitudeSquared(),1.0) ||
-			UNEQUAL(mAxis[2].magnitudeSquared(),1.0) )
-			return false;
-
-		return true;
-	}
-
-public:
-	SrPoint3D	mCenter;
-	SrVector3D	mAxis[3];
-	SrReal		mHalfLength[3];
-};
-
-//Case 1
-bool ASeparatingAxis(const SrPoint3D&t , const SrReal aHLen[3],const SrVector3D bFabsAxis[3],const SrReal bHLen[3])
-{
-	if( GREATER(fabs(t.x), aHLen[0] + bHLen[0]*bFabsAxis[0].x + bHLen[1]*bFabsAxis[1].x + bHLen[2]*bFabsAxis[2].x) )
-		return true;
-	if( GREATER(fabs(t.y), aHLen[1] + bHLen[0]*bFabsAxis[0].y + bHLen[1]*bFabsAxis[1].y + bHLen[2]*bFabsAxis[2].y) )
-		return true;
-	if( GREATER(fabs(t.z), aHLen[2] + bHLen[0]*bFabsAxis[0].z + bHLen[1]*bFabsAxis[1].z + bHLen[2]*bFabsAxis[2].z) )
-		return true;
-	return false;
-}
-
-//Case 2
-bool BSeparatingAxis(const SrPoint3D&t , const SrReal aHLen[3],const SrVector3D bFabsAxis[3],const SrReal bHLen[3])
-{
-	if( GREATER(fabs(t.x), aHLen[0]*bFabsAxis[0].x + aHLen[1]*bFabsAxis[0].y + aHLen[2]*bFabsAxis[0].z + bHLen[0]) )
-		return true;
-	if( GREATER(fabs(t.y), aHLen[0]*bFabsAxis[1].x + aHLen[1]*bFabsAxis[1].y + aHLen[2]*bFabsAxis[1].z + bHLen[1]) )
-		return true;
-	if( GREATER(fabs(t.z), aHLen[0]*bFabsAxis[2].x + aHLen[1]*bFabsAxis[2].y + aHLen[2]*bFabsAxis[2].z + bHLen[2]) )
-		return true;
-	return false;
-}
-
-bool ABSeparatingAxis(const SrPoint3D&c , const SrReal aHLen[3],const SrVector3D bAxis[3],const SrVector3D bFabsAxis[3],const SrReal bHLen[3])
-{
-	SrReal s , r;
-
-	//X and bAxis[0]
-	s = fabs(-bAxis[0].z*c.y + bAxis[0].y*c.z);
-	r = aHLen[1]*bFabsAxis[0].z + aHLen[2]*bFabsAxis[0].y + bHLen[1]*bFabsAxis[2].x + bHLen[2]*bFabsAxis[1].x;
-	if( GREATER(s,r) )	
-		return true;
-	//X and bAxis[1]
-	s = fabs(-bAxis[1].z*c.y + bAxis[1].y*c.z);
-	r = aHLen[1]*bFabsAxis[1].z + aHLen[2]*bFabsAxis[1].y + bHLen[0]*bFabsAxis[2].x + bHLen[2]*bFabsAxis[0].x;
-	if( GREATER(s,r) )	
-		return true;
-	//X and bAxis[2]
-	s = fabs(-bAxis[2].z*c.y + bAxis[2].y*c.z);
-	r = aHLen[1]*bFabsAxis[2].z + aHLen[2]*bFabsAxis[2].y + bHLen[0]*bFabsAxis[1].x + bHLen[1]*bFabsAxis[0].x;
-	if( GREATER(s,r) )
-		return true;
-
-	//Y and bAxis[0]
-	s = fabs(bAxis[0].z*c.x - bAxis[0].x*c.z);
-	r = aHLen[0]*bFabsAxis[0].z + aHLen[2]*bFabsAxis[0].x + bHLen[1]*bFabsAxis[2].y + bHLen[2]*bFabsAxis[1].y;
-	if( GREATER(s,r) )	
-		return true;
-	//Y and bAxis[1]
-	s = fabs(bAxis[1].z*c.x - bAxis[1].x*c.z);
-	r = aHLen[0]*bFabsAxis[1].z + aHLen[2]*bFabsAxis[1].x + bHLen[0]*bFabsAxis[2].y + bHLen[2]*bFabsAxis[0].y;
-	if( GREATER(s,r) )	
-		return true;
-	//Y and bAxis[2]
-	s = fabs(bAxis[2].z*c.x - bAxis[2].x*c.z);
-	r = aHLen[0]*bFabsAxis[2].z + aHLen[2]*bFabsAxis[2].x + bHLen[0]*bFabsAxis[1].y + bHLen[1]*bFabsAxis[0].y;
-	if( GREATER(s,r) )	
-		return true;
-
-	//Z and bAxis[0]
-	s = fabs(-bAxis[0].y*c.x + bAxis[0].x*c.y);
-	r = aHLen[0]*bFabsAxis[0].y + aHLen[1]*bFabsAxis[0].x + bHLen[1]*bFabsAxis[2].z + bHLen[2]*bFabsAxis[1].z;
-	if( GREATER(s,r) )
-		return true;
-	//Z and bAxis[1]
-	s = fabs(-bAxis[1].y*c.x + bAxis[1].x*c.y);
-	r = aHLen[0]*bFabsAxis[1].y + aHLen[1]*bFabsAxis[1].x + bHLen[0]*bFabsAxis[2].z + bHLen[2]*bFabsAxis[0].z;
-	if( GREATER(s,r) )	
-		return true;
-	//Z and bAxis[2]
-	s = fabs(-bAxis[2].y*c.x + bAxis[2].x*c.y);
-	r = aHLen[0]*bFabsAxis[2].y + aHLen[1]*bFabsAxis[2].x + bHLen[0]*bFabsAxis[1].z + bHLen[1]*bFabsAxis[0].z;
-	if( GREATER(s,r) )	
-		return true;
-
-	return false;
-}
-
-bool	OBBOverlapTestOBB_OptimizedSeparatingAxisMethod(const SrOBBox3D& obbA, const SrOBBox3D& obbB)
-{
-	SrVector3D bAxis[3], o, c, t;
-
-	o = obbB.mCenter - obbA.mCenter;
-
-	c.x = o.dot(obbA.mAxis[0]);
-	c.y = o.dot(obbA.mAxis[1]);
-	c.z = o.dot(obbA.mAxis[2]);
-
-	bAxis[0].x = obbA.mAxis[0].dot(obbB.mAxis[0]);
-	bAxis[0].y = obbA.mAxis[1].dot(obbB.mAxis[0]);
-	bAxis[0].z = obbA.mAxis[2].dot(obbB.mAxis[0]);
-
-	bAxis[1].x = obbA.mAxis[0].dot(obbB.mAxis[1]);
-	bAxis[1].y = obbA.mAxis[1].dot(obbB.mAxis[1]);
-	bAxis[1].z = obbA.mAxis[2].dot(obbB.mAxis[1]);
-
-	bAxis[2].x = obbA.mAxis[0].dot(obbB.mAxis[2]);
-	bAxis[2].y = obbA.mAxis[1].dot(obbB.mAxis[2]);
-	bAxis[2].z = obbA.mAxis[2].dot(obbB.mAxis[2]);
-
-	SrVector3D bFabsAxis[3];
-	bFabsAxis[0].set(fabs(bAxis[0].x),fabs(bAxis[0].y),fabs(bAxis[0].z));
-	bFabsAxis[1].set(fabs(bAxis[1].x),fabs(bAxis[1].y),fabs(bAxis[1].z));
-	bFabsAxis[2].set(fabs(bAxis[2].x),fabs(bAxis[2].y),fabs(bAxis[2].z));
-	//case 1
-	if( ASeparatingAxis(c, obbA.mHalfLength, bFabsAxis, obbB.mHalfLength) )
-		return false;
-	//case 2
-	t.set(c.dot(bAxis[0]),c.dot(bAxis[1]),c.dot(bAxis[2]));
-	if( BSeparatingAxis(t, obbA.mHalfLength, bFabsAxis, obbB.mHalfLength) )
-		return false;
-	////case 3
-	if( ABSeparatingAxis(c,obbA.mHalfLength,bAxis,bFabsAxis,obbB.mHalfLength) )
-		return false;
-	return true;
-}
-
-bool	OBBOverlapTestOBB_OptimizedSeparatingAxisMethod2(const SrOBBox3D& obbA, const SrOBBox3D& obbB)
-{
-	SrVector3D t;
-	t = obbB.mCenter - obbA.mCenter;
-	int i , j , k;
-	SrReal s , r;
-	for( i=0 ; i<3 ; i++ )
-	{
-		s = fabs(obbA.mAxis[i].dot(t));
-		r = obbA.mHalfLength[i];
-		for( j=0 ; j<3 ; j++ )
-			r += obbB.mHalfLength[j]*fabs(obbB.mAxis[j].dot(obbA.mAxis[i]));
-		if( GREATER(s,r) )
-			return false;
-	}
-	for( i=0 ; i<3 ; i++ )
-	{
-		s = fabs(obbB.mAxis[i].dot(t));
-		r = obbB.mHalfLength[i];
-		for( j=0 ; j<3 ; j++ )
-			r += obbA.mHalfLength[j]*fabs(obbA.mAxis[j].dot(obbB.mAxis[i]));
-		if( GREATER(s,r) )
-			return false;
-	}
-	SrVector3D n;
-	for( i=0 ; i<3 ; i++ )
-		for( j=0 ; j<3 ; j++ )
-		{
-			n = obbA.mAxis[i].cross(obbB.mAxis[j]);
-			s = fabs(n.dot(t));
-			r = 0.0;
-			for( k=0 ; k<3 ; k++ )
-				r += obbA.mHalfLength[k]*fabs(obbA.mAxis[k].dot(n)) + obbB.mHalfLength[k]*fabs(obbB.mAxis[k].dot(n));
-			if( GREATER(s,r) )
-				return false;
-		}
-
-	return true;
-}
-
-
-/*
-\brief	ж߶OBBǷص޷㡣
-		οģGregory, A., et al. "H-COLLIDE: A framework for fast and accurate collision detection for haptic interaction."
-\return	true	ص
-		false	ص
-*/
-bool SegmentOverlapTestOBB(const SrPoint3D& s0, const SrPoint3D& s1, const SrOBBox3D& obb)
-{
-	SrPoint3D point1 , point2;
-	SrVector3D p1 = s0 - obb.mCenter;
-	SrVector3D p2 = s1 - obb.mCenter;
-
-	point1.x = obb.mAxis[0].dot(p1);
-	point1.y = obb.mAxis[1].dot(p1);
-	point1.z = obb.mAxis[2].dot(p1);
-
-	point2.x = obb.mAxis[0].dot(p2);
-	point2.y = obb.mAxis[1].dot(p2);
-	point2.z = obb.mAxis[2].dot(p2);
-
-	SrPoint3D m = (point1 + point2)*0.5;
-	SrVector3D w = m - point1;
-
-	SrReal X = fabs(w.x), Y = fabs(w.y) , Z = fabs(w.z);
-	if( GREATER(fabs(m.x),X+obb.mHalfLength[0]) )
-		return false;
-	if( GREATER(fabs(m.y),Y+obb.mHalfLength[1]) )
-		return false;
-	if( GREATER(fabs(m.z),Z+obb.mHalfLength[2]) )
-		return false;
-	if( GREATER(fabs(m.y*w.z - m.z*w.y),obb.mHalfLength[1]*Z + obb.mHalfLength[2]*Y) )
-		return false;
-	if( GREATER(fabs(m.x*w.z - m.z*w.x),obb.mHalfLength[0]*Z + obb.mHalfLength[2]*X) )
-		return false;
-	if( GREATER(fabs(m.x*w.y - m.y*w.x),obb.mHalfLength[0]*Y + obb.mHalfLength[1]*X) )
-		return false;
-	return true;
-}
-
-bool SubOBBOverlapTestOBB_NaiveMethod(const SrOBBox3D& obbA, const SrOBBox3D& obbB)
-{
-	SrPoint3D s0 , s1;
-
-	//X Direction
-	s0 = obbA.mCenter + obbA.mHalfLength[0]*obbA.mAxis[0] + obbA.mHalfLength[1]*obbA.mAxis[1] + obbA.mHalfLength[2]*obbA.mAxis[2];
-	s1 = obbA.mCenter - obbA.mHalfLength[0]*obbA.mAxis[0] + obbA.mHalfLength[1]*obbA.mAxis[1] + obbA.mHalfLength[2]*obbA.mAxis[2];
-	if( SegmentOverlapTestOBB(s0,s1,obbB) )
-		return true;
-	s0 = obbA.mCenter + obbA.mHalfLength[0]*obbA.mAxis[0] - obbA.mHalfLength[1]*obbA.mAxis[1] + obbA.mHalfLength[2]*obbA.mAxis[2];
-	s1 = obbA.mCenter - obbA.mHalfLength[0]*obbA.mAxis[0] - obbA.mHalfLength[1]*obbA.mAxis[1] + obbA.mHalfLength[2]*obbA.mAxis[2];
-	if( SegmentOverlapTestOBB(s0,s1,obbB) )
-		return true;
-	s0 = obbA.mCenter + obbA.mHalfLength[0]*obbA.mAxis[0] + obbA.mHalfLength[1]*obbA.mAxis[1] - obbA.mHalfLength[2]*obbA.mAxis[2];
-	s1 = obbA.mCenter - obbA.mHalfLength[0]*obbA.mAxis[0] + obbA.mHalfLength[1]*obbA.mAxis[1] - obbA.mHalfLength[2]*obbA.mAxis[2];
-	if( SegmentOverlapTestOBB(s0,s1,obbB) )
-		return true;
-	s0 = obbA.mCenter + obbA.mHalfLength[0]*obbA.mAxis[0] - obbA.mHalfLength[1]*obbA.mAxis[1] - obbA.mHalfLength[2]*obbA.mAxis[2];
-	s1 = obbA.mCenter - obbA.mHalfLength[0]*obbA.mAxis[0] - obbA.mHalfLength[1]*obbA.mAxis[1] - obbA.mHalfLength[2]*obbA.mAxis[2];
-	if( SegmentOverlapTestOBB(s0,s1,obbB) )
-		return true;
-	//Y Direction
-	s0 = obbA.mCenter + obbA.mHalfLength[0]*obbA.mAxis[0] - obbA.mHalfLength[1]*obbA.mAxis[1] + obbA.mHalfLength[2]*obbA.mAxis[2];
-	s1 = obbA.mCenter + obbA.mHalfLength[0]*obbA.mAxis[0] + obbA.mHalfLength[1]*obbA.mAxis[1] + obbA.mHalfLength[2]*obbA.mAxis[2];
-	if( SegmentOverlapTestOBB(s0,s1,obbB) )
-		return true;
-	s0 = obbA.mCenter - obbA.mHalfLength[0]*obbA.mAxis[0] - obbA.mHalfLength[1]*obbA.mAxis[1] + obbA.mHalfLength[2]*obbA.mAxis[2];
-	s1 = obbA.mCenter - obbA.mHalfLength[0]*obbA.mAxis[0] + obbA.mHalfLength[1]*obbA.mAxis[1] + obbA.mHalfLength[2]*obbA.mAxis[2];
-	if( SegmentOverlapTestOBB(s0,s1,obbB) )
-		return true;
-	s0 = obbA.mCenter + obbA.mHalfLength[0]*obbA.mAxis[0] - obbA.mHalfLength[1]*obbA.mAxis[1] - obbA.mHalfLength[2]*obbA.mAxis[2];
-	s1 = obbA.mCenter + obbA.mHalfLength[0]*obbA.mAxis[0] + obbA.mHalfLength[1]*obbA.mAxis[1] - obbA.mHalfLength[2]*obbA.mAxis[2];
-	if( SegmentOverlapTestOBB(s0,s1,obbB) )
-		return true;
-	s0 = obbA.mCenter - obbA.mHalfLength[0]*obbA.mAxis[0] - obbA.mHalfLength[1]*obbA.mAxis[1] - obbA.mHalfLength[2]*obbA.mAxis[2];
-	s1 = obbA.mCenter - obbA.mHalfLength[0]*obbA.mAxis[0] + obbA.mHalfLength[1]*obbA.mAxis[1] - obbA.mHalfLength[2]*obbA.mAxis[2];
-	if( SegmentOverlapTestOBB(s0,s1,obbB) )
-		return true;
-
-	//Z Direction
-	s0 = obbA.mCenter + obbA.mHalfLength[0]*obbA.mAxis[0] + obbA.mHalfLength[1]*obbA.mAxis[1] - obbA.mHalfLength[2]*obbA.mAxis[2];
-	s1 = obbA.mCenter + obbA.mHalfLength[0]*obbA.mAxis[0] + obbA.mHalfLength[1]*obbA.mAxis[1] + obbA.mHalfLength[2]*obbA.mAxis[2];
-	if( SegmentOverlapTestOBB(s0,s1,obbB) )
-		return true;
-	s0 = obbA.mCenter - obbA.mHalfLength[0]*obbA.mAxis[0] + obbA.mHalfLength[1]*obbA.mAxis[1] - obbA.mHalfLength[2]*obbA.mAxis[2];
-	s1 = obbA.mCenter - obbA.mHalfLength[0]*obbA.mAxis[0] + obbA.mHalfLength[1]*obbA.mAxis[1] + obbA.mHalfLength[2]*obbA.mAxis[2];
-	if( SegmentOverlapTestOBB(s0,s1,obbB) )
-		return true;
-	s0 = obbA.mCenter + obbA.mHalfLength[0]*obbA.mAxis[0] - obbA.mHalfLength[1]*obbA.mAxis[1] - obbA.mHalfLength[2]*obbA.mAxis[2];
-	s1 = obbA.mCenter + obbA.mHalfLength[0]*obbA.mAxis[0] - obbA.mHalfLength[1]*obbA.mAxis[1] + obbA.mHalfLength[2]*obbA.mAxis[2];
-	if( SegmentOverlapTestOBB(s0,s1,obbB) )
-		return true;
-	s0 = obbA.mCenter - obbA.mHalfLength[0]*obbA.mAxis[0] - obbA.mHalfLength[1]*obbA.mAxis[1] - obbA.mHalfLength[2]*obbA.mAxis[2];
-	s1 = obbA.mCenter - obbA.mHalfLength[0]*obbA.mAxis[0] - obbA.mHalfLength[1]*obbA.mAxis[1] + obbA.mHalfLength[2]*obbA.mAxis[2];
-	if( SegmentOverlapTestOBB(s0,s1,obbB) )
-		return true;
-
-	return false;
-}
-
-bool OBBOverlapTestOBB_NaiveMethod(const SrOBBox3D& obbA, const SrOBBox3D& obbB)
-{
-	
-	if( SubOBBOverlapTestOBB_NaiveMethod(obbA,obbB) )
-		return true;
-	if( SubOBBOverlapTestOBB_NaiveMethod(obbB,obbA) )
-		return true;
-	return false;
-}
+#include <vector>
+#include <algorithm>
+#include <math.h>
 
 const SrOBBox3D RandomOBB(int range)
 {
@@ -415,8 +100,415 @@ void Test_OBBOverlapTestOBB()
 
 
 
+void Test_OBBOverlapTestOBB_Packet()
+{
+	int numObb = 10000 , i , j , k , count;
+	SrOBBox3D* obbA = new SrOBBox3D[numObb];
+	SrOBBox3D* obbB = new SrOBBox3D[numObb];
+	SrOBBox3DSoA soaA(numObb) , soaB(numObb);
+	int* overlapIndex = new int[numObb];
+
+	int range = 100;
+	for( i=0 ; i<numObb ; i++ )
+	{
+		obbA[i] = RandomOBB(range);
+		obbB[i] = RandomOBB(range);
+		soaA.setBox(i,obbA[i]);
+		soaB.setBox(i,obbB[i]);
+	}
+
+	//The packet versions must give exactly the same decision as the scalar one.
+	count = OBBOverlapTestOBB_PairBatch(soaA,soaB,overlapIndex);
+	for( i=0 , k=0 ; i<numObb ; i++ )
+	{
+		bool status = k<count && overlapIndex[k]==i;
+		if( status )
+			k ++;
+		ASSERT(status == OBBOverlapTestOBB_OptimizedSeparatingAxisMethod(obbA[i],obbB[i]));
+	}
+	for( j=0 ; j<100 ; j++ )
+	{
+		count = OBBOverlapTestOBB_Batch(obbA[j],soaB,overlapIndex);
+		for( i=0 , k=0 ; i<numObb ; i++ )
+		{
+			bool status = k<count && overlapIndex[k]==i;
+			if( status )
+				k ++;
+			ASSERT(status == OBBOverlapTestOBB_OptimizedSeparatingAxisMethod(obbA[j],obbB[i]));
+		}
+	}
+
+	double mTime ;
+	mTime = clock();
+	for( j=0 ; j<100 ; j++ )
+		for( i=0 ; i<numObb ; i++ )
+			OBBOverlapTestOBB_OptimizedSeparatingAxisMethod(obbA[j],obbB[i]);
+	mTime = (clock() - mTime) / CLOCKS_PER_SEC;
+	printf("%f\n",mTime);
+
+	mTime = clock();
+	for( j=0 ; j<100 ; j++ )
+		OBBOverlapTestOBB_Batch(obbA[j],soaB,overlapIndex);
+	mTime = (clock() - mTime) / CLOCKS_PER_SEC;
+	printf("%f\n",mTime);
+
+	delete []obbA;
+	delete []obbB;
+	delete []overlapIndex;
+}
+
+void Test_SeparatingAxisCache()
+{
+	int numObb = 1000 , numFrame = 50 , i , j , k;
+	SrOBBox3D* obb = new SrOBBox3D[numObb];
+	SrVector3D* velocity = new SrVector3D[numObb];
+	std::vector<int> pairA , pairB;
+	SrSeparatingAxisCache cache;
+
+	int range = 100;
+	for( i=0 ; i<numObb ; i++ )
+	{
+		obb[i] = RandomOBB(range);
+		obb[i].mCenter *= 20;
+		velocity[i] = SrVector3D(rand()%11 - 5,rand()%11 - 5,rand()%11 - 5)*0.1;
+	}
+	//The candidate pairs, whose bounding spheres overlap, play the role of a broad phase.
+	SrReal ri , rj;
+	for( i=0 ; i<numObb ; i++ )
+		for( j=i+1 ; j<numObb ; j++ )
+		{
+			ri = obb[i].mHalfLength[0] + obb[i].mHalfLength[1] + obb[i].mHalfLength[2];
+			rj = obb[j].mHalfLength[0] + obb[j].mHalfLength[1] + obb[j].mHalfLength[2];
+			if( (obb[i].mCenter - obb[j].mCenter).magnitudeSquared()<(ri + rj)*(ri + rj) )
+			{
+				pairA.push_back(i);
+				pairB.push_back(j);
+				//Without a cached axis, the search must agree with the overlap test.
+				ASSERT((OBBFindSeparatingAxis(obb[i],obb[j],-1)<0) == OBBOverlapTestOBB_OptimizedSeparatingAxisMethod(obb[i],obb[j]));
+			}
+		}
+	int numPair = (int)pairA.size();
+
+	double cacheTime = 0 , plainTime = 0 , mTime;
+	for( k=0 ; k<numFrame ; k++ )
+	{
+		for( i=0 ; i<numObb ; i++ )
+			obb[i].mCenter += velocity[i];
+		mTime = clock();
+		for( i=0 ; i<numPair ; i++ )
+			OBBOverlapTestOBB_OptimizedSeparatingAxisMethod(obb[pairA[i]],obb[pairB[i]]);
+		plainTime += clock() - mTime;
+		mTime = clock();
+		cache.nextGeneration();
+		for( i=0 ; i<numPair ; i++ )
+			cache.overlap(pairA[i],obb[pairA[i]],pairB[i],obb[pairB[i]]);
+		cacheTime += clock() - mTime;
+	}
+	printf("%d pairs, hit rate: %f\n",numPair,cache.hitRate());
+	printf("%f %f\n",plainTime / CLOCKS_PER_SEC,cacheTime / CLOCKS_PER_SEC);
+
+	//A cached axis never changes the result.
+	for( i=0 ; i<numPair ; i++ )
+		ASSERT(cache.overlap(pairA[i],obb[pairA[i]],pairB[i],obb[pairB[i]]) == OBBOverlapTestOBB_OptimizedSeparatingAxisMethod(obb[pairA[i]],obb[pairB[i]]));
+	//After the cache is invalidated, the first query of a pair is always a miss.
+	cache.invalidateAll();
+	cache.resetCounter();
+	cache.overlap(pairA[0],obb[pairA[0]],pairB[0],obb[pairB[0]]);
+	ASSERT(cache.mNumMiss == 1);
+
+	//Every frame queries numPair new pairs, the pairs of older frames are evicted and the table stays bounded.
+	SrSeparatingAxisCache boundedCache(16);
+	for( k=0 ; k<numFrame ; k++ )
+	{
+		boundedCache.nextGeneration();
+		for( i=0 ; i<numPair ; i++ )
+			boundedCache.overlap(k*numObb + pairA[i],obb[pairA[i]],pairB[i],obb[pairB[i]]);
+		ASSERT(boundedCache.capacity()<8*(2*numPair + 1));
+	}
+
+	delete []obb;
+	delete []velocity;
+}
+
+const SrOBBox3D RandomSmallOBB(int range)
+{
+	SrOBBox3D obb = RandomOBB(range);
+	obb.mCenter *= 10;
+	obb.mHalfLength[0] *= 0.1;
+	obb.mHalfLength[1] *= 0.1;
+	obb.mHalfLength[2] *= 0.1;
+	return obb;
+}
+
+bool BoxPairLess(const tBoxPair& p1,const tBoxPair& p2)
+{
+	return p1.mBox1<p2.mBox1 || (p1.mBox1==p2.mBox1 && p1.mBox2<p2.mBox2);
+}
+
+void Test_SweepAndPrune()
+{
+	int numObb = 1000 , numFrame = 20 , numAxis , i , j , k , c;
+	std::vector<SrOBBox3D> obb(numObb);
+	std::vector<int> id(numObb);
+	BoxPairArray pairs , overlapPairs , bruteForce;
+	SrVector3D velocity;
+	SrSeparatingAxisCache cache;
+
+	int range = 100;
+	for( numAxis=1 ; numAxis<=3 ; numAxis++ )
+	{
+		SrSweepAndPrune sap(numAxis);
+		for( i=0 ; i<numObb ; i++ )
+			obb[i] = RandomSmallOBB(range);
+		//Half of the boxes are built at once, the others are added one by one.
+		sap.build(&obb[0],numObb/2);
+		for( i=0 ; i<numObb ; i++ )
+			id[i] = i<numObb/2 ? i : sap.addBox(obb[i]);
+		for( k=0 ; k<numFrame ; k++ )
+		{
+			for( i=0 ; i<numObb ; i++ )
+			{
+				velocity = SrVector3D(rand()%21 - 10,rand()%21 - 10,rand()%21 - 10);
+				obb[i].mCenter += velocity;
+				if( rand()%50==0 )
+				{
+					sap.removeBox(id[i]);
+					id[i] = sap.addBox(obb[i]);
+				}
+				else
+					sap.updateBox(id[i],obb[i]);
+			}
+			//Compare with the brute force overlap test of the AABBs.
+			bruteForce.clear();
+			for( i=0 ; i<numObb ; i++ )
+				for( j=0 ; j<numObb ; j++ )
+				{
+					if( id[i]>=id[j] )
+						continue;
+					for( c=0 ; c<3 ; c++ )
+					{
+						SrReal ei = 0 , ej = 0;
+						for( int m=0 ; m<3 ; m++ )
+						{
+							ei += obb[i].mHalfLength[m]*fabs(obb[i].mAxis[m][c]);
+							ej += obb[j].mHalfLength[m]*fabs(obb[j].mAxis[m][c]);
+						}
+						if( obb[i].mCenter[c] - ei>obb[j].mCenter[c] + ej || obb[j].mCenter[c] - ej>obb[i].mCenter[c] + ei )
+							break;
+					}
+					if( c==3 )
+					{
+						tBoxPair pair;
+						pair.mBox1 = id[i];
+						pair.mBox2 = id[j];
+						bruteForce.push_back(pair);
+					}
+				}
+			sap.findPairs(pairs);
+			ASSERT(pairs.size()==bruteForce.size());
+			std::sort(pairs.begin(),pairs.end(),BoxPairLess);
+			std::sort(bruteForce.begin(),bruteForce.end(),BoxPairLess);
+			for( i=0 ; i<(int)pairs.size() ; i++ )
+				ASSERT(pairs[i].mBox1==bruteForce[i].mBox1 && pairs[i].mBox2==bruteForce[i].mBox2);
+
+			sap.findOverlapPairs(overlapPairs,&cache);
+			for( i=0 , j=0 ; i<(int)pairs.size() ; i++ )
+			{
+				bool status = OBBOverlapTestOBB_OptimizedSeparatingAxisMethod(sap.getBox(pairs[i].mBox1),sap.getBox(pairs[i].mBox2));
+				if( status )
+					j ++;
+			}
+			ASSERT(j==(int)overlapPairs.size());
+		}
+		cache.invalidateAll();
+	}
+
+	//100k boxes moving coherently.
+	numObb = 100000;
+	obb.resize(numObb);
+	std::vector<SrVector3D> velocities(numObb);
+	for( i=0 ; i<numObb ; i++ )
+	{
+		obb[i] = RandomSmallOBB(range);
+		obb[i].mCenter = SrPoint3D(rand()%10000,rand()%10000,rand()%10000)*0.5;
+		velocities[i] = SrVector3D(rand()%11 - 5,rand()%11 - 5,rand()%11 - 5)*0.1;
+	}
+	SrSweepAndPrune sap(3);
+	double mTime = clock();
+	sap.build(&obb[0],numObb);
+	printf("build: %f, %d pairs\n",(clock() - mTime) / CLOCKS_PER_SEC,sap.numPair());
+	mTime = clock();
+	for( k=0 ; k<numFrame ; k++ )
+	{
+		for( i=0 ; i<numObb ; i++ )
+		{
+			obb[i].mCenter += velocities[i];
+			sap.updateBox(i,obb[i]);
+		}
+		sap.findOverlapPairs(overlapPairs);
+	}
+	printf("update: %f per frame, %d swaps per frame, %d overlapping pairs\n",
+		(clock() - mTime) / CLOCKS_PER_SEC / numFrame,sap.mNumSwap / numFrame,(int)overlapPairs.size());
+}
+
+/*
+\brief	The penetration depth of two OBBs by the separating axis theorem, the minimum overlap on the 15 axes.
+*/
+SrReal OBBPenetrationDepth(const SrOBBox3D& obbA,const SrOBBox3D& obbB)
+{
+	SrVector3D axis[15] , d = obbB.mCenter - obbA.mCenter;
+	int i , j , numAxis = 0;
+	for( i=0 ; i<3 ; i++ )
+	{
+		axis[numAxis++] = obbA.mAxis[i];
+		axis[numAxis++] = obbB.mAxis[i];
+		for( j=0 ; j<3 ; j++ )
+		{
+			axis[numAxis] = obbA.mAxis[i].cross(obbB.mAxis[j]);
+			if( axis[numAxis].normalize()>1e-6 )
+				numAxis ++;
+		}
+	}
+	SrReal depth = SR_MAX_F64 , overlap;
+	for( i=0 ; i<numAxis ; i++ )
+	{
+		overlap = -fabs(axis[i].dot(d));
+		for( j=0 ; j<3 ; j++ )
+			overlap += obbA.mHalfLength[j]*fabs(obbA.mAxis[j].dot(axis[i])) + obbB.mHalfLength[j]*fabs(obbB.mAxis[j].dot(axis[i]));
+		if( overlap<depth )
+			depth = overlap;
+	}
+	return depth;
+}
+
+/*
+\brief	A GJK result is right if the closest points are on the shapes and the plane with
+		the normal through them separates the shapes, or if the shapes overlap by the
+		penetration depth along the normal.
+*/
+bool CheckGJKResult(const SrConvexShape3D& shapeA,const SrConvexShape3D& shapeB,const tGJKResult3D& result)
+{
+	SrReal maxA = shapeA.support(result.mNormal).dot(result.mNormal) + shapeA.mMargin;
+	SrReal minB = shapeB.support(-result.mNormal).dot(result.mNormal) - shapeB.mMargin;
+	SrReal tolerance = 1e-6*(1 + fabs(maxA) + fabs(minB));
+	return fabs(result.mNormal.magnitude() - 1)<1e-9 &&
+		(result.mPointB - result.mPointA - result.mNormal*result.mDistance).magnitude()<tolerance &&
+		fabs(minB - maxA - result.mDistance)<tolerance &&
+		fabs(result.mPointA.dot(result.mNormal) - maxA)<tolerance &&
+		fabs(result.mPointB.dot(result.mNormal) - minB)<tolerance;
+}
+
+const SrTriangle3D RandomTriangle(int range)
+{
+	SrTriangle3D triangle;
+	do
+	{
+		for( int i=0 ; i<3 ; i++ )
+			triangle.mPoint[i] = SrPoint3D(rand() % range,rand() % range,rand() % range);
+	} while (!triangle.isValid());
+	return triangle;
+}
+
+void Test_GJK()
+{
+	int numCase = 2000 , numPoint = 200 , range = 100 , i , j;
+	SrGJK3D gjk;
+	tGJKResult3D result , warmResult;
+	for( i=0 ; i<numCase ; i++ )
+	{
+		//Spheres, the core shapes are points.
+		SrSphere3D sphereA(SrPoint3D(rand() % range,rand() % range,rand() % range),1 + rand() % 30);
+		SrSphere3D sphereB(SrPoint3D(rand() % range,rand() % range,rand() % range),1 + rand() % 30);
+		SrSphereShape3D shapeSphereA(sphereA) , shapeSphereB(sphereB);
+		gjk.penetration(shapeSphereA,shapeSphereB,result);
+		ASSERT(fabs(result.mDistance - (sphereA.mCenter.distance(sphereB.mCenter) - sphereA.mRadius - sphereB.mRadius))<1e-9);
+		ASSERT(CheckGJKResult(shapeSphereA,shapeSphereB,result));
+
+		//OBBs, the penetration depth is the same as the separating axis theorem.
+		SrOBBox3D obbA = RandomOBB(range) , obbB = RandomOBB(range);
+		obbA.mCenter *= 2;
+		obbB.mCenter *= 2;
+		SrOBBShape3D shapeObbA(obbA) , shapeObbB(obbB);
+		if( gjk.penetration(shapeObbA,shapeObbB,result) )
+		{
+			ASSERT(OBBOverlapTestOBB_OptimizedSeparatingAxisMethod(obbA,obbB));
+			ASSERT(fabs(result.mDistance + OBBPenetrationDepth(obbA,obbB))<1e-6*range);
+		}
+		else
+		{
+			ASSERT(!OBBOverlapTestOBB_OptimizedSeparatingAxisMethod(obbA,obbB));
+		}
+		ASSERT(CheckGJKResult(shapeObbA,shapeObbB,result));
+
+		//Convex hulls against triangles and spheres.
+		SrPoint3D point[200];
+		SrPoint3D center(rand() % range,rand() % range,rand() % range);
+		for( j=0 ; j<numPoint ; j++ )
+			point[j] = center + SrVector3D(rand() % range,rand() % range,rand() % range)*0.3;
+		QuickHull quickHull;
+		tHull hull;
+		if( !quickHull.quickHull(point,numPoint,&hull) )
+			continue;
+		SrHullShape3D shapeHull(&hull);
+		SrTriangleShape3D shapeTriangle(RandomTriangle(range));
+		gjk.penetration(shapeHull,shapeTriangle,result);
+		ASSERT(CheckGJKResult(shapeHull,shapeTriangle,result));
+		gjk.penetration(shapeSphereA,shapeHull,result);
+		ASSERT(CheckGJKResult(shapeSphereA,shapeHull,result));
+		gjk.penetration(shapeHull,shapeObbB,result);
+		ASSERT(CheckGJKResult(shapeHull,shapeObbB,result));
+
+		//The support function climbing on the hull gives the same result.
+		SrHullExtremePoint extremePoint;
+		extremePoint.build(&hull);
+		SrHullShape3D shapeClimb(&extremePoint);
+		gjk.penetration(shapeClimb,shapeObbB,warmResult);
+		ASSERT(fabs(result.mDistance - warmResult.mDistance)<1e-6*range);
+		delete []hull.mVertes;
+		delete []hull.mFacet;
+	}
+
+	//The boxes move a little every frame, the last simplex of a pair starts the next query.
+	int numObb = 200 , numFrame = 50 , k , numQuery = 0 , numSupport = 0 , numWarmSupport = 0;
+	std::vector<SrOBBox3D> obb(numObb);
+	std::vector<SrVector3D> velocity(numObb);
+	std::vector<SrGJKCache3D> cache(numObb*numObb);
+	for( i=0 ; i<numObb ; i++ )
+	{
+		obb[i] = RandomSmallOBB(range);
+		velocity[i] = SrVector3D(rand()%11 - 5,rand()%11 - 5,rand()%11 - 5)*0.1;
+	}
+	double plainTime = 0 , warmTime = 0 , mTime;
+	for( k=0 ; k<numFrame ; k++ )
+	{
+		for( i=0 ; i<numObb ; i++ )
+			obb[i].mCenter += velocity[i];
+		for( i=0 ; i<numObb ; i++ )
+			for( j=i+1 ; j<numObb ; j++ )
+			{
+				SrOBBShape3D shapeA(obb[i]) , shapeB(obb[j]);
+				mTime = clock();
+				gjk.penetration(shapeA,shapeB,result);
+				plainTime += clock() - mTime;
+				mTime = clock();
+				gjk.penetration(shapeA,shapeB,warmResult,&cache[i*numObb + j]);
+				warmTime += clock() - mTime;
+				ASSERT(fabs(result.mDistance - warmResult.mDistance)<1e-6*range);
+				numQuery ++;
+				numSupport += result.mNumSupport;
+				numWarmSupport += warmResult.mNumSupport;
+			}
+	}
+	printf("GJK: %f, %f support queries per pair\n",plainTime / CLOCKS_PER_SEC,numSupport / (double)numQuery);
+	printf("GJK warm start: %f, %f support queries per pair\n",warmTime / CLOCKS_PER_SEC,numWarmSupport / (double)numQuery);
+}
+
 int main( )
 {
 	Test_OBBOverlapTestOBB();
+	Test_OBBOverlapTestOBB_Packet();
+	Test_SeparatingAxisCache();
+	Test_SweepAndPrune();
+	Test_GJK();
 	return 0;
 }
\ No newline at end of file
@@ -9,275 +9,16 @@
 				ͨͶӰΧĵƽľķ
 				ʵƽAABBOBBཻԡ
 ****************************************************************************/
-#include "../include/SrGeometricTools.h"
-#include "../include/SrDataType.h"
+#include "../Algorithms/PlaneHitTestBV.h"
+#include "../Algorithms/DynamicAABBTree.h"
 #include <stdio.h>
 #include <math.h>
 #include <time.h>
-
-
-/**
-\brief 3D axis-aligned bounding box (AABB) class.
-*/
-class SrAABBox3D
-{
-public:
-	SrAABBox3D()
-	{
-		mMinAABB.set(0,0,0);
-		mMaxAABB.set(0,0,0);
-	}
-	SrAABBox3D(const SrPoint3D& mn,const SrPoint3D& mx)
-	{
-		mMinAABB = mn;
-		mMaxAABB = mx;
-	}
-	/**
-	\brief The AABB is valid if the three components in "minAABB" are greater to those in "maxAABB".
-	*/
-	bool	isValid() const
-	{
-		if( GEQUAL(mMinAABB.x,mMaxAABB.x) ||
-			GEQUAL(mMinAABB.y,mMaxAABB.y) ||
-			GEQUAL(mMinAABB.z,mMaxAABB.z))
-			return false;
-		return true;
-	}
-
-public:
-	SrPoint3D mMinAABB;
-	SrPoint3D mMaxAABB;
-};
-
-
-/**
-\brief 3D plane class.
-
-This is a 3D plane class with public data members.
-The line is parameterized as ^n*^X+d=0,in which ^n is the 'normal' data,d is the 'd' data.
-The normal isn't normalized.
-*/
-class SrPlane3D
-{
-public:
-	/**
-	\brief Default constructor.
-	*/
-	SrPlane3D()
-	{
-		mNormal.set(0,0,0);
-		mD = 0;
-	}
-	bool init(const SrPoint3D& p0,const SrPoint3D& p1,const SrPoint3D&p2)
-	{
-		SrVector3D norm = (p1-p0).cross(p2-p0);
-		if(EQUAL(norm.x,0)&&EQUAL(norm.y,0)&&EQUAL(norm.z,0))
-			return false;
-		mNormal = norm;
-		mD = -mNormal.dot(p0);
-		return true;
-	}
-	/**
-	\brief  The plane is valid if the normal of the plane is not zero.
-	*/
-	bool	isValid()const
-	{
-		if( EQUAL(mNormal.x,0)&&EQUAL(mNormal.y,0)&&EQUAL(mNormal.z,0) )
-			return false;
-		return true;
-	}
-
-public:
-	SrVector3D	mNormal;
-	SrReal		mD;
-};
-
-
-/**
-\brief 3D oriented bounding box (OBB) class.
-*/
-class SrOBBox3D
-{
-public:
-	SrOBBox3D()
-	{
-		mCenter = SrVector3D(0,0,0);
-		mAxis[0] = mAxis[1] = mAxis[2] = SrVector3D(0,0,0);
-		mHalfLength[0]	= mHalfLength[1] = mHalfLength[2] = 0;
-	}
-	SrOBBox3D(const SrPoint3D& c,const SrVector3D* pAxis,const SrReal* pHalfLength)
-	{
-		mCenter = c;
-		mAxis[0] = pAxis[0];
-		mAxis[1] = pAxis[1];
-		mAxis[2] = pAxis[2];
-
-		mHalfLength[0] = pHalfLength[0];
-		mHalfLength[1] = pHalfLength[1];
-		mHalfLength[2] = pHalfLength[2];
-	}
-	/**
-	\brief  The OBB is valid if one of the three axis is unit length, 
-			the length of them is greater than 0, and the axis should 
-			be perpendicular to each other.
-	*/
-	bool	isValid() const
-	{
-		int i;
-		if( UNEQUAL(mAxis[0].dot(mAxis[1]),0) ||
-			UNEQUAL(mAxis[0].dot(mAxis[2]),0)||
-			UNEQUAL(mAxis[1].dot(mAxis[2]),0))
-			return false;
-		for( i=0 ; i<3 ; i++ )
-		{
-			if( LEQUAL(mHalfLength[i],0) )
-				return false;
-			if( UNEQUAL(mAxis[i].magnitudeSquared(),1.0) )
-				return false;
-		}
-		return true;
-	}
-
-public:
-	SrPoint3D	mCenter;
-	SrVector3D	mAxis[3];
-	SrReal		mHalfLength[3];
-
-};
+#include <stdlib.h>
+#include <vector>
+#include <algorithm>
 
 
-/*
-\brief	ͨѰҰΧӽƽ淨ĶԽߣʵƽAABBཻ
-\return	SR_PLANE_TANGENT	ƽAABB
-\return	SR_PLANE_FRONT		AABBƽռ
-\return	SR_PLANE_BACK		AABBƽĸռ
-\return	SR_PLANE_INTERSECTING	ƽAABBཻ
-*/
-int	Plane3DHitTestAABB_DiagonalMethod(const SrPlane3D& plane,const SrAABBox3D& aabb)
-{
-	SrPoint3D minPoint,maxPoint;
-	int i;
-	for( i=0 ; i<3 ; i++ )
-	{
-		if( GEQUAL(plane.mNormal[i],0) )
-		{
-			minPoint[i] = aabb.mMinAABB[i];
-			maxPoint[i] = aabb.mMaxAABB[i];
-		}
-		else
-		{
-			minPoint[i] = aabb.mMaxAABB[i];
-			maxPoint[i] = aabb.mMinAABB[i];
-		}
-	}
-	SrReal tmp ;
-	tmp = plane.mNormal.dot(minPoint) + plane.mD;
-	if( EQUAL(tmp,0) )
-		return SR_PLANE_TANGENT;
-	else if( GREATER(tmp,0) )
-		return SR_PLANE_FRONT;
-	tmp = plane.mNormal.dot(maxPoint) + plane.mD ;
-	if( EQUAL(tmp,0) )
-		return SR_PLANE_TANGENT;
-	else if( LESS(tmp , 0) )
-		return SR_PLANE_BACK;
-	return SR_PLANE_INTERSECTING;
-}
-
-/*
-\brief	ͨͶӰΧĵƽľ룬ʵƽAABBཻ
-\return	SR_PLANE_TANGENT	ƽAABB
-\return	SR_PLANE_FRONT		AABBƽռ
-\return	SR_PLANE_BACK		AABBƽĸռ
-\return	SR_PLANE_INTERSECTING	ƽAABBཻ
-*/
-int	Plane3DHitTestAABB_DistanceMethod(const SrPlane3D& plane,const SrAABBox3D& aabb)
-{
-	SrVector3D v0 = SrVector3D(1.0,0,0);
-	SrVector3D v1 = SrVector3D(0,1.0,0);
-	SrVector3D v2 = SrVector3D(0,0,1.0);
-	SrReal r = 0;
-	r += fabs(plane.mNormal.dot(v0)*(aabb.mMaxAABB[0] - aabb.mMinAABB[0]));
-	r += fabs(plane.mNormal.dot(v1)*(aabb.mMaxAABB[1] - aabb.mMinAABB[1]));
-	r += fabs(plane.mNormal.dot(v2)*(aabb.mMaxAABB[2] - aabb.mMinAABB[2]));
-	SrPoint3D center = aabb.mMinAABB + aabb.mMaxAABB;
-	SrReal tmp = (plane.mNormal.dot(center) + 2*plane.mD) ;
-	if( EQUAL(tmp , r) || EQUAL(tmp , -r) )
-		return SR_PLANE_TANGENT;
-	else if( GREATER(tmp,r) )
-		return SR_PLANE_FRONT;
-	else if( LESS(tmp,-r) )
-		return SR_PLANE_BACK;
-	return SR_PLANE_INTERSECTING;
-}
-
-
-/*
-\brief	ͨѰҰΧӽƽ淨ĶԽߣʵƽOBBཻ
-\return	SR_PLANE_TANGENT	ƽOBB
-\return	SR_PLANE_FRONT		OBBƽռ
-\return	SR_PLANE_BACK		OBBƽĸռ
-\return	SR_PLANE_INTERSECTING	ƽOBBཻ
-*/
-int	Plane3DHitTestOBB_DiagonalMethod(const SrPlane3D& plane,const SrOBBox3D& obb)
-{
-	SrPoint3D minPoint,maxPoint;
-	SrVector3D normal;
-	normal.x = obb.mAxis[0].dot(plane.mNormal);
-	normal.y = obb.mAxis[1].dot(plane.mNormal);
-	normal.z = obb.mAxis[2].dot(plane.mNormal);
-	SrReal d = obb.mCenter.dot(plane.mNormal);
-	int i;
-	for( i=0 ; i<3 ; i++ )
-	{
-		if( GEQUAL(normal[i],0) )
-		{
-			minPoint[i] = - obb.mHalfLength[i];
-			maxPoint[i] =   obb.mHalfLength[i];
-		}
-		else
-		{
-			minPoint[i] =   obb.mHalfLength[i];
-			maxPoint[i] = - obb.mHalfLength[i];
-		}
-	}
-	SrReal tmp ;
-	tmp = normal.dot(minPoint) + d + plane.mD;
-	if( EQUAL(tmp,0) )
-		return SR_PLANE_TANGENT;
-	else if( GREATER(tmp,0) )
-		return SR_PLANE_FRONT;
-	tmp = normal.dot(maxPoint) + d + plane.mD;
-	if( EQUAL(tmp,0) )
-		return SR_PLANE_TANGENT;
-	else if( LESS(tmp , 0) )
-		return SR_PLANE_BACK;
-	return SR_PLANE_INTERSECTING;
-}
-
-/*
-\brief	ͨͶӰΧĵƽľ룬ʵƽOBBཻ
-\return	SR_PLANE_TANGENT	ƽOBB
-\return	SR_PLANE_FRONT		OBBƽռ
-\return	SR_PLANE_BACK		OBBƽĸռ
-\return	SR_PLANE_INTERSECTING	ƽOBBཻ
-*/
-int	Plane3DHitTestOBB_DistanceMethod(const SrPlane3D& plane,const SrOBBox3D& obb)
-{
-	SrReal r = 0;
-	r += fabs(plane.mNormal.dot(obb.mAxis[0])*obb.mHalfLength[0]);
-	r += fabs(plane.mNormal.dot(obb.mAxis[1])*obb.mHalfLength[1]);
-	r += fabs(plane.mNormal.dot(obb.mAxis[2])*obb.mHalfLength[2]);
-	SrReal tmp = (plane.mNormal.dot(obb.mCenter) + plane.mD) ;
-	if( EQUAL(tmp , r) || EQUAL(tmp , -r) )
-		return SR_PLANE_TANGENT;
-	else if( GREATER(tmp,r) )
-		return SR_PLANE_FRONT;
-	else if( LESS(tmp,-r) )
-		return SR_PLANE_BACK;
-	return SR_PLANE_INTERSECTING;
-}
-
 /*
 \brief ƽݣƽAABBOBBཻ㷨ȷԣ㷨Чʡ
 */
@@ -368,8 +109,429 @@ void Test_Plane3DHitTestBoundingBox()
 	delete []plane;
 }
 
+const SrAABBox3D RandomAABB(int range,int size)
+{
+	SrPoint3D mn(rand()%range,rand()%range,rand()%range);
+	SrPoint3D mx = mn + SrVector3D(rand()%size + 1,rand()%size + 1,rand()%size + 1);
+	return SrAABBox3D(mn,mx);
+}
+
+bool AABBOverlap(const SrAABBox3D& aabb1,const SrAABBox3D& aabb2)
+{
+	int c;
+	for( c=0 ; c<3 ; c++ )
+	{
+		if( aabb1.mMinAABB[c]>aabb2.mMaxAABB[c] || aabb2.mMinAABB[c]>aabb1.mMaxAABB[c] )
+			return false;
+	}
+	return true;
+}
+
+const SrOBBox3D AABBToOBB(const SrAABBox3D& aabb)
+{
+	SrVector3D axis[3];
+	axis[0] = SrVector3D(1,0,0);
+	axis[1] = SrVector3D(0,1,0);
+	axis[2] = SrVector3D(0,0,1);
+	SrReal halfLen[3];
+	int c;
+	for( c=0 ; c<3 ; c++ )
+		halfLen[c] = (aabb.mMaxAABB[c] - aabb.mMinAABB[c])*0.5;
+	return SrOBBox3D((aabb.mMinAABB + aabb.mMaxAABB)*0.5,axis,halfLen);
+}
+
+bool BoxPairLess(const tBoxPair& p1,const tBoxPair& p2)
+{
+	return p1.mBox1<p2.mBox1 || (p1.mBox1==p2.mBox1 && p1.mBox2<p2.mBox2);
+}
+
+/*
+\brief 롢ƶɾ壬Ѷ̬AABBص߶ΡƽԲѯȽϣԴģµЧʡ
+*/
+void Test_DynamicAABBTree()
+{
+	int numBox = 2000 , numFrame = 10 , range = 1000 , size = 30;
+	int i , j , k , status;
+	std::vector<SrAABBox3D> aabb(numBox);
+	std::vector<int> proxy(numBox);
+	std::vector<int> result , bruteForce;
+	BoxPairArray pairs , bruteForcePairs;
+	tBoxPair pair;
+	SrVector3D velocity;
+	SrPlane3D plane;
+	SrSegment3D segment;
+
+	SrDynamicAABBTree tree(2.0);
+	for( i=0 ; i<numBox ; i++ )
+	{
+		aabb[i] = RandomAABB(range,size);
+		proxy[i] = tree.insert(aabb[i],i);
+	}
+	tree.validate();
+	for( k=0 ; k<numFrame ; k++ )
+	{
+		for( i=0 ; i<numBox ; i++ )
+		{
+			velocity = SrVector3D(rand()%5 - 2,rand()%5 - 2,rand()%5 - 2);
+			aabb[i].mMinAABB += velocity;
+			aabb[i].mMaxAABB += velocity;
+			if( rand()%50==0 )
+			{
+				tree.remove(proxy[i]);
+				proxy[i] = tree.insert(aabb[i],i);
+			}
+			else
+				tree.move(proxy[i],aabb[i]);
+		}
+		if( k%3==2 )
+		{//еһ
+			for( i=0 ; i<numBox ; i++ )
+				tree.setLeafBox(proxy[i],aabb[i]);
+			tree.refit();
+			tree.rebalance();
+		}
+		tree.validate();
+
+		//صѯ
+		for( j=0 ; j<100 ; j++ )
+		{
+			SrAABBox3D query = RandomAABB(range,100);
+			tree.queryOverlap(query,result);
+			bruteForce.clear();
+			for( i=0 ; i<numBox ; i++ )
+				if( AABBOverlap(tree.getFatBox(proxy[i]),query) )
+					bruteForce.push_back(i);
+			std::sort(result.begin(),result.end());
+			ASSERT(result==bruteForce);
+		}
+		//߶βѯ
+		for( j=0 ; j<100 ; j++ )
+		{
+			segment = SrSegment3D(SrPoint3D(rand()%range,rand()%range,rand()%range),SrPoint3D(rand()%range,rand()%range,rand()%range));
+			tree.querySegment(segment,result);
+			bruteForce.clear();
+			for( i=0 ; i<numBox ; i++ )
+				if( SegmentOverlapTestOBB_FastTesting(segment,AABBToOBB(tree.getFatBox(proxy[i]))) )
+					bruteForce.push_back(i);
+			std::sort(result.begin(),result.end());
+			ASSERT(result==bruteForce);
+		}
+		//ƽѯ
+		for( j=0 ; j<100 ; j++ )
+		{
+			while( !plane.init(SrPoint3D(rand()%range,rand()%range,rand()%range),SrPoint3D(rand()%range,rand()%range,rand()%range),
+							   SrPoint3D(rand()%range,rand()%range,rand()%range)) || !plane.isValid() );
+			tree.queryPlane(plane,result);
+			bruteForce.clear();
+			for( i=0 ; i<numBox ; i++ )
+			{
+				status = Plane3DHitTestAABB_DistanceMethod(plane,tree.getFatBox(proxy[i]));
+				if( status!=SR_PLANE_FRONT && status!=SR_PLANE_BACK )
+					bruteForce.push_back(i);
+			}
+			std::sort(result.begin(),result.end());
+			ASSERT(result==bruteForce);
+		}
+		//Բѯ
+		tree.queryPairs(pairs);
+		bruteForcePairs.clear();
+		for( i=0 ; i<numBox ; i++ )
+			for( j=i + 1 ; j<numBox ; j++ )
+				if( AABBOverlap(tree.getFatBox(proxy[i]),tree.getFatBox(proxy[j])) )
+				{
+					pair.mBox1 = i;
+					pair.mBox2 = j;
+					bruteForcePairs.push_back(pair);
+				}
+		std::sort(pairs.begin(),pairs.end(),BoxPairLess);
+		ASSERT(pairs.size()==bruteForcePairs.size());
+		for( i=0 ; i<(int)pairs.size() ; i++ )
+			ASSERT(pairs[i].mBox1==bruteForcePairs[i].mBox1 && pairs[i].mBox2==bruteForcePairs[i].mBox2);
+	}
+
+	//Чʲԣ200000˶
+	numBox = 200000;
+	range  = 20000;
+	aabb.resize(numBox);
+	proxy.resize(numBox);
+	std::vector<SrVector3D> velocityArray(numBox);
+	SrDynamicAABBTree largeTree(1.0);
+	double mTime;
+	printf("̬AABB:%d壬ʱ俪(s)",numBox);
+	mTime = clock();
+	for( i=0 ; i<numBox ; i++ )
+	{
+		aabb[i] = RandomAABB(range,size);
+		velocityArray[i] = SrVector3D(rand()%3 - 1,rand()%3 - 1,rand()%3 - 1)*0.5;
+		proxy[i] = largeTree.insert(aabb[i],i);
+	}
+	mTime = (clock() - mTime) / CLOCKS_PER_SEC;
+	printf("%f%d\n",mTime,largeTree.getHeight());
+
+	int numMoved = 0;
+	printf("̬AABB:ƶ%d%d֡ʱ俪(s)",numBox,numFrame);
+	mTime = clock();
+	for( k=0 ; k<numFrame ; k++ )
+	{
+		for( i=0 ; i<numBox ; i++ )
+		{
+			aabb[i].mMinAABB += velocityArray[i];
+			aabb[i].mMaxAABB += velocityArray[i];
+			if( largeTree.move(proxy[i],aabb[i]) )
+				numMoved ++;
+		}
+	}
+	mTime = (clock() - mTime) / CLOCKS_PER_SEC;
+	printf("%f²%d\n",mTime,numMoved);
+
+	SrReal cost = largeTree.getAreaCost();
+	printf("̬AABB:תʱ俪(s)");
+	mTime = clock();
+	for( i=0 ; i<numBox ; i++ )
+		largeTree.setLeafBox(proxy[i],aabb[i]);
+	largeTree.refit();
+	largeTree.rebalance();
+	mTime = (clock() - mTime) / CLOCKS_PER_SEC;
+	printf("%f%f -> %f\n",mTime,cost,largeTree.getAreaCost());
+
+	int numQuery = 10000 , numResult = 0;
+	printf("̬AABB:%dصѯʱ俪(s)",numQuery);
+	mTime = clock();
+	for( j=0 ; j<numQuery ; j++ )
+	{
+		largeTree.queryOverlap(RandomAABB(range,100),result);
+		numResult += (int)result.size();
+	}
+	mTime = (clock() - mTime) / CLOCKS_PER_SEC;
+	printf("%fƽ%f\n",mTime,(double)numResult/numQuery);
+
+	numResult = 0;
+	printf("̬AABB:%d߲ѯʱ俪(s)",numQuery);
+	mTime = clock();
+	for( j=0 ; j<numQuery ; j++ )
+	{
+		velocity = SrVector3D(rand()%201 - 100,rand()%201 - 100,rand()%201 - 100);
+		largeTree.queryRay(SrPoint3D(rand()%range,rand()%range,rand()%range),velocity,10,result);
+		numResult += (int)result.size();
+	}
+	mTime = (clock() - mTime) / CLOCKS_PER_SEC;
+	printf("%fƽ%f\n",mTime,(double)numResult/numQuery);
+
+	printf("̬AABB:Բѯʱ俪(s)");
+	mTime = clock();
+	largeTree.queryPairs(pairs);
+	mTime = (clock() - mTime) / CLOCKS_PER_SEC;
+	printf("%f%d\n",mTime,(int)pairs.size());
+}
+
+/*
+\brief x򿴵׶壬ӽΪ90ȣƽķָ׶⡣
+*/
+void MakeFrustum(const SrPoint3D& eye,SrReal zNear,SrReal zFar,SrPlane3D* plane)
+{
+	plane[0].mNormal = SrVector3D(-1,0,0);
+	plane[1].mNormal = SrVector3D(1,0,0);
+	plane[2].mNormal = SrVector3D(-1,1,0);
+	plane[3].mNormal = SrVector3D(-1,-1,0);
+	plane[4].mNormal = SrVector3D(-1,0,1);
+	plane[5].mNormal = SrVector3D(-1,0,-1);
+	plane[0].mD = eye.x + zNear;
+	plane[1].mD = -(eye.x + zFar);
+	int i;
+	for( i=2 ; i<6 ; i++ )
+		plane[i].mD = -plane[i].mNormal.dot(eye);
+}
+
+const SrOBBox3D RandomOBB(int range,int size)
+{
+	SrVector3D axis[3];
+	SrReal halfLen[3];
+	do
+	{
+		axis[0] = SrVector3D(rand()%201 - 100,rand()%201 - 100,rand()%201 - 100);
+		axis[1] = axis[0].cross(SrVector3D(rand()%201 - 100,rand()%201 - 100,rand()%201 - 100));
+	}while( axis[0].magnitudeSquared()<1 || axis[1].magnitudeSquared()<1 );
+	axis[0].normalize();
+	axis[1].normalize();
+	axis[2] = axis[0].cross(axis[1]);
+	int k;
+	for( k=0 ; k<3 ; k++ )
+		halfLen[k] = rand()%size + 1;
+	return SrOBBox3D(SrPoint3D(rand()%range,rand()%range,rand()%range),axis,halfLen);
+}
+
+/*
+\brief ƽľжΧ͹ĹϵΪȽϵı׼
+*/
+template<class tBox>
+int CullBruteForce(const SrPlane3D* plane,int numPlane,const tBox& box,int (*planeTest)(const SrPlane3D&,const tBox&))
+{
+	int i , status , result = SR_CULL_INSIDE;
+	for( i=0 ; i<numPlane ; i++ )
+	{
+		status = planeTest(plane[i],box);
+		if( status==SR_PLANE_FRONT )
+			return SR_CULL_OUTSIDE;
+		if( status!=SR_PLANE_BACK )
+			result = SR_CULL_INTERSECTING;
+	}
+	return result;
+}
+
+/*
+\brief AABBOBB׶k-DOPȽ޳޳ƽԼ̬AABBĽ޳Чʡ
+*/
+void Test_PlaneSetCulling()
+{
+	int numBox = 10000 , range = 2000 , size = 50 , numFrame = 10;
+	int i , j , k , count , status , numPlane;
+	SrU32 planeMask;
+	SrPlane3D plane[SR_CULL_MAX_PLANE];
+	SrPlaneSet planes;
+	std::vector<SrAABBox3D> aabb(numBox);
+	std::vector<SrOBBox3D> obb(numBox);
+	SrAABBox3DSoA aabbSoA(numBox);
+	SrOBBox3DSoA obbSoA(numBox);
+	std::vector<unsigned char> aabbStatus(numBox) , obbStatus(numBox);
+	std::vector<int> aabbLastPlane(numBox,0) , obbLastPlane(numBox,0);
+	SrDynamicAABBTree tree(0);
+	for( i=0 ; i<numBox ; i++ )
+	{
+		aabb[i] = RandomAABB(range,size);
+		obb[i]  = RandomOBB(range,size);
+		aabbSoA.setBox(i,aabb[i]);
+		obbSoA.setBox(i,obb[i]);
+		tree.insert(aabb[i],i);
+	}
+	std::vector<int> inside , intersecting , treeInside , treeIntersecting;
+	SrPoint3D eye(-500,1000,1000);
+	for( k=0 ; k<numFrame ; k++ )
+	{
+		if( k%2==0 )
+		{//׶壬ÿ֡ǰƶ
+			numPlane = 6;
+			MakeFrustum(eye,10,1500,plane);
+			eye.x += 50;
+		}
+		else
+		{//k-DOP
+			numPlane = 13;
+			SrPoint3D center(rand()%range,rand()%range,rand()%range);
+			for( j=0 ; j<numPlane ; j++ )
+			{
+				do
+				{
+					plane[j].mNormal = SrVector3D(rand()%21 - 10,rand()%21 - 10,rand()%21 - 10);
+				}while( plane[j].mNormal.magnitudeSquared()<1 );
+				plane[j].mD = -plane[j].mNormal.dot(center) - 300*plane[j].mNormal.magnitude();
+			}
+		}
+		planes.set(plane,numPlane);
+
+		count = PlaneSetCullAABB_Batch(planes,aabbSoA,&aabbStatus[0],&aabbLastPlane[0]);
+		inside.clear();
+		intersecting.clear();
+		for( i=0 ; i<numBox ; i++ )
+		{
+			status = CullBruteForce(plane,numPlane,aabb[i],Plane3DHitTestAABB_DistanceMethod);
+			ASSERT(status==aabbStatus[i]);
+			planeMask = planes.fullMask();
+			ASSERT(status==PlaneSetCullAABB(planes,aabb[i],planeMask));
+			if( status==SR_CULL_INSIDE )
+				inside.push_back(i);
+			else if( status==SR_CULL_INTERSECTING )
+				intersecting.push_back(i);
+		}
+		ASSERT(count==(int)(inside.size() + intersecting.size()));
+
+		tree.queryPlaneSet(planes,treeInside,treeIntersecting);
+		std::sort(treeInside.begin(),treeInside.end());
+		std::sort(treeIntersecting.begin(),treeIntersecting.end());
+		ASSERT(treeInside==inside && treeIntersecting==intersecting);
+
+		count = PlaneSetCullOBB_Batch(planes,obbSoA,&obbStatus[0],k%3 ? &obbLastPlane[0] : NULL);
+		for( i=0 ; i<numBox ; i++ )
+		{
+			status = CullBruteForce(plane,numPlane,obb[i],Plane3DHitTestOBB_DistanceMethod);
+			ASSERT(status==obbStatus[i]);
+			planeMask = planes.fullMask();
+			ASSERT(status==PlaneSetCullOBB(planes,obb[i],planeMask));
+			if( status!=SR_CULL_OUTSIDE )
+				count --;
+		}
+		ASSERT(count==0);
+	}
+
+	//Чʲԣ1000000AABB׶֡ƶ
+	numBox = 1000000;
+	range  = 20000;
+	aabbSoA.allocate(numBox);
+	aabbStatus.resize(numBox);
+	aabbLastPlane.assign(numBox,0);
+	aabb.resize(numBox);
+	for( i=0 ; i<numBox ; i++ )
+	{
+		aabb[i] = RandomAABB(range,size);
+		aabbSoA.setBox(i,aabb[i]);
+	}
+	double mTime;
+	eye = SrPoint3D(0,10000,10000);
+	printf("׶޳%dAABB %d֡:޳ʱ俪(s)",numBox,numFrame);
+	mTime = clock();
+	for( k=0 ; k<numFrame ; k++ )
+	{
+		MakeFrustum(eye + SrVector3D(k*20,0,0),10,5000,plane);
+		planes.set(plane,6);
+		for( i=0 ; i<numBox ; i++ )
+		{
+			planeMask = planes.fullMask();
+			aabbStatus[i] = (unsigned char)PlaneSetCullAABB(planes,aabb[i],planeMask);
+		}
+	}
+	mTime = (clock() - mTime) / CLOCKS_PER_SEC;
+	printf("%f\n",mTime);
+
+	printf("׶޳%dAABB %d֡:޳ʱ俪(s)",numBox,numFrame);
+	mTime = clock();
+	for( k=0 ; k<numFrame ; k++ )
+	{
+		MakeFrustum(eye + SrVector3D(k*20,0,0),10,5000,plane);
+		planes.set(plane,6);
+		count = PlaneSetCullAABB_Batch(planes,aabbSoA,&aabbStatus[0]);
+	}
+	mTime = (clock() - mTime) / CLOCKS_PER_SEC;
+	printf("%f\n",mTime);
+
+	printf("׶޳%dAABB %d֡:޳¼ųƽ棬ʱ俪(s)",numBox,numFrame);
+	mTime = clock();
+	for( k=0 ; k<numFrame ; k++ )
+	{
+		MakeFrustum(eye + SrVector3D(k*20,0,0),10,5000,plane);
+		planes.set(plane,6);
+		count = PlaneSetCullAABB_Batch(planes,aabbSoA,&aabbStatus[0],&aabbLastPlane[0]);
+	}
+	mTime = (clock() - mTime) / CLOCKS_PER_SEC;
+	printf("%fɼ%d\n",mTime,count);
+
+	SrDynamicAABBTree largeTree(0);
+	for( i=0 ; i<numBox ; i++ )
+		largeTree.insert(aabb[i],i);
+	printf("׶޳%dAABB %d֡:̬AABBʱ俪(s)",numBox,numFrame);
+	mTime = clock();
+	for( k=0 ; k<numFrame ; k++ )
+	{
+		MakeFrustum(eye + SrVector3D(k*20,0,0),10,5000,plane);
+		planes.set(plane,6);
+		largeTree.queryPlaneSet(planes,treeInside,treeIntersecting);
+	}
+	mTime = (clock() - mTime) / CLOCKS_PER_SEC;
+	printf("%fɼ%d\n",mTime,(int)(treeInside.size() + treeIntersecting.size()));
+}
+
 int main( )
 {
 	Test_Plane3DHitTestBoundingBox();
+	Test_DynamicAABBTree();
+	Test_PlaneSetCulling();
 	return 0;
 }
\ No newline at end of file
@@ -6,7 +6,7 @@
 //#include <stdlib.h>
 //#include <stdio.h>
 //#include <GL/glut.h>
-//#include "QuickHull.h"
+//#include "../Algorithms/QuickHull.h"
 //
 //
 //bool		gMoveScene			= false;
@@ -211,7 +211,7 @@
 #define _CRTDBG_MAP_ALLOC
 #include <stdlib.h>
 #include <crtdbg.h>
-#include "QuickHull.h"
+#include "../Algorithms/QuickHull.h"
 #include <time.h>
 
 bool isConvex(tHull* hull)
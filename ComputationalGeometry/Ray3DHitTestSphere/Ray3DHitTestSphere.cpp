@@ -4,150 +4,15 @@
 \date	2014/06/18
 ****************************************************************************/
 /************************************************************************		
-\description	ò̷Żʵཻԡ
+\description	ò̷Żʵཻԣ
+				ݰ弯ϵİΧ󽻡
 ****************************************************************************/
-#include "../include/SrGeometricTools.h"
-#include "../include/SrDataType.h"
+#include "../Algorithms/Ray3DHitTestSphere.h"
+#include "../Algorithms/SphereBVH.h"
 #include <stdio.h>
+#include <stdlib.h>
 #include <time.h>
 
-/**
-\brief 3D sphere class.
-
-This is a 3D sphere class with public data members.
-It includes center and radius.
-*/
-class SrSphere3D
-{
-public:
-	/**
-	\brief Default constructor. Set center to (0,0) and radius to 0.
-	*/
-	SrSphere3D()
-	{
-		mCenter.set(0,0,0);
-		mRadius = -1.0;
-	}
-	/**
-	\brief The circle is initialized by center and radius.
-	*/
-	SrSphere3D(const SrPoint3D& ct ,SrReal rd)
-	{
-		mCenter = ct;
-		mRadius = rd;
-	}
-public:
-	SrPoint3D	mCenter;
-	SrReal		mRadius;
-};
-
-/**
-\brief 3D ray class.
-
-This is a 3D ray class with public data members.
-The ray is parameterized as X(t) = P+t*d,in which P is the 'base' data,d is the 'direction' data,t>=0.
-the 'direction' is unit length.
-*/
-class SrRay3D
-{
-public:
-	/**
-	\brief Default constructor, base and direction is set to (0,0).
-	*/
-	SrRay3D()
-	{
-		mBase.set(0,0,0);
-		mDirection.set(0,0,0);
-	}
-	/**
-	\brief The line is initialized by two points.The point p1 is the endpoint of the ray.
-	*/
-	SrRay3D(const SrPoint3D& p1,const SrPoint3D& p2)
-	{
-		mBase = p1;
-		mDirection = p2 - p1;
-		mDirection.normalize();
-	}
-	/**
-	\brief  The ray is valid if the direction of the line is unit.
-	*/
-	bool isValid()const
-	{
-		if( EQUAL(mDirection.magnitudeSquared(),1.0) )
-			return true;
-		return false;
-	}
-
-public:
-	SrPoint3D	mBase;
-	SrVector3D	mDirection;
-};
-
-
-/*
-\brief	ò̷ʵཻԡ
-\param[out]	result	߿òP+tDʾصһеtֵ
-\return	true	ཻУ
-		false	루޽㣩
-
-*/
-bool RayHitTestSphere_Parameter(const SrRay3D& ray,const SrSphere3D& sphere,SrReal& result)
-{
-	SrVector3D e = ray.mBase - sphere.mCenter;
-	SrReal b = e.dot(ray.mDirection), c = e.dot(e)-sphere.mRadius*sphere.mRadius;
-	SrReal delta = b*b - c;
-
-	if( LESS(delta,0) )
-		return false;
-	else if( EQUAL(delta,0) )
-	{
-		if( LESS(-b,0) )
-			return false;
-		result = -b;
-		return true;
-	}
-	else
-	{
-		SrReal d = sqrt(delta);
-		SrReal t1 = -b - d, t2 = -b + d;
-		if( LESS(t2,0) )
-			return false;
-		else if( LESS(t1,0) )
-			result = t2;
-		else
-			result = t1;
-		return true;
-
-	}
-	return true;
-}
-
-/*
-\brief	Żʵཻԡ
-\param[out]	result	߿òP+tDʾصһеtֵ
-\return	true	ཻУ
-		false	루޽㣩
-
-*/
-bool RayHitTestSphere_Optimized(const SrRay3D& ray,const SrSphere3D& sphere,SrReal& result)
-{
-	SrVector3D l = sphere.mCenter - ray.mBase;
-	SrReal s = l.dot(ray.mDirection);
-	SrReal squaredL = l.dot(l);
-	SrReal squaredRadius = sphere.mRadius * sphere.mRadius;
-	if( LESS(s,0) && GREATER(squaredL,squaredRadius) )
-		return false;
-	SrReal squaredM = squaredL - s*s;
-	if( GREATER(squaredM,squaredRadius) )
-		return false;
-	SrReal q = sqrt(squaredRadius - squaredM);
-	if( squaredL > squaredRadius )
-		result = s - q;
-	else
-		result = s + q;
-	return true;
-}
-
 /*
 \brief ݣཻԷȷԣַCPUʱӿ
 */
@@ -204,9 +69,129 @@ void Test_RayHitTestSphere()
 
 }
 
+/*
+\brief	㷨RayHitTestSphere_Optimizedе壬tСĽ㣬tͬʱС塣
+*/
+int RayNearestSphere_Naive(const SrRay3D& ray,const SrSphere3D* sphere,int numSphere,SrReal& t)
+{
+	int i , result = -1;
+	SrReal hit;
+	t = SR_MAX_F64;
+	for( i=0 ; i<numSphere ; i++ )
+	{
+		if( RayHitTestSphere_Optimized(ray,sphere[i],hit) && hit<t )
+		{
+			t	   = hit;
+			result = i;
+		}
+	}
+	return result;
+}
+
+/*
+\brief	СɵĵƳλ÷ߣÿ8*8صĿ
+		4*2һݰڵݰͬһ顣Ƚϱ㷨߱
+		ݰĽԵ߳ݰЧʡ
+*/
+void Test_SphereBVHRayPacket()
+{
+	int numSphere = 200000 , i , k;
+	SrSphere3D* sphere = new SrSphere3D[numSphere];
+	for( i=0 ; i<numSphere ; i++ )
+	{
+		sphere[i].mCenter.x = (SrReal)(rand() % 10000) / 10.0;
+		sphere[i].mCenter.y = (SrReal)(rand() % 10000) / 10.0;
+		sphere[i].mCenter.z = (SrReal)(rand() % 10000) / 10.0;
+		sphere[i].mRadius	= 1.0 + (SrReal)(rand() % 40) / 10.0;
+	}
+	//һȫغϣtͬʱĽ
+	for( i=0 ; i<100 ; i++ )
+		sphere[numSphere - 1 - i] = sphere[i];
+
+	SrSphereBVH bvh;
+	double mTime = clock();
+	bvh.build(sphere,numSphere);
+	mTime = (clock() - mTime) / CLOCKS_PER_SEC;
+	printf("Χ:%d壬%dڵ㣬ʱ(s)%f\n",numSphere,(int)bvh.mNode.size(),mTime);
+
+	//λڳ֮⣬򳡾
+	int width = 512 , height = 512 , numRay = width*height;
+	int tileX , tileY , x , y , index = 0;
+	SrRay3DSoA ray(numRay);
+	SrPoint3D eye(500,500,-600) , pixel;
+	for( tileY=0 ; tileY<height ; tileY+=8 )
+		for( tileX=0 ; tileX<width ; tileX+=8 )
+			for( k=0 ; k<8 ; k++ )
+				for( i=0 ; i<SR_RAY_PACKET_WIDTH ; i++ )
+				{
+					x = tileX + (k % 2)*4 + i % 4;
+					y = tileY + (k / 2)*2 + i / 4;
+					pixel.set(x*1000.0/width,y*1000.0/height,0);
+					ray.setRay(index++,SrRay3D(eye,pixel));
+				}
+
+	SrReal* t		= new SrReal[numRay];
+	int*	hit		= new int[numRay];
+	SrReal* tPacket = new SrReal[numRay];
+	int*	hitPacket = new int[numRay];
+	int		numHit;
+#ifdef _DEBUG
+	//㷨ȷԣֻڵ԰汾м
+	SrReal	tNaive , tSingle;
+	int		numCheck = 2000 , naive , single;
+	bvh.intersectBatch(ray,tPacket,hitPacket);
+	for( i=0 ; i<numRay ; i+=numRay / numCheck )
+	{
+		SrRay3D r = ray.getRay(i);
+		naive  = RayNearestSphere_Naive(r,sphere,numSphere,tNaive);
+		single = bvh.intersect(r,tSingle);
+		ASSERT(naive==single && tNaive==tSingle);
+		ASSERT(naive==hitPacket[i] && tNaive==tPacket[i]);
+	}
+	//ߣݰе߻
+	SrRay3DSoA randomRay(numCheck + 3);
+	SrPoint3D p0 , p1;
+	for( i=0 ; i<randomRay.mNumRay ; i++ )
+	{
+		p0.set(rand() % 1000,rand() % 1000,rand() % 1000);
+		p1.set(rand() % 1000,rand() % 1000,rand() % 1000);
+		if( p0==p1 )
+			p1.x += 1;
+		randomRay.setRay(i,SrRay3D(p0,p1));
+	}
+	bvh.intersectBatch(randomRay,t,hit);
+	for( i=0 ; i<randomRay.mNumRay ; i++ )
+	{
+		naive = RayNearestSphere_Naive(randomRay.getRay(i),sphere,numSphere,tNaive);
+		ASSERT(naive==hit[i] && tNaive==t[i]);
+	}
+#endif
+
+	printf("Χ:%dߣ߱ʱ俪(s)",numRay);
+	mTime = clock();
+	for( i=0 ; i<numRay ; i++ )
+		hit[i] = bvh.intersect(ray.getRay(i),t[i]);
+	mTime = (clock() - mTime) / CLOCKS_PER_SEC;
+	printf("%f\n",mTime);
+
+	printf("Χ:%dߣ߳ݰʱ俪(s)",numRay);
+	mTime = clock();
+	numHit = bvh.intersectBatch(ray,tPacket,hitPacket);
+	mTime = (clock() - mTime) / CLOCKS_PER_SEC;
+	printf("%f%dཻ\n",mTime,numHit);
+	for( i=0 ; i<numRay ; i++ )
+		ASSERT(hit[i]==hitPacket[i] && t[i]==tPacket[i]);
+
+	delete []hitPacket;
+	delete []tPacket;
+	delete []hit;
+	delete []t;
+	delete []sphere;
+}
 
 int main()
 {
 	Test_RayHitTestSphere();
+	Test_SphereBVHRayPacket();
 	return 0;
-}
\ No newline at end of file
+}
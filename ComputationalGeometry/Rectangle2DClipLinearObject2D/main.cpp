@@ -3,186 +3,14 @@
 \author Twinkling Star
 \date	2014/05/15
 ****************************************************************************/
-#include "../include/SrVector3.h"
-#include "../include/SrGeometricTools.h"
-#include "../include/SrDataType.h"
+#include "../Algorithms/Rectangle2DClipLinearObject2D.h"
+#include "../Algorithms/Rectangle2DClipLinearObject2DPacket.h"
+#include "../Algorithms/Rectangle2DClipPolygon2D.h"
+#include <math.h>
 
 #include <time.h>
 #include <stdio.h>
 
-const int INSIDE = 0; // 0000
-const int LEFT = 1;   // 0001
-const int RIGHT = 2;  // 0010
-const int BOTTOM = 4; // 0100
-const int TOP = 8;    // 1000
-
-
-
-// Compute the bit code for a point (x, y) using the clip rectangle
-// bounded diagonally by (xMin, yMin), and (xMax, yMax)
-int computeOutCode(const SrPoint2D& p,const SrVector2D& minW,const SrVector2D& maxW)
-{
-	int code;
-	code = INSIDE;				 // initialised as being inside of clip window
-	if ( LESS(p.x,minW.x) )           // to the left of clip window
-		code |= LEFT;
-	else if ( GREATER(p.x,maxW.x))      // to the right of clip window
-		code |= RIGHT;
-	if ( LESS(p.y , minW.y) )           // below the clip window
-		code |= BOTTOM;
-	else if ( GREATER(p.y , maxW.y) )      // above the clip window
-		code |= TOP;
-	return code;
-}
-
-// CohenCSutherland clipping algorithm clips a line from
-// P0 = (x0, y0) to P1 = (x1, y1) against a rectangle with 
-// diagonal from (xMin, yMin) to (xMax, yMax).
-bool cohenSutherland(const SrPoint2D& inP1, const SrPoint2D& inP2,
-					 const SrVector2D& minRect,const SrVector2D& maxRect,
-					 SrPoint2D& resultP1,SrPoint2D& resultP2)
-{
-
-	if( (LESS(inP1.x,minRect.x)&&LESS(inP2.x,minRect.x))||
-		(GREATER(inP1.x,maxRect.x)&&GREATER(inP2.x,maxRect.x))||
-		(LESS(inP1.y,minRect.y)&&LESS(inP2.y,minRect.y))||
-		(GREATER(inP1.y,maxRect.y)&&GREATER(inP2.y,maxRect.y)) )
-		return false;
-
-	SrPoint2D p1 = inP1;
-	SrPoint2D p2 = inP2;
-	// compute outcodes for P0, P1, and whatever point lies outside the clip rectangle
-	int outcode0 = computeOutCode(p1,minRect,maxRect);
-	int outcode1 = computeOutCode(p2,minRect,maxRect);
-	bool accept = false;
-
-	while (true) 
-	{
-		if (!(outcode0 | outcode1)) 
-		{ // Bitwise OR is 0. Trivially accept and get out of loop
-			accept = true;
-			break;
-		} 
-		else if (outcode0 & outcode1) 
-		{ // Bitwise AND is not 0. Trivially reject and get out of loop
-			break;
-		} 
-		else 
-		{
-			// failed both tests, so calculate the line segment to clip
-			// from an outside point to an intersection with clip edge
-			SrReal x, y;
-			// At least one endpoint is outside the clip rectangle; pick it.
-			int outcodeOut = outcode0 ? outcode0 : outcode1;
-			// Now find the intersection point;
-			// use formulas y = y0 + slope * (x - x0), x = x0 + (1 / slope) * (y - y0)
-			if (outcodeOut & TOP) 
-			{           // point is above the clip rectangle
-				x = p1.x + (p2.x - p1.x) * (maxRect.y - p1.y) / (p2.y - p1.y);
-				y = maxRect.y;
-			} 
-			else if (outcodeOut & BOTTOM) 
-			{ // point is below the clip rectangle
-				x = p1.x + (p2.x - p1.x) * (minRect.y - p1.y) / (p2.y - p1.y);
-				y = minRect.y;
-			} 
-			else if (outcodeOut & RIGHT) 
-			{  // point is to the right of clip rectangle
-				y = p1.y + (p2.y - p1.y) * (maxRect.x - p1.x) / (p2.x - p1.x);
-				x = maxRect.x;
-			} 
-			else if (outcodeOut & LEFT) 
-			{   // point is to the left of clip rectangle
-				y = p1.y + (p2.y - p1.y) * (minRect.x - p1.x) / (p2.x - p1.x);
-				x = minRect.x;
-			}
-			// Now we move outside point to intersection point to clip
-			// and get ready for next pass.
-			if (outcodeOut == outcode0) 
-			{
-				p1.x = x;
-				p1.y = y;
-				outcode0 = computeOutCode(p1,minRect,maxRect);
-			} 
-			else 
-			{
-				p2.x = x;
-				p2.y = y;
-				outcode1 = computeOutCode(p2,minRect,maxRect);
-			}
-		}
-	}
-	if (accept) 
-	{
-		resultP1 = p1;
-		resultP2 = p2;
-		return true;
-	}
-	return false;
-}
-
-bool clip(SrReal p,SrReal q,SrReal& t0,SrReal& t1)
-{
-	SrReal r;
-	if( LESS(p,0) && LESS(q,0) )
-	{
-		r = q/p;
-		if( GREATER(r,t1) )
-			return false;
-		else if( GREATER(r,t0) )
-			t0 = r;
-	}
-	else if( GREATER(p,0) && LESS(q,p) )
-	{
-		r = q/p;
-		if( LESS(r,t0) )
-			return false;
-		else if( LESS(r,t1) )
-			t1 = r;
-	}
-	else if( LESS(q,0) )
-		return false;
-	return true;
-}
-
-// Liang-Barsky clipping algorithm clips a line from
-// P0 = (x0, y0) to P1 = (x1, y1) against a rectangle with 
-// diagonal from (xMin, yMin) to (xMax, yMax).
-bool LiangBarsky(const SrPoint2D& inP1, const SrPoint2D& inP2,const SrVector2D& minRect,const SrVector2D& maxRect,SrPoint2D& resultP1,SrPoint2D& resultP2)
-{
-	if( (LESS(inP1.x,minRect.x)&&LESS(inP2.x,minRect.x))||
-		(GREATER(inP1.x,maxRect.x)&&GREATER(inP2.x,maxRect.x))||
-		(LESS(inP1.y,minRect.y)&&LESS(inP2.y,minRect.y))||
-		(GREATER(inP1.y,maxRect.y)&&GREATER(inP2.y,maxRect.y)) )
-		return false;
-
-	SrReal t0, t1;
-	t0 = 0.0;
-	t1 = 1.0;
-	SrReal deltaX , deltaY;
-
-	deltaX = inP2.x - inP1.x;
-	if( clip(-deltaX,inP1.x - minRect.x,t0,t1) && clip(deltaX,maxRect.x - inP1.x,t0,t1))
-	{
-		deltaY = inP2.y - inP1.y;
-		if( clip(-deltaY,inP1.y - minRect.y,t0,t1) && clip(deltaY,maxRect.y - inP1.y,t0,t1) )
-		{
-			if( LEQUAL(t1,1) )
-			{
-				resultP2.x = inP1.x + t1*deltaX;
-				resultP2.y = inP1.y + t1*deltaY;
-			}
-			if( GEQUAL(t0,0) )
-			{
-				resultP1.x = inP1.x + t0*deltaX;
-				resultP1.y = inP1.y + t0*deltaY;
-			}
-			return true;
-		}
-	}
-	return false;
-}
-
 void testClipSegment()
 {
 	int numPoint = 100000, range = 100;
@@ -206,14 +34,14 @@ void testClipSegment()
 	SrPoint2D maxRect = SrPoint2D(50,50);
 	/*for( i=0 ; i<numPoint ; i++ )
 	{
-		bool status1 = cohenSutherland(point1[i],point2[i],minRect,maxRect,res1[0],res1[1]);
-		bool status2 = LiangBarsky(point1[i],point2[i],minRect,maxRect,res2[0],res2[1]);
+		bool status1 = Segment2DClipRectangle_CohenSutherland(point1[i],point2[i],minRect,maxRect,res1[0],res1[1]);
+		bool status2 = Segment2DClipRectangle_LiangBarsky(point1[i],point2[i],minRect,maxRect,res2[0],res2[1]);
 		if( status1 != status2 )
 		{
 			int t ;
 			t = 10;
-			cohenSutherland(point1[i],point2[i],minRect,maxRect,res1[0],res1[1]);
-			LiangBarsky(point1[i],point2[i],minRect,maxRect,res2[0],res2[1]);
+			Segment2DClipRectangle_CohenSutherland(point1[i],point2[i],minRect,maxRect,res1[0],res1[1]);
+			Segment2DClipRectangle_LiangBarsky(point1[i],point2[i],minRect,maxRect,res2[0],res2[1]);
 		}
 		ASSERT(EQUAL(res1[0].x,res2[0].x)&&EQUAL(res1[0].y,res2[0].y));
 		ASSERT(EQUAL(res1[1].x,res2[1].x)&&EQUAL(res1[1].y,res2[1].y));
@@ -223,7 +51,7 @@ void testClipSegment()
 	double seconds = clock();
 	for( i=0 ; i<numPoint ; i++ )
 	{
-		cohenSutherland(point1[i],point2[i],minRect,maxRect,res1[0],res1[1]);
+		Segment2DClipRectangle_CohenSutherland(point1[i],point2[i],minRect,maxRect,res1[0],res1[1]);
 	}
 	seconds = (clock() - seconds)/CLOCKS_PER_SEC;
 	printf("%.6lf\n",seconds);
@@ -231,16 +59,308 @@ void testClipSegment()
 	seconds = clock();
 	for( i=0 ; i<numPoint ; i++ )
 	{
-		LiangBarsky(point1[i],point2[i],minRect,maxRect,res1[0],res1[1]);
+		Segment2DClipRectangle_LiangBarsky(point1[i],point2[i],minRect,maxRect,res1[0],res1[1]);
 	}
 	seconds = (clock() - seconds)/CLOCKS_PER_SEC;
 	printf("%.6lf\n",seconds);
 
 }
 
+void testClipSegmentPacket()
+{
+	int numSegment = 1000000, range = 100;
+	SrSegment2DSoA segment(numSegment) , result(numSegment);
+	int* resultIndex = new int[numSegment];
+	SrPoint2D p1 , p2 , res1 , res2;
+	int i , k , count;
+	for( i=0 ; i<numSegment ; i++ )
+	{
+		do 
+		{
+			p1.x = rand()%range;
+			p1.y = rand()%range;
+			p2.x = rand()%range;
+			p2.y = rand()%range;
+		} while ((EQUAL(p1.x,p2.x)&&EQUAL(p1.y,p2.y)));
+		segment.setSegment(i,p1,p2);
+	}
+	SrPoint2D minRect = SrPoint2D(20,20);
+	SrPoint2D maxRect = SrPoint2D(50,50);
+
+	//The packet version must keep exactly the same segments with exactly the same endpoints as the scalar one.
+	count = Segment2DClipRectangle_LiangBarskyBatch(segment,minRect,maxRect,result,resultIndex);
+	for( i=0 , k=0 ; i<numSegment ; i++ )
+	{
+		segment.getSegment(i,p1,p2);
+		bool status = Segment2DClipRectangle_LiangBarsky(p1,p2,minRect,maxRect,res1,res2);
+		ASSERT(status == (k<count && resultIndex[k]==i));
+		if( !status )
+			continue;
+		ASSERT(result.mPoint1[0][k]==res1.x && result.mPoint1[1][k]==res1.y);
+		ASSERT(result.mPoint2[0][k]==res2.x && result.mPoint2[1][k]==res2.y);
+		k ++;
+	}
+	printf("Segments: %d, Clipped: %d\n",numSegment,count);
+
+	double seconds = clock();
+	for( i=0 ; i<numSegment ; i++ )
+	{
+		segment.getSegment(i,p1,p2);
+		Segment2DClipRectangle_LiangBarsky(p1,p2,minRect,maxRect,res1,res2);
+	}
+	seconds = (clock() - seconds)/CLOCKS_PER_SEC;
+	printf("Liang-Barsky Time:	%.6lf\n",seconds);
+
+	seconds = clock();
+	Segment2DClipRectangle_LiangBarskyBatch(segment,minRect,maxRect,result,resultIndex);
+	seconds = (clock() - seconds)/CLOCKS_PER_SEC;
+	printf("Liang-Barsky Packet Time:	%.6lf\n",seconds);
+
+	//[0,range]ֳ8x8ֿ飬߶βߣʱ˳ͬڵ߶ͬķֿ
+	int numTile = 8 , numRect = numTile*numTile , r;
+	SrVector2D tileMin[64] , tileMax[64];
+	SrReal tileSize = (SrReal)range/numTile;
+	for( r=0 ; r<numRect ; r++ )
+	{
+		tileMin[r] = SrVector2D((r%numTile)*tileSize,(r/numTile)*tileSize);
+		tileMax[r] = SrVector2D((r%numTile + 1)*tileSize,(r/numTile + 1)*tileSize);
+	}
+	for( i=0 ; i<numSegment ; i++ )
+	{
+		if( i%1000==0 )
+		{
+			p2.x = rand()%(range*4)*0.25;
+			p2.y = rand()%(range*4)*0.25;
+		}
+		p1 = p2;
+		p2.x = p1.x + rand()%9*0.25 - 1;
+		p2.y = p1.y + rand()%9*0.25 - 1;
+		segment.setSegment(i,p1,p2);
+	}
+	SrSegment2DSoA binned;
+	std::vector<int> binIndex , binStart;
+	count = Segment2DClipRectangle_LiangBarskyBin(segment,tileMin,tileMax,numRect,binned,binIndex,binStart);
+	for( r=0 ; r<numRect ; r++ )
+	{
+		for( i=0 , k=binStart[r] ; i<numSegment ; i++ )
+		{
+			segment.getSegment(i,p1,p2);
+			bool status = Segment2DClipRectangle_LiangBarsky(p1,p2,tileMin[r],tileMax[r],res1,res2);
+			ASSERT(status == (k<binStart[r + 1] && binIndex[k]==i));
+			if( !status )
+				continue;
+			ASSERT(binned.mPoint1[0][k]==res1.x && binned.mPoint1[1][k]==res1.y);
+			ASSERT(binned.mPoint2[0][k]==res2.x && binned.mPoint2[1][k]==res2.y);
+			k ++;
+		}
+	}
+	printf("Tiles: %d, Binned: %d\n",numRect,count);
+
+	seconds = clock();
+	for( r=0 ; r<numRect ; r++ )
+	{
+		for( i=0 ; i<numSegment ; i++ )
+		{
+			segment.getSegment(i,p1,p2);
+			Segment2DClipRectangle_LiangBarsky(p1,p2,tileMin[r],tileMax[r],res1,res2);
+		}
+	}
+	seconds = (clock() - seconds)/CLOCKS_PER_SEC;
+	printf("Liang-Barsky Tiles Time:	%.6lf\n",seconds);
+
+	seconds = clock();
+	Segment2DClipRectangle_LiangBarskyBin(segment,tileMin,tileMax,numRect,binned,binIndex,binStart);
+	seconds = (clock() - seconds)/CLOCKS_PER_SEC;
+	printf("Liang-Barsky Bin Time:	%.6lf\n",seconds);
+
+	delete []resultIndex;
+}
+
+SrReal ringArea(const std::vector<SrPoint2D>& vertex,int first,int last)
+{
+	SrReal area = 0;
+	int i;
+	for( i=first + 1 ; i<last - 1 ; i++ )
+		area += (vertex[i] - vertex[first]).cross(vertex[i + 1] - vertex[first]);
+	return area/2;
+}
+
+SrReal totalArea(const std::vector<SrPoint2D>& vertex,const std::vector<int>& ringStart)
+{
+	SrReal area = 0;
+	int i;
+	for( i=0 ; i + 1<(int)ringStart.size() ; i++ )
+		area += ringArea(vertex,ringStart[i],ringStart[i + 1]);
+	return area;
+}
+
+/*
+	ʽزüΣÿchunk
+*/
+int clipPolygonInChunk(SrPolygonClipper2D& clipper,int mode,const std::vector<SrPoint2D>& polygon,int chunk,
+					   std::vector<SrPoint2D>& vertex,std::vector<int>& ringStart)
+{
+	int i , n = (int)polygon.size();
+	vertex.clear();
+	ringStart.clear();
+	clipper.begin(mode);
+	for( i=0 ; i<n ; i+=chunk )
+		clipper.addVertex(&polygon[i],i + chunk<n ? chunk : n - i);
+	return clipper.end(vertex,ringStart);
+}
+
+/*
+	ζΣcenterõеĶ
+*/
+void generateStarPolygon(const SrPoint2D& center,SrReal radius,int numVertex,bool isCCW,std::vector<SrPoint2D>& polygon)
+{
+	int i;
+	SrReal angle , r;
+	polygon.resize(numVertex);
+	for( i=0 ; i<numVertex ; i++ )
+	{
+		angle = 2*3.14159265358979*i/numVertex;
+		if( !isCCW )
+			angle = -angle;
+		r = radius*(0.2 + 0.8*(rand()%1000)/1000.0);
+		polygon[i] = center + SrVector2D(cos(angle),sin(angle))*r;
+	}
+}
+
+void testClipPolygon()
+{
+	std::vector<SrPoint2D> polygon , vertex1 , vertex2;
+	std::vector<int> ring1 , ring2;
+	int i , j , numRing;
+
+	//״ĶΣжеĳݣWeiler-Atherton㷨õÿݵĻ
+	int numTooth = 10;
+	polygon.push_back(SrPoint2D(0,0));
+	polygon.push_back(SrPoint2D(2*numTooth,0));
+	for( i=numTooth - 1 ; i>=0 ; i-- )
+	{
+		polygon.push_back(SrPoint2D(2*i + 2,10));
+		polygon.push_back(SrPoint2D(2*i + 1,10));
+		polygon.push_back(SrPoint2D(2*i + 1,2));
+		if( i>0 )
+			polygon.push_back(SrPoint2D(2*i,2));
+	}
+	SrPolygonClipper2D clipper(SrClipWindow2D(SrVector2D(-1,5),SrVector2D(2*numTooth + 1,8)));
+	numRing = clipPolygonInChunk(clipper,SR_CLIP_WEILER_ATHERTON,polygon,3,vertex1,ring1);
+	ASSERT(numRing==numTooth);
+	for( i=0 ; i<numRing ; i++ )
+		ASSERT(EQUAL(ringArea(vertex1,ring1[i],ring1[i + 1]),3));
+	numRing = clipPolygonInChunk(clipper,SR_CLIP_SUTHERLAND_HODGMAN,polygon,3,vertex2,ring2);
+	ASSERT(numRing==1 && EQUAL(totalArea(vertex2,ring2),3*numTooth));
+
+	//ζΣ㷨ֿͬ붥Ľһȫͬ
+	SrReal area1 , area2;
+	int numCase = 2000;
+	for( i=0 ; i<numCase ; i++ )
+	{
+		generateStarPolygon(SrPoint2D(rand()%100,rand()%100),10 + rand()%40,3 + rand()%60,i%2==0,polygon);
+		SrReal angle = (rand()%360)*3.14159265358979/180;
+		SrPoint2D axis[2] = { SrPoint2D(cos(angle),sin(angle)) , SrPoint2D(-sin(angle),cos(angle)) };
+		SrReal halfLength[2] = { (SrReal)(5 + rand()%30) , (SrReal)(5 + rand()%30) };
+		clipper.setWindow(SrClipWindow2D(SrPoint2D(rand()%100,rand()%100),axis,halfLength));
+		for( j=0 ; j<3 ; j++ )
+		{
+			int mode = j==0 ? SR_CLIP_WEILER_ATHERTON : SR_CLIP_SUTHERLAND_HODGMAN;
+			clipPolygonInChunk(clipper,mode,polygon,(int)polygon.size(),vertex1,ring1);
+			clipPolygonInChunk(clipper,mode,polygon,1 + rand()%7,vertex2,ring2);
+			ASSERT(vertex1==vertex2 && ring1==ring2);
+			if( j==0 )
+				area1 = totalArea(vertex1,ring1);
+			else
+				area2 = totalArea(vertex1,ring1);
+		}
+		//Weiler-Athertonÿεķͬ
+		clipPolygonInChunk(clipper,SR_CLIP_WEILER_ATHERTON,polygon,(int)polygon.size(),vertex1,ring1);
+		for( j=0 ; j + 1<(int)ring1.size() ; j++ )
+			ASSERT((i%2==0 ? 1 : -1)*ringArea(vertex1,ring1[j],ring1[j + 1])>0);
+		ASSERT(fabs(area1 - area2)<1e-6*(1 + fabs(area1)));
+	}
+
+	//ֿ飺ֿĻֱ÷ֿüĽ֮ͬ͵ü
+	int numTileX = 16 , numTileY = 12 , tile;
+	SrVector2D tileSize(5,5);
+	SrTileClipper2D tiler(SrPoint2D(10,10),tileSize,numTileX,numTileY);
+	std::vector<int> ringTile;
+	generateStarPolygon(SrPoint2D(50,40),40,5000,true,polygon);
+	vertex1.clear();
+	ring1.clear();
+	tiler.begin();
+	for( i=0 ; i<(int)polygon.size() ; i+=64 )
+		tiler.addVertex(&polygon[i],i + 64<(int)polygon.size() ? 64 : (int)polygon.size() - i);
+	numRing = tiler.end(vertex1,ring1,ringTile);
+	area1 = 0;
+	for( i=0 ; i<numRing ; i++ )
+	{
+		tile = ringTile[i];
+		SrVector2D minTile(10 + (tile%numTileX)*tileSize.x,10 + (tile/numTileX)*tileSize.y);
+		clipper.setWindow(SrClipWindow2D(minTile,minTile + tileSize));
+		clipPolygonInChunk(clipper,SR_CLIP_SUTHERLAND_HODGMAN,polygon,(int)polygon.size(),vertex2,ring2);
+		area2 = ringArea(vertex1,ring1[i],ring1[i + 1]);
+		ASSERT(fabs(area2 - totalArea(vertex2,ring2))<1e-9);
+		area1 += area2;
+	}
+	clipper.setWindow(SrClipWindow2D(SrVector2D(10,10),SrVector2D(10 + numTileX*tileSize.x,10 + numTileY*tileSize.y)));
+	clipPolygonInChunk(clipper,SR_CLIP_SUTHERLAND_HODGMAN,polygon,(int)polygon.size(),vertex2,ring2);
+	ASSERT(fabs(area1 - totalArea(vertex2,ring2))<1e-6);
+	printf("Tiles: %d, Rings: %d\n",numTileX*numTileY,numRing);
+
+	double seconds = clock();
+	for( i=0 ; i<100 ; i++ )
+	{
+		tiler.begin();
+		tiler.addVertex(&polygon[0],(int)polygon.size());
+		tiler.end(vertex1,ring1,ringTile);
+	}
+	seconds = (clock() - seconds)/CLOCKS_PER_SEC;
+	printf("Tile Clipper Time:	%.6lf\n",seconds);
+
+	seconds = clock();
+	for( i=0 ; i<100 ; i++ )
+	{
+		for( tile=0 ; tile<numTileX*numTileY ; tile++ )
+		{
+			SrVector2D minTile(10 + (tile%numTileX)*tileSize.x,10 + (tile/numTileX)*tileSize.y);
+			clipper.setWindow(SrClipWindow2D(minTile,minTile + tileSize));
+			clipPolygonInChunk(clipper,SR_CLIP_SUTHERLAND_HODGMAN,polygon,(int)polygon.size(),vertex2,ring2);
+		}
+	}
+	seconds = (clock() - seconds)/CLOCKS_PER_SEC;
+	printf("Sutherland-Hodgman Per Tile Time:	%.6lf\n",seconds);
+
+	//ߣڴڵܳȵ߶βüĳ֮
+	SrPoint2D minRect(20,20) , maxRect(50,50) , res1 , res2;
+	polygon.resize(10000);
+	polygon[0].set(35,35);
+	for( i=1 ; i<(int)polygon.size() ; i++ )
+		polygon[i] = polygon[i - 1] + SrVector2D(rand()%9 - 4,rand()%9 - 4);
+	clipper.setWindow(SrClipWindow2D(minRect,maxRect));
+	clipper.begin(SR_CLIP_POLYLINE);
+	vertex1.clear();
+	ring1.clear();
+	for( i=0 ; i<(int)polygon.size() ; i+=100 )
+		clipper.addVertex(&polygon[i],100);
+	numRing = clipper.end(vertex1,ring1);
+	area1 = area2 = 0;
+	for( i=0 ; i<numRing ; i++ )
+		for( j=ring1[i] ; j<ring1[i + 1] - 1 ; j++ )
+			area1 += vertex1[j].distance(vertex1[j + 1]);
+	for( i=0 ; i<(int)polygon.size() - 1 ; i++ )
+		if( Segment2DClipRectangle_LiangBarsky(polygon[i],polygon[i + 1],minRect,maxRect,res1,res2) )
+			area2 += res1.distance(res2);
+	ASSERT(fabs(area1 - area2)<1e-6);
+	printf("Polylines: %d\n",numRing);
+}
+
 int main()
 {
 
 	testClipSegment();
+	testClipSegmentPacket();
+	testClipPolygon();
 	return 0;
 }
\ No newline at end of file
@@ -6,204 +6,14 @@
 /************************************************************************		
 \description	ַж߶ΧǷص
 ****************************************************************************/
-#include "../include/SrGeometricTools.h"
-#include "../include/SrDataType.h"
+#include "../Algorithms/SegmentOverlapOBB.h"
+#include "../Algorithms/SegmentOverlapOBBPacket.h"
 #include <stdio.h>
 #include <math.h>
 #include <time.h>
+#include <stdlib.h>
+#include <vector>
 
-/**
-\brief 3D segment class.
-This is a 3D segment class with public data members,two endpoints.
-*/
-class SrSegment3D
-{
-public:
-	/**
-	\brief Default constructor, the two endpoints is set to (0,0,0).
-	*/
-	SrSegment3D()
-	{
-		mPoint1.set(0,0,0);
-		mPoint2.set(0,0,0);
-	}
-	/**
-	\brief The segment is initialized by two points.
-	*/
-	SrSegment3D(const SrPoint3D& p1,const SrPoint3D& p2)
-	{
-		mPoint1 = p1;
-		mPoint2 = p2;
-	}
-	/**
-	\brief  true if the line is valid.
-	*/
-	bool isValid()const
-	{
-		if( EQUAL(mPoint1.x,mPoint2.x)&&EQUAL(mPoint1.y,mPoint2.y)&&EQUAL(mPoint1.z,mPoint2.z) )
-			return false;
-		return true;
-	}
-public:
-	SrPoint3D mPoint1;
-	SrPoint3D mPoint2;
-};
-
-/**
-\brief 3D oriented bounding box (OBB) class.
-*/
-class SrOBBox3D
-{
-public:
-	SrOBBox3D()
-	{
-		mCenter = SrVector3D(0,0,0);
-		mAxis[0] = mAxis[1] = mAxis[2] = SrVector3D(0,0,0);
-		mHalfLength[0]	= mHalfLength[1] = mHalfLength[2] = 0;
-	}
-	SrOBBox3D(const SrPoint3D& c,const SrVector3D* pAxis,const SrReal* pHalfLength)
-	{
-		mCenter = c;
-		mAxis[0] = pAxis[0];
-		mAxis[1] = pAxis[1];
-		mAxis[2] = pAxis[2];
-
-		mHalfLength[0] = pHalfLength[0];
-		mHalfLength[1] = pHalfLength[1];
-		mHalfLength[2] = pHalfLength[2];
-	}
-	/**
-	\brief  The OBB is valid if one of the three axis is unit length, 
-			the length of them is greater than 0, and the axis should 
-			be perpendicular to each other.
-	*/
-	bool	isValid() const
-	{
-		int i;
-		if( UNEQUAL(mAxis[0].dot(mAxis[1]),0) ||
-			UNEQUAL(mAxis[0].dot(mAxis[2]),0)||
-			UNEQUAL(mAxis[1].dot(mAxis[2]),0))
-			return false;
-		for( i=0 ; i<3 ; i++ )
-		{
-			if( LEQUAL(mHalfLength[i],0) )
-				return false;
-			if( UNEQUAL(mAxis[i].magnitudeSquared(),1.0) )
-				return false;
-		}
-		return true;
-	}
-
-public:
-	SrPoint3D	mCenter;
-	SrVector3D	mAxis[3];
-	SrReal		mHalfLength[3];
-};
-
-/*
-\brief	ж߶OBBǷص޷㡣
-		οģGregory, A., et al. "H-COLLIDE: A framework for fast and accurate collision detection for haptic interaction."
-\return	true	ص
-		false	ص
-
-ĳЩƽ̨ϣfabs()Ŀϴ󣬵¿ٷȺ巨
-*/
-bool SegmentOverlapTestOBB_FastTesting(const SrSegment3D& segment, const SrOBBox3D& obb)
-{
-	SrPoint3D point1 , point2;
-	SrVector3D p1 = segment.mPoint1 - obb.mCenter;
-	SrVector3D p2 = segment.mPoint2 - obb.mCenter;
-
-	point1.x = obb.mAxis[0].dot(p1);
-	point1.y = obb.mAxis[1].dot(p1);
-	point1.z = obb.mAxis[2].dot(p1);
-
-	point2.x = obb.mAxis[0].dot(p2);
-	point2.y = obb.mAxis[1].dot(p2);
-	point2.z = obb.mAxis[2].dot(p2);
-
-	SrPoint3D m = (point1 + point2)*0.5;
-	SrVector3D w = m - point1;
-
-	SrReal X = fabs(w.x), Y = fabs(w.y) , Z = fabs(w.z);
-	if( GREATER(fabs(m.x),X+obb.mHalfLength[0]) )
-		return false;
-	if( GREATER(fabs(m.y),Y+obb.mHalfLength[1]) )
-		return false;
-	if( GREATER(fabs(m.z),Z+obb.mHalfLength[2]) )
-		return false;
-	if( GREATER(fabs(m.y*w.z - m.z*w.y),obb.mHalfLength[1]*Z + obb.mHalfLength[2]*Y) )
-		return false;
-	if( GREATER(fabs(m.x*w.z - m.z*w.x),obb.mHalfLength[0]*Z + obb.mHalfLength[2]*X) )
-		return false;
-	if( GREATER(fabs(m.x*w.y - m.y*w.x),obb.mHalfLength[0]*Y + obb.mHalfLength[1]*X) )
-		return false;
-	return true;
-}
-
-
-/*
-\brief	ú巨ж߶OBBǷصַԼ㡣
-\return	true	ص
-		false	ص
-*/
-bool SegmentOverlapTestOBB_SlabsMethod(const SrSegment3D& segment, const SrOBBox3D& obb)
-{
-	SrPoint3D point1 , point2;
-	SrVector3D p1 = segment.mPoint1 - obb.mCenter;
-	SrVector3D p2 = segment.mPoint2 - obb.mCenter;
-
-	point1.x = obb.mAxis[0].dot(p1);
-	point1.y = obb.mAxis[1].dot(p1);
-	point1.z = obb.mAxis[2].dot(p1);
-
-	point2.x = obb.mAxis[0].dot(p2);
-	point2.y = obb.mAxis[1].dot(p2);
-	point2.z = obb.mAxis[2].dot(p2);
-	
-	//ж߶ζ˵ǷڰΧ
-	if( GEQUAL(point1.x,-obb.mHalfLength[0])&&LEQUAL(point1.x, obb.mHalfLength[0])&&
-		GEQUAL(point1.y,-obb.mHalfLength[1])&&LEQUAL(point1.y, obb.mHalfLength[1])&&
-		GEQUAL(point1.z,-obb.mHalfLength[2])&&LEQUAL(point1.z, obb.mHalfLength[2]))
-		return true;
-	if( GEQUAL(point2.x,-obb.mHalfLength[0])&&LEQUAL(point2.x, obb.mHalfLength[0])&&
-		GEQUAL(point2.y,-obb.mHalfLength[1])&&LEQUAL(point2.y, obb.mHalfLength[1])&&
-		GEQUAL(point2.z,-obb.mHalfLength[2])&&LEQUAL(point2.z, obb.mHalfLength[2]))
-		return true;
-
-	//ж߶ǷΧཻ
-	SrVector3D direction = point2 - point1, base = point1;
-	SrReal tNear = SR_MIN_F32;
-	SrReal tFar = SR_MAX_F32;
-	SrReal t0,t1,tmp;
-	int i;
-	for( i=0 ; i<3 ; i++ )
-	{
-		if( EQUAL(direction[i],0) )
-		{
-			if( LESS(base[i],-obb.mHalfLength[i]) || GREATER(base[i], obb.mHalfLength[i]) )
-				return false;
-			continue;
-		}
-		t0 = (-obb.mHalfLength[i] - base[i]) / direction[i];
-		t1 = ( obb.mHalfLength[i] - base[i]) / direction[i];
-
-		if( GREATER(t0,t1) )
-		{
-			tmp = t0;
-			t0 = t1;
-			t1 = tmp;
-		}
-		if( GREATER(t0,tNear) )
-			tNear = t0;
-		if( LESS(t1,tFar) )
-			tFar = t1;
-		if( GREATER(tNear,tFar) || LESS(tFar,0) || GREATER(tNear,1.0) )
-			return false;
-	}
-
-	return true;
-}
 
 /*
 \brief ߶ݣ߶OBBཻ㷨ȷԣ㷨Чʡ
@@ -269,8 +79,151 @@ void Test_SegmentOverlapTestOBB()
 	delete []segment;
 }
 
+const SrOBBox3D RandomOBB(int range,int size,bool isAligned)
+{
+	SrVector3D axis[3];
+	SrReal halfLen[3];
+	if( isAligned )
+	{
+		axis[0] = SrVector3D(1,0,0);
+		axis[1] = SrVector3D(0,1,0);
+		axis[2] = SrVector3D(0,0,1);
+	}
+	else
+	{
+		do
+		{
+			axis[0] = SrVector3D(rand()%201 - 100,rand()%201 - 100,rand()%201 - 100);
+			axis[1] = axis[0].cross(SrVector3D(rand()%201 - 100,rand()%201 - 100,rand()%201 - 100));
+		}while( axis[0].magnitudeSquared()<1 || axis[1].magnitudeSquared()<1 );
+		axis[0].normalize();
+		axis[1].normalize();
+		axis[2] = axis[0].cross(axis[1]);
+	}
+	int k;
+	for( k=0 ; k<3 ; k++ )
+		halfLen[k] = rand()%size + 1;
+	return SrOBBox3D(SrPoint3D(rand()%range,rand()%range,rand()%range),axis,halfLen);
+}
+
+/*
+\brief ߶Σһ߶ƽƽ棬Ƚ㷨ݰ汾汾Ľ
+	   ԵOBBOBBԵ⣬ԼַЧʡ
+*/
+void Test_SegmentOverlapTestOBBBatch()
+{
+	int numSeg = 100003 , range = 2000;
+	int i , j , k , c , count;
+	SrSegment3DSoA segmentSoA(numSeg);
+	SrOBBox3DSoA obbSoA(numSeg);
+	std::vector<SrSegment3D> segment(numSeg);
+	std::vector<SrOBBox3D> obb(numSeg);
+	std::vector<int> overlapIndex(numSeg);
+	SrPoint3D p0 , p1;
+	for( i=0 ; i<numSeg ; i++ )
+	{
+		do
+		{
+			p0 = SrPoint3D(rand()%range,rand()%range,rand()%range);
+			p1 = SrPoint3D(rand()%range,rand()%range,rand()%range);
+			//ƽƽ߶
+			if( i%4==0 )
+				p1[rand()%3] = p0[rand()%3];
+		}while( p0==p1 );
+		segment[i] = SrSegment3D(p0,p1);
+		obb[i] = RandomOBB(range,500,i%3==0);
+		segmentSoA.setSegment(i,segment[i]);
+		obbSoA.setBox(i,obb[i]);
+	}
+	int kernel;
+	bool status;
+	for( kernel=SR_SEGMENT_KERNEL_FAST ; kernel<=SR_SEGMENT_KERNEL_SLABS ; kernel++ )
+	{
+		//N߶1OBB
+		for( j=0 ; j<20 ; j++ )
+		{
+			count = SegmentOverlapTestOBB_Batch(segmentSoA,obb[j],&overlapIndex[0],kernel);
+			for( i=0 , k=0 ; i<numSeg ; i++ )
+			{
+				status = kernel==SR_SEGMENT_KERNEL_FAST ? SegmentOverlapTestOBB_FastTesting(segment[i],obb[j]) : SegmentOverlapTestOBB_SlabsMethod(segment[i],obb[j]);
+				if( status )
+				{
+					ASSERT(k<count && overlapIndex[k]==i);
+					k ++;
+				}
+			}
+			ASSERT(k==count);
+		}
+		//N߶NOBB
+		count = SegmentOverlapTestOBB_PairBatch(segmentSoA,obbSoA,&overlapIndex[0],kernel);
+		for( i=0 , k=0 ; i<numSeg ; i++ )
+		{
+			status = kernel==SR_SEGMENT_KERNEL_FAST ? SegmentOverlapTestOBB_FastTesting(segment[i],obb[i]) : SegmentOverlapTestOBB_SlabsMethod(segment[i],obb[i]);
+			ASSERT(status==((SegmentOverlapTestOBB_PairPacket(segmentSoA,obbSoA,i - i%SR_SEGMENT_PACKET_WIDTH,kernel)>>(i%SR_SEGMENT_PACKET_WIDTH) & 1)!=0));
+			if( status )
+			{
+				ASSERT(k<count && overlapIndex[k]==i);
+				k ++;
+			}
+		}
+		ASSERT(k==count);
+	}
+
+	//Чʲԣһ߶8OBB
+	numSeg = 1000000;
+	segmentSoA.allocate(numSeg);
+	segment.resize(numSeg);
+	overlapIndex.resize(numSeg);
+	for( i=0 ; i<numSeg ; i++ )
+	{
+		for( c=0 ; c<3 ; c++ )
+		{
+			p0[c] = rand()%range;
+			p1[c] = rand()%range;
+		}
+		segment[i] = SrSegment3D(p0,p1);
+		segmentSoA.setSegment(i,segment[i]);
+	}
+	int numObb = 8;
+	double mTime;
+	printf("%d߶%dOBB:ٲԷʱ俪(s)",numSeg,numObb);
+	mTime = clock();
+	count = 0;
+	for( j=0 ; j<numObb ; j++ )
+		for( i=0 ; i<numSeg ; i++ )
+			count += SegmentOverlapTestOBB_FastTesting(segment[i],obb[j]);
+	mTime = (clock() - mTime) / CLOCKS_PER_SEC;
+	printf("%fص%d\n",mTime,count);
+
+	printf("%d߶%dOBB:巨ʱ俪(s)",numSeg,numObb);
+	mTime = clock();
+	count = 0;
+	for( j=0 ; j<numObb ; j++ )
+		for( i=0 ; i<numSeg ; i++ )
+			count += SegmentOverlapTestOBB_SlabsMethod(segment[i],obb[j]);
+	mTime = (clock() - mTime) / CLOCKS_PER_SEC;
+	printf("%fص%d\n",mTime,count);
+
+	for( kernel=SR_SEGMENT_KERNEL_FAST ; kernel<=SR_SEGMENT_KERNEL_SLABS ; kernel++ )
+	{
+		printf("%d߶%dOBB:%s⣬ʱ俪(s)",numSeg,numObb,kernel==SR_SEGMENT_KERNEL_FAST ? "ٲԷ" : "巨");
+		mTime = clock();
+		count = 0;
+		for( j=0 ; j<numObb ; j++ )
+			count += SegmentOverlapTestOBB_Batch(segmentSoA,obb[j],&overlapIndex[0],kernel);
+		mTime = (clock() - mTime) / CLOCKS_PER_SEC;
+		printf("%fص%d\n",mTime,count);
+	}
+
+	mTime = clock();
+	kernel = SegmentOverlapTestOBB_SelectKernel();
+	mTime = (clock() - mTime) / CLOCKS_PER_SEC;
+	printf("Զѡ㷨%sʱ(s)%f\n",kernel==SR_SEGMENT_KERNEL_FAST ? "ٲԷ" : "巨",mTime);
+}
+
 int main() 
 {
 	Test_SegmentOverlapTestOBB();
+	Test_SegmentOverlapTestOBBBatch();
 	return 0;
 }
\ No newline at end of file
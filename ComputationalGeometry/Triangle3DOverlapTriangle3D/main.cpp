@@ -3,746 +3,15 @@
 \author Twinkling Star
 \date	2014/04/20
 ****************************************************************************/
-#include "SrGeometricTools.h"
-#include "SrDataType.h"
+#include "../Algorithms/Tri3DOverlapTri3D.h"
+#include "../Algorithms/Tri3DOverlapTri3DPacket.h"
+#include "../Algorithms/TriangleBVH.h"
 
 #include <time.h>
 #include <stdio.h>
-
-#define Real		SrReal
-#define Point2D		SrPoint2D
-#define Vector2D	SrVector2D
-#define Point3D		SrPoint3D
-#define Vector3D	SrVector3D
-
-
-#define EPS			0.000001f
-#define INSIDE		0x01
-#define OUTSIDE		0x02
-#define ON_EDGE		0x03
-
-#define AXIS_X		0x01
-#define AXIS_Y		0x02
-#define AXIS_Z		0x04
-
-/**
-\brief 3D triangle class.
-This is a 3D triangle class with public data members.
-*/
-class SrTriangle3D
-{
-public:
-	SrTriangle3D()
-	{
-		mPoint[0].set(0,0,0);
-		mPoint[1].set(0,0,0);
-		mPoint[2].set(0,0,0);
-	}
-	SrTriangle3D(const SrPoint3D& p0,const SrPoint3D& p1,const SrPoint3D& p2)
-	{
-		mPoint[0] = p0;
-		mPoint[1] = p1;
-		mPoint[2] = p2;
-	}
-	/**
-	\brief The triangle is valid if the three points are not on a line.
-	*/
-	bool isValid()
-	{
-		SrVector3D norm = (mPoint[1]-mPoint[0]).cross(mPoint[2]-mPoint[0]);
-		if( EQUAL(norm.x,0)&&EQUAL(norm.y,0)&&EQUAL(norm.z,0) )
-			return false;
-		return true;
-	}
-	/**
-	\brief  Judge whether the point is in the triangle or not.
-	\return SR_POSITION_ON		 if the point is on the edge; 
-			SR_POSITION_INSIDE  if inside the triangle and on the same plane; 
-			SR_POSITION_OUTSIDE if outside the triangle and on the same plane.
-			SR_POSITION_INVALID if not on the same plane.
-	*/
-	int		pointLocation(const SrPoint3D& p) const
-	{
-		//Judge whether the three points determine a plane or not.
-		SrVector3D norm = (mPoint[1] - mPoint[0]).cross(mPoint[2] - mPoint[0]);
-		if(EQUAL(norm.x,0) && EQUAL(norm.y,0) && EQUAL(norm.z,0))
-			return SR_POSITION_INVALID;
-		SrReal d = -norm.dot(mPoint[0]);
-		if( EQUAL(norm.dot(p) + d, 0) )
-			return SR_POSITION_INVALID;
-
-		SrReal flag1 = norm.dot((mPoint[1]-mPoint[0]).cross(p-mPoint[0]));
-		if( LESS(flag1,0) )
-			return SR_POSITION_OUTSIDE;
-		SrReal flag2 = norm.dot((mPoint[2]-mPoint[1]).cross(p-mPoint[1]));
-		if( LESS(flag2,0) )
-			return SR_POSITION_OUTSIDE;
-		SrVector3D tmp = (mPoint[0]-mPoint[2]).cross(p-mPoint[2]);
-		SrReal flag3 = norm.dot((mPoint[0]-mPoint[2]).cross(p-mPoint[2]));
-		if( LESS(flag3,0) )
-			return SR_POSITION_OUTSIDE;
-		if( EQUAL(flag1,0) || EQUAL(flag2,0) || EQUAL(flag3,0) )
-			return SR_POSITION_ON;
-		return SR_POSITION_INSIDE;
-	}
-	/**
-	\brief  Judge whether or not the segment hits the triangle.
-	\return SR_OVERLAPPING		 if the segment is on the plane where the triangle lies;
-			SR_PARALLEL			 if the segment is parallel to the triangle.
-			SR_SEPARATING		 if the segment misses the triangle;
-			SR_INTERSECTING		 if the segment intersects with the triangle and intersection point is not on the edge.
-	*/
-	int segmentHitTest(const SrPoint3D& p0, const SrPoint3D& p1)const
-	{
-		SrVector3D ret;
-		SrVector3D direction = p1 - p0;
-		int retFlag = linearIntersectTriangle(p0,direction,ret);
-		if( retFlag!=SR_INTERSECTING )
-			return retFlag;
-		//check t. 0<= t <=1
-		if( LESS(ret.z,0) || GREATER(ret.z,1) )
-			return SR_DISJOINT;
-		//check whether the intersection point is on the edge.
-		return SR_INTERSECTING;
-	}
-public:
-	SrPoint3D mPoint[3];
-private:
-	/*
-	--------------------------------------------------------------------------
-	Devised by Moller and Trumbore,1997. <Fast,minimum storage ray-triangle 
-	intersection>
-	Any point in a triangle can be defined in terms of its position relative
-	to the triangles vertices:
-			Qu,v = (1-u-v)V0 + uV1 + vV2 ,0<=u<=1,0<=v<=1,0<=u+v<=1
-	For the linear componentCtriangle intersection,
-			P + t*^d = Qu,v
-	which can be expanded and applied Cramers rule to:
-			|t|							| |P-V0  V1-V0  V2-V0| |
-			|u| = 1/|-^d  V1-V0  V2-V0| | |-^d   P-V0   V2-V0| |
-			|v|							| |-^d   V1-V0   P-V0| |
-										
-											| ((P-V0)(V1-V0))(V2-V0) |
-				= 1/(^d(V2-v0))(V1-V0)	|    (^d(V2-V0))(P-V0)   |
-											|    ((P-V0)(V1-V0))^d	 |
-	--------------------------------------------------------------------------
-	*/
-	int linearIntersectTriangle(const SrPoint3D& base,const SrVector3D& direction,SrVector3D& result)const
-	{
-		SrReal u,v,tmp;
-		SrVector3D e1,e2,p,s,q;
-		e1 = mPoint[1] - mPoint[0];
-		e2 = mPoint[2] - mPoint[0];
-		p = direction.cross(e2);
-		tmp = p.dot(e1);
-		//If the line is perpendicular to the normal of triangle.
-		if( EQUAL(tmp,0) )
-		{
-			//The line is on the plane.
-			p = e1.cross(e2);
-			if( EQUAL(p.dot(base - mPoint[0]),0) )
-				return SR_OVERLAPPING;
-			//The line is parallel to the plane.
-			return SR_PARALLEL;
-		}
-		s=base - mPoint[0];
-		u = p.dot(s)/tmp;
-		if( LESS(u,0) || GREATER(u,1) )
-			return SR_DISJOINT;
-		q = s.cross(e1);
-		v = q.dot(direction)/tmp;
-		if( LESS(v,0) || GREATER(v,1) || GREATER(u+v,1) )
-			return SR_DISJOINT;
-
-		result.x = u;
-		result.y = v;
-		result.z = e2.dot(q)/tmp;
-		return SR_INTERSECTING;
-	}
-};
-
-#define  Triangle3D			SrTriangle3D
-
-
-/*
-*\brief  ڶάռϣж߶Ƿཻ.
-*\return true		ཻ.
-		 false		ཻ.
-*/
-bool Seg2DIntersectSeg2D(const Point2D& p0, const Point2D& p1, const Point2D& q0, const Point2D& q1 )
-{
-	SrVector2D A = p1 - p0;
-	SrVector2D B = q0 - q1;
-	SrVector2D C = p0 - q0;
-	SrReal a = B.y*C.x - B.x*C.y;
-	SrReal b;
-	SrReal denom = A.y*B.x - A.x*B.y;
-	if( GREATER( denom,0 ) )
-	{
-		if( LESS(a,0) || GREATER(a,denom) )
-			return false;
-		b = A.x*C.y - A.y*C.x;
-		if( LESS(b,0) || GREATER(b,denom) )
-			return false;
-		return true;
-	}
-	else if (LESS( denom,0 ))
-	{
-		if( GREATER(a,0) || LESS(a,denom) )
-			return false;
-		b = A.x*C.y - A.y*C.x;
-		if( GREATER(b,0) || LESS(b,denom) )
-			return false;
-		return true;
-	}
-	else
-	{
-		if( !EQUAL(a,0) )
-			return false;
-
-		SrReal denom , t0, t1;
-		if( GREATER(fabs(A.x),fabs(A.y)) )
-		{
-			t0 = q0.x - p0.x;
-			t1 = q1.x - p0.x;
-			denom = A.x;
-		}
-		else
-		{
-			t0 = q0.y - p0.y;
-			t1 = q1.y - p0.y;
-			denom = A.y;
-		}
-		if( LESS(denom,0) )
-		{
-			denom = -denom;
-			t0    = -t0;
-			t1	  = -t1;
-		}
-		SrReal tmp;
-		if( t0>t1 )
-		{
-			tmp = t0;
-			t0 = t1;
-			t1 = tmp;
-		}
-		if( GREATER(t0,denom) || LESS(t1,0) )
-			return false;
-		else if( EQUAL(t1,0) || EQUAL(t0,1) )
-			return true;
-
-		return true;
-	}
-	return false;
-}
-
-/**
-\brief  ڶάռϣжһεĹϵ
-\return ON_EDGE		εı; 
-		INSIDE		ڲ; 
-		OUTSIDE		ⲿ.
-*/
-int		PointTriangleRelation(const Point2D* tri, const Point2D& p) 
-{
-	Real d0 = (tri[1] - tri[0]).cross(p - tri[0]);
-	Real d1 = (tri[2] - tri[1]).cross(p - tri[1]);
-	Real d2 = (tri[0] - tri[2]).cross(p - tri[2]);
-	Real s0 = d0*d1, s1 = d1*d2;
-
-	if( LESS(s0,0) || LESS(s1,0) )
-		return OUTSIDE;
-	else if( EQUAL(s0,0) || EQUAL(s1,0))
-		return ON_EDGE;
-	return INSIDE;
-}
-/**
-\brief  ڶάռϣεص
-\return true		ص;
-		false		.
-*/
-bool Tri2DOverlapTestTri2D(const Point2D* tri1, const Point2D* tri2)
-{
-	int i , j;
-	for( i = 0 ; i < 3 ; i++ )
-	{
-		for( j = 0 ; j < 3 ; j++ )
-		{
-			if( Seg2DIntersectSeg2D(tri1[i],tri1[(i + 1) % 3],tri2[j],tri2[(j + 1) % 3]) )
-				return true;
-		}
-	}
-	if(PointTriangleRelation(tri1,tri2[0]) != OUTSIDE)
-		return true;
-	else if(PointTriangleRelation(tri2,tri1[0]) != OUTSIDE )
-		return true;
-	return false;
-}
-
-int GetMaximumAxis(const Vector3D& normal)
-{
-	Vector3D tm = Vector3D(fabs(normal.x),fabs(normal.y),fabs(normal.z));
-	if( GEQUAL(tm.x,tm.y) && GEQUAL(tm.x,tm.z) )
-		return AXIS_X;
-	else if( GEQUAL(tm.y,tm.x) && GEQUAL(tm.y,tm.z) )
-		return AXIS_Y;
-	return AXIS_Z;
-}
-
-/**
-\brief  άĵ㣬Ƴһõάĵ
-*/
-void Point3DToPoint2D(const Point3D& point,Point2D& result,int axis)
-{
-	if(axis == AXIS_X)
-	{
-		result.x = point.y;
-		result.y = point.z;
-	}
-	else if(axis == AXIS_Y)
-	{
-		result.x = point.z;
-		result.y = point.x;
-	}
-	else
-	{
-		result.x = point.x;
-		result.y = point.y;
-	}
-}
-
-void Point3DToPoint2D(const SrPoint3D*point,int number,SrPoint2D* result,int axisRemoved)
-{
-	int i = 0;
-	for( i=0 ; i<number ; i++ )
-	{
-		Point3DToPoint2D(point[i],result[i],axisRemoved);
-	}
-}
-
-bool Tri3DCoplanarTri3D(const SrTriangle3D& tri1,const SrTriangle3D& tri2,int axis)
-{
-	Point2D tmpTri1[3],tmpTri2[3];
-	Point3DToPoint2D(tri1.mPoint,3,tmpTri1,axis);
-	Point3DToPoint2D(tri2.mPoint,3,tmpTri2,axis);
-	return Tri2DOverlapTestTri2D(tmpTri1,tmpTri2);
-}
-
-void ComputeInterval(const Triangle3D& triangle,const Vector3D& direction,int maxAxis,Real* distTriToPlane,Real* t)
-{
-	Real p[3], tm;
-	int indx[3];
-	//sort the dist by using the index table.
-	int minIndex = 0 , tmpIndx;
-	if( LESS(distTriToPlane[1],distTriToPlane[minIndex]) )
-		minIndex = 1;
-	if( LESS(distTriToPlane[2],distTriToPlane[minIndex]) )
-		minIndex = 2;
-	int tmp1 = (minIndex + 1)%3, tmp2 = (minIndex + 2)%3;
-	indx[0] = minIndex;
-	if( LESS(distTriToPlane[tmp1],distTriToPlane[tmp2]) )
-	{
-		indx[1] = tmp1;
-		indx[2] = tmp2;
-	}
-	else
-	{
-		indx[1] = tmp2;
-		indx[2] = tmp1;;
-	}
-
-	if( EQUAL(distTriToPlane[indx[0]],0) && EQUAL(distTriToPlane[indx[1]],0) )
-	{
-		t[0] = triangle.mPoint[indx[0]][maxAxis];
-		t[1] = triangle.mPoint[indx[1]][maxAxis];
-	}
-	else if( EQUAL(distTriToPlane[indx[1]],0) && EQUAL(distTriToPlane[indx[2]],0) )
-	{
-		t[0] = triangle.mPoint[indx[1]][maxAxis];
-		t[1] = triangle.mPoint[indx[2]][maxAxis];
-	}
-	else
-	{
-		if( LESS(distTriToPlane[indx[1]],0) )
-		{
-			tmpIndx = indx[0];
-			indx[0] = indx[2];
-			indx[2] = tmpIndx;
-		}
-		p[0] = triangle.mPoint[indx[0]][maxAxis];
-		p[1] = triangle.mPoint[indx[1]][maxAxis];
-		p[2] = triangle.mPoint[indx[2]][maxAxis];
-
-		t[0] = p[1] + (p[0] - p[1])*distTriToPlane[indx[1]] / (distTriToPlane[indx[1]] - distTriToPlane[indx[0]]);
-		t[1] = p[2] + (p[0] - p[2])*distTriToPlane[indx[2]] / (distTriToPlane[indx[2]] - distTriToPlane[indx[0]]);
-	}
-
-	if( GREATER(t[0] , t[1]) )
-	{
-		tm	 = t[0];
-		t[0] = t[1];
-		t[1] = tm;
-	}
-}
-
-/*
-	صжǷص
-*/
-
-bool Tri3DOverlapTestTri3D_Moller(const Triangle3D& tri1,const Triangle3D& tri2)
-{
-	Vector3D tri1Normal,tri2Normal;
-	Real d, d0, d1;
-
-	//ʼtri1ڵƽ
-	tri1Normal = (tri1.mPoint[1] - tri1.mPoint[0]).cross(tri1.mPoint[2] - tri1.mPoint[0]);
-	d = -tri1Normal.dot(tri1.mPoint[0]);
-
-	Real distTri2ToPlane[3] , distTri1ToPlane[3];
-	//tri2ϵ㵽tri1ڵƽзž
-	distTri2ToPlane[0] = tri1Normal.dot(tri2.mPoint[0]) + d;
-	distTri2ToPlane[1] = tri1Normal.dot(tri2.mPoint[1]) + d;
-	distTri2ToPlane[2] = tri1Normal.dot(tri2.mPoint[2]) + d;
-
-	//жзžǷǸ
-	d0 = distTri2ToPlane[0]*distTri2ToPlane[1];
-	d1 = distTri2ToPlane[1]*distTri2ToPlane[2];
-	if( GREATER(d0,0) && GREATER(d1,0) )
-		return false;
-
-	if( EQUAL(distTri2ToPlane[0],0) && EQUAL(distTri2ToPlane[1],0) && EQUAL(distTri2ToPlane[2],0) )
-	{//The two triangles are coplanar.
-		int axis = GetMaximumAxis(tri1Normal);
-		return Tri3DCoplanarTri3D(tri1,tri2,axis);
-	}
-	//ʼtri2ڵƽ
-	tri2Normal = (tri2.mPoint[1] - tri2.mPoint[0]).cross(tri2.mPoint[2] - tri2.mPoint[0]);
-	d = -tri2Normal.dot(tri2.mPoint[0]);
-
-	//tri1ϵ㵽tri2ڵƽзž
-	distTri1ToPlane[0] = tri2Normal.dot(tri1.mPoint[0]) + d;
-	distTri1ToPlane[1] = tri2Normal.dot(tri1.mPoint[1]) + d;
-	distTri1ToPlane[2] = tri2Normal.dot(tri1.mPoint[2]) + d;
-
-	//жзžǷ
-	d0 = distTri1ToPlane[0]*distTri1ToPlane[1];
-	d1 = distTri1ToPlane[1]*distTri1ToPlane[2];
-	if( GREATER(d0,0) && GREATER(d1,0) )
-		return false;
-
-	//ֱཻߵķ
-	Vector3D direction = tri1Normal.cross(tri2Normal);
-	Real t0[2] , t1[2];
-	int maxAxis = 0 ;
-	Vector3D tmpDirection = Vector3D(fabs(direction.x),fabs(direction.y),fabs(direction.z));
-	if( GREATER(tmpDirection.x,tmpDirection.y) )
-	{
-		if( GREATER(tmpDirection.z , tmpDirection.x)  )
-			maxAxis = 2;
-		else
-			maxAxis = 0;
-	}
-	else
-	{
-		if( GREATER(tmpDirection.z , tmpDirection.y) )
-			maxAxis = 2;
-		else
-			maxAxis = 1;
-	}
-
-	ComputeInterval(tri1,direction,maxAxis,distTri1ToPlane,t0);
-	ComputeInterval(tri2,direction,maxAxis,distTri2ToPlane,t1);
-
-	if( GREATER(t0[0] , t1[1]) || LESS(t0[1] , t1[0]) )
-		return false;
-	return true;
-}
-
-
-Real Determinant(const Point3D& p0,const Point3D& p1,const Point3D& p2,const Point3D& p3)
-{
-	return (p3-p0).dot((p1-p0).cross(p2-p0));
-}
-
-void ReorderVertex(Real* distTriToPlane, int* index)
-{
-	index[0] = 0;index[1] = 1;index[2] = 2;
-	//sort the dist by using the index table.
-	int sole = 0 ;
-	if( LESS(distTriToPlane[1],distTriToPlane[sole]) )
-		sole = 1;
-	if( LESS(distTriToPlane[2],distTriToPlane[sole]) )
-		sole = 2;
-	int tmp1 = (sole + 1) % 3, tmp2 = (sole + 2) % 3;
-
-	if( EQUAL(distTriToPlane[sole],0) )
-	{
-		if( EQUAL(distTriToPlane[tmp1],0) )
-			sole = tmp2;
-		else if( EQUAL(distTriToPlane[tmp2],0) )
-			sole = tmp1;
-	}
-	else
-	{
-		if( LESS(distTriToPlane[tmp1],0) )
-			sole = tmp2;
-		else if( LESS(distTriToPlane[tmp2],0) )
-			sole = tmp1;
-	}
-
-	index[0] =  sole;
-	index[1] = (sole + 1) % 3;
-	index[2] = (sole + 2) % 3;
-}
-
-
-void Transposition(Real*distTri1ToPlane,int *tri1Index,
-				   Real*distTri2ToPlane,int* tri2Index)
-{
-	int tmpIndex;
-	if( EQUAL(distTri1ToPlane[tri1Index[0]],0) )
-	{
-		if( GREATER(distTri1ToPlane[tri1Index[1]] , 0) )
-		{
-			tmpIndex = tri2Index[1];
-			tri2Index[1] = tri2Index[2];
-			tri2Index[2] = tmpIndex;
-		}
-	}
-	else
-	{
-		if( LESS(distTri1ToPlane[tri1Index[0]] , 0) )
-		{
-			tmpIndex = tri2Index[1];
-			tri2Index[1] = tri2Index[2];
-			tri2Index[2] = tmpIndex;
-		}
-	}
-
-	if( EQUAL(distTri2ToPlane[tri2Index[0]],0) )
-	{
-		if( GREATER(distTri2ToPlane[tri2Index[1]] , 0) )
-		{
-			tmpIndex = tri1Index[1];
-			tri1Index[1] = tri1Index[2];
-			tri1Index[2] = tmpIndex;
-		}
-	}
-	else
-	{
-		if( LESS(distTri2ToPlane[tri2Index[0]] , 0) )
-		{
-			tmpIndex = tri1Index[1];
-			tri1Index[1] = tri1Index[2];
-			tri1Index[2] = tmpIndex;
-		}
-	}
-}
-
-bool Tri3DOverlapTestTri3D_Guigue(const Triangle3D& tri1,const Triangle3D& tri2)
-{
-	Vector3D tri1Normal,tri2Normal;
-	tri1Normal = (tri1.mPoint[1] - tri1.mPoint[0]).cross(tri1.mPoint[2] - tri1.mPoint[0]);
-	Real distTri2ToPlane[3] , distTri1ToPlane[3];
-	distTri2ToPlane[0] = tri1Normal.dot(tri2.mPoint[0] - tri1.mPoint[0]);
-	distTri2ToPlane[1] = tri1Normal.dot(tri2.mPoint[1] - tri1.mPoint[0]);
-	distTri2ToPlane[2] = tri1Normal.dot(tri2.mPoint[2] - tri1.mPoint[0]);
-	Real d0 = distTri2ToPlane[0]*distTri2ToPlane[1];
-	Real d1 = distTri2ToPlane[1]*distTri2ToPlane[2];
-	if( GREATER(d0,0) && GREATER(d1,0) )
-		return false;
-
-	if( EQUAL(distTri2ToPlane[0],0) && EQUAL(distTri2ToPlane[1],0) && EQUAL(distTri2ToPlane[2],0) )
-	{//The two triangles are coplanar.
-		int axis = GetMaximumAxis(tri1Normal);
-		return Tri3DCoplanarTri3D(tri1,tri2,axis);
-	}
-	tri2Normal = (tri2.mPoint[1] - tri2.mPoint[0]).cross(tri2.mPoint[2] - tri2.mPoint[0]);
-	distTri1ToPlane[0] = tri2Normal.dot(tri1.mPoint[0] - tri2.mPoint[0]);
-	distTri1ToPlane[1] = tri2Normal.dot(tri1.mPoint[1] - tri2.mPoint[0]);
-	distTri1ToPlane[2] = tri2Normal.dot(tri1.mPoint[2] - tri2.mPoint[0]);
-
-	d0 = distTri1ToPlane[0]*distTri1ToPlane[1];
-	d1 = distTri1ToPlane[1]*distTri1ToPlane[2];
-	if( GREATER(d0,0) && GREATER(d1,0) )
-		return false;
-
-	int indexTri1[3] , indexTri2[3];
-	ReorderVertex(distTri1ToPlane,indexTri1);
-	ReorderVertex(distTri2ToPlane,indexTri2);
-	Transposition(distTri1ToPlane,indexTri1,distTri2ToPlane,indexTri2);
-
-	Real d;
-	d = Determinant(tri2.mPoint[indexTri2[0]],tri2.mPoint[indexTri2[1]],tri1.mPoint[indexTri1[0]],tri1.mPoint[indexTri1[1]]);
-	if( GREATER(d,0) )
-		return false;
-	d = Determinant(tri2.mPoint[indexTri2[0]],tri2.mPoint[indexTri2[2]],tri1.mPoint[indexTri1[2]],tri1.mPoint[indexTri1[0]]);
-	if( GREATER(d,0) )
-		return false;
-	return true;
-}
-
-bool Tri3DOverlapTestTri3D_Naive(const SrTriangle3D& tri1,const SrTriangle3D& tri2)
-{
-	SrVector3D tri1Normal,tri2Normal;
-	SrReal d;
-	tri1Normal = (tri1.mPoint[1] - tri1.mPoint[0]).cross(tri1.mPoint[2] - tri1.mPoint[0]);
-	d = -tri1Normal.dot(tri1.mPoint[0]);
-
-	SrReal distTri2ToPlane[3],distTri1ToPlane[3];
-	distTri2ToPlane[0] = tri1Normal.dot(tri2.mPoint[0]) + d;
-	distTri2ToPlane[1] = tri1Normal.dot(tri2.mPoint[1]) + d;
-	distTri2ToPlane[2] = tri1Normal.dot(tri2.mPoint[2]) + d;
-	SrReal d0 = distTri2ToPlane[0] * distTri2ToPlane[1];
-	SrReal d1 = distTri2ToPlane[1] * distTri2ToPlane[2];
-	//The three vertex of triangle tri2 is on the same side of the plane initialized by triangle tri1.
-	if( GREATER(d0,0) && GREATER(d1,0) )
-		return false;
-
-	if( EQUAL(distTri2ToPlane[0],0) && EQUAL(distTri2ToPlane[1],0) && EQUAL(distTri2ToPlane[2],0) )
-	{//The two triangles are coplanar.
-		int axis = GetMaximumAxis(tri1Normal);
-		return Tri3DCoplanarTri3D(tri1,tri2,axis);
-	}
-
-	tri2Normal = (tri2.mPoint[1] - tri2.mPoint[0]).cross(tri2.mPoint[2] - tri2.mPoint[0]);
-	d = -tri2Normal.dot(tri2.mPoint[0]);
-	distTri1ToPlane[0] = tri2Normal.dot(tri1.mPoint[0]) + d;
-	distTri1ToPlane[1] = tri2Normal.dot(tri1.mPoint[1]) + d;
-	distTri1ToPlane[2] = tri2Normal.dot(tri1.mPoint[2]) + d;
-
-	d0 = distTri1ToPlane[0]*distTri1ToPlane[1];
-	d1 = distTri1ToPlane[1]*distTri1ToPlane[2];
-
-	if( GREATER(d0,0) && GREATER(d1,0) )
-		return false;
-	int i;
-	for( i=0 ; i<3 ; i++ )
-	{
-		if( tri2.segmentHitTest(tri1.mPoint[i], tri1.mPoint[(i+1)%3]) == SR_INTERSECTING )
-			return true;
-	}
-	for( i=0 ; i<3 ; i++ )
-	{
-		if( tri1.segmentHitTest(tri2.mPoint[i], tri2.mPoint[(i+1)%3])==SR_INTERSECTING )
-			return true;
-	}
-	return false;
-}
-
-
-void ComputeIntersection(const SrTriangle3D& triangle,SrReal* distTriToPlane,const SrVector3D& normal,SrReal d,SrPoint3D* outPoint)
-{
-	int indx[3];
-	//sort the dist by using the index table.
-	int minIndex = 0 , tmpIndx;
-	if( LESS(distTriToPlane[1],distTriToPlane[minIndex]) )
-		minIndex = 1;
-	if( LESS(distTriToPlane[2],distTriToPlane[minIndex]) )
-		minIndex = 2;
-	int tmp1 = (minIndex + 1)%3, tmp2 = (minIndex + 2)%3;
-	indx[0] = minIndex;
-	if( LESS(distTriToPlane[tmp1],distTriToPlane[tmp2]) )
-	{
-		indx[1] = tmp1;
-		indx[2] = tmp2;
-	}
-	else
-	{
-		indx[1] = tmp2;
-		indx[2] = tmp1;;
-	}
-
-	if( EQUAL(distTriToPlane[indx[1]],0) )
-	{
-		if( EQUAL(distTriToPlane[indx[0]],0) )
-		{
-			outPoint[0] = triangle.mPoint[indx[0]];
-			outPoint[1] = triangle.mPoint[indx[1]];
-			return;
-		}
-		else if( EQUAL(distTriToPlane[indx[2]],0) )
-		{
-			outPoint[0] = triangle.mPoint[indx[1]];
-			outPoint[1] = triangle.mPoint[indx[2]];
-			return;
-		}
-	}
-	else if( LESS(distTriToPlane[indx[1]],0) )
-	{
-		tmpIndx = indx[0];
-		indx[0] = indx[2];
-		indx[2] = tmpIndx;
-	}
-	SrVector3D direction = triangle.mPoint[indx[1]] - triangle.mPoint[indx[0]];
-	SrReal denom = direction.dot(normal);
-	SrReal t = -(d + normal.dot(triangle.mPoint[indx[0]])) / denom;
-	outPoint[0] = triangle.mPoint[indx[0]] + t*direction;
-
-	direction = triangle.mPoint[indx[2]] - triangle.mPoint[indx[0]];
-	denom = direction.dot(normal);
-	t = -(d + normal.dot(triangle.mPoint[indx[0]])) / denom;
-	outPoint[1] = triangle.mPoint[indx[0]] + t*direction;
-}
-bool Tri3DOverlapTestTri3D_ERIT(const SrTriangle3D& tri1,const SrTriangle3D& tri2)
-{
-	SrVector3D tri1Normal,tri2Normal;
-	SrReal tri1d,tri2d;
-	tri1Normal = (tri1.mPoint[1] - tri1.mPoint[0]).cross(tri1.mPoint[2] - tri1.mPoint[0]);
-	tri1d = -tri1Normal.dot(tri1.mPoint[0]);
-
-	SrReal distTri2ToPlane[3] , distTri1ToPlane[3];
-	distTri2ToPlane[0] = tri1Normal.dot(tri2.mPoint[0]) + tri1d;
-	distTri2ToPlane[1] = tri1Normal.dot(tri2.mPoint[1]) + tri1d;
-	distTri2ToPlane[2] = tri1Normal.dot(tri2.mPoint[2]) + tri1d;
-
-	SrReal d0 = distTri2ToPlane[0] * distTri2ToPlane[1];
-	SrReal d1 = distTri2ToPlane[1] * distTri2ToPlane[2];
-	//The three vertex of triangle tri2 is on the same side of the plane initialized by triangle tri1.
-	if( GREATER(d0,0) && GREATER(d1,0) )
-	{
-		//printf("first\n");
-		return false;
-	}
-
-	if( EQUAL(distTri2ToPlane[0],0) && EQUAL(distTri2ToPlane[1],0) && EQUAL(distTri2ToPlane[2],0) )
-	{//The two triangles are coplanar.
-		int axis = GetMaximumAxis(tri1Normal);
-		return Tri3DCoplanarTri3D(tri1,tri2,axis);
-	}
-	tri2Normal = (tri2.mPoint[1] - tri2.mPoint[0]).cross(tri2.mPoint[2] - tri2.mPoint[0]);
-	tri2d = -tri2Normal.dot(tri2.mPoint[0]);
-	distTri1ToPlane[0] = tri2Normal.dot(tri1.mPoint[0]) + tri2d;
-	distTri1ToPlane[1] = tri2Normal.dot(tri1.mPoint[1]) + tri2d;
-	distTri1ToPlane[2] = tri2Normal.dot(tri1.mPoint[2]) + tri2d;
-
-	d0 = distTri1ToPlane[0]*distTri1ToPlane[1];
-	d1 = distTri1ToPlane[1]*distTri1ToPlane[2];
-
-	if( GREATER(d0,0) && GREATER(d1,0) )
-	{
-		//printf("GREATER(d0,0) && GREATER(d1,0)\n");
-		return false;
-	}
-
-	SrPoint3D inPoint[2];
-	SrPoint2D point[3];
-	SrPoint2D p0, p1;
-	ComputeIntersection(tri2,distTri2ToPlane,tri1Normal,tri1d,inPoint);
-	int axis = GetMaximumAxis(tri1Normal) , i;
-	Point3DToPoint2D(inPoint[0],p0,axis);
-	Point3DToPoint2D(inPoint[1],p1,axis);
-	Point3DToPoint2D(tri1.mPoint,3,point,axis);
-	int status = PointTriangleRelation(point,p0);
-	if( status != OUTSIDE )
-		return true;
-	for( i=0 ; i<3 ; i++ )
-	{
-		if(Seg2DIntersectSeg2D(p0,p1,point[i],point[(i+1)%3]))
-			return true;
-	}
-	//printf("return false;\n");
-	return false;
-}
+#include <stdlib.h>
+#include <math.h>
+#include <algorithm>
 
 void testTriangle3dIntersectTriangle3d_Guigue(SrTriangle3D* tri1,SrTriangle3D* tri2,int numCase)
 {
@@ -815,6 +84,173 @@ void testTriangle3dIntersectTriangle3d_ERIT(SrTriangle3D* tri1,SrTriangle3D* tri
 }
 
 
+#ifdef _DEBUG
+/*
+\brief	ptriڲ߱ϣpƽľ벻tolerancePointTriangleRelationһ
+		pߵĲطķԱ߳õpֱߵ룬С-tolerance
+*/
+static bool PointOnTriangle(const SrTriangle3D& tri,const SrPoint3D& p,SrReal tolerance)
+{
+	SrVector3D normal = (tri.mPoint[1] - tri.mPoint[0]).cross(tri.mPoint[2] - tri.mPoint[0]) , edge;
+	normal.normalize();
+	if( fabs(normal.dot(p - tri.mPoint[0]))>tolerance )
+		return false;
+	int i;
+	for( i=0 ; i<3 ; i++ )
+	{
+		edge = tri.mPoint[(i + 1) % 3] - tri.mPoint[i];
+		if( normal.dot(edge.cross(p - tri.mPoint[i]))<-tolerance*edge.magnitude() )
+			return false;
+	}
+	return true;
+}
+
+/*
+\brief	triƽ(normal,point)Ľ߶ͶӰdirectionϵ[minT,maxT]Tri3DIntersectTri3D޹أ
+		ֱö㵽ƽڷŲͬıϲֵΪ0Ķ㱾ƽ
+\return	ƽ治ཻʱfalse
+*/
+static bool TrianglePlaneInterval(const SrTriangle3D& tri,const SrVector3D& normal,const SrPoint3D& point,
+								  const SrVector3D& direction,SrReal& minT,SrReal& maxT)
+{
+	SrReal dist[3] , t;
+	int i , j;
+	bool isIntersecting = false;
+	for( i=0 ; i<3 ; i++ )
+		dist[i] = normal.dot(tri.mPoint[i] - point);
+	for( i=0 ; i<3 ; i++ )
+	{
+		j = (i + 1) % 3;
+		if( dist[i]==0 )
+			t = direction.dot(tri.mPoint[i]);
+		else if( (dist[i]<0 && dist[j]>0) || (dist[i]>0 && dist[j]<0) )
+			t = direction.dot(tri.mPoint[i] + (tri.mPoint[j] - tri.mPoint[i])*(dist[i]/(dist[i] - dist[j])));
+		else
+			continue;
+		if( !isIntersecting || t<minT )
+			minT = t;
+		if( !isIntersecting || t>maxT )
+			maxT = t;
+		isIntersecting = true;
+	}
+	return isIntersecting;
+}
+#endif
+
+void testTriangle3dIntersectTriangle3d_Segment(SrTriangle3D* tri1,SrTriangle3D* tri2,int numCase)
+{
+	SrPoint3D point[SR_TRI3D_MAX_INTERSECTION];
+	int i , numPoint;
+#ifdef _DEBUG
+	int j , status;
+	SrVector3D normal1 , normal2 , direction;
+	SrReal min1 , max1 , min2 , max2;
+	for( i=0 ; i<numCase ; i++ )
+	{
+		status = Tri3DIntersectTri3D(tri1[i],tri2[i],point,numPoint);
+		ASSERT((status != SR_DISJOINT) == Tri3DOverlapTestTri3D_Naive(tri1[i],tri2[i]));
+		//Every intersection point is inside or on both triangles.
+		for( j=0 ; j<numPoint ; j++ )
+			ASSERT(PointOnTriangle(tri1[i],point[j],1e-6) && PointOnTriangle(tri2[i],point[j],1e-6));
+		if( status != SR_INTERSECTING )
+			continue;
+		//The segment is the overlap of the two triangles' intervals on the intersection line n1 x n2.
+		ASSERT(numPoint==2);
+		normal1 = (tri1[i].mPoint[1] - tri1[i].mPoint[0]).cross(tri1[i].mPoint[2] - tri1[i].mPoint[0]);
+		normal2 = (tri2[i].mPoint[1] - tri2[i].mPoint[0]).cross(tri2[i].mPoint[2] - tri2[i].mPoint[0]);
+		direction = normal1.cross(normal2);
+		direction.normalize();
+		ASSERT(TrianglePlaneInterval(tri1[i],normal2,tri2[i].mPoint[0],direction,min1,max1));
+		ASSERT(TrianglePlaneInterval(tri2[i],normal1,tri1[i].mPoint[0],direction,min2,max2));
+		ASSERT(fabs((point[1] - point[0]).magnitude() - (std::min(max1,max2) - std::max(min1,min2)))<1e-6);
+	}
+#endif
+	double seconds = clock();
+	for( i=0 ; i<numCase ; i++ )
+	{
+		Tri3DIntersectTri3D(tri1[i],tri2[i],point,numPoint);
+	}
+	seconds = (clock() - seconds)/CLOCKS_PER_SEC;
+	printf("Time:	%.6lf\n",seconds);
+}
+
+/*
+	λĳߵӳʱPointTriangleRelationΪ(0,0),(2,0),(0,2)(3,-1)ڵڶx + y = 2ӳϣ
+	d0 = -2, d1 = 0, d2 = 6ԭʵó˻d0*d1d1*d2ķжϣ˻0㱻жΪON_EDGE
+	湲ζԱص㷨ΪصζԱERIT㷨Ϊص
+	ֻҪͬʱиOUTSIDEе㷨жΪصTri3DIntersectTri3DڹʱòüӰ졣
+*/
+void testTriangle3dIntersectTriangle3d_EdgeExtension()
+{
+#ifdef _DEBUG
+	SrTriangle3D tri1(SrPoint3D(0,0,0),SrPoint3D(2,0,0),SrPoint3D(0,2,0));
+	SrPoint3D point[SR_TRI3D_MAX_INTERSECTION];
+	int numPoint;
+	//棺tri2ĵһӳϣάصPointTriangleRelation(tri1,tri2[0])ԭON_EDGE
+	SrTriangle3D coplanar(SrPoint3D(3,-1,0),SrPoint3D(4,-1,0),SrPoint3D(4,-2,0));
+	//棺tri2tri1ƽĽ߶(3,-1,0)-(4.5,-2.5,0)ӳϣERIT㷨PointTriangleRelationԭON_EDGE
+	SrTriangle3D crossing(SrPoint3D(3,-1,-1),SrPoint3D(3,-1,1),SrPoint3D(6,-4,1));
+	SrTriangle3D* tri2[2] = { &coplanar , &crossing };
+	int i;
+	for( i=0 ; i<2 ; i++ )
+	{
+		ASSERT(!Tri3DOverlapTestTri3D_Naive(tri1,*tri2[i]));
+		ASSERT(!Tri3DOverlapTestTri3D_Moller(tri1,*tri2[i]));
+		ASSERT(!Tri3DOverlapTestTri3D_Guigue(tri1,*tri2[i]));
+		ASSERT(!Tri3DOverlapTestTri3D_ERIT(tri1,*tri2[i]));
+		ASSERT(Tri3DIntersectTri3D(tri1,*tri2[i],point,numPoint)==SR_DISJOINT && numPoint==0);
+	}
+	//ڱڲжϲ䣺tri2ƽƵϻڲȻص
+	SrTriangle3D touching(SrPoint3D(1,1,0),SrPoint3D(4,-1,0),SrPoint3D(4,-2,0));
+	SrTriangle3D inside(SrPoint3D(0.5,0.5,0),SrPoint3D(4,-1,0),SrPoint3D(4,-2,0));
+	ASSERT(Tri3DOverlapTestTri3D_Moller(tri1,touching) && Tri3DOverlapTestTri3D_ERIT(tri1,touching));
+	ASSERT(Tri3DOverlapTestTri3D_Moller(tri1,inside) && Tri3DOverlapTestTri3D_ERIT(tri1,inside));
+	ASSERT(Tri3DIntersectTri3D(tri1,inside,point,numPoint)==SR_OVERLAPPING && numPoint>=3);
+#endif
+}
+
+void testTriangle3dIntersectTriangle3d_Packet(SrTriangle3D* tri1,SrTriangle3D* tri2,int numCase)
+{
+	SrTriangle3DSoA soa1(numCase) , soa2(numCase);
+	int* overlapIndex = new int[numCase];
+	int i , k , count;
+	for( i=0 ; i<numCase ; i++ )
+	{
+		soa1.setTriangle(i,tri1[i]);
+		soa2.setTriangle(i,tri2[i]);
+	}
+	//The packet versions must give exactly the same decision as the scalar ones.
+	count = Tri3DOverlapTestTri3D_GuigueBatch(soa1,soa2,overlapIndex);
+	for( i=0 , k=0 ; i<numCase ; i++ )
+	{
+		bool status = k<count && overlapIndex[k]==i;
+		if( status )
+			k ++;
+		ASSERT(status == Tri3DOverlapTestTri3D_Guigue(tri1[i],tri2[i]));
+	}
+	count = Tri3DOverlapTestTri3D_MollerBatch(soa1,soa2,overlapIndex);
+	for( i=0 , k=0 ; i<numCase ; i++ )
+	{
+		bool status = k<count && overlapIndex[k]==i;
+		if( status )
+			k ++;
+		ASSERT(status == Tri3DOverlapTestTri3D_Moller(tri1[i],tri2[i]));
+	}
+
+	double seconds = clock();
+	Tri3DOverlapTestTri3D_GuigueBatch(soa1,soa2,overlapIndex);
+	seconds = (clock() - seconds)/CLOCKS_PER_SEC;
+	printf("Guigue Packet Time:	%.6lf\n",seconds);
+
+	seconds = clock();
+	Tri3DOverlapTestTri3D_MollerBatch(soa1,soa2,overlapIndex);
+	seconds = (clock() - seconds)/CLOCKS_PER_SEC;
+	printf("Moller Packet Time:	%.6lf\n",seconds);
+
+	delete []overlapIndex;
+}
+
+
 void testTriangle3dIntersectTriangle3d()
 {
 	int numCase = 100000;
@@ -822,6 +258,7 @@ void testTriangle3dIntersectTriangle3d()
 	SrTriangle3D* tri2 = new SrTriangle3D[numCase];
 	int i , j;
 
+	testTriangle3dIntersectTriangle3d_EdgeExtension();
 	for( i=0 ; i<numCase ; i++ )
 	{
 		do 
@@ -855,14 +292,154 @@ void testTriangle3dIntersectTriangle3d()
 	testTriangle3dIntersectTriangle3d_Guigue(tri1,tri2,numCase);
 	printf("ERIT Algorithm:\n");
 	testTriangle3dIntersectTriangle3d_ERIT(tri1,tri2,numCase);
+	printf("Intersection Segment:\n");
+	testTriangle3dIntersectTriangle3d_Segment(tri1,tri2,numCase);
+	printf("Packet Algorithms:\n");
+	testTriangle3dIntersectTriangle3d_Packet(tri1,tri2,numCase);
 
 	delete []tri1;
 	delete []tri2;
 }
 
 
+/*
+	εRay3DHitTestTriangleĽ㣬tͬʱС
+*/
+int rayNearestTriangle_Naive(const SrRay3D& ray,const SrTriangle3D* tri,int numTriangle,tRayTriangleHit& hit)
+{
+	tRayTriangleHit cur;
+	int i;
+	hit.mT		  = SR_MAX_F64;
+	hit.mTriangle = -1;
+	for( i=0 ; i<numTriangle ; i++ )
+	{
+		if( Ray3DHitTestTriangle(ray,tri[i],cur) && cur.mT<hit.mT )
+		{
+			hit			  = cur;
+			hit.mTriangle = i;
+		}
+	}
+	return hit.mTriangle;
+}
+
+bool isSameHit(const tRayTriangleHit& hit1,const tRayTriangleHit& hit2)
+{
+	if( hit1.mTriangle!=hit2.mTriangle )
+		return false;
+	return hit1.mTriangle<0 || (hit1.mT==hit2.mT && hit1.mU==hit2.mU && hit1.mV==hit2.mV);
+}
+
+/*
+	Ƚַ㣬ͳʱ
+*/
+void testRayHitTriangle_Compare(const SrTriangle3D* tri,int numTriangle,const SrRay3D* ray,int numRay)
+{
+	tRayTriangleHit* hit = new tRayTriangleHit[numRay];
+	tRayTriangleHit naive , packet;
+	int i , numHit = 0;
+	SrTriangle3DSoA soa(numTriangle);
+	for( i=0 ; i<numTriangle ; i++ )
+		soa.setTriangle(i,tri[i]);
+	SrTriangleBVH bvh;
+	bvh.build(tri,numTriangle);
+	bvh.intersectBatch(ray,numRay,hit);
+	//The packet kernel and the hierarchy must give exactly the same nearest hit as the scalar test.
+	for( i=0 ; i<numRay ; i++ )
+	{
+		rayNearestTriangle_Naive(ray[i],tri,numTriangle,naive);
+		Ray3DHitTestTriangle_Closest(ray[i],soa,packet);
+		ASSERT(isSameHit(naive,packet));
+		ASSERT(isSameHit(naive,hit[i]));
+		if( naive.mTriangle>=0 )
+			numHit ++;
+	}
+	printf("Triangles: %d, Rays: %d, Hit: %d\n",numTriangle,numRay,numHit);
+
+	double seconds = clock();
+	for( i=0 ; i<numRay ; i++ )
+		rayNearestTriangle_Naive(ray[i],tri,numTriangle,naive);
+	seconds = (clock() - seconds)/CLOCKS_PER_SEC;
+	printf("Naive Time:	%.6lf\n",seconds);
+
+	seconds = clock();
+	for( i=0 ; i<numRay ; i++ )
+		Ray3DHitTestTriangle_Closest(ray[i],soa,packet);
+	seconds = (clock() - seconds)/CLOCKS_PER_SEC;
+	printf("Packet Time:	%.6lf\n",seconds);
+
+	seconds = clock();
+	bvh.intersectBatch(ray,numRay,hit);
+	seconds = (clock() - seconds)/CLOCKS_PER_SEC;
+	printf("BVH Time:	%.6lf\n",seconds);
+
+	delete []hit;
+}
+
+void testRayHitTriangle()
+{
+	//кܶ๲ıߺͶ㣬߾ͬʱж
+	int numTriangle = 5000 , numRay = 1000;
+	SrTriangle3D* tri = new SrTriangle3D[numTriangle];
+	SrRay3D* ray = new SrRay3D[numRay];
+	int i , j , x , y;
+	for( i=0 ; i<numTriangle ; i++ )
+	{
+		do 
+		{
+			for( j=0 ; j<3 ; j++ )
+			{
+				tri[i].mPoint[j].x = rand()%100;
+				tri[i].mPoint[j].y = rand()%100;
+				tri[i].mPoint[j].z = rand()%100;
+			}
+		} while (!tri[i].isValid());
+	}
+	for( i=0 ; i<numRay ; i++ )
+	{
+		SrPoint3D p1(rand()%200 - 50,rand()%200 - 50,rand()%200 - 50) , p2(rand()%100,rand()%100,rand()%100);
+		if( i%4==0 )
+			p2 = tri[rand()%numTriangle].mPoint[rand()%3];
+		if( p1==p2 )
+			p2.x += 1;
+		ray[i] = SrRay3D(p1,p2);
+	}
+	testRayHitTriangle_Compare(tri,numTriangle,ray,numRay);
+	delete []tri;
+	delete []ray;
+
+	//߶ȳߴϷʰȡͬ
+	int size = 200;
+	SrPoint3D* vertex = new SrPoint3D[(size + 1)*(size + 1)];
+	numTriangle = 2*size*size;
+	tri = new SrTriangle3D[numTriangle];
+	ray = new SrRay3D[numRay];
+	for( y=0 ; y<=size ; y++ )
+		for( x=0 ; x<=size ; x++ )
+			vertex[y*(size + 1) + x].set(x,y,rand()%8*0.25);
+	for( y=0 , i=0 ; y<size ; y++ )
+	{
+		for( x=0 ; x<size ; x++ )
+		{
+			j = y*(size + 1) + x;
+			tri[i++] = SrTriangle3D(vertex[j],vertex[j + 1],vertex[j + size + 2]);
+			tri[i++] = SrTriangle3D(vertex[j],vertex[j + size + 2],vertex[j + size + 1]);
+		}
+	}
+	for( i=0 ; i<numRay ; i++ )
+	{
+		SrPoint3D p1(rand()%(4*size) - size,rand()%(4*size) - size,50) , p2(rand()%(size*4)*0.25,rand()%(size*4)*0.25,0);
+		ray[i] = SrRay3D(p1,p2);
+	}
+	testRayHitTriangle_Compare(tri,numTriangle,ray,numRay);
+	delete []vertex;
+	delete []tri;
+	delete []ray;
+}
+
 int main( )
 {
 	testTriangle3dIntersectTriangle3d();
+	printf("Ray Hit Triangle:\n");
+	testRayHitTriangle();
 	return 0;
 }
\ No newline at end of file
@@ -0,0 +1,229 @@
+/************************************************************************
+\link	www.twinklingstar.cn
+\author Twinkling Star
+\date	2026/10/19
+****************************************************************************/
+#ifndef SR_FOUNDATION_EIGEN3_H_
+#define SR_FOUNDATION_EIGEN3_H_
+
+/** \addtogroup foundation
+  @{
+*/
+
+#include "SrDataType.h"
+#include "SrSimd.h"
+
+/*
+	JacobiɨԼǶԽԪƽھƽ͵ֵ
+*/
+#define SR_EIGEN3_MAX_SWEEP		8
+#define SR_EIGEN3_TOLERANCE		1e-30
+
+/**
+\brief Static class with allocation free eigen solvers of 3x3 symmetric matrices.
+
+Both routines run the cyclic Jacobi method, rotating the pairs (0,1), (0,2) and
+(1,2) in turn until the off diagonal entries vanish, at most SR_EIGEN3_MAX_SWEEP
+sweeps. Only the upper triangle of a matrix is read. The eigenvalues are sorted
+in descending order, and the eigenvectors are unit, perpendicular and right
+handed, so they can be used as the axes of a box directly.
+
+solveBatch() takes the matrices as a structure of arrays and solves
+SR_SIMD_WIDTH matrices per SSE2 packet with the same rotations, the last odd
+matrix is solved by solve(). It runs on the calling thread.
+*/
+class SrEigen3
+	{
+	public:
+		/**
+		\brief Solves one matrix.
+		\param[in] matrix The symmetric matrix, only matrix[i][j] with i <= j are read.
+		\param[out] eigenvalue The eigenvalues, eigenvalue[0] is the largest.
+		\param[out] eigenvector The unit eigenvector of eigenvalue[i] is eigenvector[i].
+		*/
+		SR_INLINE static void solve(const SrReal matrix[3][3],SrReal eigenvalue[3],SrVector3D eigenvector[3]);
+		/**
+		\brief Solves numMatrix matrices.
+		\param[in] matrix The entries 00, 01, 02, 11, 12 and 22 of matrix i are matrix[0][i], ..., matrix[5][i].
+		\param[out] eigenvalue The eigenvalue k of matrix i is eigenvalue[k][i].
+		\param[out] eigenvector The component r of the eigenvector k of matrix i is eigenvector[3*k + r][i].
+		*/
+		SR_INLINE static void solveBatch(const SrReal* const matrix[6],int numMatrix,SrReal* const eigenvalue[3],SrReal* const eigenvector[9]);
+
+	private:
+		SR_INLINE static void rotate(SrReal* diagonal,SrReal* offDiagonal,SrReal vector[3][3],int p,int q);
+		SR_INLINE static void rotate(SrSimdReal* diagonal,SrSimdReal* offDiagonal,SrSimdReal vector[3][3],int p,int q);
+		SR_INLINE static void swap(SrSimdReal* diagonal,SrSimdReal vector[3][3],int p,int q);
+	};
+
+/*
+	ԽԪdiagonal[i]a(i,i)ǶԽԪoffDiagonal[r]r±Ԫa(p,q)
+	offDiagonal = (a12,a02,a01)vector[k][i]ǵiĵk
+	תa(p,q)Ϊ0ʱa(r,p)a(r,q)offDiagonal[q]offDiagonal[p]
+*/
+SR_INLINE void SrEigen3::rotate(SrReal* diagonal,SrReal* offDiagonal,SrReal vector[3][3],int p,int q)
+	{
+	int r = 3 - p - q , k;
+	SrReal apq = offDiagonal[r];
+	if( apq==0 )
+		return;
+	//t = sign(theta)/(|theta| + sqrt(theta^2 + 1))theta = h/gӷĸͬ|g|ʡȥһγ
+	SrReal h = diagonal[q] - diagonal[p] , g = 2*apq;
+	SrReal t = g / (fabs(h) + sqrt(h*h + g*g));
+	if( h<0 )
+		t = -t;
+	SrReal c = 1 / sqrt(t*t + 1) , s = t*c;
+	SrReal arp = offDiagonal[q] , arq = offDiagonal[p] , vp;
+	diagonal[p] -= t*apq;
+	diagonal[q] += t*apq;
+	offDiagonal[r] = 0;
+	offDiagonal[q] = c*arp - s*arq;
+	offDiagonal[p] = s*arp + c*arq;
+	for( k=0 ; k<3 ; k++ )
+		{
+		vp = vector[k][p];
+		vector[k][p] = c*vp - s*vector[k][q];
+		vector[k][q] = s*vp + c*vector[k][q];
+		}
+	}
+
+SR_INLINE void SrEigen3::solve(const SrReal matrix[3][3],SrReal eigenvalue[3],SrVector3D eigenvector[3])
+	{
+	SrReal diagonal[3] = {matrix[0][0],matrix[1][1],matrix[2][2]};
+	SrReal offDiagonal[3] = {matrix[1][2],matrix[0][2],matrix[0][1]};
+	SrReal vector[3][3] = {{1,0,0},{0,1,0},{0,0,1}};
+	SrReal off , norm;
+	int sweep , i , j , k , order[3] = {0,1,2};
+	for( sweep=0 ; sweep<SR_EIGEN3_MAX_SWEEP ; sweep++ )
+		{
+		off = offDiagonal[0]*offDiagonal[0] + offDiagonal[1]*offDiagonal[1] + offDiagonal[2]*offDiagonal[2];
+		norm = diagonal[0]*diagonal[0] + diagonal[1]*diagonal[1] + diagonal[2]*diagonal[2] + 2*off;
+		if( off<=SR_EIGEN3_TOLERANCE*norm )
+			break;
+		rotate(diagonal,offDiagonal,vector,0,1);
+		rotate(diagonal,offDiagonal,vector,0,2);
+		rotate(diagonal,offDiagonal,vector,1,2);
+		}
+	//ֵӴС򣬵ȡǰĲʹϵϵ
+	for( i=0 ; i<2 ; i++ )
+		for( j=2 ; j>i ; j-- )
+			if( diagonal[order[j]]>diagonal[order[j - 1]] )
+				{
+				k = order[j];
+				order[j] = order[j - 1];
+				order[j - 1] = k;
+				}
+	for( i=0 ; i<3 ; i++ )
+		{
+		eigenvalue[i] = diagonal[order[i]];
+		eigenvector[i].set(vector[0][order[i]],vector[1][order[i]],vector[2][order[i]]);
+		}
+	eigenvector[2] = eigenvector[0].cross(eigenvector[1]);
+	}
+
+/*
+	rotate()ͬa(p,q)Ϊ0ͨtΪ0ת
+*/
+SR_INLINE void SrEigen3::rotate(SrSimdReal* diagonal,SrSimdReal* offDiagonal,SrSimdReal vector[3][3],int p,int q)
+	{
+	int r = 3 - p - q , k;
+	const SrSimdReal zero = SrSimd::splat(0) , one = SrSimd::splat(1);
+	SrSimdReal apq = offDiagonal[r];
+	SrSimdReal h = SrSimd::sub(diagonal[q],diagonal[p]) , g = SrSimd::add(apq,apq);
+	SrSimdReal denominator = SrSimd::add(SrSimd::abs(h),SrSimd::sqrt(SrSimd::add(SrSimd::mul(h,h),SrSimd::mul(g,g))));
+	//hgΪ0ʱdenominatorΪ0ʱgҲΪ0tȡ0
+	SrSimdReal t = SrSimd::div(g,SrSimd::select(SrSimd::cmpEqual(denominator,zero),one,denominator));
+	t = SrSimd::select(SrSimd::cmpLess(h,zero),SrSimd::neg(t),t);
+	SrSimdReal c = SrSimd::div(one,SrSimd::sqrt(SrSimd::add(SrSimd::mul(t,t),one))) , s = SrSimd::mul(t,c);
+	SrSimdReal arp = offDiagonal[q] , arq = offDiagonal[p] , vp;
+	diagonal[p] = SrSimd::sub(diagonal[p],SrSimd::mul(t,apq));
+	diagonal[q] = SrSimd::add(diagonal[q],SrSimd::mul(t,apq));
+	offDiagonal[r] = zero;
+	offDiagonal[q] = SrSimd::sub(SrSimd::mul(c,arp),SrSimd::mul(s,arq));
+	offDiagonal[p] = SrSimd::add(SrSimd::mul(s,arp),SrSimd::mul(c,arq));
+	for( k=0 ; k<3 ; k++ )
+		{
+		vp = vector[k][p];
+		vector[k][p] = SrSimd::sub(SrSimd::mul(c,vp),SrSimd::mul(s,vector[k][q]));
+		vector[k][q] = SrSimd::add(SrSimd::mul(s,vp),SrSimd::mul(c,vector[k][q]));
+		}
+	}
+
+/*
+	ֵpСֵqֵͨ
+*/
+SR_INLINE void SrEigen3::swap(SrSimdReal* diagonal,SrSimdReal vector[3][3],int p,int q)
+	{
+	SrSimdReal mask = SrSimd::cmpLess(diagonal[p],diagonal[q]) , temp;
+	int k;
+	temp = diagonal[p];
+	diagonal[p] = SrSimd::select(mask,diagonal[q],temp);
+	diagonal[q] = SrSimd::select(mask,temp,diagonal[q]);
+	for( k=0 ; k<3 ; k++ )
+		{
+		temp = vector[k][p];
+		vector[k][p] = SrSimd::select(mask,vector[k][q],temp);
+		vector[k][q] = SrSimd::select(mask,temp,vector[k][q]);
+		}
+	}
+
+SR_INLINE void SrEigen3::solveBatch(const SrReal* const matrix[6],int numMatrix,SrReal* const eigenvalue[3],SrReal* const eigenvector[9])
+	{
+	const SrSimdReal zero = SrSimd::splat(0) , one = SrSimd::splat(1) , tolerance = SrSimd::splat(SR_EIGEN3_TOLERANCE);
+	SrSimdReal diagonal[3] , offDiagonal[3] , vector[3][3] , off , norm;
+	int i , j , k , sweep;
+	for( i=0 ; i + SR_SIMD_WIDTH<=numMatrix ; i+=SR_SIMD_WIDTH )
+		{
+		diagonal[0] = SrSimd::load(matrix[0] + i);
+		diagonal[1] = SrSimd::load(matrix[3] + i);
+		diagonal[2] = SrSimd::load(matrix[5] + i);
+		offDiagonal[0] = SrSimd::load(matrix[4] + i);
+		offDiagonal[1] = SrSimd::load(matrix[2] + i);
+		offDiagonal[2] = SrSimd::load(matrix[1] + i);
+		for( j=0 ; j<3 ; j++ )
+			for( k=0 ; k<3 ; k++ )
+				vector[j][k] = j==k ? one : zero;
+		//ֹͨͣ
+		for( sweep=0 ; sweep<SR_EIGEN3_MAX_SWEEP ; sweep++ )
+			{
+			off = SrSimd::add(SrSimd::add(SrSimd::mul(offDiagonal[0],offDiagonal[0]),SrSimd::mul(offDiagonal[1],offDiagonal[1])),SrSimd::mul(offDiagonal[2],offDiagonal[2]));
+			norm = SrSimd::add(SrSimd::add(SrSimd::mul(diagonal[0],diagonal[0]),SrSimd::mul(diagonal[1],diagonal[1])),SrSimd::mul(diagonal[2],diagonal[2]));
+			norm = SrSimd::add(norm,SrSimd::add(off,off));
+			if( SrSimd::moveMask(SrSimd::cmpLEqual(off,SrSimd::mul(tolerance,norm)))==SR_SIMD_FULL_MASK )
+				break;
+			rotate(diagonal,offDiagonal,vector,0,1);
+			rotate(diagonal,offDiagonal,vector,0,2);
+			rotate(diagonal,offDiagonal,vector,1,2);
+			}
+		swap(diagonal,vector,1,2);
+		swap(diagonal,vector,0,1);
+		swap(diagonal,vector,1,2);
+		//ȡǰĲ
+		vector[0][2] = SrSimd::sub(SrSimd::mul(vector[1][0],vector[2][1]),SrSimd::mul(vector[2][0],vector[1][1]));
+		vector[1][2] = SrSimd::sub(SrSimd::mul(vector[2][0],vector[0][1]),SrSimd::mul(vector[0][0],vector[2][1]));
+		vector[2][2] = SrSimd::sub(SrSimd::mul(vector[0][0],vector[1][1]),SrSimd::mul(vector[1][0],vector[0][1]));
+		for( k=0 ; k<3 ; k++ )
+			{
+			SrSimd::store(eigenvalue[k] + i,diagonal[k]);
+			for( j=0 ; j<3 ; j++ )
+				SrSimd::store(eigenvector[3*k + j] + i,vector[j][k]);
+			}
+		}
+	for( ; i<numMatrix ; i++ )
+		{
+		SrReal a[3][3] , value[3];
+		SrVector3D axis[3];
+		a[0][0] = matrix[0][i]; a[0][1] = matrix[1][i]; a[0][2] = matrix[2][i];
+		a[1][1] = matrix[3][i]; a[1][2] = matrix[4][i]; a[2][2] = matrix[5][i];
+		solve(a,value,axis);
+		for( k=0 ; k<3 ; k++ )
+			{
+			eigenvalue[k][i] = value[k];
+			for( j=0 ; j<3 ; j++ )
+				eigenvector[3*k + j][i] = axis[k][j];
+			}
+		}
+	}
+
+/** @} */
+#endif
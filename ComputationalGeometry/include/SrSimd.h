@@ -0,0 +1,228 @@
+/************************************************************************
+\link	www.twinklingstar.cn
+\author Twinkling Star
+\date	2026/10/19
+****************************************************************************/
+#ifndef SR_FOUNDATION_SIMD_H_
+#define SR_FOUNDATION_SIMD_H_
+
+/** \addtogroup foundation
+  @{
+*/
+
+#include <emmintrin.h>
+#include "SrSimpleTypes.h"
+#include "SrGeometricTools.h"
+
+/**
+\brief A packet of SR_SIMD_WIDTH SrReal values, also used as a lane mask.
+*/
+typedef __m128d				SrSimdReal;
+
+#define SR_SIMD_WIDTH		2
+#define SR_SIMD_FULL_MASK	0x03
+
+/**
+\brief Static class with stateless SSE2 routines on packets of SrReal.
+
+The comparison routines greater(), less(), equal()... evaluate exactly the
+same expressions as the GREATER, LESS, EQUAL... macros in SrGeometricTools.h,
+so a packet kernel built on them returns the same decisions as its scalar
+counterpart.
+*/
+class SrSimd
+	{
+	public:
+		/**
+		\brief Returns a packet with every lane set to a.
+		*/
+		SR_INLINE static SrSimdReal splat(SrReal a);
+		/**
+		\brief Loads SR_SIMD_WIDTH values from an arbitrarily aligned address.
+		*/
+		SR_INLINE static SrSimdReal load(const SrReal* p);
+		/**
+		\brief Stores SR_SIMD_WIDTH values to an arbitrarily aligned address.
+		*/
+		SR_INLINE static void store(SrReal* p,SrSimdReal a);
+		/**
+		\brief Lane-wise arithmetic.
+		*/
+		SR_INLINE static SrSimdReal add(SrSimdReal a,SrSimdReal b);
+		SR_INLINE static SrSimdReal sub(SrSimdReal a,SrSimdReal b);
+		SR_INLINE static SrSimdReal mul(SrSimdReal a,SrSimdReal b);
+		SR_INLINE static SrSimdReal div(SrSimdReal a,SrSimdReal b);
+		SR_INLINE static SrSimdReal min(SrSimdReal a,SrSimdReal b);
+		SR_INLINE static SrSimdReal max(SrSimdReal a,SrSimdReal b);
+		SR_INLINE static SrSimdReal neg(SrSimdReal a);
+		SR_INLINE static SrSimdReal abs(SrSimdReal a);
+		SR_INLINE static SrSimdReal sqrt(SrSimdReal a);
+		/**
+		\brief Lane-wise raw comparisons, each lane is all ones if true.
+		*/
+		SR_INLINE static SrSimdReal cmpGreater(SrSimdReal a,SrSimdReal b);
+		SR_INLINE static SrSimdReal cmpGEqual(SrSimdReal a,SrSimdReal b);
+		SR_INLINE static SrSimdReal cmpLess(SrSimdReal a,SrSimdReal b);
+		SR_INLINE static SrSimdReal cmpLEqual(SrSimdReal a,SrSimdReal b);
+		SR_INLINE static SrSimdReal cmpEqual(SrSimdReal a,SrSimdReal b);
+		/**
+		\brief Lane-wise GREATER, LESS, EQUAL, LEQUAL and GEQUAL with the tolerance SR_EPS.
+		*/
+		SR_INLINE static SrSimdReal greater(SrSimdReal a,SrSimdReal b);
+		SR_INLINE static SrSimdReal less(SrSimdReal a,SrSimdReal b);
+		SR_INLINE static SrSimdReal equal(SrSimdReal a,SrSimdReal b);
+		SR_INLINE static SrSimdReal lequal(SrSimdReal a,SrSimdReal b);
+		SR_INLINE static SrSimdReal gequal(SrSimdReal a,SrSimdReal b);
+		/**
+		\brief Lane-wise mask operations. andNot() returns (~a)&b.
+		*/
+		SR_INLINE static SrSimdReal andMask(SrSimdReal a,SrSimdReal b);
+		SR_INLINE static SrSimdReal orMask(SrSimdReal a,SrSimdReal b);
+		SR_INLINE static SrSimdReal andNot(SrSimdReal a,SrSimdReal b);
+		/**
+		\brief Returns a in the lanes where mask is set, b in the others.
+		*/
+		SR_INLINE static SrSimdReal select(SrSimdReal mask,SrSimdReal a,SrSimdReal b);
+		/**
+		\brief Packs the sign bits of the lanes into an integer, bit i for lane i.
+		*/
+		SR_INLINE static int moveMask(SrSimdReal mask);
+	};
+
+SR_INLINE SrSimdReal SrSimd::splat(SrReal a)
+	{
+	return _mm_set1_pd(a);
+	}
+
+SR_INLINE SrSimdReal SrSimd::load(const SrReal* p)
+	{
+	return _mm_loadu_pd(p);
+	}
+
+SR_INLINE void SrSimd::store(SrReal* p,SrSimdReal a)
+	{
+	_mm_storeu_pd(p,a);
+	}
+
+SR_INLINE SrSimdReal SrSimd::add(SrSimdReal a,SrSimdReal b)
+	{
+	return _mm_add_pd(a,b);
+	}
+
+SR_INLINE SrSimdReal SrSimd::sub(SrSimdReal a,SrSimdReal b)
+	{
+	return _mm_sub_pd(a,b);
+	}
+
+SR_INLINE SrSimdReal SrSimd::mul(SrSimdReal a,SrSimdReal b)
+	{
+	return _mm_mul_pd(a,b);
+	}
+
+SR_INLINE SrSimdReal SrSimd::div(SrSimdReal a,SrSimdReal b)
+	{
+	return _mm_div_pd(a,b);
+	}
+
+SR_INLINE SrSimdReal SrSimd::min(SrSimdReal a,SrSimdReal b)
+	{
+	return _mm_min_pd(a,b);
+	}
+
+SR_INLINE SrSimdReal SrSimd::max(SrSimdReal a,SrSimdReal b)
+	{
+	return _mm_max_pd(a,b);
+	}
+
+SR_INLINE SrSimdReal SrSimd::neg(SrSimdReal a)
+	{
+	return _mm_xor_pd(_mm_set1_pd(-0.0),a);
+	}
+
+SR_INLINE SrSimdReal SrSimd::abs(SrSimdReal a)
+	{
+	return _mm_andnot_pd(_mm_set1_pd(-0.0),a);
+	}
+
+SR_INLINE SrSimdReal SrSimd::sqrt(SrSimdReal a)
+	{
+	return _mm_sqrt_pd(a);
+	}
+
+SR_INLINE SrSimdReal SrSimd::cmpGreater(SrSimdReal a,SrSimdReal b)
+	{
+	return _mm_cmpgt_pd(a,b);
+	}
+
+SR_INLINE SrSimdReal SrSimd::cmpGEqual(SrSimdReal a,SrSimdReal b)
+	{
+	return _mm_cmpge_pd(a,b);
+	}
+
+SR_INLINE SrSimdReal SrSimd::cmpLess(SrSimdReal a,SrSimdReal b)
+	{
+	return _mm_cmplt_pd(a,b);
+	}
+
+SR_INLINE SrSimdReal SrSimd::cmpLEqual(SrSimdReal a,SrSimdReal b)
+	{
+	return _mm_cmple_pd(a,b);
+	}
+
+SR_INLINE SrSimdReal SrSimd::cmpEqual(SrSimdReal a,SrSimdReal b)
+	{
+	return _mm_cmpeq_pd(a,b);
+	}
+
+SR_INLINE SrSimdReal SrSimd::greater(SrSimdReal a,SrSimdReal b)
+	{
+	return _mm_cmpge_pd(_mm_sub_pd(a,b),_mm_set1_pd(SR_EPS));
+	}
+
+SR_INLINE SrSimdReal SrSimd::less(SrSimdReal a,SrSimdReal b)
+	{
+	return _mm_cmple_pd(_mm_sub_pd(a,b),_mm_set1_pd(-SR_EPS));
+	}
+
+SR_INLINE SrSimdReal SrSimd::equal(SrSimdReal a,SrSimdReal b)
+	{
+	return _mm_cmplt_pd(abs(_mm_sub_pd(a,b)),_mm_set1_pd(SR_EPS));
+	}
+
+SR_INLINE SrSimdReal SrSimd::lequal(SrSimdReal a,SrSimdReal b)
+	{
+	return _mm_cmplt_pd(_mm_sub_pd(a,b),_mm_set1_pd(SR_EPS));
+	}
+
+SR_INLINE SrSimdReal SrSimd::gequal(SrSimdReal a,SrSimdReal b)
+	{
+	return _mm_cmpgt_pd(_mm_sub_pd(a,b),_mm_set1_pd(-SR_EPS));
+	}
+
+SR_INLINE SrSimdReal SrSimd::andMask(SrSimdReal a,SrSimdReal b)
+	{
+	return _mm_and_pd(a,b);
+	}
+
+SR_INLINE SrSimdReal SrSimd::orMask(SrSimdReal a,SrSimdReal b)
+	{
+	return _mm_or_pd(a,b);
+	}
+
+SR_INLINE SrSimdReal SrSimd::andNot(SrSimdReal a,SrSimdReal b)
+	{
+	return _mm_andnot_pd(a,b);
+	}
+
+SR_INLINE SrSimdReal SrSimd::select(SrSimdReal mask,SrSimdReal a,SrSimdReal b)
+	{
+	return _mm_or_pd(_mm_and_pd(mask,a),_mm_andnot_pd(mask,b));
+	}
+
+SR_INLINE int SrSimd::moveMask(SrSimdReal mask)
+	{
+	return _mm_movemask_pd(mask);
+	}
+
+/** @} */
+#endif
@@ -502,7 +502,7 @@ SR_INLINE void  SrVector2::setMinusInfinity()
 SR_INLINE void SrVector2::max(const SrVector2 & v)
 	{
 		x = x > v.x?x:v.x;
-		y = y > v.y?y:y;
+		y = y > v.y?y:v.y;
 	}
 
  